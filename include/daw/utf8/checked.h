@@ -159,10 +159,14 @@ namespace daw::utf8 {
 		return utf8::replace_invalid( start, end, out, replacement_marker );
 	}
 
-	template<typename octet_iterator>
+	/// Decode the code point at it with the decoder Engine, e.g.
+	/// next<engine::dfa>( it, end )
+	template<typename Engine, typename octet_iterator,
+	         std::enable_if_t<engine::is_engine_v<Engine>, std::nullptr_t> =
+	           nullptr>
 	constexpr uint32_t next( octet_iterator &it, octet_iterator end ) {
 		uint32_t cp = 0;
-		auto const err_code = utf8::internal::validate_next( it, end, cp );
+		auto const err_code = Engine::validate_next( it, end, cp );
 
 		switch( err_code ) {
 		case internal::utf_error::UTF8_OK:
@@ -180,11 +184,25 @@ namespace daw::utf8 {
 	}
 
 	template<typename octet_iterator>
+	constexpr uint32_t next( octet_iterator &it, octet_iterator end ) {
+		return utf8::next<engine::classic>( it, end );
+	}
+
+	template<typename Engine, typename octet_iterator,
+	         std::enable_if_t<engine::is_engine_v<Engine>, std::nullptr_t> =
+	           nullptr>
 	constexpr uint32_t peek_next( octet_iterator it, octet_iterator end ) {
-		return utf8::next( it, end );
+		return utf8::next<Engine>( it, end );
 	}
 
 	template<typename octet_iterator>
+	constexpr uint32_t peek_next( octet_iterator it, octet_iterator end ) {
+		return utf8::next<engine::classic>( it, end );
+	}
+
+	template<typename Engine, typename octet_iterator,
+	         std::enable_if_t<engine::is_engine_v<Engine>, std::nullptr_t> =
+	           nullptr>
 	constexpr uint32_t prior( octet_iterator &it, octet_iterator start ) {
 		// can't do much if it == start
 		daw::exception::precondition_check<not_enough_room>( it != start );
@@ -195,7 +213,12 @@ namespace daw::utf8 {
 			// error - no lead byte in the sequence
 			daw::exception::precondition_check<invalid_utf8>( it != start, *it );
 		}
-		return utf8::peek_next( it, end );
+		return utf8::peek_next<Engine>( it, end );
+	}
+
+	template<typename octet_iterator>
+	constexpr uint32_t prior( octet_iterator &it, octet_iterator start ) {
+		return utf8::prior<engine::classic>( it, start );
 	}
 
 	/// Deprecated in versions that include "prior"
@@ -295,9 +318,11 @@ namespace daw::utf8 {
 		return result;
 	}
 
-	// The iterator class
-	template<typename octet_iterator>
+	// The iterator class, Engine is the decoder used to validate each step
+	template<typename octet_iterator, typename Engine = engine::classic>
 	class iterator {
+		static_assert( engine::is_engine_v<Engine> );
+
 		octet_iterator it;
 		octet_iterator range_start;
 		octet_iterator range_end;
@@ -341,7 +366,7 @@ namespace daw::utf8 {
 
 		constexpr value_type operator*( ) const {
 			octet_iterator temp = it;
-			return utf8::next( temp, range_end );
+			return utf8::next<Engine>( temp, range_end );
 		}
 
 		constexpr bool operator==( const iterator &rhs ) const {
@@ -356,24 +381,24 @@ namespace daw::utf8 {
 		}
 
 		constexpr iterator &operator++( ) {
-			utf8::next( it, range_end );
+			utf8::next<Engine>( it, range_end );
 			return *this;
 		}
 
 		constexpr iterator operator++( int ) {
 			iterator temp = *this;
-			utf8::next( it, range_end );
+			utf8::next<Engine>( it, range_end );
 			return temp;
 		}
 
 		constexpr iterator &operator--( ) {
-			utf8::prior( it, range_start );
+			utf8::prior<Engine>( it, range_start );
 			return *this;
 		}
 
 		constexpr iterator operator--( int ) {
 			iterator temp = *this;
-			utf8::prior( it, range_start );
+			utf8::prior<Engine>( it, range_start );
 			return temp;
 		}
 	}; // class iterator
@@ -27,7 +27,9 @@ DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include <cinttypes>
+#include <cstddef>
 #include <iterator>
+#include <type_traits>
 
 namespace daw::utf8 {
 	// The typedefs for 8-bit, 16-bit and 32-bit unsigned integers
@@ -57,7 +59,12 @@ namespace daw::utf8 {
 
 		template<typename octet_type>
 		constexpr uint8_t mask8( octet_type oc ) noexcept {
-			return static_cast<uint8_t>( 0xff & oc );
+			if constexpr( std::is_enum_v<octet_type> ) {
+				// std::byte
+				return static_cast<uint8_t>( oc );
+			} else {
+				return static_cast<uint8_t>( 0xff & oc );
+			}
 		}
 
 		template<typename u16_type>
@@ -292,24 +299,210 @@ namespace daw::utf8 {
 			return utf8::internal::validate_next( it, end, ignored );
 		}
 
+		/// Byte classes and state transitions of the UTF-8 DFA from Bjoern
+		/// Hoehrmann's "Flexible and Economical UTF-8 Decoder".  States are
+		/// pre-multiplied by the number of classes so the next state is one
+		/// lookup
+		namespace dfa {
+			constexpr uint8_t accept = 0;
+			constexpr uint8_t reject = 12;
+
+			constexpr uint8_t classes[256] = {
+			  // 00..7F
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, //
+			  // 80..BF continuations, split where E0, ED, F0 and F4 differ
+			  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, //
+			  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, //
+			  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, //
+			  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, //
+			  // C0..DF, C0 and C1 are always overlong
+			  8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, //
+			  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, //
+			  // E0..EF
+			  10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, //
+			  // F0..FF, F5 and up are beyond U+10FFFF
+			  11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8 };
+
+			constexpr uint8_t transitions[108] = {
+			  0,  12, 24, 36, 60, 96, 84, 12, 12, 12, 48, 72, // accept
+			  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, // reject
+			  12, 0,  12, 12, 12, 12, 12, 0,  12, 0,  12, 12, // 1 trail left
+			  12, 24, 12, 12, 12, 12, 12, 24, 12, 24, 12, 12, // 2 trails left
+			  12, 12, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12, // after E0
+			  12, 24, 12, 12, 12, 12, 12, 12, 12, 24, 12, 12, // after ED
+			  12, 12, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12, // after F0
+			  12, 36, 12, 12, 12, 12, 12, 36, 12, 36, 12, 12, // 3 trails left
+			  12, 36, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12  // after F4
+			};
+
+			/// The sequence length of a class as a lead octet, 0 when it cannot
+			/// start one
+			constexpr uint8_t lengths[12] = { 1, 0, 2, 3, 3, 4, 4, 0, 0, 0, 3, 4 };
+
+			/// Feed one octet, cp accumulates the code point
+			constexpr uint32_t step( uint32_t state, uint32_t &cp,
+			                         uint8_t octet ) noexcept {
+				auto const type = classes[octet];
+				cp = state != accept ? ( octet & 0x3FU ) | ( cp << 6U )
+				                     : ( 0xFFU >> type ) & octet;
+				return transitions[state + type];
+			}
+		} // namespace dfa
+
+		/// validate_next using the DFA.  The lead octet's class gives the
+		/// number of trail octets, they are fed without looking at the state
+		/// as reject absorbs every later octet.  Errors are rare, so the failing
+		/// sequence is decoded again with validate_next to classify it
+		template<typename octet_iterator>
+		constexpr utf_error dfa_validate_next( octet_iterator &it,
+		                                       octet_iterator end,
+		                                       uint32_t &code_point ) noexcept {
+			if( it == end ) {
+				return utf8::internal::validate_next( it, end, code_point );
+			}
+			auto pos = it;
+			auto const lead = utf8::internal::mask8( *pos );
+			if( lead < 0x80U ) {
+				code_point = lead;
+				it = ++pos;
+				return utf_error::UTF8_OK;
+			}
+			auto const type = dfa::classes[lead];
+			uint32_t state = dfa::transitions[type];
+			uint32_t cp = ( 0xFFU >> type ) & lead;
+			++pos;
+			for( auto n = dfa::lengths[type]; n > 1 and pos != end; --n, ++pos ) {
+				auto const octet = utf8::internal::mask8( *pos );
+				cp = ( octet & 0x3FU ) | ( cp << 6U );
+				state = dfa::transitions[state + dfa::classes[octet]];
+			}
+			if( state == dfa::accept ) {
+				code_point = cp;
+				it = pos;
+				return utf_error::UTF8_OK;
+			}
+			return utf8::internal::validate_next( it, end, code_point );
+		}
+
+		/// Scan with the DFA, one table lookup per octet and no branches on the
+		/// shape of the text
+		template<typename octet_iterator>
+		constexpr octet_iterator dfa_find_invalid( octet_iterator start,
+		                                           octet_iterator end ) noexcept {
+			uint32_t state = dfa::accept;
+			auto sequence_start = start;
+			for( ; start != end; ++start ) {
+				if( state == dfa::accept ) {
+					sequence_start = start;
+				}
+				auto const type = dfa::classes[utf8::internal::mask8( *start )];
+				state = dfa::transitions[state + type];
+				if( state == dfa::reject ) {
+					return sequence_start;
+				}
+			}
+			return state == dfa::accept ? end : sequence_start;
+		}
+
 	} // namespace internal
 
+	/// Decoder engines for the validating functions.  find_invalid, next and
+	/// iterator take one as a template parameter
+	namespace engine {
+		/// Decodes by sequence length then checks the result, the default
+		struct classic {
+			template<typename octet_iterator>
+			static constexpr internal::utf_error
+			validate_next( octet_iterator &it, octet_iterator end,
+			               uint32_t &code_point ) noexcept {
+				return utf8::internal::validate_next( it, end, code_point );
+			}
+
+			template<typename octet_iterator>
+			static constexpr octet_iterator
+			find_invalid( octet_iterator start, octet_iterator end ) noexcept {
+				auto result = start;
+				while( result != end ) {
+					auto err_code = utf8::internal::validate_next( result, end );
+					if( err_code != internal::utf_error::UTF8_OK ) {
+						return result;
+					}
+				}
+				return result;
+			}
+		};
+
+		/// Table driven DFA, validates and decodes in one pass.  Faster on text
+		/// that mixes sequence lengths
+		struct dfa {
+			template<typename octet_iterator>
+			static constexpr internal::utf_error
+			validate_next( octet_iterator &it, octet_iterator end,
+			               uint32_t &code_point ) noexcept {
+				return utf8::internal::dfa_validate_next( it, end, code_point );
+			}
+
+			template<typename octet_iterator>
+			static constexpr octet_iterator
+			find_invalid( octet_iterator start, octet_iterator end ) noexcept {
+				return utf8::internal::dfa_find_invalid( start, end );
+			}
+		};
+
+		template<typename T>
+		inline constexpr bool is_engine_v =
+		  std::is_same_v<T, classic> or std::is_same_v<T, dfa>;
+	} // namespace engine
+
 	/// The library API - functions intended to be called by the users
 
 	// Byte order mark
 	constexpr uint8_t const bom[3] = { 0xEF, 0xBB, 0xBF };
 
+	/// The number of utf8 octets needed to encode cp
+	constexpr size_t encoded_length( uint32_t cp ) noexcept {
+		if( cp < 0x80 ) {
+			return 1;
+		} else if( cp < 0x800 ) {
+			return 2;
+		} else if( cp < 0x10000 ) {
+			return 3;
+		}
+		return 4;
+	}
+
+	/// The number of utf8 octets needed to encode the code points in
+	/// [start, end)
+	template<typename u32bit_iterator>
+	constexpr size_t encoded_length( u32bit_iterator start,
+	                                 u32bit_iterator end ) noexcept {
+		size_t result = 0;
+		while( start != end ) {
+			result += utf8::encoded_length( static_cast<uint32_t>( *start++ ) );
+		}
+		return result;
+	}
+
 	template<typename octet_iterator>
 	constexpr octet_iterator find_invalid( octet_iterator start,
 	                                       octet_iterator end ) noexcept {
-		auto result = start;
-		while( result != end ) {
-			auto err_code = utf8::internal::validate_next( result, end );
-			if( err_code != internal::utf_error::UTF8_OK ) {
-				return result;
-			}
-		}
-		return result;
+		return engine::classic::find_invalid( start, end );
+	}
+
+	/// find_invalid using the decoder Engine, e.g. find_invalid<engine::dfa>
+	template<typename Engine, typename octet_iterator,
+	         std::enable_if_t<engine::is_engine_v<Engine>, std::nullptr_t> =
+	           nullptr>
+	constexpr octet_iterator find_invalid( octet_iterator start,
+	                                       octet_iterator end ) noexcept {
+		return Engine::find_invalid( start, end );
 	}
 
 	template<typename octet_iterator>
@@ -0,0 +1,605 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "impl/kernels_avx2.h"
+#include "impl/kernels_avx512.h"
+#include "impl/kernels_scalar.h"
+#include "impl/kernels_sse42.h"
+#include "simd.h"
+#include "stats.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+/// Runtime selection of the validation, counting and transcoding kernels.  The
+/// best tier the CPU supports is chosen on first use and cached.  Set the
+/// environment variable DAW_UTF8_ISA to one of scalar, sse42, avx2 or avx512
+/// to force a lower tier, or call set_isa
+namespace daw::utf8::dispatch {
+	enum class isa { scalar, sse42, avx2, avx512 };
+
+	constexpr char const *isa_name( isa i ) noexcept {
+		switch( i ) {
+		case isa::scalar:
+			return "scalar";
+		case isa::sse42:
+			return "sse42";
+		case isa::avx2:
+			return "avx2";
+		case isa::avx512:
+			return "avx512";
+		}
+		return "unknown";
+	}
+
+	struct kernel_table {
+		isa tier;
+		char const *( *find_invalid )( char const *, char const * ) noexcept;
+		size_t ( *count_code_points )( char const *, char const * ) noexcept;
+		char16_t *( *utf8to16 )( char const *, char const *, char16_t * ) noexcept;
+		char32_t *( *utf8to32 )( char const *, char const *, char32_t * ) noexcept;
+		char *( *utf16to8 )( char16_t const *, char16_t const *, char * ) noexcept;
+		char *( *utf32to8 )( char32_t const *, char32_t const *, char * ) noexcept;
+		char16_t const *( *find_invalid_utf16le )( char16_t const *,
+		                                           char16_t const * ) noexcept;
+		char16_t const *( *find_invalid_utf16be )( char16_t const *,
+		                                           char16_t const * ) noexcept;
+		size_t ( *utf16le_count_code_points )( char16_t const *,
+		                                       char16_t const * ) noexcept;
+		size_t ( *utf16be_count_code_points )( char16_t const *,
+		                                       char16_t const * ) noexcept;
+		size_t ( *latin1_utf8_length )( char const *, char const * ) noexcept;
+		char *( *latin1to8 )( char const *, char const *, char * ) noexcept;
+		simd::transcode_result ( *utf8tolatin1 )( char const *, char const *,
+		                                          char * ) noexcept;
+		char const *( *find_substring )( char const *, char const *,
+		                                 char const *, char const * ) noexcept;
+		char const *( *rfind_substring )( char const *, char const *,
+		                                  char const *, char const * ) noexcept;
+		simd::teddy_block ( *teddy_find )( simd::teddy_masks const &,
+		                                   char const *, char const *,
+		                                   uint8_t * ) noexcept;
+		char const *( *find_non_ascii )( char const *, char const * ) noexcept;
+		char const *( *find_not_in_set )( simd::byte_set const &, char const *,
+		                                  char const * ) noexcept;
+		char const *( *ascii_case_map )( char const *, char const *, char *,
+		                                 bool ) noexcept;
+		size_t ( *ascii_icase_prefix )( char const *, char const *,
+		                                size_t ) noexcept;
+		char const *( *find_non_printable_ascii )( char const *,
+		                                           char const * ) noexcept;
+		char const *( *advance_code_points )( char const *, char const *,
+		                                      size_t ) noexcept;
+		size_t ( *utf8_utf16_length )( char const *, char const * ) noexcept;
+		simd::advance_result ( *advance_utf16_units )( char const *,
+		                                               char const *,
+		                                               size_t ) noexcept;
+		simd::line_masks ( *scan_lines )( char const *, size_t ) noexcept;
+	};
+
+	namespace internal {
+		inline constexpr kernel_table scalar_kernels = {
+		  isa::scalar,
+		  simd::scalar::find_invalid,
+		  simd::scalar::count_code_points,
+		  simd::scalar::utf8to16,
+		  simd::scalar::utf8to32,
+		  simd::scalar::utf16to8,
+		  simd::scalar::utf32to8,
+		  simd::scalar::find_invalid_utf16<false>,
+		  simd::scalar::find_invalid_utf16<true>,
+		  simd::scalar::utf16_count_code_points<false>,
+		  simd::scalar::utf16_count_code_points<true>,
+		  simd::scalar::latin1_utf8_length,
+		  simd::scalar::latin1to8,
+		  simd::scalar::utf8tolatin1,
+		  simd::scalar::find_substring,
+		  simd::scalar::rfind_substring,
+		  simd::scalar::teddy_find,
+		  simd::scalar::find_non_ascii,
+		  simd::scalar::find_not_in_set,
+		  simd::scalar::ascii_case_map,
+		  simd::scalar::ascii_icase_prefix,
+		  simd::scalar::find_non_printable_ascii,
+		  simd::scalar::advance_code_points,
+		  simd::scalar::utf8_utf16_length,
+		  simd::scalar::advance_utf16_units,
+		  simd::scalar::scan_lines };
+
+#if defined( DAW_UTF8_X86_KERNELS )
+		inline constexpr kernel_table sse42_kernels = {
+		  isa::sse42,
+		  simd::sse42::find_invalid,
+		  simd::sse42::count_code_points,
+		  simd::sse42::utf8to16,
+		  simd::sse42::utf8to32,
+		  simd::sse42::utf16to8,
+		  simd::sse42::utf32to8,
+		  simd::sse42::find_invalid_utf16<false>,
+		  simd::sse42::find_invalid_utf16<true>,
+		  simd::sse42::utf16_count_code_points<false>,
+		  simd::sse42::utf16_count_code_points<true>,
+		  simd::sse42::latin1_utf8_length,
+		  simd::sse42::latin1to8,
+		  simd::sse42::utf8tolatin1,
+		  simd::sse42::find_substring,
+		  simd::sse42::rfind_substring,
+		  simd::sse42::teddy_find,
+		  simd::sse42::find_non_ascii,
+		  simd::sse42::find_not_in_set,
+		  simd::sse42::ascii_case_map,
+		  simd::sse42::ascii_icase_prefix,
+		  simd::sse42::find_non_printable_ascii,
+		  simd::sse42::advance_code_points,
+		  simd::sse42::utf8_utf16_length,
+		  simd::sse42::advance_utf16_units,
+		  simd::sse42::scan_lines };
+
+		inline constexpr kernel_table avx2_kernels = {
+		  isa::avx2,
+		  simd::avx2::find_invalid,
+		  simd::avx2::count_code_points,
+		  simd::avx2::utf8to16,
+		  simd::avx2::utf8to32,
+		  simd::avx2::utf16to8,
+		  simd::avx2::utf32to8,
+		  simd::avx2::find_invalid_utf16<false>,
+		  simd::avx2::find_invalid_utf16<true>,
+		  simd::avx2::utf16_count_code_points<false>,
+		  simd::avx2::utf16_count_code_points<true>,
+		  simd::avx2::latin1_utf8_length,
+		  simd::avx2::latin1to8,
+		  simd::avx2::utf8tolatin1,
+		  simd::avx2::find_substring,
+		  simd::avx2::rfind_substring,
+		  simd::avx2::teddy_find,
+		  simd::avx2::find_non_ascii,
+		  simd::avx2::find_not_in_set,
+		  simd::avx2::ascii_case_map,
+		  simd::avx2::ascii_icase_prefix,
+		  simd::avx2::find_non_printable_ascii,
+		  simd::avx2::advance_code_points,
+		  simd::avx2::utf8_utf16_length,
+		  simd::avx2::advance_utf16_units,
+		  simd::avx2::scan_lines };
+
+		inline constexpr kernel_table avx512_kernels = {
+		  isa::avx512,
+		  simd::avx512::find_invalid,
+		  simd::avx512::count_code_points,
+		  simd::avx512::utf8to16,
+		  simd::avx512::utf8to32,
+		  simd::avx512::utf16to8,
+		  simd::avx512::utf32to8,
+		  simd::avx512::find_invalid_utf16<false>,
+		  simd::avx512::find_invalid_utf16<true>,
+		  simd::avx512::utf16_count_code_points<false>,
+		  simd::avx512::utf16_count_code_points<true>,
+		  simd::avx512::latin1_utf8_length,
+		  simd::avx512::latin1to8,
+		  simd::avx512::utf8tolatin1,
+		  simd::avx512::find_substring,
+		  simd::avx512::rfind_substring,
+		  simd::avx512::teddy_find,
+		  simd::avx512::find_non_ascii,
+		  simd::avx512::find_not_in_set,
+		  simd::avx512::ascii_case_map,
+		  simd::avx512::ascii_icase_prefix,
+		  simd::avx512::find_non_printable_ascii,
+		  simd::avx512::advance_code_points,
+		  simd::avx512::utf8_utf16_length,
+		  simd::avx512::advance_utf16_units,
+		  simd::avx512::scan_lines };
+
+#if defined( _MSC_VER ) and not defined( __clang__ )
+		inline isa detect_isa( ) noexcept {
+			int regs[4];
+			__cpuid( regs, 0 );
+			auto const max_leaf = regs[0];
+			__cpuid( regs, 1 );
+			bool const has_sse42 = ( regs[2] & ( 1 << 20 ) ) != 0 and
+			                       ( regs[2] & ( 1 << 23 ) ) != 0;
+			bool const has_osxsave = ( regs[2] & ( 1 << 27 ) ) != 0;
+			if( not has_sse42 ) {
+				return isa::scalar;
+			}
+			if( max_leaf < 7 or not has_osxsave ) {
+				return isa::sse42;
+			}
+			auto const xcr0 = _xgetbv( 0 );
+			if( ( xcr0 & 0x6U ) != 0x6U ) {
+				return isa::sse42;
+			}
+			__cpuidex( regs, 7, 0 );
+			// AVX-512 F, BW and VL with the OS saving the opmask and zmm state
+			auto const avx512_bits = ( 1 << 16 ) | ( 1 << 30 ) | ( 1 << 31 );
+			if( ( regs[1] & avx512_bits ) == avx512_bits and
+			    ( xcr0 & 0xE6U ) == 0xE6U ) {
+				return isa::avx512;
+			}
+			auto const avx2_bits = ( 1 << 5 ) | ( 1 << 3 ) | ( 1 << 8 );
+			if( ( regs[1] & avx2_bits ) == avx2_bits ) {
+				return isa::avx2;
+			}
+			return isa::sse42;
+		}
+#else
+		inline isa detect_isa( ) noexcept {
+			__builtin_cpu_init( );
+			if( __builtin_cpu_supports( "avx512f" ) and
+			    __builtin_cpu_supports( "avx512bw" ) and
+			    __builtin_cpu_supports( "avx512vl" ) ) {
+				return isa::avx512;
+			}
+			if( __builtin_cpu_supports( "avx2" ) and
+			    __builtin_cpu_supports( "bmi2" ) ) {
+				return isa::avx2;
+			}
+			if( __builtin_cpu_supports( "sse4.2" ) and
+			    __builtin_cpu_supports( "popcnt" ) ) {
+				return isa::sse42;
+			}
+			return isa::scalar;
+		}
+#endif
+#else
+		inline isa detect_isa( ) noexcept {
+			return isa::scalar;
+		}
+#endif
+
+		inline kernel_table const *table_for( isa i ) noexcept {
+#if defined( DAW_UTF8_X86_KERNELS )
+			switch( i ) {
+			case isa::avx512:
+				return &avx512_kernels;
+			case isa::avx2:
+				return &avx2_kernels;
+			case isa::sse42:
+				return &sse42_kernels;
+			case isa::scalar:
+				break;
+			}
+#else
+			(void)i;
+#endif
+			return &scalar_kernels;
+		}
+
+		/// The tier named by DAW_UTF8_ISA, or fallback when it is unset or unknown
+		inline isa env_isa( isa fallback ) noexcept {
+#if defined( _MSC_VER )
+#pragma warning( suppress : 4996 )
+#endif
+			auto const value = std::getenv( "DAW_UTF8_ISA" );
+			if( value == nullptr ) {
+				return fallback;
+			}
+			for( auto i : { isa::scalar, isa::sse42, isa::avx2, isa::avx512 } ) {
+				if( std::strcmp( value, isa_name( i ) ) == 0 ) {
+					return i;
+				}
+			}
+			return fallback;
+		}
+
+		inline std::atomic<kernel_table const *> active_table{ nullptr };
+
+		static_assert( static_cast<size_t>( isa::avx512 ) + 1 ==
+		               stats::tier_count );
+
+		/// Statistics for one call, does nothing unless DAW_UTF8_STATS is defined
+		template<typename T>
+		inline stats::scoped_operation track( stats::operation op,
+		                                      kernel_table const &k,
+		                                      T const *first,
+		                                      T const *last ) noexcept {
+			return stats::scoped_operation(
+			  op, static_cast<size_t>( k.tier ),
+			  static_cast<size_t>( last - first ) * sizeof( T ) );
+		}
+
+		inline kernel_table const &kernels( ) noexcept {
+			auto result = active_table.load( std::memory_order_acquire );
+			if( result == nullptr ) {
+				auto const best = detect_isa( );
+				auto const wanted = env_isa( best );
+				result = table_for( wanted < best ? wanted : best );
+				// Any thread that races here stores the same table
+				active_table.store( result, std::memory_order_release );
+			}
+			return *result;
+		}
+	} // namespace internal
+
+	/// The best tier this CPU supports
+	inline isa supported_isa( ) noexcept {
+		static isa const result = internal::detect_isa( );
+		return result;
+	}
+
+	/// The tier in use
+	inline isa active_isa( ) noexcept {
+		return internal::kernels( ).tier;
+	}
+
+	/// Force a tier, it is lowered to supported_isa( ) if the CPU lacks it.
+	/// Returns the tier now in use
+	inline isa set_isa( isa i ) noexcept {
+		auto const best = supported_isa( );
+		auto const result = internal::table_for( i < best ? i : best );
+		internal::active_table.store( result, std::memory_order_release );
+		return result->tier;
+	}
+
+	/// Position of the first invalid UTF-8 sequence, last when it is all valid
+	inline char const *find_invalid( char const *first,
+	                                 char const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::validate, k, first, last );
+		auto const result = k.find_invalid( first, last );
+		if constexpr( stats::enabled ) {
+			stats::record_ascii( first, result );
+			if( result != last ) {
+				stats::record_invalid( result, last );
+			}
+		}
+		return result;
+	}
+
+	/// Code points in valid UTF-8
+	inline size_t count_code_points( char const *first,
+	                                 char const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::count, k, first, last );
+		return k.count_code_points( first, last );
+	}
+
+	/// Units utf8to16 writes for valid UTF-8, a code point above U+FFFF takes
+	/// two
+	inline size_t utf8_utf16_length( char const *first,
+	                                 char const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::count, k, first, last );
+		return k.utf8_utf16_length( first, last );
+	}
+
+	/// Transcode valid UTF-8, out must have room for last - first units
+	inline char16_t *utf8to16( char const *first, char const *last,
+	                           char16_t *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::utf8to16, k, first, last );
+		return k.utf8to16( first, last, out );
+	}
+
+	/// Transcode valid UTF-8, out must have room for last - first code points
+	inline char32_t *utf8to32( char const *first, char const *last,
+	                           char32_t *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::utf8to32, k, first, last );
+		return k.utf8to32( first, last, out );
+	}
+
+	/// Transcode valid UTF-16, out must have room for 3 bytes per unit
+	inline char *utf16to8( char16_t const *first, char16_t const *last,
+	                       char *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::utf16to8, k, first, last );
+		return k.utf16to8( first, last, out );
+	}
+
+	/// Transcode valid UTF-32, out must have room for 4 bytes per code point
+	inline char *utf32to8( char32_t const *first, char32_t const *last,
+	                       char *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::utf32to8, k, first, last );
+		return k.utf32to8( first, last, out );
+	}
+
+	/// Position of the first lone or misordered surrogate in little endian
+	/// UTF-16, last when it is all valid
+	inline char16_t const *find_invalid_utf16le( char16_t const *first,
+	                                             char16_t const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::validate_utf16, k, first, last );
+		return k.find_invalid_utf16le( first, last );
+	}
+
+	/// Position of the first lone or misordered surrogate in big endian
+	/// UTF-16, last when it is all valid
+	inline char16_t const *find_invalid_utf16be( char16_t const *first,
+	                                             char16_t const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::validate_utf16, k, first, last );
+		return k.find_invalid_utf16be( first, last );
+	}
+
+	/// find_invalid_utf16 for units in the byte order of the host
+	inline char16_t const *find_invalid_utf16( char16_t const *first,
+	                                           char16_t const *last ) noexcept {
+		if constexpr( simd::big_endian_host ) {
+			return find_invalid_utf16be( first, last );
+		} else {
+			return find_invalid_utf16le( first, last );
+		}
+	}
+
+	/// Code points in valid little endian UTF-16
+	inline size_t utf16le_count_code_points( char16_t const *first,
+	                                         char16_t const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::count_utf16, k, first, last );
+		return k.utf16le_count_code_points( first, last );
+	}
+
+	/// Code points in valid big endian UTF-16
+	inline size_t utf16be_count_code_points( char16_t const *first,
+	                                         char16_t const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::count_utf16, k, first, last );
+		return k.utf16be_count_code_points( first, last );
+	}
+
+	/// utf16_count_code_points for units in the byte order of the host
+	inline size_t utf16_count_code_points( char16_t const *first,
+	                                       char16_t const *last ) noexcept {
+		if constexpr( simd::big_endian_host ) {
+			return utf16be_count_code_points( first, last );
+		} else {
+			return utf16le_count_code_points( first, last );
+		}
+	}
+
+	/// Bytes latin1to8 writes for the Latin-1 text [first, last)
+	inline size_t latin1_utf8_length( char const *first,
+	                                  char const *last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::count_latin1, k, first, last );
+		return k.latin1_utf8_length( first, last );
+	}
+
+	/// Bytes utf8tolatin1 writes for valid UTF-8 with no code point above
+	/// U+FF, one per code point
+	inline size_t utf8_latin1_length( char const *first,
+	                                  char const *last ) noexcept {
+		return count_code_points( first, last );
+	}
+
+	/// Encode Latin-1 as UTF-8, out must have room for
+	/// latin1_utf8_length( first, last ) bytes
+	inline char *latin1to8( char const *first, char const *last,
+	                        char *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::latin1to8, k, first, last );
+		return k.latin1to8( first, last, out );
+	}
+
+	/// Decode valid UTF-8 to Latin-1, out must have room for
+	/// utf8_latin1_length( first, last ) bytes.  Stops at the first code point
+	/// above U+FF, the input of the result is last when there is none
+	inline simd::transcode_result
+	utf8tolatin1( char const *first, char const *last, char *out ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::utf8tolatin1, k, first, last );
+		return k.utf8tolatin1( first, last, out );
+	}
+
+	/// The first occurrence of [needle, needle_last) in [first, last), last
+	/// when there is none.  An empty needle is found at first.  Valid UTF-8 is
+	/// self-synchronizing, so a match of valid text is always whole code points
+	inline char const *find_substring( char const *first, char const *last,
+	                                   char const *needle,
+	                                   char const *needle_last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::search, k, first, last );
+		return k.find_substring( first, last, needle, needle_last );
+	}
+
+	/// The last occurrence of [needle, needle_last) in [first, last), last
+	/// when there is none.  An empty needle is found at last
+	inline char const *rfind_substring( char const *first, char const *last,
+	                                    char const *needle,
+	                                    char const *needle_last ) noexcept {
+		auto const &k = internal::kernels( );
+		[[maybe_unused]] auto const op =
+		  internal::track( stats::operation::search, k, first, last );
+		return k.rfind_substring( first, last, needle, needle_last );
+	}
+
+	/// The first block of positions in [first, last) where a pattern of masks
+	/// may start, buckets receives the candidate buckets of each position and
+	/// must hold 64.  The position is last when there is none.  This is called
+	/// once per block with candidates so it is not counted in the statistics
+	inline simd::teddy_block teddy_find( simd::teddy_masks const &masks,
+	                                     char const *first, char const *last,
+	                                     uint8_t *buckets ) noexcept {
+		return internal::kernels( ).teddy_find( masks, first, last, buckets );
+	}
+
+	/// The first byte >= 0x80 in [first, last), last when it is all ASCII.
+	/// This is called once per run of ASCII so it is not counted in the
+	/// statistics
+	inline char const *find_non_ascii( char const *first,
+	                                   char const *last ) noexcept {
+		return internal::kernels( ).find_non_ascii( first, last );
+	}
+
+	/// The first byte of [first, last) that is not in set, last when they all
+	/// are.  Like find_non_ascii it is not counted in the statistics
+	inline char const *find_not_in_set( simd::byte_set const &set,
+	                                    char const *first,
+	                                    char const *last ) noexcept {
+		return internal::kernels( ).find_not_in_set( set, first, last );
+	}
+
+	/// Copy the ASCII bytes at the start of [first, last) to out in upper
+	/// case, or in lower case which is also their case folding.  Returns the
+	/// first byte >= 0x80, or last.  Not counted in the statistics
+	inline char const *ascii_case_map( char const *first, char const *last,
+	                                   char *out, bool upper ) noexcept {
+		return internal::kernels( ).ascii_case_map( first, last, out, upper );
+	}
+
+	/// The length of the start of the n bytes at lhs and rhs that is ASCII
+	/// and equal ignoring case.  Not counted in the statistics
+	inline size_t ascii_icase_prefix( char const *lhs, char const *rhs,
+	                                  size_t n ) noexcept {
+		return internal::kernels( ).ascii_icase_prefix( lhs, rhs, n );
+	}
+
+	/// The first byte of [first, last) outside 0x20 to 0x7E, last when there
+	/// is none.  Not counted in the statistics
+	inline char const *find_non_printable_ascii( char const *first,
+	                                             char const *last ) noexcept {
+		return internal::kernels( ).find_non_printable_ascii( first, last );
+	}
+
+	/// The position n code points after first in valid UTF-8, last when there
+	/// are not that many.  Not counted in the statistics
+	inline char const *advance_code_points( char const *first,
+	                                        char const *last,
+	                                        size_t n ) noexcept {
+		return internal::kernels( ).advance_code_points( first, last, n );
+	}
+
+	/// The position after the code points that take the first n UTF-16 units
+	/// of valid UTF-8, last when there are not that many.  A code point whose
+	/// surrogate pair would be split is left out and the unit left over is
+	/// remaining.  Not counted in the statistics
+	inline simd::advance_result advance_utf16_units( char const *first,
+	                                                 char const *last,
+	                                                 size_t n ) noexcept {
+		return internal::kernels( ).advance_utf16_units( first, last, n );
+	}
+
+	/// The newlines and the bytes >= 0x80 of the count <= 64 bytes at first.
+	/// This is called once per block so it is not counted in the statistics
+	inline simd::line_masks scan_lines( char const *first,
+	                                    size_t count ) noexcept {
+		return internal::kernels( ).scan_lines( first, count );
+	}
+} // namespace daw::utf8::dispatch
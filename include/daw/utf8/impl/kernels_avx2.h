@@ -0,0 +1,738 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../simd.h"
+#include "kernels_scalar.h"
+#include "kernels_sse42.h"
+
+#if defined( DAW_UTF8_X86_KERNELS )
+
+#include <cstddef>
+#include <cstdint>
+
+/// 32 byte kernels for CPUs with AVX2
+namespace daw::utf8::simd::avx2 {
+	/// The 16 entry table repeated in both 128 bit lanes for vpshufb
+	DAW_UTF8_TARGET_AVX2 inline __m256i lane_table( __m128i table ) noexcept {
+		return _mm256_broadcastsi128_si256( table );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline __m256i high_nibbles( __m256i v ) noexcept {
+		return _mm256_and_si256( _mm256_srli_epi16( v, 4 ),
+		                         _mm256_set1_epi8( 0x0F ) );
+	}
+
+	/// The 32 bytes ending N bytes before the end of input
+	template<int N>
+	DAW_UTF8_TARGET_AVX2 inline __m256i prev( __m256i input,
+	                                          __m256i prev_input ) noexcept {
+		return _mm256_alignr_epi8(
+		  input, _mm256_permute2x128_si256( prev_input, input, 0x21 ), 16 - N );
+	}
+
+	/// Non-zero lanes mark errors in input given the previous 32 bytes.  See
+	/// sse42::check_block
+	DAW_UTF8_TARGET_AVX2 inline __m256i
+	check_block( __m256i input, __m256i prev_input ) noexcept {
+		using namespace sse42::lookup;
+		auto const prev1 = prev<1>( input, prev_input );
+		auto const byte_1_high = _mm256_shuffle_epi8(
+		  lane_table( _mm_setr_epi8(
+		    too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+		    too_long, two_conts, two_conts, two_conts, two_conts,
+		    too_short | overlong_2, too_short, too_short | overlong_3 | surrogate,
+		    too_short | too_large | too_large_1000 | overlong_4 ) ),
+		  high_nibbles( prev1 ) );
+		auto const byte_1_low = _mm256_shuffle_epi8(
+		  lane_table( _mm_setr_epi8( carry | overlong_3 | overlong_2 | overlong_4,
+		                             carry | overlong_2, carry, carry,
+		                             carry | too_large,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000 | surrogate,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000 ) ),
+		  _mm256_and_si256( prev1, _mm256_set1_epi8( 0x0F ) ) );
+		auto const byte_2_high = _mm256_shuffle_epi8(
+		  lane_table( _mm_setr_epi8(
+		    too_short, too_short, too_short, too_short, too_short, too_short,
+		    too_short, too_short,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+		      overlong_4,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large, too_short,
+		    too_short, too_short, too_short ) ),
+		  high_nibbles( input ) );
+		auto const special = _mm256_and_si256(
+		  _mm256_and_si256( byte_1_high, byte_1_low ), byte_2_high );
+		auto const is_third =
+		  _mm256_subs_epu8( prev<2>( input, prev_input ),
+		                    _mm256_set1_epi8( 0xE0 - 0x80 ) );
+		auto const is_fourth =
+		  _mm256_subs_epu8( prev<3>( input, prev_input ),
+		                    _mm256_set1_epi8( 0xF0 - 0x80 ) );
+		auto const must23 =
+		  _mm256_and_si256( _mm256_or_si256( is_third, is_fourth ),
+		                    _mm256_set1_epi8( static_cast<char>( 0x80 ) ) );
+		return _mm256_xor_si256( must23, special );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline __m256i is_incomplete( __m256i input ) noexcept {
+		auto const max_value = _mm256_setr_epi8(
+		  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		  static_cast<char>( 0xF0 - 1 ), static_cast<char>( 0xE0 - 1 ),
+		  static_cast<char>( 0xC0 - 1 ) );
+		return _mm256_subs_epu8( input, max_value );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	find_invalid( char const *const first, char const *const last ) noexcept {
+		auto it = first;
+		auto prev_input = _mm256_setzero_si256( );
+		auto prev_incomplete = _mm256_setzero_si256( );
+		while( last - it >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( it ) );
+			auto error = prev_incomplete;
+			if( _mm256_movemask_epi8( input ) == 0 ) {
+				prev_incomplete = _mm256_setzero_si256( );
+			} else {
+				error = check_block( input, prev_input );
+				prev_incomplete = is_incomplete( input );
+			}
+			if( not _mm256_testz_si256( error, error ) ) {
+				return scalar::find_invalid( scalar::rescan_start( first, it ),
+				                             last );
+			}
+			prev_input = input;
+			it += 32;
+		}
+		return sse42::find_invalid( scalar::rescan_start( first, it ), last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline size_t
+	count_code_points( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		auto const max_trail = _mm256_set1_epi8( -65 );
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const leads = _mm256_cmpgt_epi8( input, max_trail );
+			result += static_cast<size_t>( _mm_popcnt_u32(
+			  static_cast<unsigned>( _mm256_movemask_epi8( leads ) ) ) );
+			first += 32;
+		}
+		return result + scalar::count_code_points( first, last );
+	}
+
+	/// Bit n is set when byte n of the 64 at first ends a code point.  Bit 63
+	/// is left clear
+	DAW_UTF8_TARGET_AVX2 inline uint64_t code_point_ends( __m256i a,
+	                                                      __m256i b ) noexcept {
+		auto const max_trail = _mm256_set1_epi8( -65 );
+		auto const low = static_cast<uint32_t>(
+		  _mm256_movemask_epi8( _mm256_cmpgt_epi8( a, max_trail ) ) );
+		auto const high = static_cast<uint32_t>(
+		  _mm256_movemask_epi8( _mm256_cmpgt_epi8( b, max_trail ) ) );
+		return ( static_cast<uint64_t>( high ) << 32U | low ) >> 1U;
+	}
+
+	/// ASCII is widened 64 bytes at a time, other chunks are decoded by the
+	/// SSE4.2 table steps
+	DAW_UTF8_TARGET_AVX2 inline char16_t *
+	utf8to16( char const *first, char const *last, char16_t *out ) noexcept {
+		while( last - first >= 64 ) {
+			auto const a =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const b =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first + 32 ) );
+			if( _mm256_movemask_epi8( _mm256_or_si256( a, b ) ) != 0 ) {
+				first += sse42::utf8to16_chunk( first, code_point_ends( a, b ), out );
+				continue;
+			}
+			auto const p = reinterpret_cast<__m256i *>( out );
+			_mm256_storeu_si256(
+			  p, _mm256_cvtepu8_epi16( _mm256_castsi256_si128( a ) ) );
+			_mm256_storeu_si256(
+			  p + 1, _mm256_cvtepu8_epi16( _mm256_extracti128_si256( a, 1 ) ) );
+			_mm256_storeu_si256(
+			  p + 2, _mm256_cvtepu8_epi16( _mm256_castsi256_si128( b ) ) );
+			_mm256_storeu_si256(
+			  p + 3, _mm256_cvtepu8_epi16( _mm256_extracti128_si256( b, 1 ) ) );
+			first += 64;
+			out += 64;
+		}
+		return scalar::utf8to16( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char32_t *
+	utf8to32( char const *first, char const *last, char32_t *out ) noexcept {
+		while( last - first >= 64 ) {
+			auto const a =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const b =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first + 32 ) );
+			if( _mm256_movemask_epi8( _mm256_or_si256( a, b ) ) != 0 ) {
+				first += sse42::utf8to32_chunk( first, code_point_ends( a, b ), out );
+				continue;
+			}
+			for( int n = 0; n < 8; ++n ) {
+				_mm256_storeu_si256(
+				  reinterpret_cast<__m256i *>( out + 8 * n ),
+				  _mm256_cvtepu8_epi32( _mm_loadl_epi64(
+				    reinterpret_cast<__m128i const *>( first + 8 * n ) ) ) );
+			}
+			first += 64;
+			out += 64;
+		}
+		return scalar::utf8to32( first, last, out );
+	}
+
+	/// The 8 code points in the lanes of cps as UTF-8, see sse42::encode4.
+	/// Stores 16 bytes past the end of the first 4 and returns the end
+	DAW_UTF8_TARGET_AVX2 inline char *encode8( __m256i cps,
+	                                           char *out ) noexcept {
+		// Lane bytes in output order are 0x80 | bits 18-20, 12-17, 6-11, 0-5
+		auto const fields = _mm256_or_si256(
+		  _mm256_or_si256(
+		    _mm256_and_si256( _mm256_slli_epi32( cps, 24 ),
+		                      _mm256_set1_epi32( 0x3F00'0000 ) ),
+		    _mm256_and_si256( _mm256_slli_epi32( cps, 10 ),
+		                      _mm256_set1_epi32( 0x003F'0000 ) ) ),
+		  _mm256_or_si256( _mm256_and_si256( _mm256_srli_epi32( cps, 4 ),
+		                                     _mm256_set1_epi32( 0x3F00 ) ),
+		                   _mm256_srli_epi32( cps, 18 ) ) );
+		auto const m2 = _mm256_cmpgt_epi32( cps, _mm256_set1_epi32( 0x7F ) );
+		auto const m3 = _mm256_cmpgt_epi32( cps, _mm256_set1_epi32( 0x7FF ) );
+		auto const m4 = _mm256_cmpgt_epi32( cps, _mm256_set1_epi32( 0xFFFF ) );
+		// Turn the 0x80 of the lead into 0xC0, 0xE0 or 0xF0
+		auto const lead = _mm256_xor_si256(
+		  _mm256_xor_si256(
+		    _mm256_and_si256( m2, _mm256_set1_epi32( 0x0040'0000 ) ),
+		    _mm256_and_si256( m3, _mm256_set1_epi32( 0x0040'6000 ) ) ),
+		  _mm256_and_si256( m4, _mm256_set1_epi32( 0x6070 ) ) );
+		auto const lengths = _mm256_sub_epi32(
+		  _mm256_setzero_si256( ),
+		  _mm256_add_epi32( _mm256_add_epi32( m2, m3 ), m4 ) );
+		auto const bytes = _mm256_blendv_epi8(
+		  _mm256_slli_epi32( cps, 24 ),
+		  _mm256_xor_si256(
+		    _mm256_or_si256( fields, _mm256_set1_epi32( static_cast<int>(
+		                               0x8080'8080U ) ) ),
+		    lead ),
+		  m2 );
+		out = sse42::pack4( _mm256_castsi256_si128( bytes ),
+		                    _mm256_castsi256_si128( lengths ), out );
+		return sse42::pack4( _mm256_extracti128_si256( bytes, 1 ),
+		                     _mm256_extracti128_si256( lengths, 1 ), out );
+	}
+
+	/// Blocks with a surrogate are encoded 4 units at a time by
+	/// sse42::encode4_utf16.  Each 8 units encoded may store 4 bytes past the
+	/// 24 they have room for, the units after them cover it
+	DAW_UTF8_TARGET_AVX2 inline char *
+	utf16to8( char16_t const *first, char16_t const *last, char *out ) noexcept {
+		auto const start = first;
+		auto const non_ascii = _mm256_set1_epi16( static_cast<short>( 0xFF80 ) );
+		while( last - first >= 32 ) {
+			auto const a =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const b =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first + 16 ) );
+			if( _mm256_testz_si256( _mm256_or_si256( a, b ), non_ascii ) ) {
+				// packus works per 128 bit lane, restore the order after
+				_mm256_storeu_si256(
+				  reinterpret_cast<__m256i *>( out ),
+				  _mm256_permute4x64_epi64( _mm256_packus_epi16( a, b ), 0xD8 ) );
+				first += 32;
+				out += 32;
+				continue;
+			}
+			auto const low = _mm256_castsi256_si128( a );
+			auto const high = _mm256_extracti128_si256( a, 1 );
+			if( ( sse42::has_surrogate( low ) | sse42::has_surrogate( high ) ) ==
+			    0 ) {
+				out = encode8( _mm256_cvtepu16_epi32( low ), out );
+				out = encode8( _mm256_cvtepu16_epi32( high ), out );
+				first += 16;
+				continue;
+			}
+			// A trail surrogate at the start of the block pairs with the unit
+			// before it
+			auto const previous =
+			  first == start
+			    ? _mm_slli_si128( low, 2 )
+			    : _mm_loadu_si128( reinterpret_cast<__m128i const *>( first - 1 ) );
+			auto const middle = _mm_alignr_epi8( high, low, 14 );
+			out = sse42::encode4_utf16( _mm_cvtepu16_epi32( low ),
+			                            _mm_cvtepu16_epi32( previous ), out );
+			out = sse42::encode4_utf16(
+			  _mm_cvtepu16_epi32( _mm_srli_si128( low, 8 ) ),
+			  _mm_cvtepu16_epi32( _mm_srli_si128( previous, 8 ) ), out );
+			out = sse42::encode4_utf16( _mm_cvtepu16_epi32( high ),
+			                            _mm_cvtepu16_epi32( middle ), out );
+			out = sse42::encode4_utf16(
+			  _mm_cvtepu16_epi32( _mm_srli_si128( high, 8 ) ),
+			  _mm_cvtepu16_epi32( _mm_srli_si128( middle, 8 ) ), out );
+			first += 16;
+		}
+		return sse42::utf16to8_tail( start, first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char *
+	utf32to8( char32_t const *first, char32_t const *last, char *out ) noexcept {
+		auto const non_ascii = _mm256_set1_epi32( ~0x7F );
+		while( last - first >= 32 ) {
+			auto const p = reinterpret_cast<__m256i const *>( first );
+			auto const a = _mm256_loadu_si256( p );
+			auto const b = _mm256_loadu_si256( p + 1 );
+			auto const c = _mm256_loadu_si256( p + 2 );
+			auto const d = _mm256_loadu_si256( p + 3 );
+			auto const all =
+			  _mm256_or_si256( _mm256_or_si256( a, b ), _mm256_or_si256( c, d ) );
+			if( _mm256_testz_si256( all, non_ascii ) ) {
+				auto const packed = _mm256_packus_epi16( _mm256_packus_epi32( a, b ),
+				                                         _mm256_packus_epi32( c, d ) );
+				_mm256_storeu_si256(
+				  reinterpret_cast<__m256i *>( out ),
+				  _mm256_permutevar8x32_epi32(
+				    packed, _mm256_setr_epi32( 0, 4, 1, 5, 2, 6, 3, 7 ) ) );
+				first += 32;
+				out += 32;
+				continue;
+			}
+			out = encode8( a, out );
+			out = encode8( b, out );
+			out = encode8( c, out );
+			out = encode8( d, out );
+			first += 32;
+		}
+		return scalar::utf32to8( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline size_t
+	latin1_utf8_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const high = static_cast<unsigned>( _mm256_movemask_epi8( input ) );
+			result += 32U + static_cast<size_t>( _mm_popcnt_u32( high ) );
+			first += 32;
+		}
+		return result + sse42::latin1_utf8_length( first, last );
+	}
+
+	/// ASCII is copied 32 bytes at a time, the other blocks are widened 16
+	/// bytes at a time by sse42::latin1to8_block
+	DAW_UTF8_TARGET_AVX2 inline char *
+	latin1to8( char const *first, char const *last, char *out ) noexcept {
+		while( last - first >= 40 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			if( _mm256_movemask_epi8( input ) == 0 ) {
+				_mm256_storeu_si256( reinterpret_cast<__m256i *>( out ), input );
+				first += 32;
+				out += 32;
+				continue;
+			}
+			out = sse42::latin1to8_block( first, out );
+			out = sse42::latin1to8_block( first + 16, out );
+			first += 32;
+		}
+		return sse42::latin1to8( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline transcode_result
+	utf8tolatin1( char const *first, char const *last, char *out ) noexcept {
+		while( last - first >= 48 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			if( _mm256_movemask_epi8( input ) == 0 ) {
+				_mm256_storeu_si256( reinterpret_cast<__m256i *>( out ), input );
+				first += 32;
+				out += 32;
+				continue;
+			}
+			if( not sse42::utf8tolatin1_block( first, out ) ) {
+				break;
+			}
+		}
+		return sse42::utf8tolatin1( first, last, out );
+	}
+
+	/// See sse42::candidates
+	DAW_UTF8_TARGET_AVX2 inline uint32_t
+	candidates( char const *it, size_t last_offset, __m256i first_byte,
+	            __m256i last_byte ) noexcept {
+		auto const block_first =
+		  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( it ) );
+		auto const block_last = _mm256_loadu_si256(
+		  reinterpret_cast<__m256i const *>( it + last_offset ) );
+		return static_cast<uint32_t>( _mm256_movemask_epi8(
+		  _mm256_and_si256( _mm256_cmpeq_epi8( block_first, first_byte ),
+		                    _mm256_cmpeq_epi8( block_last, last_byte ) ) ) );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	find_substring( char const *first, char const *last, char const *needle,
+	                char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 ) {
+			return first;
+		}
+		auto const first_byte = _mm256_set1_epi8( needle[0] );
+		auto const last_byte = _mm256_set1_epi8( needle[n - 1] );
+		auto it = first;
+		while( static_cast<size_t>( last - it ) >= n + 31 ) {
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			while( mask != 0 ) {
+				auto const pos = it + _tzcnt_u32( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					return pos;
+				}
+				mask = _blsr_u32( mask );
+			}
+			it += 32;
+		}
+		return sse42::find_substring( it, last, needle, needle_last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	rfind_substring( char const *first, char const *last, char const *needle,
+	                 char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 or static_cast<size_t>( last - first ) < n ) {
+			return last;
+		}
+		auto const first_byte = _mm256_set1_epi8( needle[0] );
+		auto const last_byte = _mm256_set1_epi8( needle[n - 1] );
+		auto end = last - ( n - 1 );
+		while( end - first >= 32 ) {
+			auto const it = end - 32;
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			char const *result = nullptr;
+			while( mask != 0 ) {
+				auto const pos = it + _tzcnt_u32( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					result = pos;
+				}
+				mask = _blsr_u32( mask );
+			}
+			if( result != nullptr ) {
+				return result;
+			}
+			end = it;
+		}
+		auto const result =
+		  sse42::rfind_substring( first, end + ( n - 1 ), needle, needle_last );
+		return result == end + ( n - 1 ) ? last : result;
+	}
+
+	/// See sse42::teddy_lanes
+	template<unsigned Length>
+	DAW_UTF8_TARGET_AVX2 inline __m256i
+	teddy_lanes( teddy_masks const &masks, char const *it ) noexcept {
+		auto const nibble = _mm256_set1_epi8( 0x0F );
+		auto result = _mm256_set1_epi8( -1 );
+		for( unsigned k = 0; k < Length; ++k ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( it + k ) );
+			auto const lo = _mm256_shuffle_epi8(
+			  lane_table( _mm_load_si128(
+			    reinterpret_cast<__m128i const *>( masks.lo[k] ) ) ),
+			  _mm256_and_si256( input, nibble ) );
+			auto const hi = _mm256_shuffle_epi8(
+			  lane_table( _mm_load_si128(
+			    reinterpret_cast<__m128i const *>( masks.hi[k] ) ) ),
+			  _mm256_and_si256( _mm256_srli_epi16( input, 4 ), nibble ) );
+			result = _mm256_and_si256( result, _mm256_and_si256( lo, hi ) );
+		}
+		return result;
+	}
+
+	template<unsigned Length>
+	DAW_UTF8_TARGET_AVX2 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		while( last - first >= static_cast<std::ptrdiff_t>( 31 + Length ) ) {
+			auto const block = teddy_lanes<Length>( masks, first );
+			auto const empty = static_cast<uint32_t>( _mm256_movemask_epi8(
+			  _mm256_cmpeq_epi8( block, _mm256_setzero_si256( ) ) ) );
+			if( empty != 0xFFFF'FFFFU ) {
+				_mm256_storeu_si256( reinterpret_cast<__m256i *>( buckets ), block );
+				return { first, 32, ~empty };
+			}
+			first += 32;
+		}
+		return sse42::teddy_find<Length>( masks, first, last, buckets );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		switch( masks.length ) {
+		case 1:
+			return teddy_find<1>( masks, first, last, buckets );
+		case 2:
+			return teddy_find<2>( masks, first, last, buckets );
+		default:
+			return teddy_find<3>( masks, first, last, buckets );
+		}
+	}
+
+	/// Bit n is set when unit n of the 32 at ptr is a lead surrogate, and in
+	/// trails when it is a trail surrogate.  See sse42::surrogate_bits
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX2 inline uint32_t
+	surrogate_bits( char16_t const *ptr, uint32_t &trails ) noexcept {
+		using c = sse42::utf16_constants<BigEndian>;
+		auto const mask = _mm256_set1_epi16( c::mask );
+		auto const p = reinterpret_cast<__m256i const *>( ptr );
+		auto const a = _mm256_and_si256( _mm256_loadu_si256( p ), mask );
+		auto const b = _mm256_and_si256( _mm256_loadu_si256( p + 1 ), mask );
+		auto const lead = _mm256_set1_epi16( c::lead );
+		auto const trail = _mm256_set1_epi16( c::trail );
+		// packs interleaves the 128 bit lanes of a and b, 0xD8 restores order
+		auto const leads = _mm256_permute4x64_epi64(
+		  _mm256_packs_epi16( _mm256_cmpeq_epi16( a, lead ),
+		                      _mm256_cmpeq_epi16( b, lead ) ),
+		  0xD8 );
+		auto const trail_units = _mm256_permute4x64_epi64(
+		  _mm256_packs_epi16( _mm256_cmpeq_epi16( a, trail ),
+		                      _mm256_cmpeq_epi16( b, trail ) ),
+		  0xD8 );
+		trails = static_cast<uint32_t>( _mm256_movemask_epi8( trail_units ) );
+		return static_cast<uint32_t>( _mm256_movemask_epi8( leads ) );
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX2 inline char16_t const *
+	find_invalid_utf16( char16_t const *first, char16_t const *last ) noexcept {
+		uint32_t carry = 0;
+		while( last - first >= 32 ) {
+			uint32_t trails = 0;
+			auto const leads = surrogate_bits<BigEndian>( first, trails );
+			if( ( ( leads << 1U ) | carry ) != trails ) {
+				break;
+			}
+			carry = leads >> 31U;
+			first += 32;
+		}
+		return sse42::find_invalid_utf16<BigEndian>( first - carry, last );
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX2 inline size_t
+	utf16_count_code_points( char16_t const *first,
+	                         char16_t const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 32 ) {
+			uint32_t trails = 0;
+			surrogate_bits<BigEndian>( first, trails );
+			result += 32U - static_cast<size_t>( _mm_popcnt_u32( trails ) );
+			first += 32;
+		}
+		return result + scalar::utf16_count_code_points<BigEndian>( first, last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	find_non_ascii( char const *first, char const *last ) noexcept {
+		while( last - first >= 32 ) {
+			auto const high = static_cast<uint32_t>(
+			  _mm256_movemask_epi8( _mm256_loadu_si256(
+			    reinterpret_cast<__m256i const *>( first ) ) ) );
+			if( high != 0 ) {
+				return first + scalar::lowest_set_bit( high );
+			}
+			first += 32;
+		}
+		return sse42::find_non_ascii( first, last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	find_not_in_set( byte_set const &set, char const *first,
+	                 char const *last ) noexcept {
+		auto const rows = lane_table(
+		  _mm_load_si128( reinterpret_cast<__m128i const *>( set.rows ) ) );
+		auto const bits = lane_table( sse42::high_nibble_bits( ) );
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const row = _mm256_shuffle_epi8(
+			  rows, _mm256_and_si256( input, _mm256_set1_epi8( 0x0F ) ) );
+			auto const bit = _mm256_shuffle_epi8( bits, high_nibbles( input ) );
+			auto const in = static_cast<uint32_t>( _mm256_movemask_epi8(
+			  _mm256_cmpeq_epi8( _mm256_and_si256( row, bit ), bit ) ) );
+			if( in != 0xFFFF'FFFFU ) {
+				return first + scalar::lowest_set_bit( ~in );
+			}
+			first += 32;
+		}
+		return sse42::find_not_in_set( set, first, last );
+	}
+
+	/// See sse42::ascii_case_bits
+	DAW_UTF8_TARGET_AVX2 inline __m256i ascii_case_bits( __m256i input,
+	                                                     uint8_t lo ) noexcept {
+		auto const moved = _mm256_add_epi8(
+		  input, _mm256_set1_epi8( static_cast<char>( 0x80U - lo ) ) );
+		auto const in =
+		  _mm256_cmpgt_epi8( _mm256_set1_epi8( -128 + 26 ), moved );
+		return _mm256_and_si256( in, _mm256_set1_epi8( 0x20 ) );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	ascii_case_map( char const *first, char const *last, char *out,
+	                bool upper ) noexcept {
+		auto const lo = static_cast<uint8_t>( upper ? 'a' : 'A' );
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			if( _mm256_movemask_epi8( input ) != 0 ) {
+				break;
+			}
+			_mm256_storeu_si256(
+			  reinterpret_cast<__m256i *>( out ),
+			  _mm256_xor_si256( input, ascii_case_bits( input, lo ) ) );
+			first += 32;
+			out += 32;
+		}
+		return sse42::ascii_case_map( first, last, out, upper );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline size_t
+	ascii_icase_prefix( char const *lhs, char const *rhs, size_t n ) noexcept {
+		size_t pos = 0;
+		for( ; n - pos >= 32; pos += 32 ) {
+			auto const l =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( lhs + pos ) );
+			auto const r =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( rhs + pos ) );
+			auto const same = _mm256_cmpeq_epi8(
+			  _mm256_or_si256( l, ascii_case_bits( l, 'A' ) ),
+			  _mm256_or_si256( r, ascii_case_bits( r, 'A' ) ) );
+			// Non-ASCII has the high bit set in l or r
+			auto const mismatch = ~static_cast<uint32_t>( _mm256_movemask_epi8(
+			                        same ) ) |
+			                      static_cast<uint32_t>( _mm256_movemask_epi8(
+			                        _mm256_or_si256( l, r ) ) );
+			if( mismatch != 0 ) {
+				return pos + scalar::lowest_set_bit( mismatch );
+			}
+		}
+		return pos + sse42::ascii_icase_prefix( lhs + pos, rhs + pos, n - pos );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	find_non_printable_ascii( char const *first, char const *last ) noexcept {
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const moved = _mm256_add_epi8( input, _mm256_set1_epi8( 0x60 ) );
+			auto const printable = static_cast<uint32_t>( _mm256_movemask_epi8(
+			  _mm256_cmpgt_epi8( _mm256_set1_epi8( -128 + 0x5F ), moved ) ) );
+			if( printable != 0xFFFF'FFFFU ) {
+				return first + scalar::lowest_set_bit( ~printable );
+			}
+			first += 32;
+		}
+		return sse42::find_non_printable_ascii( first, last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline char const *
+	advance_code_points( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		auto const max_trail = _mm256_set1_epi8( -65 );
+		while( last - first >= 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) );
+			auto const leads = static_cast<uint32_t>(
+			  _mm256_movemask_epi8( _mm256_cmpgt_epi8( input, max_trail ) ) );
+			auto const count = static_cast<size_t>( _mm_popcnt_u32( leads ) );
+			if( count > n ) {
+				return first + scalar::nth_set_bit( leads, n );
+			}
+			n -= count;
+			first += 32;
+		}
+		return sse42::advance_code_points( first, last, n );
+	}
+
+	/// The UTF-16 units of 32 bytes of valid UTF-8
+	DAW_UTF8_TARGET_AVX2 inline size_t utf16_units( __m256i input ) noexcept {
+		auto const leads = static_cast<uint32_t>( _mm256_movemask_epi8(
+		  _mm256_cmpgt_epi8( input, _mm256_set1_epi8( -65 ) ) ) );
+		auto const four = static_cast<uint32_t>(
+		  _mm256_movemask_epi8(
+		    _mm256_cmpgt_epi8( input, _mm256_set1_epi8( -17 ) ) ) &
+		  _mm256_movemask_epi8( input ) );
+		return static_cast<size_t>( _mm_popcnt_u32( leads ) +
+		                            _mm_popcnt_u32( four ) );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline size_t
+	utf8_utf16_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 32 ) {
+			result += utf16_units(
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) ) );
+			first += 32;
+		}
+		return result + sse42::utf8_utf16_length( first, last );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline advance_result
+	advance_utf16_units( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		while( last - first >= 32 ) {
+			auto const units = utf16_units(
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first ) ) );
+			if( units > n ) {
+				return scalar::advance_utf16_units( first, last, n );
+			}
+			n -= units;
+			first += 32;
+		}
+		return sse42::advance_utf16_units( first, last, n );
+	}
+
+	DAW_UTF8_TARGET_AVX2 inline line_masks scan_lines( char const *first,
+	                                                   size_t count ) noexcept {
+		auto result = line_masks{ 0, 0 };
+		size_t n = 0;
+		for( ; count - n >= 32; n += 32 ) {
+			auto const input =
+			  _mm256_loadu_si256( reinterpret_cast<__m256i const *>( first + n ) );
+			auto const newlines = static_cast<uint32_t>( _mm256_movemask_epi8(
+			  _mm256_cmpeq_epi8( input, _mm256_set1_epi8( '\n' ) ) ) );
+			auto const high =
+			  static_cast<uint32_t>( _mm256_movemask_epi8( input ) );
+			result.newlines |= static_cast<uint64_t>( newlines ) << n;
+			result.non_ascii |= static_cast<uint64_t>( high ) << n;
+		}
+		if( n != count ) {
+			auto const tail = sse42::scan_lines( first + n, count - n );
+			result.newlines |= tail.newlines << n;
+			result.non_ascii |= tail.non_ascii << n;
+		}
+		return result;
+	}
+} // namespace daw::utf8::simd::avx2
+
+#endif
@@ -0,0 +1,916 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../simd.h"
+#include "kernels_scalar.h"
+#include "kernels_sse42.h"
+
+#if defined( DAW_UTF8_X86_KERNELS )
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+// GCC 12 warns about the undefined vectors in its own AVX-512 intrinsics
+#if defined( __GNUC__ ) and not defined( __clang__ )
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+
+/// 64 byte kernels for CPUs with AVX-512 F, BW and VL.  Decoding works on 16
+/// byte windows, widening each byte to a 32 bit lane and compressing the
+/// lanes that hold a lead byte
+namespace daw::utf8::simd::avx512 {
+	DAW_UTF8_TARGET_AVX512 inline __m512i lane_table( __m128i table ) noexcept {
+		return _mm512_broadcast_i32x4( table );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline __m512i high_nibbles( __m512i v ) noexcept {
+		return _mm512_and_si512( _mm512_srli_epi16( v, 4 ),
+		                         _mm512_set1_epi8( 0x0F ) );
+	}
+
+	/// Mask with the low n bits set, n <= 64
+	DAW_UTF8_TARGET_AVX512 inline uint64_t low_mask( size_t n ) noexcept {
+		return _bzhi_u64( ~0ULL, static_cast<unsigned>( n ) );
+	}
+
+	/// The 64 bytes ending N bytes before the end of input
+	template<int N>
+	DAW_UTF8_TARGET_AVX512 inline __m512i prev( __m512i input,
+	                                            __m512i prev_input ) noexcept {
+		// Each 128 bit lane of shifted is the lane before it in input
+		auto const shifted = _mm512_alignr_epi64( input, prev_input, 6 );
+		return _mm512_alignr_epi8( input, shifted, 16 - N );
+	}
+
+	/// Non-zero lanes mark errors in input given the previous 64 bytes.  See
+	/// sse42::check_block
+	DAW_UTF8_TARGET_AVX512 inline __m512i
+	check_block( __m512i input, __m512i prev_input ) noexcept {
+		using namespace sse42::lookup;
+		auto const prev1 = prev<1>( input, prev_input );
+		auto const byte_1_high = _mm512_shuffle_epi8(
+		  lane_table( _mm_setr_epi8(
+		    too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+		    too_long, two_conts, two_conts, two_conts, two_conts,
+		    too_short | overlong_2, too_short, too_short | overlong_3 | surrogate,
+		    too_short | too_large | too_large_1000 | overlong_4 ) ),
+		  high_nibbles( prev1 ) );
+		auto const byte_1_low = _mm512_shuffle_epi8(
+		  lane_table( _mm_setr_epi8( carry | overlong_3 | overlong_2 | overlong_4,
+		                             carry | overlong_2, carry, carry,
+		                             carry | too_large,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000 | surrogate,
+		                             carry | too_large | too_large_1000,
+		                             carry | too_large | too_large_1000 ) ),
+		  _mm512_and_si512( prev1, _mm512_set1_epi8( 0x0F ) ) );
+		auto const byte_2_high = _mm512_shuffle_epi8(
+		  lane_table( _mm_setr_epi8(
+		    too_short, too_short, too_short, too_short, too_short, too_short,
+		    too_short, too_short,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+		      overlong_4,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large, too_short,
+		    too_short, too_short, too_short ) ),
+		  high_nibbles( input ) );
+		auto const special = _mm512_and_si512(
+		  _mm512_and_si512( byte_1_high, byte_1_low ), byte_2_high );
+		auto const is_third =
+		  _mm512_subs_epu8( prev<2>( input, prev_input ),
+		                    _mm512_set1_epi8( 0xE0 - 0x80 ) );
+		auto const is_fourth =
+		  _mm512_subs_epu8( prev<3>( input, prev_input ),
+		                    _mm512_set1_epi8( 0xF0 - 0x80 ) );
+		auto const must23 =
+		  _mm512_and_si512( _mm512_or_si512( is_third, is_fourth ),
+		                    _mm512_set1_epi8( static_cast<char>( 0x80 ) ) );
+		return _mm512_xor_si512( must23, special );
+	}
+
+	/// Non-zero lanes mark a lead byte in the last 3 bytes that needs more
+	/// bytes than remain in the block
+	DAW_UTF8_TARGET_AVX512 inline __m512i
+	is_incomplete( __m512i input ) noexcept {
+		// Only the top 3 bytes can be incomplete, the rest saturate to 0
+		auto const max_value = _mm512_mask_blend_epi8(
+		  0xE000'0000'0000'0000ULL, _mm512_set1_epi8( -1 ),
+		  lane_table( _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		                             -1, -1, static_cast<char>( 0xF0 - 1 ),
+		                             static_cast<char>( 0xE0 - 1 ),
+		                             static_cast<char>( 0xC0 - 1 ) ) ) );
+		return _mm512_subs_epu8( input, max_value );
+	}
+
+	/// Validation state carried from one block to the next
+	struct validator {
+		__m512i prev_input;
+		__m512i prev_incomplete;
+
+		/// True when input, or a sequence ending in it, is invalid
+		DAW_UTF8_TARGET_AVX512 inline bool has_error( __m512i input ) noexcept {
+			auto error = prev_incomplete;
+			if( _mm512_movepi8_mask( input ) == 0 ) {
+				prev_incomplete = _mm512_setzero_si512( );
+			} else {
+				error = check_block( input, prev_input );
+				prev_incomplete = is_incomplete( input );
+			}
+			prev_input = input;
+			return _mm512_test_epi8_mask( error, error ) != 0;
+		}
+	};
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	find_invalid( char const *const first, char const *const last ) noexcept {
+		auto it = first;
+		auto state = validator{ _mm512_setzero_si512( ), _mm512_setzero_si512( ) };
+		while( last - it >= 64 ) {
+			if( state.has_error( _mm512_loadu_si512( it ) ) ) {
+				return scalar::find_invalid( scalar::rescan_start( first, it ), last );
+			}
+			it += 64;
+		}
+		// The zero padding after the tail flags any sequence cut off by last
+		auto const tail = low_mask( static_cast<size_t>( last - it ) );
+		if( state.has_error( _mm512_maskz_loadu_epi8( tail, it ) ) ) {
+			return scalar::find_invalid( scalar::rescan_start( first, it ), last );
+		}
+		return last;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline size_t
+	count_code_points( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		auto const max_trail = _mm512_set1_epi8( -65 );
+		while( last - first >= 64 ) {
+			auto const input = _mm512_loadu_si512( first );
+			result += static_cast<size_t>(
+			  _mm_popcnt_u64( _mm512_cmpgt_epi8_mask( input, max_trail ) ) );
+			first += 64;
+		}
+		auto const tail = low_mask( static_cast<size_t>( last - first ) );
+		auto const input = _mm512_maskz_loadu_epi8( tail, first );
+		return result + static_cast<size_t>( _mm_popcnt_u64(
+		                  _mm512_cmpgt_epi8_mask( input, max_trail ) & tail ) );
+	}
+
+	/// Decode the code points whose lead byte is in [first, first + 16) into
+	/// 32 bit lanes, the lanes of lead bytes are set in leads.  Reads 19 bytes
+	struct window {
+		__m512i code_points;
+		__mmask16 leads;
+		__mmask16 four_byte;
+	};
+
+	/// 16 bytes from ptr, zero extended to 32 bits each
+	DAW_UTF8_TARGET_AVX512 inline __m512i load_widened( char const *ptr ) {
+		return _mm512_cvtepu8_epi32(
+		  _mm_loadu_si128( reinterpret_cast<__m128i const *>( ptr ) ) );
+	}
+
+	/// The payload bits of a lead byte shifted into place
+	template<int Mask, unsigned Shift>
+	DAW_UTF8_TARGET_AVX512 inline __m512i lead_bits( __m512i b0 ) {
+		return _mm512_slli_epi32(
+		  _mm512_and_si512( b0, _mm512_set1_epi32( Mask ) ), Shift );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline window decode_window( char const *first ) {
+		auto const b0 = load_widened( first );
+		auto const payload = _mm512_set1_epi32( 0x3F );
+		auto const c1 = _mm512_and_si512( load_widened( first + 1 ), payload );
+		auto const c2 = _mm512_and_si512( load_widened( first + 2 ), payload );
+		auto const c3 = _mm512_and_si512( load_widened( first + 3 ), payload );
+		auto const cp2 = _mm512_or_si512( lead_bits<0x1F, 6>( b0 ), c1 );
+		auto const cp3 = _mm512_or_si512(
+		  _mm512_or_si512( lead_bits<0x0F, 12>( b0 ), _mm512_slli_epi32( c1, 6 ) ),
+		  c2 );
+		auto const cp4 = _mm512_or_si512(
+		  _mm512_or_si512( lead_bits<0x07, 18>( b0 ),
+		                   _mm512_slli_epi32( c1, 12 ) ),
+		  _mm512_or_si512( _mm512_slli_epi32( c2, 6 ), c3 ) );
+		auto const m2 = _mm512_cmpge_epu32_mask( b0, _mm512_set1_epi32( 0xC0 ) );
+		auto const m3 = _mm512_cmpge_epu32_mask( b0, _mm512_set1_epi32( 0xE0 ) );
+		auto const m4 = _mm512_cmpge_epu32_mask( b0, _mm512_set1_epi32( 0xF0 ) );
+		auto cp = _mm512_mask_mov_epi32( b0, m2, cp2 );
+		cp = _mm512_mask_mov_epi32( cp, m3, cp3 );
+		cp = _mm512_mask_mov_epi32( cp, m4, cp4 );
+		auto const ascii =
+		  _mm512_cmplt_epu32_mask( b0, _mm512_set1_epi32( 0x80 ) );
+		return window{ cp, static_cast<__mmask16>( ascii | m2 ), m4 };
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline bool is_ascii_block( char const *first ) {
+		return _mm512_movepi8_mask( _mm512_loadu_si512( first ) ) == 0;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char16_t *
+	utf8to16( char const *first, char const *last, char16_t *out ) noexcept {
+		while( last - first >= 19 ) {
+			if( last - first >= 64 and is_ascii_block( first ) ) {
+				for( int n = 0; n < 2; ++n ) {
+					_mm512_storeu_si512(
+					  out + 32 * n,
+					  _mm512_cvtepu8_epi16( _mm256_loadu_si256(
+					    reinterpret_cast<__m256i const *>( first + 32 * n ) ) ) );
+				}
+				first += 64;
+				out += 64;
+				continue;
+			}
+			auto const w = decode_window( first );
+			if( w.four_byte == 0 ) {
+				auto const count = static_cast<size_t>( _mm_popcnt_u32( w.leads ) );
+				_mm512_mask_cvtepi32_storeu_epi16(
+				  out, static_cast<__mmask16>( low_mask( count ) ),
+				  _mm512_maskz_compress_epi32( w.leads, w.code_points ) );
+				out += count;
+			} else {
+				// Surrogate pairs, decode the leads in the window one at a time
+				auto it = first;
+				while( utf8::internal::is_trail( *it ) ) {
+					++it;
+				}
+				while( it < first + 16 ) {
+					auto const cp = utf8::unchecked::next( it );
+					if( cp > 0xFFFFU ) {
+						*out++ =
+						  static_cast<char16_t>( ( cp >> 10U ) + internal::LEAD_OFFSET );
+						*out++ = static_cast<char16_t>( ( cp & 0x3FFU ) +
+						                                internal::TRAIL_SURROGATE_MIN );
+					} else {
+						*out++ = static_cast<char16_t>( cp );
+					}
+				}
+			}
+			first += 16;
+		}
+		// The last window may have consumed the first bytes here
+		while( first != last and utf8::internal::is_trail( *first ) ) {
+			++first;
+		}
+		return scalar::utf8to16( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char32_t *
+	utf8to32( char const *first, char const *last, char32_t *out ) noexcept {
+		while( last - first >= 19 ) {
+			if( last - first >= 64 and is_ascii_block( first ) ) {
+				for( int n = 0; n < 4; ++n ) {
+					_mm512_storeu_si512(
+					  out + 16 * n,
+					  _mm512_cvtepu8_epi32( _mm_loadu_si128(
+					    reinterpret_cast<__m128i const *>( first + 16 * n ) ) ) );
+				}
+				first += 64;
+				out += 64;
+				continue;
+			}
+			auto const w = decode_window( first );
+			auto const count = static_cast<size_t>( _mm_popcnt_u32( w.leads ) );
+			_mm512_mask_storeu_epi32(
+			  out, static_cast<__mmask16>( low_mask( count ) ),
+			  _mm512_maskz_compress_epi32( w.leads, w.code_points ) );
+			out += count;
+			first += 16;
+		}
+		while( first != last and utf8::internal::is_trail( *first ) ) {
+			++first;
+		}
+		return scalar::utf8to32( first, last, out );
+	}
+
+	/// The UTF-8 of the code points in the lanes of cps, ending at the last
+	/// byte of each lane.  lengths is set to L - 1 per lane.  See
+	/// sse42::encode_bytes
+	DAW_UTF8_TARGET_AVX512 inline __m512i encode_bytes( __m512i cps,
+	                                                    __m512i &lengths ) noexcept {
+		// Lane bytes in output order are 0x80 | bits 18-20, 12-17, 6-11, 0-5
+		auto const fields = _mm512_or_si512(
+		  _mm512_or_si512(
+		    _mm512_and_si512( _mm512_slli_epi32( cps, 24 ),
+		                      _mm512_set1_epi32( 0x3F00'0000 ) ),
+		    _mm512_and_si512( _mm512_slli_epi32( cps, 10 ),
+		                      _mm512_set1_epi32( 0x003F'0000 ) ) ),
+		  _mm512_or_si512( _mm512_and_si512( _mm512_srli_epi32( cps, 4 ),
+		                                     _mm512_set1_epi32( 0x3F00 ) ),
+		                   _mm512_srli_epi32( cps, 18 ) ) );
+		auto const m2 = _mm512_cmpgt_epu32_mask( cps, _mm512_set1_epi32( 0x7F ) );
+		auto const m3 = _mm512_cmpgt_epu32_mask( cps, _mm512_set1_epi32( 0x7FF ) );
+		auto const m4 =
+		  _mm512_cmpgt_epu32_mask( cps, _mm512_set1_epi32( 0xFFFF ) );
+		// Turn the 0x80 of the lead into 0xC0, 0xE0 or 0xF0
+		auto const lead = _mm512_xor_si512(
+		  _mm512_xor_si512(
+		    _mm512_maskz_mov_epi32( m2, _mm512_set1_epi32( 0x0040'0000 ) ),
+		    _mm512_maskz_mov_epi32( m3, _mm512_set1_epi32( 0x0040'6000 ) ) ),
+		  _mm512_maskz_mov_epi32( m4, _mm512_set1_epi32( 0x6070 ) ) );
+		auto const one = _mm512_set1_epi32( 1 );
+		lengths = _mm512_add_epi32(
+		  _mm512_add_epi32( _mm512_maskz_mov_epi32( m2, one ),
+		                    _mm512_maskz_mov_epi32( m3, one ) ),
+		  _mm512_maskz_mov_epi32( m4, one ) );
+		return _mm512_mask_blend_epi32(
+		  m2, _mm512_slli_epi32( cps, 24 ),
+		  _mm512_xor_si512(
+		    _mm512_or_si512( fields, _mm512_set1_epi32( static_cast<int>(
+		                               0x8080'8080U ) ) ),
+		    lead ) );
+	}
+
+	/// Store the last L bytes of each lane of bytes, lengths holds L - 1 per
+	/// lane.  Each group of 4 lanes is packed by sse42::pack4, the last stores
+	/// 16 bytes
+	DAW_UTF8_TARGET_AVX512 inline char *pack16( __m512i bytes, __m512i lengths,
+	                                            char *out ) noexcept {
+		out = sse42::pack4( _mm512_castsi512_si128( bytes ),
+		                    _mm512_castsi512_si128( lengths ), out );
+		out = sse42::pack4( _mm512_extracti32x4_epi32( bytes, 1 ),
+		                    _mm512_extracti32x4_epi32( lengths, 1 ), out );
+		out = sse42::pack4( _mm512_extracti32x4_epi32( bytes, 2 ),
+		                    _mm512_extracti32x4_epi32( lengths, 2 ), out );
+		return sse42::pack4( _mm512_extracti32x4_epi32( bytes, 3 ),
+		                     _mm512_extracti32x4_epi32( lengths, 3 ), out );
+	}
+
+	/// The 16 UTF-16 units in the lanes of units as UTF-8, previous holds the
+	/// unit before each.  See sse42::encode4_utf16
+	DAW_UTF8_TARGET_AVX512 inline char *
+	encode16_utf16( __m512i units, __m512i previous, char *out ) noexcept {
+		__m512i lengths;
+		auto const bytes = encode_bytes( units, lengths );
+		auto const kind = _mm512_and_si512( units, _mm512_set1_epi32( 0xFC00 ) );
+		auto const leads =
+		  _mm512_cmpeq_epi32_mask( kind, _mm512_set1_epi32( 0xD800 ) );
+		auto const trails =
+		  _mm512_cmpeq_epi32_mask( kind, _mm512_set1_epi32( 0xDC00 ) );
+		// 11110www 10xxxxxx, the plane is the lead's bits 6-9 plus 1
+		auto const plane = _mm512_add_epi32( units, _mm512_set1_epi32( 0x40 ) );
+		auto const lead_bytes = _mm512_or_si512(
+		  _mm512_or_si512(
+		    _mm512_slli_epi32( _mm512_and_si512( _mm512_srli_epi32( plane, 8 ),
+		                                         _mm512_set1_epi32( 0x07 ) ),
+		                       16 ),
+		    _mm512_slli_epi32( _mm512_and_si512( _mm512_srli_epi32( plane, 2 ),
+		                                         _mm512_set1_epi32( 0x3F ) ),
+		                       24 ) ),
+		  _mm512_set1_epi32( static_cast<int>( 0x80F0'0000U ) ) );
+		// 10yyyyyy 10zzzzzz
+		auto const trail_bytes = _mm512_or_si512(
+		  _mm512_or_si512(
+		    _mm512_slli_epi32(
+		      _mm512_or_si512(
+		        _mm512_slli_epi32(
+		          _mm512_and_si512( previous, _mm512_set1_epi32( 0x03 ) ), 4 ),
+		        _mm512_and_si512( _mm512_srli_epi32( units, 6 ),
+		                          _mm512_set1_epi32( 0x0F ) ) ),
+		      16 ),
+		    _mm512_slli_epi32(
+		      _mm512_and_si512( units, _mm512_set1_epi32( 0x3F ) ), 24 ) ),
+		  _mm512_set1_epi32( static_cast<int>( 0x8080'0000U ) ) );
+		auto const surrogates = static_cast<__mmask16>( leads | trails );
+		return pack16(
+		  _mm512_mask_blend_epi32(
+		    leads, _mm512_mask_blend_epi32( trails, bytes, trail_bytes ),
+		    lead_bytes ),
+		  _mm512_mask_mov_epi32( lengths, surrogates, _mm512_set1_epi32( 1 ) ),
+		  out );
+	}
+
+	/// Non-ASCII blocks encode their first 16 units, the units after them
+	/// cover the 4 bytes the last group of 4 may store past its room
+	DAW_UTF8_TARGET_AVX512 inline char *
+	utf16to8( char16_t const *first, char16_t const *last, char *out ) noexcept {
+		auto const start = first;
+		auto const non_ascii = _mm512_set1_epi16( static_cast<short>( 0xFF80 ) );
+		while( last - first >= 32 ) {
+			auto const input = _mm512_loadu_si512( first );
+			if( _mm512_test_epi16_mask( input, non_ascii ) == 0 ) {
+				_mm512_mask_cvtepi16_storeu_epi8(
+				  out, static_cast<__mmask32>( 0xFFFF'FFFFU ), input );
+				first += 32;
+				out += 32;
+				continue;
+			}
+			// A trail surrogate at the start pairs with the unit before it
+			auto const before = first == start ? 0 : static_cast<int>( first[-1] );
+			auto const units =
+			  _mm512_cvtepu16_epi32( _mm512_castsi512_si256( input ) );
+			out = encode16_utf16(
+			  units, _mm512_alignr_epi32( units, _mm512_set1_epi32( before ), 15 ),
+			  out );
+			first += 16;
+		}
+		return sse42::utf16to8_tail( start, first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char *
+	utf32to8( char32_t const *first, char32_t const *last, char *out ) noexcept {
+		auto const non_ascii = _mm512_set1_epi32( ~0x7F );
+		while( last - first >= 16 ) {
+			auto const input = _mm512_loadu_si512( first );
+			if( _mm512_test_epi32_mask( input, non_ascii ) == 0 ) {
+				_mm512_mask_cvtepi32_storeu_epi8(
+				  out, static_cast<__mmask16>( 0xFFFFU ), input );
+				first += 16;
+				out += 16;
+				continue;
+			}
+			// 4 bytes of room per code point, the stores stay within it
+			__m512i lengths;
+			auto const bytes = encode_bytes( input, lengths );
+			out = pack16( bytes, lengths, out );
+			first += 16;
+		}
+		return scalar::utf32to8( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline size_t
+	latin1_utf8_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 64 ) {
+			auto const input = _mm512_loadu_si512( first );
+			result += 64U + static_cast<size_t>(
+			                  _mm_popcnt_u64( _mm512_movepi8_mask( input ) ) );
+			first += 64;
+		}
+		return result + scalar::latin1_utf8_length( first, last );
+	}
+
+	/// Each of 16 bytes is widened to a lead and a trail lane.  They are
+	/// interleaved into two vectors and the trails of the ASCII bytes are
+	/// compressed out
+	DAW_UTF8_TARGET_AVX512 inline char *
+	latin1to8( char const *first, char const *last, char *out ) noexcept {
+		auto const low_half = _mm512_setr_epi32( 0, 16, 1, 17, 2, 18, 3, 19, 4,
+		                                         20, 5, 21, 6, 22, 7, 23 );
+		auto const high_half = _mm512_setr_epi32(
+		  8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31 );
+		while( last - first >= 16 ) {
+			if( last - first >= 64 and is_ascii_block( first ) ) {
+				_mm512_storeu_si512( out, _mm512_loadu_si512( first ) );
+				first += 64;
+				out += 64;
+				continue;
+			}
+			auto const b = load_widened( first );
+			auto const non_ascii = static_cast<unsigned>(
+			  _mm512_cmpge_epu32_mask( b, _mm512_set1_epi32( 0x80 ) ) );
+			auto const lead = _mm512_mask_mov_epi32(
+			  b, static_cast<__mmask16>( non_ascii ),
+			  _mm512_or_si512( _mm512_srli_epi32( b, 6 ),
+			                   _mm512_set1_epi32( 0xC0 ) ) );
+			auto const trail = _mm512_or_si512(
+			  _mm512_and_si512( b, _mm512_set1_epi32( 0x3F ) ),
+			  _mm512_set1_epi32( 0x80 ) );
+			for( unsigned n = 0; n < 2; ++n ) {
+				auto const units = _mm512_permutex2var_epi32(
+				  lead, n == 0 ? low_half : high_half, trail );
+				// Every lead lane, and the trail lanes of bytes >= 0x80
+				auto const keep = static_cast<__mmask16>(
+				  0x5555U | _pdep_u32( ( non_ascii >> ( 8U * n ) ) & 0xFFU, 0xAAAAU ) );
+				auto const count = static_cast<size_t>( _mm_popcnt_u32( keep ) );
+				_mm512_mask_cvtepi32_storeu_epi8(
+				  out, static_cast<__mmask16>( low_mask( count ) ),
+				  _mm512_maskz_compress_epi32( keep, units ) );
+				out += count;
+			}
+			first += 16;
+		}
+		return scalar::latin1to8( first, last, out );
+	}
+
+	/// 16 byte windows as in utf8to32, with 0xC3 the largest lead allowed
+	DAW_UTF8_TARGET_AVX512 inline transcode_result
+	utf8tolatin1( char const *first, char const *last, char *out ) noexcept {
+		while( last - first >= 17 ) {
+			if( last - first >= 64 and is_ascii_block( first ) ) {
+				_mm512_storeu_si512( out, _mm512_loadu_si512( first ) );
+				first += 64;
+				out += 64;
+				continue;
+			}
+			auto const b0 = load_widened( first );
+			if( _mm512_cmpgt_epu32_mask( b0, _mm512_set1_epi32( 0xC3 ) ) != 0 ) {
+				break;
+			}
+			auto const c1 = _mm512_and_si512( load_widened( first + 1 ),
+			                                  _mm512_set1_epi32( 0x3F ) );
+			auto const leads =
+			  _mm512_cmpge_epu32_mask( b0, _mm512_set1_epi32( 0xC0 ) );
+			auto const ascii =
+			  _mm512_cmplt_epu32_mask( b0, _mm512_set1_epi32( 0x80 ) );
+			auto const cp = _mm512_mask_mov_epi32(
+			  b0, leads, _mm512_or_si512( lead_bits<0x03, 6>( b0 ), c1 ) );
+			auto const keep = static_cast<__mmask16>( ascii | leads );
+			auto const count = static_cast<size_t>( _mm_popcnt_u32( keep ) );
+			_mm512_mask_cvtepi32_storeu_epi8(
+			  out, static_cast<__mmask16>( low_mask( count ) ),
+			  _mm512_maskz_compress_epi32( keep, cp ) );
+			out += count;
+			first += 16;
+		}
+		// The last window may have consumed the first bytes here
+		while( first != last and utf8::internal::is_trail( *first ) ) {
+			++first;
+		}
+		return scalar::utf8tolatin1( first, last, out );
+	}
+
+	/// See sse42::candidates
+	DAW_UTF8_TARGET_AVX512 inline uint64_t
+	candidates( char const *it, size_t last_offset, __m512i first_byte,
+	            __m512i last_byte ) noexcept {
+		return _mm512_cmpeq_epi8_mask( _mm512_loadu_si512( it ), first_byte ) &
+		       _mm512_cmpeq_epi8_mask( _mm512_loadu_si512( it + last_offset ),
+		                               last_byte );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	find_substring( char const *first, char const *last, char const *needle,
+	                char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 ) {
+			return first;
+		}
+		auto const first_byte = _mm512_set1_epi8( needle[0] );
+		auto const last_byte = _mm512_set1_epi8( needle[n - 1] );
+		auto it = first;
+		while( static_cast<size_t>( last - it ) >= n + 63 ) {
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			while( mask != 0 ) {
+				auto const pos = it + _tzcnt_u64( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					return pos;
+				}
+				mask = _blsr_u64( mask );
+			}
+			it += 64;
+		}
+		return sse42::find_substring( it, last, needle, needle_last );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	rfind_substring( char const *first, char const *last, char const *needle,
+	                 char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 or static_cast<size_t>( last - first ) < n ) {
+			return last;
+		}
+		auto const first_byte = _mm512_set1_epi8( needle[0] );
+		auto const last_byte = _mm512_set1_epi8( needle[n - 1] );
+		auto end = last - ( n - 1 );
+		while( end - first >= 64 ) {
+			auto const it = end - 64;
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			char const *result = nullptr;
+			while( mask != 0 ) {
+				auto const pos = it + _tzcnt_u64( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					result = pos;
+				}
+				mask = _blsr_u64( mask );
+			}
+			if( result != nullptr ) {
+				return result;
+			}
+			end = it;
+		}
+		auto const result =
+		  sse42::rfind_substring( first, end + ( n - 1 ), needle, needle_last );
+		return result == end + ( n - 1 ) ? last : result;
+	}
+
+	/// See sse42::teddy_lanes
+	template<unsigned Length>
+	DAW_UTF8_TARGET_AVX512 inline __m512i
+	teddy_lanes( teddy_masks const &masks, char const *it ) noexcept {
+		auto const nibble = _mm512_set1_epi8( 0x0F );
+		auto result = _mm512_set1_epi8( -1 );
+		for( unsigned k = 0; k < Length; ++k ) {
+			auto const input = _mm512_loadu_si512( it + k );
+			auto const lo = _mm512_shuffle_epi8(
+			  lane_table( _mm_load_si128(
+			    reinterpret_cast<__m128i const *>( masks.lo[k] ) ) ),
+			  _mm512_and_si512( input, nibble ) );
+			auto const hi = _mm512_shuffle_epi8(
+			  lane_table( _mm_load_si128(
+			    reinterpret_cast<__m128i const *>( masks.hi[k] ) ) ),
+			  _mm512_and_si512( _mm512_srli_epi16( input, 4 ), nibble ) );
+			result = _mm512_and_si512( result, _mm512_and_si512( lo, hi ) );
+		}
+		return result;
+	}
+
+	template<unsigned Length>
+	DAW_UTF8_TARGET_AVX512 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		while( last - first >= static_cast<std::ptrdiff_t>( 63 + Length ) ) {
+			auto const block = teddy_lanes<Length>( masks, first );
+			auto const candidates = _mm512_test_epi8_mask( block, block );
+			if( candidates != 0 ) {
+				_mm512_storeu_si512( buckets, block );
+				return { first, 64, candidates };
+			}
+			first += 64;
+		}
+		return sse42::teddy_find<Length>( masks, first, last, buckets );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		switch( masks.length ) {
+		case 1:
+			return teddy_find<1>( masks, first, last, buckets );
+		case 2:
+			return teddy_find<2>( masks, first, last, buckets );
+		default:
+			return teddy_find<3>( masks, first, last, buckets );
+		}
+	}
+
+	/// Lead and trail surrogate masks of up to 64 UTF-16 units, units at or
+	/// after count are treated as not being surrogates
+	struct surrogate_masks {
+		uint64_t leads;
+		uint64_t trails;
+	};
+
+	constexpr uint64_t join_masks( uint32_t lo, uint32_t hi ) noexcept {
+		return static_cast<uint64_t>( lo ) | ( static_cast<uint64_t>( hi ) << 32U );
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX512 inline surrogate_masks
+	load_surrogates( char16_t const *ptr, size_t count ) noexcept {
+		using c = sse42::utf16_constants<BigEndian>;
+		auto const in_range = low_mask( count );
+		auto const mask = _mm512_set1_epi16( c::mask );
+		auto const a = _mm512_and_si512(
+		  _mm512_maskz_loadu_epi16( static_cast<__mmask32>( in_range ), ptr ),
+		  mask );
+		auto const b = _mm512_and_si512(
+		  _mm512_maskz_loadu_epi16( static_cast<__mmask32>( in_range >> 32U ),
+		                            ptr + 32 ),
+		  mask );
+		auto const lead = _mm512_set1_epi16( c::lead );
+		auto const trail = _mm512_set1_epi16( c::trail );
+		return { join_masks( _mm512_cmpeq_epi16_mask( a, lead ),
+		                     _mm512_cmpeq_epi16_mask( b, lead ) ) &
+		           in_range,
+		         join_masks( _mm512_cmpeq_epi16_mask( a, trail ),
+		                     _mm512_cmpeq_epi16_mask( b, trail ) ) &
+		           in_range };
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX512 inline char16_t const *
+	find_invalid_utf16( char16_t const *const first,
+	                    char16_t const *const last ) noexcept {
+		auto it = first;
+		uint64_t carry = 0;
+		while( it != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - it ), 64U );
+			auto const m = load_surrogates<BigEndian>( it, count );
+			// A lead in the last unit of the input has no trail
+			auto const open = count < 64 ? m.leads >> ( count - 1U ) : 0U;
+			if( ( ( m.leads << 1U ) | carry ) != m.trails or open != 0 ) {
+				return scalar::find_invalid_utf16<BigEndian>(
+				  it - static_cast<std::ptrdiff_t>( carry ), last );
+			}
+			carry = m.leads >> 63U;
+			it += count;
+		}
+		if( carry != 0 ) {
+			return last - 1;
+		}
+		return last;
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_AVX512 inline size_t
+	utf16_count_code_points( char16_t const *first,
+	                         char16_t const *last ) noexcept {
+		auto result = static_cast<size_t>( last - first );
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const m = load_surrogates<BigEndian>( first, count );
+			result -= static_cast<size_t>( _mm_popcnt_u64( m.trails ) );
+			first += count;
+		}
+		return result;
+	}
+
+	/// The tail is a masked load, bytes past last read as zero
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	find_non_ascii( char const *first, char const *last ) noexcept {
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const high = _mm512_movepi8_mask(
+			  _mm512_maskz_loadu_epi8( low_mask( count ), first ) );
+			if( high != 0 ) {
+				return first + scalar::lowest_set_bit( high );
+			}
+			first += count;
+		}
+		return last;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	find_not_in_set( byte_set const &set, char const *first,
+	                 char const *last ) noexcept {
+		auto const rows = lane_table(
+		  _mm_load_si128( reinterpret_cast<__m128i const *>( set.rows ) ) );
+		auto const bits = lane_table( sse42::high_nibble_bits( ) );
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			// Bytes past last read as zero, which is in the set
+			auto const input = _mm512_maskz_loadu_epi8( low_mask( count ), first );
+			auto const row = _mm512_shuffle_epi8(
+			  rows, _mm512_and_si512( input, _mm512_set1_epi8( 0x0F ) ) );
+			auto const bit = _mm512_shuffle_epi8( bits, high_nibbles( input ) );
+			auto const out = _mm512_cmpneq_epi8_mask(
+			  _mm512_and_si512( row, bit ), bit );
+			if( out != 0 ) {
+				return first + scalar::lowest_set_bit( out );
+			}
+			first += count;
+		}
+		return last;
+	}
+
+	/// The mask of the bytes of input in [lo, lo + 26)
+	DAW_UTF8_TARGET_AVX512 inline __mmask64
+	ascii_case_mask( __m512i input, uint8_t lo ) noexcept {
+		return _mm512_cmplt_epu8_mask(
+		  _mm512_sub_epi8( input, _mm512_set1_epi8( static_cast<char>( lo ) ) ),
+		  _mm512_set1_epi8( 26 ) );
+	}
+
+	/// The tail is a masked load and store
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	ascii_case_map( char const *first, char const *last, char *out,
+	                bool upper ) noexcept {
+		auto const lo = static_cast<uint8_t>( upper ? 'a' : 'A' );
+		auto const bit = _mm512_set1_epi8( 0x20 );
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const input = _mm512_maskz_loadu_epi8( low_mask( count ), first );
+			auto const high = _mm512_movepi8_mask( input );
+			auto const ascii =
+			  high == 0 ? count : scalar::lowest_set_bit( high );
+			auto const result = _mm512_xor_si512(
+			  input, _mm512_maskz_mov_epi8( ascii_case_mask( input, lo ), bit ) );
+			_mm512_mask_storeu_epi8( out, low_mask( ascii ), result );
+			first += ascii;
+			out += ascii;
+			if( ascii != count ) {
+				break;
+			}
+		}
+		return first;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline size_t
+	ascii_icase_prefix( char const *lhs, char const *rhs, size_t n ) noexcept {
+		auto const bit = _mm512_set1_epi8( 0x20 );
+		size_t pos = 0;
+		while( pos != n ) {
+			auto const count = std::min<size_t>( n - pos, 64U );
+			auto const mask = low_mask( count );
+			auto const l = _mm512_maskz_loadu_epi8( mask, lhs + pos );
+			auto const r = _mm512_maskz_loadu_epi8( mask, rhs + pos );
+			auto const lf = _mm512_or_si512(
+			  l, _mm512_maskz_mov_epi8( ascii_case_mask( l, 'A' ), bit ) );
+			auto const rf = _mm512_or_si512(
+			  r, _mm512_maskz_mov_epi8( ascii_case_mask( r, 'A' ), bit ) );
+			// Bytes past n read as zero in both and match
+			auto const mismatch =
+			  _mm512_cmpneq_epi8_mask( lf, rf ) |
+			  _mm512_movepi8_mask( _mm512_or_si512( l, r ) );
+			if( mismatch != 0 ) {
+				return pos + scalar::lowest_set_bit( mismatch );
+			}
+			pos += count;
+		}
+		return n;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	find_non_printable_ascii( char const *first, char const *last ) noexcept {
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const mask = low_mask( count );
+			auto const input = _mm512_maskz_loadu_epi8( mask, first );
+			auto const other = _mm512_mask_cmpge_epu8_mask(
+			  mask, _mm512_sub_epi8( input, _mm512_set1_epi8( 0x20 ) ),
+			  _mm512_set1_epi8( 0x5F ) );
+			if( other != 0 ) {
+				return first + scalar::lowest_set_bit( other );
+			}
+			first += count;
+		}
+		return last;
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline char const *
+	advance_code_points( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		auto const max_trail = _mm512_set1_epi8( -65 );
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const mask = low_mask( count );
+			auto const leads = _mm512_mask_cmpgt_epi8_mask(
+			  mask, _mm512_maskz_loadu_epi8( mask, first ), max_trail );
+			auto const lead_count = static_cast<size_t>( _mm_popcnt_u64( leads ) );
+			if( lead_count > n ) {
+				return first + scalar::nth_set_bit( leads, n );
+			}
+			n -= lead_count;
+			first += count;
+		}
+		return last;
+	}
+
+	/// The UTF-16 units of the bytes of valid UTF-8 at first in mask
+	DAW_UTF8_TARGET_AVX512 inline size_t utf16_units( char const *first,
+	                                                  uint64_t mask ) noexcept {
+		auto const input = _mm512_maskz_loadu_epi8( mask, first );
+		auto const leads =
+		  _mm512_mask_cmpgt_epi8_mask( mask, input, _mm512_set1_epi8( -65 ) );
+		auto const four =
+		  _mm512_mask_cmpge_epu8_mask( mask, input, _mm512_set1_epi8( -16 ) );
+		return static_cast<size_t>( _mm_popcnt_u64( leads ) +
+		                            _mm_popcnt_u64( four ) );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline size_t
+	utf8_utf16_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 64 ) {
+			result += utf16_units( first, ~uint64_t{ 0 } );
+			first += 64;
+		}
+		auto const tail = low_mask( static_cast<size_t>( last - first ) );
+		return result + utf16_units( first, tail );
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline advance_result
+	advance_utf16_units( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		while( first != last ) {
+			auto const count = std::min<size_t>(
+			  static_cast<size_t>( last - first ), 64U );
+			auto const units = utf16_units( first, low_mask( count ) );
+			if( units > n ) {
+				return scalar::advance_utf16_units( first, last, n );
+			}
+			n -= units;
+			first += count;
+		}
+		return { last, n };
+	}
+
+	DAW_UTF8_TARGET_AVX512 inline line_masks scan_lines( char const *first,
+	                                                     size_t count ) noexcept {
+		auto const mask = low_mask( count );
+		auto const input = _mm512_maskz_loadu_epi8( mask, first );
+		return { _mm512_mask_cmpeq_epi8_mask( mask, input,
+		                                      _mm512_set1_epi8( '\n' ) ),
+		         _mm512_movepi8_mask( input ) };
+	}
+} // namespace daw::utf8::simd::avx512
+
+#if defined( __GNUC__ ) and not defined( __clang__ )
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,616 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../core.h"
+#include "../simd.h"
+#include "../unchecked.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/// Portable kernels.  These are the fallback for every tier and handle the
+/// tails that are shorter than a vector.  Transcoding and counting assume
+/// valid input, as the utf8::unchecked functions do
+namespace daw::utf8::simd::scalar {
+	constexpr uint64_t high_bits = 0x8080'8080'8080'8080ULL;
+
+	inline uint64_t load64( void const *ptr ) noexcept {
+		uint64_t result;
+		std::memcpy( &result, ptr, sizeof( result ) );
+		return result;
+	}
+
+	constexpr size_t popcount( uint64_t v ) noexcept {
+		v = v - ( ( v >> 1U ) & 0x5555'5555'5555'5555ULL );
+		v = ( v & 0x3333'3333'3333'3333ULL ) +
+		    ( ( v >> 2U ) & 0x3333'3333'3333'3333ULL );
+		v = ( v + ( v >> 4U ) ) & 0x0F0F'0F0F'0F0F'0F0FULL;
+		return static_cast<size_t>( ( v * 0x0101'0101'0101'0101ULL ) >> 56U );
+	}
+
+	/// Index of the lowest set bit of v, v != 0
+	inline unsigned lowest_set_bit( uint64_t v ) noexcept {
+#if defined( __GNUC__ ) or defined( __clang__ )
+		return static_cast<unsigned>( __builtin_ctzll( v ) );
+#else
+		unsigned result = 0;
+		for( ; ( v & 1U ) == 0; v >>= 1U ) {
+			++result;
+		}
+		return result;
+#endif
+	}
+
+	/// The start of the code point that is open at pos, or pos when the bytes
+	/// before it end on a code point boundary.  The bytes before pos must have
+	/// already been validated.  Vector kernels use this to end a block on a code
+	/// point boundary
+	inline char const *sequence_start( char const *first,
+	                                   char const *pos ) noexcept {
+		for( std::ptrdiff_t n = 1; n <= 3 and pos - n >= first; ++n ) {
+			auto const lead = pos - n;
+			if( not utf8::internal::is_trail( *lead ) ) {
+				return utf8::internal::sequence_length( lead ) > n ? lead : pos;
+			}
+		}
+		return pos;
+	}
+
+	/// Where to rescan from after a vector kernel flags the block at pos.  An
+	/// error can start in the last 3 bytes before pos, so back up to the code
+	/// point boundary before them
+	inline char const *rescan_start( char const *first,
+	                                 char const *pos ) noexcept {
+		auto result = pos - first > 3 ? pos - 3 : first;
+		for( int n = 0;
+		     n < 3 and result != first and utf8::internal::is_trail( *result );
+		     ++n ) {
+			--result;
+		}
+		return result;
+	}
+
+	inline char const *find_invalid( char const *first,
+	                                 char const *last ) noexcept {
+		while( first != last ) {
+			while( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				first += 8;
+			}
+			if( first == last ) {
+				break;
+			}
+			auto it = first;
+			if( utf8::internal::validate_next( it, last ) !=
+			    utf8::internal::utf_error::UTF8_OK ) {
+				return first;
+			}
+			first = it;
+		}
+		return first;
+	}
+
+	/// Count the bytes that are not continuation bytes, eight at a time
+	inline size_t count_code_points( char const *first,
+	                                 char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 8 ) {
+			auto const w = load64( first );
+			// bit 7 of a byte is set when it is 10xxxxxx
+			auto const trail = w & ~( w << 1U ) & high_bits;
+			result += 8U - popcount( trail );
+			first += 8;
+		}
+		for( ; first != last; ++first ) {
+			result += utf8::internal::is_trail( *first ) ? 0U : 1U;
+		}
+		return result;
+	}
+
+	inline char16_t *utf8to16( char const *first, char const *last,
+	                           char16_t *out ) noexcept {
+		while( first != last ) {
+			if( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				for( int n = 0; n < 8; ++n ) {
+					*out++ = static_cast<char16_t>( *first++ );
+				}
+				continue;
+			}
+			auto const cp = utf8::unchecked::next( first );
+			if( cp > 0xFFFFU ) {
+				*out++ =
+				  static_cast<char16_t>( ( cp >> 10U ) + internal::LEAD_OFFSET );
+				*out++ = static_cast<char16_t>( ( cp & 0x3FFU ) +
+				                                internal::TRAIL_SURROGATE_MIN );
+			} else {
+				*out++ = static_cast<char16_t>( cp );
+			}
+		}
+		return out;
+	}
+
+	inline char32_t *utf8to32( char const *first, char const *last,
+	                           char32_t *out ) noexcept {
+		while( first != last ) {
+			if( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				for( int n = 0; n < 8; ++n ) {
+					*out++ = static_cast<char32_t>( *first++ );
+				}
+				continue;
+			}
+			*out++ = static_cast<char32_t>( utf8::unchecked::next( first ) );
+		}
+		return out;
+	}
+
+	inline char *utf16to8( char16_t const *first, char16_t const *last,
+	                       char *out ) noexcept {
+		return utf8::unchecked::utf16to8( first, last, out );
+	}
+
+	inline char *utf32to8( char32_t const *first, char32_t const *last,
+	                       char *out ) noexcept {
+		return utf8::unchecked::utf32to8( first, last, out );
+	}
+
+	/// UTF-8 bytes for Latin-1, one more than the input for each byte >= 0x80
+	inline size_t latin1_utf8_length( char const *first,
+	                                  char const *last ) noexcept {
+		auto result = static_cast<size_t>( last - first );
+		while( last - first >= 8 ) {
+			result += popcount( load64( first ) & high_bits );
+			first += 8;
+		}
+		for( ; first != last; ++first ) {
+			result += static_cast<uint8_t>( *first ) >= 0x80U ? 1U : 0U;
+		}
+		return result;
+	}
+
+	inline char *latin1to8( char const *first, char const *last,
+	                        char *out ) noexcept {
+		while( first != last ) {
+			if( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				std::memcpy( out, first, 8 );
+				first += 8;
+				out += 8;
+				continue;
+			}
+			auto const b = static_cast<uint8_t>( *first++ );
+			if( b < 0x80U ) {
+				*out++ = static_cast<char>( b );
+			} else {
+				*out++ = static_cast<char>( 0xC0U | ( b >> 6U ) );
+				*out++ = static_cast<char>( 0x80U | ( b & 0x3FU ) );
+			}
+		}
+		return out;
+	}
+
+	/// Narrow valid UTF-8 to Latin-1, stopping at the lead of the first code
+	/// point above U+FF
+	inline transcode_result utf8tolatin1( char const *first, char const *last,
+	                                      char *out ) noexcept {
+		while( first != last ) {
+			if( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				std::memcpy( out, first, 8 );
+				first += 8;
+				out += 8;
+				continue;
+			}
+			auto const lead = static_cast<uint8_t>( *first );
+			if( lead < 0x80U ) {
+				*out++ = *first++;
+				continue;
+			}
+			// Only 0xC2 and 0xC3 lead a code point below U+100
+			if( lead > 0xC3U ) {
+				break;
+			}
+			auto const trail = static_cast<uint8_t>( first[1] );
+			*out++ = static_cast<char>( ( ( lead & 0x03U ) << 6U ) |
+			                            ( trail & 0x3FU ) );
+			first += 2;
+		}
+		return { first, out };
+	}
+
+	/// True when the n bytes of the needle at it match, the first and last
+	/// have already been compared
+	inline bool matches_inner( char const *it, char const *needle,
+	                           size_t n ) noexcept {
+		return n <= 2 or std::memcmp( it + 1, needle + 1, n - 2 ) == 0;
+	}
+
+	/// The first occurrence of [needle, needle_last) in [first, last), last
+	/// when there is none.  An empty needle is found at first
+	inline char const *find_substring( char const *first, char const *last,
+	                                   char const *needle,
+	                                   char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 ) {
+			return first;
+		}
+		if( static_cast<size_t>( last - first ) < n ) {
+			return last;
+		}
+		auto const end = last - ( n - 1 );
+		auto it = first;
+		while( it != end ) {
+			auto const found = std::memchr( it, static_cast<unsigned char>( *needle ),
+			                                static_cast<size_t>( end - it ) );
+			if( found == nullptr ) {
+				break;
+			}
+			it = static_cast<char const *>( found );
+			if( it[n - 1] == needle[n - 1] and matches_inner( it, needle, n ) ) {
+				return it;
+			}
+			++it;
+		}
+		return last;
+	}
+
+	/// The last occurrence of [needle, needle_last) in [first, last), last
+	/// when there is none.  An empty needle is found at last
+	inline char const *rfind_substring( char const *first, char const *last,
+	                                    char const *needle,
+	                                    char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 or static_cast<size_t>( last - first ) < n ) {
+			return last;
+		}
+		for( auto it = last - n + 1; it != first; ) {
+			--it;
+			if( it[0] == needle[0] and it[n - 1] == needle[n - 1] and
+			    matches_inner( it, needle, n ) ) {
+				return it;
+			}
+		}
+		return last;
+	}
+
+	/// Buckets whose patterns may start at it, it + masks.length <= last
+	inline uint8_t teddy_buckets( teddy_masks const &masks,
+	                              char const *it ) noexcept {
+		unsigned result = 0xFFU;
+		for( unsigned k = 0; k < masks.length; ++k ) {
+			auto const b = static_cast<uint8_t>( it[k] );
+			result &= masks.lo[k][b & 0x0FU] & masks.hi[k][b >> 4U];
+		}
+		return static_cast<uint8_t>( result );
+	}
+
+	/// The first block of positions in [first, last) holding one where a
+	/// pattern may start, the position is last when there is none
+	inline teddy_block teddy_find( teddy_masks const &masks, char const *first,
+	                               char const *last,
+	                               uint8_t *buckets ) noexcept {
+		if( static_cast<size_t>( last - first ) >= masks.length ) {
+			auto const end = last - ( masks.length - 1 );
+			for( ; first != end; ++first ) {
+				buckets[0] = teddy_buckets( masks, first );
+				if( buckets[0] != 0 ) {
+					return { first, 1, 1 };
+				}
+			}
+		}
+		return { last, 0, 0 };
+	}
+
+	/// A UTF-16 unit stored in BigEndian or little endian byte order
+	template<bool BigEndian>
+	constexpr uint16_t load_utf16( char16_t const *ptr ) noexcept {
+		auto const unit = static_cast<uint16_t>( *ptr );
+		if constexpr( BigEndian != big_endian_host ) {
+			return static_cast<uint16_t>( ( unit >> 8U ) | ( unit << 8U ) );
+		} else {
+			return unit;
+		}
+	}
+
+	/// True when none of the 4 units in w are surrogates.  The mask is applied
+	/// to the units as stored, so it is byte swapped for the other byte order
+	template<bool BigEndian>
+	constexpr bool no_surrogates( uint64_t w ) noexcept {
+		constexpr bool swap = BigEndian != big_endian_host;
+		constexpr uint64_t mask =
+		  swap ? 0x00F8'00F8'00F8'00F8ULL : 0xF800'F800'F800'F800ULL;
+		constexpr uint64_t surrogate =
+		  swap ? 0x00D8'00D8'00D8'00D8ULL : 0xD800'D800'D800'D800ULL;
+		// A unit of y is zero when that unit is a surrogate
+		auto const y = ( w & mask ) ^ surrogate;
+		auto const zero =
+		  ( y - 0x0001'0001'0001'0001ULL ) & ~y & 0x8000'8000'8000'8000ULL;
+		return zero == 0;
+	}
+
+	/// The first lone or misordered surrogate in [first, last), last when it
+	/// is all valid UTF-16
+	template<bool BigEndian>
+	inline char16_t const *find_invalid_utf16( char16_t const *first,
+	                                           char16_t const *last ) noexcept {
+		while( first != last ) {
+			while( last - first >= 4 and
+			       no_surrogates<BigEndian>( load64( first ) ) ) {
+				first += 4;
+			}
+			if( first == last ) {
+				break;
+			}
+			auto const unit = load_utf16<BigEndian>( first );
+			if( utf8::internal::is_lead_surrogate( unit ) ) {
+				if( last - first < 2 or not utf8::internal::is_trail_surrogate(
+				                          load_utf16<BigEndian>( first + 1 ) ) ) {
+					return first;
+				}
+				first += 2;
+			} else if( utf8::internal::is_trail_surrogate( unit ) ) {
+				return first;
+			} else {
+				++first;
+			}
+		}
+		return first;
+	}
+
+	/// Count the units that are not trail surrogates
+	template<bool BigEndian>
+	inline size_t utf16_count_code_points( char16_t const *first,
+	                                       char16_t const *last ) noexcept {
+		size_t result = static_cast<size_t>( last - first );
+		while( last - first >= 4 ) {
+			if( not no_surrogates<BigEndian>( load64( first ) ) ) {
+				for( int n = 0; n < 4; ++n ) {
+					result -= utf8::internal::is_trail_surrogate(
+					            load_utf16<BigEndian>( first + n ) )
+					            ? 1U
+					            : 0U;
+				}
+			}
+			first += 4;
+		}
+		for( ; first != last; ++first ) {
+			result -=
+			  utf8::internal::is_trail_surrogate( load_utf16<BigEndian>( first ) )
+			    ? 1U
+			    : 0U;
+		}
+		return result;
+	}
+
+	/// The first byte >= 0x80 in [first, last), last when there is none
+	inline char const *find_non_ascii( char const *first,
+	                                   char const *last ) noexcept {
+		while( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+			first += 8;
+		}
+		while( first != last and static_cast<uint8_t>( *first ) < 0x80U ) {
+			++first;
+		}
+		return first;
+	}
+
+	/// The first byte of [first, last) that is not in set
+	inline char const *find_not_in_set( byte_set const &set, char const *first,
+	                                    char const *last ) noexcept {
+		while( first != last ) {
+			if( last - first >= 8 and ( load64( first ) & high_bits ) == 0 ) {
+				first += 8;
+				continue;
+			}
+			if( not set.contains( static_cast<uint8_t>( *first ) ) ) {
+				break;
+			}
+			++first;
+		}
+		return first;
+	}
+
+	/// 0x20 in each byte of the ASCII word that is in [lo, lo + 26)
+	constexpr uint64_t ascii_case_bits( uint64_t word, uint8_t lo ) noexcept {
+		constexpr uint64_t ones = 0x0101'0101'0101'0101ULL;
+		auto const from = word + ones * ( 0x80U - lo );
+		auto const to = word + ones * ( 0x80U - lo - 26U );
+		return ( ( from ^ to ) & high_bits ) >> 2U;
+	}
+
+	/// Copy the ASCII bytes at the start of [first, last) to out, as upper
+	/// case or as lower case, which is also their case folding.  Returns
+	/// where the copy stopped, the first byte >= 0x80 or last
+	inline char const *ascii_case_map( char const *first, char const *last,
+	                                   char *out, bool upper ) noexcept {
+		auto const lo = static_cast<uint8_t>( upper ? 'a' : 'A' );
+		while( last - first >= 8 ) {
+			auto const word = load64( first );
+			if( ( word & high_bits ) != 0 ) {
+				break;
+			}
+			auto const result = word ^ ascii_case_bits( word, lo );
+			std::memcpy( out, &result, 8 );
+			first += 8;
+			out += 8;
+		}
+		for( ; first != last; ++first ) {
+			auto const b = static_cast<uint8_t>( *first );
+			if( b >= 0x80U ) {
+				break;
+			}
+			*out++ = static_cast<char>(
+			  static_cast<uint8_t>( b - lo ) < 26U ? b ^ 0x20U : b );
+		}
+		return first;
+	}
+
+	/// The length of the start of the n bytes at lhs and rhs that is ASCII
+	/// and equal ignoring case
+	inline size_t ascii_icase_prefix( char const *lhs, char const *rhs,
+	                                  size_t n ) noexcept {
+		size_t pos = 0;
+		for( ; n - pos >= 8; pos += 8 ) {
+			auto const l = load64( lhs + pos );
+			auto const r = load64( rhs + pos );
+			if( ( ( l | r ) & high_bits ) != 0 or
+			    ( l | ascii_case_bits( l, 'A' ) ) !=
+			      ( r | ascii_case_bits( r, 'A' ) ) ) {
+				break;
+			}
+		}
+		for( ; pos != n; ++pos ) {
+			auto const l = static_cast<uint8_t>( lhs[pos] );
+			auto const r = static_cast<uint8_t>( rhs[pos] );
+			if( ( l | r ) >= 0x80U or
+			    ( static_cast<uint8_t>( l - 'A' ) < 26U ? l | 0x20U : l ) !=
+			      ( static_cast<uint8_t>( r - 'A' ) < 26U ? r | 0x20U : r ) ) {
+				break;
+			}
+		}
+		return pos;
+	}
+
+	/// The first byte of [first, last) that is not printable ASCII, 0x20 to
+	/// 0x7E
+	inline char const *find_non_printable_ascii( char const *first,
+	                                             char const *last ) noexcept {
+		constexpr uint64_t ones = 0x0101'0101'0101'0101ULL;
+		while( last - first >= 8 ) {
+			auto const word = load64( first );
+			// The high bit of a byte of below is set when it is below 0x20 and
+			// of above when it is 0x7F, as neither overflows into the next
+			// byte once the bytes >= 0x80 are excluded
+			auto const below = ( word & ~high_bits ) + ones * ( 0x80U - 0x20U );
+			auto const above = ( word & ~high_bits ) + ones;
+			if( ( ( word | ~below | above ) & high_bits ) != 0 ) {
+				break;
+			}
+			first += 8;
+		}
+		while( first != last and
+		       static_cast<uint8_t>( *first - 0x20 ) < 0x5FU ) {
+			++first;
+		}
+		return first;
+	}
+
+	/// Index of set bit n of v, counting from 0, v has more than n set
+	inline unsigned nth_set_bit( uint64_t v, size_t n ) noexcept {
+		for( ; n != 0; --n ) {
+			v &= v - 1U;
+		}
+		return lowest_set_bit( v );
+	}
+
+	/// The position n code points after first in valid UTF-8, last when
+	/// there are not that many
+	inline char const *advance_code_points( char const *first, char const *last,
+	                                        size_t n ) noexcept {
+		while( last - first >= 8 ) {
+			auto const w = load64( first );
+			auto const trail = w & ~( w << 1U ) & high_bits;
+			auto const leads = 8U - popcount( trail );
+			if( leads > n ) {
+				break;
+			}
+			n -= leads;
+			first += 8;
+		}
+		for( ; first != last; ++first ) {
+			if( not utf8::internal::is_trail( *first ) ) {
+				if( n == 0 ) {
+					return first;
+				}
+				--n;
+			}
+		}
+		return last;
+	}
+
+	/// The UTF-16 units of one byte of valid UTF-8, 2 for the lead of a
+	/// surrogate pair and 0 for continuation bytes
+	constexpr size_t utf16_units( char c ) noexcept {
+		auto const b = static_cast<uint8_t>( c );
+		return b >= 0xF0U ? 2U : ( b & 0xC0U ) == 0x80U ? 0U : 1U;
+	}
+
+	/// The UTF-16 units in the valid UTF-8 [first, last), a code point above
+	/// U+FFFF takes two
+	inline size_t utf8_utf16_length( char const *first,
+	                                 char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 8 ) {
+			auto const w = load64( first );
+			auto const trail = w & ~( w << 1U ) & high_bits;
+			// bit 7 of a byte is set when it is 11110xxx
+			auto const four = w & ( w << 1U ) & ( w << 2U ) & ( w << 3U ) & high_bits;
+			result += 8U - popcount( trail ) + popcount( four );
+			first += 8;
+		}
+		for( ; first != last; ++first ) {
+			result += utf16_units( *first );
+		}
+		return result;
+	}
+
+	/// The position after the code points that take the first n UTF-16 units
+	/// of valid UTF-8, last when there are not that many.  A code point that
+	/// would be split between the units of its surrogate pair is left out and
+	/// the unit left over is remaining
+	inline advance_result advance_utf16_units( char const *first,
+	                                           char const *last,
+	                                           size_t n ) noexcept {
+		while( last - first >= 8 ) {
+			auto const w = load64( first );
+			auto const trail = w & ~( w << 1U ) & high_bits;
+			auto const four = w & ( w << 1U ) & ( w << 2U ) & ( w << 3U ) & high_bits;
+			auto const units = 8U - popcount( trail ) + popcount( four );
+			if( units > n ) {
+				break;
+			}
+			n -= units;
+			first += 8;
+		}
+		for( ; first != last; ++first ) {
+			auto const units = utf16_units( *first );
+			if( units > n ) {
+				return { first, n };
+			}
+			n -= units;
+		}
+		return { last, n };
+	}
+
+	/// The high bits of the bytes of w as 8 bits, like a movemask
+	constexpr uint64_t high_bit_mask( uint64_t w ) noexcept {
+		return ( ( w & high_bits ) * 0x0002'0408'1020'4081ULL ) >> 56U;
+	}
+
+	/// The newlines and bytes >= 0x80 of the count <= 64 bytes at first
+	inline line_masks scan_lines( char const *first, size_t count ) noexcept {
+		constexpr uint64_t ones = 0x0101'0101'0101'0101ULL;
+		constexpr uint64_t low_bits = ~high_bits;
+		auto result = line_masks{ 0, 0 };
+		size_t n = 0;
+		for( ; count - n >= 8; n += 8 ) {
+			auto const word = load64( first + n );
+			// The high bit of a byte of zero is set when it is 0, with no
+			// borrows between bytes
+			auto const x = word ^ ( ones * '\n' );
+			auto const zero = ~( ( ( x & low_bits ) + low_bits ) | x | low_bits );
+			result.newlines |= high_bit_mask( zero ) << n;
+			result.non_ascii |= high_bit_mask( word ) << n;
+		}
+		for( ; n < count; ++n ) {
+			auto const b = static_cast<uint8_t>( first[n] );
+			result.newlines |= static_cast<uint64_t>( b == '\n' ) << n;
+			result.non_ascii |= static_cast<uint64_t>( b >= 0x80U ) << n;
+		}
+		return result;
+	}
+} // namespace daw::utf8::simd::scalar
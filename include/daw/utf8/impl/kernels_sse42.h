@@ -0,0 +1,1220 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../simd.h"
+#include "kernels_scalar.h"
+
+#if defined( DAW_UTF8_X86_KERNELS )
+
+#include <cstddef>
+#include <cstdint>
+
+/// 16 byte kernels for CPUs with SSE4.2 and POPCNT
+namespace daw::utf8::simd::sse42 {
+	/// Error flags for the byte pair lookups from "Validating UTF-8 In Less
+	/// Than One Instruction Per Byte", Keiser and Lemire 2021
+	namespace lookup {
+		constexpr char too_short = 1 << 0;
+		constexpr char too_long = 1 << 1;
+		constexpr char overlong_3 = 1 << 2;
+		constexpr char too_large = 1 << 3;
+		constexpr char surrogate = 1 << 4;
+		constexpr char overlong_2 = 1 << 5;
+		constexpr char too_large_1000 = 1 << 6;
+		constexpr char overlong_4 = 1 << 6;
+		constexpr char two_conts = static_cast<char>( 1 << 7 );
+		constexpr char carry = too_short | too_long | two_conts;
+	} // namespace lookup
+
+	DAW_UTF8_TARGET_SSE42 inline __m128i high_nibbles( __m128i v ) noexcept {
+		return _mm_and_si128( _mm_srli_epi16( v, 4 ), _mm_set1_epi8( 0x0F ) );
+	}
+
+	/// Non-zero lanes mark errors in input given the previous 16 bytes
+	DAW_UTF8_TARGET_SSE42 inline __m128i
+	check_block( __m128i input, __m128i prev_input ) noexcept {
+		using namespace lookup;
+		auto const prev1 = _mm_alignr_epi8( input, prev_input, 15 );
+		auto const byte_1_high = _mm_shuffle_epi8(
+		  _mm_setr_epi8( too_long, too_long, too_long, too_long, too_long,
+		                 too_long, too_long, too_long, two_conts, two_conts,
+		                 two_conts, two_conts, too_short | overlong_2, too_short,
+		                 too_short | overlong_3 | surrogate,
+		                 too_short | too_large | too_large_1000 | overlong_4 ),
+		  high_nibbles( prev1 ) );
+		auto const byte_1_low = _mm_shuffle_epi8(
+		  _mm_setr_epi8( carry | overlong_3 | overlong_2 | overlong_4,
+		                 carry | overlong_2, carry, carry, carry | too_large,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000 | surrogate,
+		                 carry | too_large | too_large_1000,
+		                 carry | too_large | too_large_1000 ),
+		  _mm_and_si128( prev1, _mm_set1_epi8( 0x0F ) ) );
+		auto const byte_2_high = _mm_shuffle_epi8(
+		  _mm_setr_epi8(
+		    too_short, too_short, too_short, too_short, too_short, too_short,
+		    too_short, too_short,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 |
+		      overlong_4,
+		    too_long | overlong_2 | two_conts | overlong_3 | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large,
+		    too_long | overlong_2 | two_conts | surrogate | too_large, too_short,
+		    too_short, too_short, too_short ),
+		  high_nibbles( input ) );
+		auto const special =
+		  _mm_and_si128( _mm_and_si128( byte_1_high, byte_1_low ), byte_2_high );
+		// Bytes 2 and 3 after a 3 or 4 byte lead must be continuations
+		auto const prev2 = _mm_alignr_epi8( input, prev_input, 14 );
+		auto const prev3 = _mm_alignr_epi8( input, prev_input, 13 );
+		auto const is_third = _mm_subs_epu8( prev2, _mm_set1_epi8( 0xE0 - 0x80 ) );
+		auto const is_fourth =
+		  _mm_subs_epu8( prev3, _mm_set1_epi8( 0xF0 - 0x80 ) );
+		auto const must23 =
+		  _mm_and_si128( _mm_or_si128( is_third, is_fourth ),
+		                 _mm_set1_epi8( static_cast<char>( 0x80 ) ) );
+		return _mm_xor_si128( must23, special );
+	}
+
+	/// Non-zero lanes mark a lead byte in the last 3 bytes that needs more
+	/// bytes than remain in the block
+	DAW_UTF8_TARGET_SSE42 inline __m128i is_incomplete( __m128i input ) noexcept {
+		auto const max_value = _mm_setr_epi8(
+		  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		  static_cast<char>( 0xF0 - 1 ), static_cast<char>( 0xE0 - 1 ),
+		  static_cast<char>( 0xC0 - 1 ) );
+		return _mm_subs_epu8( input, max_value );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	find_invalid( char const *const first, char const *const last ) noexcept {
+		auto it = first;
+		auto prev_input = _mm_setzero_si128( );
+		auto prev_incomplete = _mm_setzero_si128( );
+		while( last - it >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( it ) );
+			auto error = prev_incomplete;
+			if( _mm_movemask_epi8( input ) == 0 ) {
+				prev_incomplete = _mm_setzero_si128( );
+			} else {
+				error = check_block( input, prev_input );
+				prev_incomplete = is_incomplete( input );
+			}
+			if( not _mm_testz_si128( error, error ) ) {
+				// Rescan from the last known good boundary to locate the error
+				return scalar::find_invalid( scalar::rescan_start( first, it ),
+				                             last );
+			}
+			prev_input = input;
+			it += 16;
+		}
+		return scalar::find_invalid( scalar::rescan_start( first, it ), last );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline size_t
+	count_code_points( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		// Signed, only continuation bytes are <= -65(0xBF)
+		auto const max_trail = _mm_set1_epi8( -65 );
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			auto const leads = _mm_cmpgt_epi8( input, max_trail );
+			result += static_cast<size_t>( _mm_popcnt_u32(
+			  static_cast<unsigned>( _mm_movemask_epi8( leads ) ) ) );
+			first += 16;
+		}
+		return result + scalar::count_code_points( first, last );
+	}
+
+	namespace transcode {
+		/// pshufb indices that gather the UTF-8 of 4 code points to the front
+		/// of a vector.  Each 32 bit lane holds a sequence in its last L bytes
+		/// and bits 2n and 2n + 1 of the index are L - 1 for lane n
+		struct encode_table {
+			uint8_t indices[256][16];
+			uint8_t lengths[256];
+		};
+
+		constexpr encode_table make_encode_table( ) noexcept {
+			auto result = encode_table{ };
+			for( unsigned m = 0; m < 256; ++m ) {
+				unsigned pos = 0;
+				for( unsigned n = 0; n < 4; ++n ) {
+					auto const len = ( ( m >> ( 2 * n ) ) & 3U ) + 1U;
+					for( unsigned b = 4 - len; b < 4; ++b ) {
+						result.indices[m][pos++] = static_cast<uint8_t>( 4 * n + b );
+					}
+				}
+				result.lengths[m] = static_cast<uint8_t>( pos );
+				for( ; pos < 16; ++pos ) {
+					result.indices[m][pos] = 0x80;
+				}
+			}
+			return result;
+		}
+
+		inline constexpr encode_table encode_shuffles = make_encode_table( );
+
+		/// Where the shuffles that decode 4 and 3 code points start in
+		/// decode_table, the first 64 decode 6
+		constexpr unsigned four_code_points = 64;
+		constexpr unsigned three_code_points = 145;
+
+		/// pshufb indices for the ways 12 bytes can start with 6 code points
+		/// of 1 or 2 bytes, 4 of 1 to 3 or 3 of 1 to 4.  Each is moved into a
+		/// 16 bit lane, or a 32 bit lane for 4 and 3, with its last byte
+		/// lowest.  The index has bit n set when byte n ends a code point, the
+		/// low byte of an entry is the shuffle and the high byte the bytes used
+		struct decode_table {
+			uint8_t shuffles[209][16];
+			uint16_t index[4096];
+		};
+
+		constexpr decode_table make_decode_table( ) noexcept {
+			auto result = decode_table{ };
+			for( auto &shuffle : result.shuffles ) {
+				for( auto &b : shuffle ) {
+					b = 0x80;
+				}
+			}
+			for( unsigned n = 0; n < four_code_points; ++n ) {
+				unsigned pos = 0;
+				for( unsigned k = 0; k < 6; ++k ) {
+					auto const len = ( ( n >> k ) & 1U ) + 1U;
+					result.shuffles[n][2 * k] = static_cast<uint8_t>( pos + len - 1 );
+					if( len == 2 ) {
+						result.shuffles[n][2 * k + 1] = static_cast<uint8_t>( pos );
+					}
+					pos += len;
+				}
+			}
+			for( unsigned n = four_code_points; n < 209; ++n ) {
+				auto const count = n < three_code_points ? 4U : 3U;
+				auto digits = n - ( n < three_code_points ? four_code_points
+				                                          : three_code_points );
+				unsigned pos = 0;
+				for( unsigned k = 0; k < count; ++k ) {
+					// The radix is the longest sequence, 3 or 4
+					auto const len = digits % ( 7U - count ) + 1U;
+					digits /= 7U - count;
+					for( unsigned b = 0; b < len; ++b ) {
+						result.shuffles[n][4 * k + b] =
+						  static_cast<uint8_t>( pos + len - 1 - b );
+					}
+					pos += len;
+				}
+			}
+			for( unsigned mask = 0; mask < 4096; ++mask ) {
+				unsigned lengths[12] = { };
+				unsigned count = 0;
+				unsigned start = 0;
+				for( unsigned n = 0; n < 12; ++n ) {
+					if( ( mask >> n ) & 1U ) {
+						lengths[count++] = n + 1 - start;
+						start = n + 1;
+					}
+				}
+				auto const fits = [&]( unsigned cps, unsigned max_length ) {
+					if( count < cps ) {
+						return false;
+					}
+					for( unsigned k = 0; k < cps; ++k ) {
+						if( lengths[k] > max_length ) {
+							return false;
+						}
+					}
+					return true;
+				};
+				// Three ASCII, only reached by invalid UTF-8
+				unsigned shuffle = three_code_points;
+				unsigned cps = 3;
+				unsigned radix = 1;
+				if( fits( 6, 2 ) ) {
+					shuffle = 0;
+					cps = 6;
+					radix = 2;
+				} else if( fits( 4, 3 ) ) {
+					shuffle = four_code_points;
+					cps = 4;
+					radix = 3;
+				} else if( fits( 3, 4 ) ) {
+					radix = 4;
+				}
+				unsigned bytes = 0;
+				unsigned place = 1;
+				for( unsigned k = 0; k < cps; ++k ) {
+					auto const len = radix == 1 ? 1U : lengths[k];
+					shuffle += ( len - 1 ) * place;
+					place *= radix;
+					bytes += len;
+				}
+				result.index[mask] = static_cast<uint16_t>( shuffle | bytes << 8U );
+			}
+			return result;
+		}
+
+		inline constexpr decode_table decode_shuffles = make_decode_table( );
+
+		/// pshufb indices that pack 4 32 bit lanes into UTF-16, all of a lane
+		/// whose bit is set in the index and its low unit otherwise
+		struct surrogate_table {
+			uint8_t shuffles[16][16];
+		};
+
+		constexpr surrogate_table make_surrogate_table( ) noexcept {
+			auto result = surrogate_table{ };
+			for( unsigned mask = 0; mask < 16; ++mask ) {
+				unsigned pos = 0;
+				for( unsigned k = 0; k < 4; ++k ) {
+					auto const bytes = ( ( mask >> k ) & 1U ) ? 4U : 2U;
+					for( unsigned b = 0; b < bytes; ++b ) {
+						result.shuffles[mask][pos++] = static_cast<uint8_t>( 4 * k + b );
+					}
+				}
+				while( pos < 16 ) {
+					result.shuffles[mask][pos++] = 0x80;
+				}
+			}
+			return result;
+		}
+
+		inline constexpr surrogate_table surrogate_shuffles =
+		  make_surrogate_table( );
+
+		/// The encode_table index for the L - 1 of lane n in byte n of
+		/// lengths
+		constexpr unsigned encode_key( uint32_t lengths ) noexcept {
+			return ( lengths * 0x0104'1040U ) >> 24U;
+		}
+	} // namespace transcode
+
+	/// Store the last L bytes of each lane of bytes, lengths holds L - 1 per
+	/// lane.  Stores 16 bytes and returns the end of the 4 to 16 that are used
+	DAW_UTF8_TARGET_SSE42 inline char *pack4( __m128i bytes, __m128i lengths,
+	                                          char *out ) noexcept {
+		// L - 1 per lane, gathered into the low 4 bytes
+		auto const key = transcode::encode_key( static_cast<uint32_t>(
+		  _mm_cvtsi128_si32( _mm_shuffle_epi8(
+		    lengths, _mm_setr_epi8( 0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1,
+		                            -1, -1, -1, -1 ) ) ) ) );
+		_mm_storeu_si128(
+		  reinterpret_cast<__m128i *>( out ),
+		  _mm_shuffle_epi8( bytes, _mm_loadu_si128( reinterpret_cast<__m128i const *>(
+		                             transcode::encode_shuffles.indices[key] ) ) ) );
+		return out + transcode::encode_shuffles.lengths[key];
+	}
+
+	/// The UTF-8 of the code points in the lanes of cps, ending at the last
+	/// byte of each lane.  lengths is set to L - 1 per lane
+	DAW_UTF8_TARGET_SSE42 inline __m128i encode_bytes( __m128i cps,
+	                                                   __m128i &lengths ) noexcept {
+		// Lane bytes in output order are 0x80 | bits 18-20, 12-17, 6-11, 0-5
+		auto const fields = _mm_or_si128(
+		  _mm_or_si128(
+		    _mm_and_si128( _mm_slli_epi32( cps, 24 ),
+		                   _mm_set1_epi32( 0x3F00'0000 ) ),
+		    _mm_and_si128( _mm_slli_epi32( cps, 10 ),
+		                   _mm_set1_epi32( 0x003F'0000 ) ) ),
+		  _mm_or_si128(
+		    _mm_and_si128( _mm_srli_epi32( cps, 4 ), _mm_set1_epi32( 0x3F00 ) ),
+		    _mm_srli_epi32( cps, 18 ) ) );
+		auto const m2 = _mm_cmpgt_epi32( cps, _mm_set1_epi32( 0x7F ) );
+		auto const m3 = _mm_cmpgt_epi32( cps, _mm_set1_epi32( 0x7FF ) );
+		auto const m4 = _mm_cmpgt_epi32( cps, _mm_set1_epi32( 0xFFFF ) );
+		// Turn the 0x80 of the lead into 0xC0, 0xE0 or 0xF0
+		auto const lead = _mm_xor_si128(
+		  _mm_xor_si128( _mm_and_si128( m2, _mm_set1_epi32( 0x0040'0000 ) ),
+		                 _mm_and_si128( m3, _mm_set1_epi32( 0x0040'6000 ) ) ),
+		  _mm_and_si128( m4, _mm_set1_epi32( 0x6070 ) ) );
+		lengths = _mm_sub_epi32( _mm_setzero_si128( ),
+		                         _mm_add_epi32( _mm_add_epi32( m2, m3 ), m4 ) );
+		return _mm_blendv_epi8(
+		  _mm_slli_epi32( cps, 24 ),
+		  _mm_xor_si128( _mm_or_si128( fields, _mm_set1_epi32( static_cast<int>(
+		                                         0x8080'8080U ) ) ),
+		                 lead ),
+		  m2 );
+	}
+
+	/// The 4 code points in the lanes of cps as UTF-8, one pshufb packs them.
+	/// Stores 16 bytes and returns the end of the 4 to 16 that are used
+	DAW_UTF8_TARGET_SSE42 inline char *encode4( __m128i cps,
+	                                            char *out ) noexcept {
+		__m128i lengths;
+		auto const bytes = encode_bytes( cps, lengths );
+		return pack4( bytes, lengths, out );
+	}
+
+	/// The 4 UTF-16 units in the lanes of units as UTF-8.  previous holds the
+	/// unit before each.  A surrogate pair is split into the first 2 bytes,
+	/// from the lead surrogate, and the last 2, from the trail surrogate and
+	/// the low bits of the lead in previous
+	DAW_UTF8_TARGET_SSE42 inline char *
+	encode4_utf16( __m128i units, __m128i previous, char *out ) noexcept {
+		__m128i lengths;
+		auto const bytes = encode_bytes( units, lengths );
+		auto const kind = _mm_and_si128( units, _mm_set1_epi32( 0xFC00 ) );
+		auto const leads = _mm_cmpeq_epi32( kind, _mm_set1_epi32( 0xD800 ) );
+		auto const surrogates = _mm_or_si128(
+		  leads, _mm_cmpeq_epi32( kind, _mm_set1_epi32( 0xDC00 ) ) );
+		// 11110www 10xxxxxx, the plane is the lead's bits 6-9 plus 1
+		auto const plane = _mm_add_epi32( units, _mm_set1_epi32( 0x40 ) );
+		auto const lead_bytes = _mm_or_si128(
+		  _mm_or_si128(
+		    _mm_slli_epi32( _mm_and_si128( _mm_srli_epi32( plane, 8 ),
+		                                   _mm_set1_epi32( 0x07 ) ),
+		                    16 ),
+		    _mm_slli_epi32( _mm_and_si128( _mm_srli_epi32( plane, 2 ),
+		                                   _mm_set1_epi32( 0x3F ) ),
+		                    24 ) ),
+		  _mm_set1_epi32( static_cast<int>( 0x80F0'0000U ) ) );
+		// 10yyyyyy 10zzzzzz
+		auto const trail_bytes = _mm_or_si128(
+		  _mm_or_si128(
+		    _mm_slli_epi32(
+		      _mm_or_si128(
+		        _mm_slli_epi32( _mm_and_si128( previous, _mm_set1_epi32( 0x03 ) ),
+		                        4 ),
+		        _mm_and_si128( _mm_srli_epi32( units, 6 ),
+		                       _mm_set1_epi32( 0x0F ) ) ),
+		      16 ),
+		    _mm_slli_epi32( _mm_and_si128( units, _mm_set1_epi32( 0x3F ) ), 24 ) ),
+		  _mm_set1_epi32( static_cast<int>( 0x8080'0000U ) ) );
+		return pack4(
+		  _mm_blendv_epi8( bytes,
+		                   _mm_blendv_epi8( trail_bytes, lead_bytes, leads ),
+		                   surrogates ),
+		  _mm_add_epi32( lengths, surrogates ), out );
+	}
+
+	/// Bit n is set when byte n of input is not a trail byte
+	DAW_UTF8_TARGET_SSE42 inline unsigned lead_mask( __m128i input ) noexcept {
+		// Signed, only continuation bytes are <= -65(0xBF)
+		return static_cast<unsigned>(
+		  _mm_movemask_epi8( _mm_cmpgt_epi8( input, _mm_set1_epi8( -65 ) ) ) );
+	}
+
+	/// Bit n is set when byte n of the 64 at first ends a code point.  Bit 63
+	/// is left clear
+	DAW_UTF8_TARGET_SSE42 inline uint64_t
+	code_point_ends( char const *first ) noexcept {
+		uint64_t leads = 0;
+		for( unsigned n = 0; n < 4; ++n ) {
+			leads |= static_cast<uint64_t>( lead_mask( _mm_loadu_si128(
+			           reinterpret_cast<__m128i const *>( first + 16 * n ) ) ) )
+			         << ( 16U * n );
+		}
+		return leads >> 1U;
+	}
+
+	/// Decode the 6, 4 or 3 code points that start in the first 12 bytes of
+	/// input, valid UTF-8 that starts a code point.  ends has bit n set when
+	/// byte n ends one.  values holds 6 in 16 bit lanes and the others in 32
+	/// bit lanes.  Returns the decode_table entry
+	DAW_UTF8_TARGET_SSE42 inline unsigned
+	decode12( __m128i input, uint64_t ends, __m128i &values ) noexcept {
+		auto const entry = transcode::decode_shuffles.index[ends & 0xFFFU];
+		auto const shuffle = entry & 0xFFU;
+		auto const lanes = _mm_shuffle_epi8(
+		  input, _mm_loadu_si128( reinterpret_cast<__m128i const *>(
+		           transcode::decode_shuffles.shuffles[shuffle] ) ) );
+		auto const low = _mm_and_si128( lanes, _mm_set1_epi32( 0x7F ) );
+		auto const second = _mm_srli_epi32(
+		  _mm_and_si128( lanes, _mm_set1_epi32( 0x3F00 ) ), 2 );
+		if( shuffle < transcode::four_code_points ) {
+			// 110xxxxx 10yyyyyy
+			values = _mm_or_si128(
+			  _mm_and_si128( lanes, _mm_set1_epi16( 0x7F ) ),
+			  _mm_srli_epi16( _mm_and_si128( lanes, _mm_set1_epi16( 0x1F00 ) ),
+			                  2 ) );
+		} else if( shuffle < transcode::three_code_points ) {
+			// 1110xxxx 10yyyyyy 10zzzzzz
+			values = _mm_or_si128(
+			  _mm_or_si128( low, second ),
+			  _mm_srli_epi32(
+			    _mm_and_si128( lanes, _mm_set1_epi32( 0x0F'0000 ) ), 4 ) );
+		} else {
+			// 11110www 10xxxxxx 10yyyyyy 10zzzzzz.  The mask leaves bit 5 of a 3
+			// byte lead set, its bit 6 clears it
+			auto const third = _mm_xor_si128(
+			  _mm_and_si128( lanes, _mm_set1_epi32( 0x3F'0000 ) ),
+			  _mm_srli_epi32( _mm_and_si128( lanes, _mm_set1_epi32( 0x40'0000 ) ),
+			                  1 ) );
+			values = _mm_or_si128(
+			  _mm_or_si128( low, second ),
+			  _mm_or_si128(
+			    _mm_srli_epi32( third, 4 ),
+			    _mm_srli_epi32(
+			      _mm_and_si128( lanes, _mm_set1_epi32( 0x0700'0000 ) ), 6 ) ) );
+		}
+		return entry;
+	}
+
+	/// Decode the code points that start in the first 49 of the 64 bytes at
+	/// first, taking 6, 4 or 3 at a time by table.  ends has bit n set when
+	/// byte n ends a code point.  A step stores up to 8 units, at most 8 past
+	/// the bytes it starts at, the 16 bytes after it cover them.  Returns the
+	/// bytes used
+	DAW_UTF8_TARGET_SSE42 inline unsigned
+	utf8to16_chunk( char const *first, uint64_t ends, char16_t *&out ) noexcept {
+		unsigned pos = 0;
+		while( pos <= 48 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first + pos ) );
+			if( _mm_movemask_epi8( input ) == 0 ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out ),
+				                  _mm_cvtepu8_epi16( input ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out + 8 ),
+				                  _mm_cvtepu8_epi16( _mm_srli_si128( input, 8 ) ) );
+				pos += 16;
+				out += 16;
+				continue;
+			}
+			__m128i values;
+			auto const entry = decode12( input, ends >> pos, values );
+			pos += entry >> 8U;
+			auto const shuffle = entry & 0xFFU;
+			if( shuffle < transcode::four_code_points ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out ), values );
+				out += 6;
+				continue;
+			}
+			auto const count = shuffle < transcode::three_code_points ? 4U : 3U;
+			if( _mm_testz_si128( values, _mm_set1_epi32( ~0xFFFF ) ) ) {
+				_mm_storel_epi64( reinterpret_cast<__m128i *>( out ),
+				                  _mm_packus_epi32( values, values ) );
+				out += count;
+				continue;
+			}
+			// Lanes above U+FFFF become a surrogate pair, lead unit first
+			auto const pairs = _mm_cmpgt_epi32( values, _mm_set1_epi32( 0xFFFF ) );
+			auto const offset = _mm_sub_epi32( values, _mm_set1_epi32( 0x1'0000 ) );
+			auto const units = _mm_blendv_epi8(
+			  values,
+			  _mm_or_si128(
+			    _mm_or_si128( _mm_srli_epi32( offset, 10 ),
+			                  _mm_set1_epi32( static_cast<int>( 0xDC00'D800U ) ) ),
+			    _mm_slli_epi32( _mm_and_si128( offset, _mm_set1_epi32( 0x3FF ) ),
+			                    16 ) ),
+			  pairs );
+			auto const mask =
+			  static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( pairs ) ) ) &
+			  ( ( 1U << count ) - 1U );
+			_mm_storeu_si128(
+			  reinterpret_cast<__m128i *>( out ),
+			  _mm_shuffle_epi8( units,
+			                    _mm_loadu_si128( reinterpret_cast<__m128i const *>(
+			                      transcode::surrogate_shuffles.shuffles[mask] ) ) ) );
+			out += count + static_cast<unsigned>( _mm_popcnt_u32( mask ) );
+		}
+		return pos;
+	}
+
+	/// As utf8to16_chunk, a step stores up to 8 code points
+	DAW_UTF8_TARGET_SSE42 inline unsigned
+	utf8to32_chunk( char const *first, uint64_t ends, char32_t *&out ) noexcept {
+		unsigned pos = 0;
+		while( pos <= 48 ) {
+			auto input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first + pos ) );
+			if( _mm_movemask_epi8( input ) == 0 ) {
+				for( int n = 0; n < 4; ++n ) {
+					_mm_storeu_si128( reinterpret_cast<__m128i *>( out + 4 * n ),
+					                  _mm_cvtepu8_epi32( input ) );
+					input = _mm_srli_si128( input, 4 );
+				}
+				pos += 16;
+				out += 16;
+				continue;
+			}
+			__m128i values;
+			auto const entry = decode12( input, ends >> pos, values );
+			pos += entry >> 8U;
+			auto const shuffle = entry & 0xFFU;
+			if( shuffle < transcode::four_code_points ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out ),
+				                  _mm_cvtepu16_epi32( values ) );
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out + 4 ),
+				                  _mm_cvtepu16_epi32( _mm_srli_si128( values, 8 ) ) );
+				out += 6;
+				continue;
+			}
+			_mm_storeu_si128( reinterpret_cast<__m128i *>( out ), values );
+			out += shuffle < transcode::three_code_points ? 4 : 3;
+		}
+		return pos;
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char16_t *
+	utf8to16( char const *first, char const *last, char16_t *out ) noexcept {
+		while( last - first >= 64 ) {
+			first += utf8to16_chunk( first, code_point_ends( first ), out );
+		}
+		return scalar::utf8to16( first, last, out );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char32_t *
+	utf8to32( char const *first, char const *last, char32_t *out ) noexcept {
+		while( last - first >= 64 ) {
+			first += utf8to32_chunk( first, code_point_ends( first ), out );
+		}
+		return scalar::utf8to32( first, last, out );
+	}
+
+	/// Non-zero when a unit of input is a surrogate
+	DAW_UTF8_TARGET_SSE42 inline int has_surrogate( __m128i input ) noexcept {
+		return _mm_movemask_epi8( _mm_cmpeq_epi16(
+		  _mm_and_si128( input, _mm_set1_epi16( static_cast<short>( 0xF800 ) ) ),
+		  _mm_set1_epi16( static_cast<short>( 0xD800 ) ) ) );
+	}
+
+	/// The units after the blocks, first may be the trail of a surrogate
+	/// pair whose lead was encoded with the last block
+	inline char *utf16to8_tail( char16_t const *start, char16_t const *first,
+	                            char16_t const *last, char *out ) noexcept {
+		if( first != start and first != last and
+		    utf8::internal::is_trail_surrogate( *first ) ) {
+			// 10yyyyyy 10zzzzzz
+			auto const unit = static_cast<uint32_t>( *first );
+			*out++ = static_cast<char>(
+			  0x80U | ( static_cast<uint32_t>( first[-1] ) & 0x3U ) << 4U |
+			  ( ( unit >> 6U ) & 0xFU ) );
+			*out++ = static_cast<char>( 0x80U | ( unit & 0x3FU ) );
+			++first;
+		}
+		return scalar::utf16to8( first, last, out );
+	}
+
+	/// Each 4 units encoded may store 4 bytes past the 12 they have room for,
+	/// the units after them cover it
+	DAW_UTF8_TARGET_SSE42 inline char *
+	utf16to8( char16_t const *first, char16_t const *last, char *out ) noexcept {
+		auto const start = first;
+		auto const non_ascii = _mm_set1_epi16( static_cast<short>( 0xFF80 ) );
+		while( last - first >= 16 ) {
+			auto const a =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			auto const b =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first + 8 ) );
+			if( _mm_testz_si128( _mm_or_si128( a, b ), non_ascii ) ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out ),
+				                  _mm_packus_epi16( a, b ) );
+				first += 16;
+				out += 16;
+				continue;
+			}
+			if( has_surrogate( a ) == 0 ) {
+				out = encode4( _mm_cvtepu16_epi32( a ), out );
+				out = encode4( _mm_cvtepu16_epi32( _mm_srli_si128( a, 8 ) ), out );
+				first += 8;
+				continue;
+			}
+			// A trail surrogate at the start of the block pairs with the unit
+			// before it
+			auto const previous =
+			  first == start
+			    ? _mm_slli_si128( a, 2 )
+			    : _mm_loadu_si128( reinterpret_cast<__m128i const *>( first - 1 ) );
+			out = encode4_utf16( _mm_cvtepu16_epi32( a ),
+			                     _mm_cvtepu16_epi32( previous ), out );
+			out = encode4_utf16( _mm_cvtepu16_epi32( _mm_srli_si128( a, 8 ) ),
+			                     _mm_cvtepu16_epi32( _mm_srli_si128( previous, 8 ) ),
+			                     out );
+			first += 8;
+		}
+		return utf16to8_tail( start, first, last, out );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char *
+	utf32to8( char32_t const *first, char32_t const *last, char *out ) noexcept {
+		auto const non_ascii = _mm_set1_epi32( ~0x7F );
+		while( last - first >= 16 ) {
+			auto const p = reinterpret_cast<__m128i const *>( first );
+			auto const a = _mm_loadu_si128( p );
+			auto const b = _mm_loadu_si128( p + 1 );
+			auto const c = _mm_loadu_si128( p + 2 );
+			auto const d = _mm_loadu_si128( p + 3 );
+			auto const all =
+			  _mm_or_si128( _mm_or_si128( a, b ), _mm_or_si128( c, d ) );
+			if( _mm_testz_si128( all, non_ascii ) ) {
+				auto const ab = _mm_packus_epi32( a, b );
+				auto const cd = _mm_packus_epi32( c, d );
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( out ),
+				                  _mm_packus_epi16( ab, cd ) );
+				first += 16;
+				out += 16;
+				continue;
+			}
+			out = encode4( a, out );
+			out = encode4( b, out );
+			out = encode4( c, out );
+			out = encode4( d, out );
+			first += 16;
+		}
+		return scalar::utf32to8( first, last, out );
+	}
+
+	/// pshufb indices for an 8 byte block, indexed by a bit per byte
+	struct shuffle_table {
+		uint8_t indices[256][16];
+	};
+
+	namespace latin1 {
+		/// Byte n of the block is widened to the 16 bit lane n, the lead byte
+		/// of its UTF-8 in the low half and the trail in the high half.  Bit n
+		/// of the index is set when byte n is >= 0x80 and needs both
+		constexpr shuffle_table make_expand_table( ) noexcept {
+			auto result = shuffle_table{ };
+			for( unsigned m = 0; m < 256; ++m ) {
+				unsigned pos = 0;
+				for( unsigned n = 0; n < 8; ++n ) {
+					result.indices[m][pos++] = static_cast<uint8_t>( 2 * n );
+					if( ( m >> n ) & 1U ) {
+						result.indices[m][pos++] = static_cast<uint8_t>( 2 * n + 1 );
+					}
+				}
+				for( ; pos < 16; ++pos ) {
+					result.indices[m][pos] = 0x80;
+				}
+			}
+			return result;
+		}
+
+		/// Bit n of the index is set when byte n is dropped, the bytes that are
+		/// kept are packed to the front
+		constexpr shuffle_table make_pack_table( ) noexcept {
+			auto result = shuffle_table{ };
+			for( unsigned m = 0; m < 256; ++m ) {
+				unsigned pos = 0;
+				for( unsigned n = 0; n < 8; ++n ) {
+					if( ( ( m >> n ) & 1U ) == 0 ) {
+						result.indices[m][pos++] = static_cast<uint8_t>( n );
+					}
+				}
+				for( ; pos < 16; ++pos ) {
+					result.indices[m][pos] = 0x80;
+				}
+			}
+			return result;
+		}
+
+		inline constexpr shuffle_table expand_table = make_expand_table( );
+		inline constexpr shuffle_table pack_table = make_pack_table( );
+	} // namespace latin1
+
+	DAW_UTF8_TARGET_SSE42 inline __m128i
+	load_shuffle( shuffle_table const &table, unsigned index ) noexcept {
+		return _mm_loadu_si128(
+		  reinterpret_cast<__m128i const *>( table.indices[index] ) );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline size_t
+	latin1_utf8_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			auto const high = static_cast<unsigned>( _mm_movemask_epi8( input ) );
+			result += 16U + static_cast<size_t>( _mm_popcnt_u32( high ) );
+			first += 16;
+		}
+		return result + scalar::latin1_utf8_length( first, last );
+	}
+
+	/// UTF-8 for the 8 Latin-1 bytes in the low half of input, non_ascii has
+	/// a bit for each byte >= 0x80.  Stores 16 bytes and returns the end of
+	/// the 8 + popcount( non_ascii ) that are used
+	DAW_UTF8_TARGET_SSE42 inline char *
+	latin1to8_half( __m128i input, unsigned non_ascii, char *out ) noexcept {
+		auto const wide = _mm_cvtepu8_epi16( input );
+		auto const lead =
+		  _mm_or_si128( _mm_srli_epi16( wide, 6 ), _mm_set1_epi16( 0xC0 ) );
+		auto const trail = _mm_slli_epi16(
+		  _mm_or_si128( _mm_and_si128( wide, _mm_set1_epi16( 0x3F ) ),
+		                _mm_set1_epi16( 0x80 ) ),
+		  8 );
+		auto const units =
+		  _mm_blendv_epi8( wide, _mm_or_si128( lead, trail ),
+		                   _mm_cmpgt_epi16( wide, _mm_set1_epi16( 0x7F ) ) );
+		_mm_storeu_si128(
+		  reinterpret_cast<__m128i *>( out ),
+		  _mm_shuffle_epi8( units,
+		                    load_shuffle( latin1::expand_table, non_ascii ) ) );
+		return out + 8 + _mm_popcnt_u32( non_ascii );
+	}
+
+	/// UTF-8 for the 16 Latin-1 bytes at first.  Stores up to 8 bytes past
+	/// the returned end
+	DAW_UTF8_TARGET_SSE42 inline char *latin1to8_block( char const *first,
+	                                                    char *out ) noexcept {
+		auto const input =
+		  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+		auto const non_ascii =
+		  static_cast<unsigned>( _mm_movemask_epi8( input ) );
+		if( non_ascii == 0 ) {
+			_mm_storeu_si128( reinterpret_cast<__m128i *>( out ), input );
+			return out + 16;
+		}
+		out = latin1to8_half( input, non_ascii & 0xFFU, out );
+		return latin1to8_half( _mm_srli_si128( input, 8 ), non_ascii >> 8U,
+		                       out );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char *
+	latin1to8( char const *first, char const *last, char *out ) noexcept {
+		// The 8 bytes a block may store past its end are written over by the
+		// at least 8 that the input after it produces
+		while( last - first >= 24 ) {
+			out = latin1to8_block( first, out );
+			first += 16;
+		}
+		return scalar::latin1to8( first, last, out );
+	}
+
+	/// Narrow the 16 bytes of valid UTF-8 at first, which starts on a code
+	/// point boundary.  A lead in the last byte is left for the next block.
+	/// Returns false, with nothing written, when they hold a code point above
+	/// U+FF.  Stores up to 4 bytes past the new out
+	DAW_UTF8_TARGET_SSE42 inline bool utf8tolatin1_block( char const *&first,
+	                                                      char *&out ) noexcept {
+		auto const input =
+		  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+		if( _mm_movemask_epi8( input ) == 0 ) {
+			_mm_storeu_si128( reinterpret_cast<__m128i *>( out ), input );
+			first += 16;
+			out += 16;
+			return true;
+		}
+		auto const c3 = _mm_set1_epi8( static_cast<char>( 0xC3 ) );
+		auto const above = _mm_subs_epu8( input, c3 );
+		if( not _mm_testz_si128( above, above ) ) {
+			return false;
+		}
+		// Trails are 0x80-0xBF, the code point after 0xC2 and 0x40 less after
+		// 0xC3.  The leads are dropped
+		auto const after_c3 = _mm_cmpeq_epi8( _mm_slli_si128( input, 1 ), c3 );
+		auto const values = _mm_add_epi8(
+		  input, _mm_and_si128( after_c3, _mm_set1_epi8( 0x40 ) ) );
+		auto const lead_bits = _mm_set1_epi8( static_cast<char>( 0xC0 ) );
+		auto const leads = static_cast<unsigned>( _mm_movemask_epi8(
+		  _mm_cmpeq_epi8( _mm_and_si128( input, lead_bits ), lead_bits ) ) );
+		auto const lo = leads & 0xFFU;
+		auto const hi = leads >> 8U;
+		_mm_storel_epi64(
+		  reinterpret_cast<__m128i *>( out ),
+		  _mm_shuffle_epi8( values, load_shuffle( latin1::pack_table, lo ) ) );
+		out += 8 - _mm_popcnt_u32( lo );
+		_mm_storel_epi64(
+		  reinterpret_cast<__m128i *>( out ),
+		  _mm_shuffle_epi8( _mm_srli_si128( values, 8 ),
+		                    load_shuffle( latin1::pack_table, hi ) ) );
+		out += 8 - _mm_popcnt_u32( hi );
+		first += ( hi & 0x80U ) != 0 ? 15 : 16;
+		return true;
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline transcode_result
+	utf8tolatin1( char const *first, char const *last, char *out ) noexcept {
+		// The 16 bytes after a block hold at least 4 code points, enough to
+		// cover the bytes it stores past its end
+		while( last - first >= 32 ) {
+			if( not utf8tolatin1_block( first, out ) ) {
+				break;
+			}
+		}
+		return scalar::utf8tolatin1( first, last, out );
+	}
+
+	/// Index of the lowest set bit of a non-zero mask
+	DAW_UTF8_TARGET_SSE42 inline unsigned lowest_bit( unsigned mask ) noexcept {
+		auto const below = ( mask & ( 0U - mask ) ) - 1U;
+		return static_cast<unsigned>( _mm_popcnt_u32( below ) );
+	}
+
+	/// Bit n is set when the byte at it + n matches the first byte of the
+	/// needle and the byte at it + n + last_offset matches its last byte
+	DAW_UTF8_TARGET_SSE42 inline unsigned
+	candidates( char const *it, size_t last_offset, __m128i first_byte,
+	            __m128i last_byte ) noexcept {
+		auto const block_first =
+		  _mm_loadu_si128( reinterpret_cast<__m128i const *>( it ) );
+		auto const block_last =
+		  _mm_loadu_si128( reinterpret_cast<__m128i const *>( it + last_offset ) );
+		auto const both = _mm_and_si128( _mm_cmpeq_epi8( block_first, first_byte ),
+		                                 _mm_cmpeq_epi8( block_last, last_byte ) );
+		return static_cast<unsigned>( _mm_movemask_epi8( both ) );
+	}
+
+	/// Blocks of 16 candidate positions are filtered on the first and last
+	/// byte of the needle, only those left are compared in full
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	find_substring( char const *first, char const *last, char const *needle,
+	                char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 ) {
+			return first;
+		}
+		auto const first_byte = _mm_set1_epi8( needle[0] );
+		auto const last_byte = _mm_set1_epi8( needle[n - 1] );
+		auto it = first;
+		while( static_cast<size_t>( last - it ) >= n + 15 ) {
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			while( mask != 0 ) {
+				auto const pos = it + lowest_bit( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					return pos;
+				}
+				mask &= mask - 1U;
+			}
+			it += 16;
+		}
+		return scalar::find_substring( it, last, needle, needle_last );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	rfind_substring( char const *first, char const *last, char const *needle,
+	                 char const *needle_last ) noexcept {
+		auto const n = static_cast<size_t>( needle_last - needle );
+		if( n == 0 or static_cast<size_t>( last - first ) < n ) {
+			return last;
+		}
+		auto const first_byte = _mm_set1_epi8( needle[0] );
+		auto const last_byte = _mm_set1_epi8( needle[n - 1] );
+		// One past the last position a match can start at
+		auto end = last - ( n - 1 );
+		while( end - first >= 16 ) {
+			auto const it = end - 16;
+			auto mask = candidates( it, n - 1, first_byte, last_byte );
+			char const *result = nullptr;
+			while( mask != 0 ) {
+				auto const pos = it + lowest_bit( mask );
+				if( scalar::matches_inner( pos, needle, n ) ) {
+					result = pos;
+				}
+				mask &= mask - 1U;
+			}
+			if( result != nullptr ) {
+				return result;
+			}
+			end = it;
+		}
+		auto const result =
+		  scalar::rfind_substring( first, end + ( n - 1 ), needle, needle_last );
+		return result == end + ( n - 1 ) ? last : result;
+	}
+
+	/// Non-zero lanes hold the buckets that may start at it + lane
+	template<unsigned Length>
+	DAW_UTF8_TARGET_SSE42 inline __m128i
+	teddy_lanes( teddy_masks const &masks, char const *it ) noexcept {
+		auto const nibble = _mm_set1_epi8( 0x0F );
+		auto result = _mm_set1_epi8( -1 );
+		for( unsigned k = 0; k < Length; ++k ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( it + k ) );
+			auto const lo = _mm_shuffle_epi8(
+			  _mm_load_si128( reinterpret_cast<__m128i const *>( masks.lo[k] ) ),
+			  _mm_and_si128( input, nibble ) );
+			auto const hi = _mm_shuffle_epi8(
+			  _mm_load_si128( reinterpret_cast<__m128i const *>( masks.hi[k] ) ),
+			  _mm_and_si128( _mm_srli_epi16( input, 4 ), nibble ) );
+			result = _mm_and_si128( result, _mm_and_si128( lo, hi ) );
+		}
+		return result;
+	}
+
+	template<unsigned Length>
+	DAW_UTF8_TARGET_SSE42 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		while( last - first >= static_cast<std::ptrdiff_t>( 15 + Length ) ) {
+			auto const block = teddy_lanes<Length>( masks, first );
+			auto const empty = static_cast<unsigned>(
+			  _mm_movemask_epi8( _mm_cmpeq_epi8( block, _mm_setzero_si128( ) ) ) );
+			if( empty != 0xFFFFU ) {
+				_mm_storeu_si128( reinterpret_cast<__m128i *>( buckets ), block );
+				return { first, 16, ~empty & 0xFFFFU };
+			}
+			first += 16;
+		}
+		return scalar::teddy_find( masks, first, last, buckets );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline teddy_block
+	teddy_find( teddy_masks const &masks, char const *first, char const *last,
+	            uint8_t *buckets ) noexcept {
+		switch( masks.length ) {
+		case 1:
+			return teddy_find<1>( masks, first, last, buckets );
+		case 2:
+			return teddy_find<2>( masks, first, last, buckets );
+		default:
+			return teddy_find<3>( masks, first, last, buckets );
+		}
+	}
+
+	/// Surrogate halves of UTF-16 units in BigEndian or little endian order.
+	/// Only the top 6 bits of a unit are compared, so for the swapped order
+	/// the constants are swapped instead of the input
+	template<bool BigEndian>
+	struct utf16_constants {
+		static constexpr short mask = BigEndian ? 0x00FC : -1024; // 0xFC00
+		static constexpr short lead = BigEndian ? 0x00D8 : -10240; // 0xD800
+		static constexpr short trail = BigEndian ? 0x00DC : -9216; // 0xDC00
+	};
+
+	/// Bit n of the low half is set when unit n of the 16 at ptr is a lead
+	/// surrogate, the high half marks the trail surrogates
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_SSE42 inline uint32_t
+	surrogate_bits( char16_t const *ptr ) noexcept {
+		using c = utf16_constants<BigEndian>;
+		auto const mask = _mm_set1_epi16( c::mask );
+		auto const p = reinterpret_cast<__m128i const *>( ptr );
+		auto const a = _mm_and_si128( _mm_loadu_si128( p ), mask );
+		auto const b = _mm_and_si128( _mm_loadu_si128( p + 1 ), mask );
+		auto const lead = _mm_set1_epi16( c::lead );
+		auto const trail = _mm_set1_epi16( c::trail );
+		auto const leads = _mm_packs_epi16( _mm_cmpeq_epi16( a, lead ),
+		                                    _mm_cmpeq_epi16( b, lead ) );
+		auto const trails = _mm_packs_epi16( _mm_cmpeq_epi16( a, trail ),
+		                                     _mm_cmpeq_epi16( b, trail ) );
+		return static_cast<uint32_t>( _mm_movemask_epi8( leads ) ) |
+		       ( static_cast<uint32_t>( _mm_movemask_epi8( trails ) ) << 16U );
+	}
+
+	/// A trail surrogate must follow each lead surrogate and nothing else.
+	/// carry is set when the unit before the block is a lead
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_SSE42 inline char16_t const *
+	find_invalid_utf16( char16_t const *first, char16_t const *last ) noexcept {
+		uint32_t carry = 0;
+		while( last - first >= 16 ) {
+			auto const bits = surrogate_bits<BigEndian>( first );
+			auto const leads = bits & 0xFFFFU;
+			auto const trails = bits >> 16U;
+			if( ( ( ( leads << 1U ) | carry ) & 0xFFFFU ) != trails ) {
+				break;
+			}
+			carry = leads >> 15U;
+			first += 16;
+		}
+		return scalar::find_invalid_utf16<BigEndian>( first - carry, last );
+	}
+
+	template<bool BigEndian>
+	DAW_UTF8_TARGET_SSE42 inline size_t
+	utf16_count_code_points( char16_t const *first,
+	                         char16_t const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 16 ) {
+			auto const trails = surrogate_bits<BigEndian>( first ) >> 16U;
+			result += 16U - static_cast<size_t>( _mm_popcnt_u32( trails ) );
+			first += 16;
+		}
+		return result + scalar::utf16_count_code_points<BigEndian>( first, last );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	find_non_ascii( char const *first, char const *last ) noexcept {
+		while( last - first >= 16 ) {
+			auto const high = static_cast<unsigned>( _mm_movemask_epi8(
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) ) ) );
+			if( high != 0 ) {
+				return first + scalar::lowest_set_bit( high );
+			}
+			first += 16;
+		}
+		return scalar::find_non_ascii( first, last );
+	}
+
+	/// Bit h - 8 for each high nibble h >= 8, 0 for ASCII
+	DAW_UTF8_TARGET_SSE42 inline __m128i high_nibble_bits( ) noexcept {
+		return _mm_setr_epi8( 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 8, 16, 32, 64,
+		                      -128 );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	find_not_in_set( byte_set const &set, char const *first,
+	                 char const *last ) noexcept {
+		auto const rows =
+		  _mm_load_si128( reinterpret_cast<__m128i const *>( set.rows ) );
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			auto const row = _mm_shuffle_epi8(
+			  rows, _mm_and_si128( input, _mm_set1_epi8( 0x0F ) ) );
+			auto const bit =
+			  _mm_shuffle_epi8( high_nibble_bits( ), high_nibbles( input ) );
+			// ASCII has no bit and is always in the set
+			auto const in = static_cast<unsigned>( _mm_movemask_epi8(
+			  _mm_cmpeq_epi8( _mm_and_si128( row, bit ), bit ) ) );
+			if( in != 0xFFFFU ) {
+				return first + scalar::lowest_set_bit( ~in & 0xFFFFU );
+			}
+			first += 16;
+		}
+		return scalar::find_not_in_set( set, first, last );
+	}
+
+	/// 0x20 in each byte of input in [lo, lo + 26)
+	DAW_UTF8_TARGET_SSE42 inline __m128i ascii_case_bits( __m128i input,
+	                                                      uint8_t lo ) noexcept {
+		// Moves [lo, lo + 26) to the bottom of the signed bytes
+		auto const moved =
+		  _mm_add_epi8( input, _mm_set1_epi8( static_cast<char>( 0x80U - lo ) ) );
+		auto const in = _mm_cmplt_epi8( moved, _mm_set1_epi8( -128 + 26 ) );
+		return _mm_and_si128( in, _mm_set1_epi8( 0x20 ) );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	ascii_case_map( char const *first, char const *last, char *out,
+	                bool upper ) noexcept {
+		auto const lo = static_cast<uint8_t>( upper ? 'a' : 'A' );
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			if( _mm_movemask_epi8( input ) != 0 ) {
+				break;
+			}
+			_mm_storeu_si128( reinterpret_cast<__m128i *>( out ),
+			                  _mm_xor_si128( input, ascii_case_bits( input, lo ) ) );
+			first += 16;
+			out += 16;
+		}
+		return scalar::ascii_case_map( first, last, out, upper );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline size_t
+	ascii_icase_prefix( char const *lhs, char const *rhs, size_t n ) noexcept {
+		size_t pos = 0;
+		for( ; n - pos >= 16; pos += 16 ) {
+			auto const l =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( lhs + pos ) );
+			auto const r =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( rhs + pos ) );
+			auto const same = _mm_cmpeq_epi8(
+			  _mm_or_si128( l, ascii_case_bits( l, 'A' ) ),
+			  _mm_or_si128( r, ascii_case_bits( r, 'A' ) ) );
+			auto const mismatch = static_cast<unsigned>( _mm_movemask_epi8(
+			  _mm_or_si128( _mm_andnot_si128( same, _mm_set1_epi8( -1 ) ),
+			                _mm_or_si128( l, r ) ) ) );
+			if( mismatch != 0 ) {
+				return pos + scalar::lowest_set_bit( mismatch );
+			}
+		}
+		return pos + scalar::ascii_icase_prefix( lhs + pos, rhs + pos, n - pos );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	find_non_printable_ascii( char const *first, char const *last ) noexcept {
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			// Moves 0x20 to 0x7E to the bottom of the signed bytes
+			auto const moved = _mm_add_epi8( input, _mm_set1_epi8( 0x60 ) );
+			auto const printable = static_cast<unsigned>( _mm_movemask_epi8(
+			  _mm_cmplt_epi8( moved, _mm_set1_epi8( -128 + 0x5F ) ) ) );
+			if( printable != 0xFFFFU ) {
+				return first + scalar::lowest_set_bit( ~printable & 0xFFFFU );
+			}
+			first += 16;
+		}
+		return scalar::find_non_printable_ascii( first, last );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline char const *
+	advance_code_points( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		auto const max_trail = _mm_set1_epi8( -65 );
+		while( last - first >= 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) );
+			auto const leads = static_cast<unsigned>(
+			  _mm_movemask_epi8( _mm_cmpgt_epi8( input, max_trail ) ) );
+			auto const count = static_cast<size_t>( _mm_popcnt_u32( leads ) );
+			if( count > n ) {
+				return first + scalar::nth_set_bit( leads, n );
+			}
+			n -= count;
+			first += 16;
+		}
+		return scalar::advance_code_points( first, last, n );
+	}
+
+	/// The UTF-16 units of 16 bytes of valid UTF-8
+	DAW_UTF8_TARGET_SSE42 inline size_t utf16_units( __m128i input ) noexcept {
+		auto const leads = static_cast<unsigned>(
+		  _mm_movemask_epi8( _mm_cmpgt_epi8( input, _mm_set1_epi8( -65 ) ) ) );
+		// Signed, the bytes >= 0xF0 are -16 to -1
+		auto const four = static_cast<unsigned>(
+		  _mm_movemask_epi8( _mm_cmpgt_epi8( input, _mm_set1_epi8( -17 ) ) ) &
+		  _mm_movemask_epi8( input ) );
+		return static_cast<size_t>( _mm_popcnt_u32( leads ) +
+		                            _mm_popcnt_u32( four ) );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline size_t
+	utf8_utf16_length( char const *first, char const *last ) noexcept {
+		size_t result = 0;
+		while( last - first >= 16 ) {
+			result += utf16_units(
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) ) );
+			first += 16;
+		}
+		return result + scalar::utf8_utf16_length( first, last );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline advance_result
+	advance_utf16_units( char const *first, char const *last,
+	                     size_t n ) noexcept {
+		while( last - first >= 16 ) {
+			auto const units = utf16_units(
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) ) );
+			if( units > n ) {
+				break;
+			}
+			n -= units;
+			first += 16;
+		}
+		return scalar::advance_utf16_units( first, last, n );
+	}
+
+	DAW_UTF8_TARGET_SSE42 inline line_masks scan_lines( char const *first,
+	                                                    size_t count ) noexcept {
+		auto result = line_masks{ 0, 0 };
+		size_t n = 0;
+		for( ; count - n >= 16; n += 16 ) {
+			auto const input =
+			  _mm_loadu_si128( reinterpret_cast<__m128i const *>( first + n ) );
+			auto const newlines = static_cast<unsigned>( _mm_movemask_epi8(
+			  _mm_cmpeq_epi8( input, _mm_set1_epi8( '\n' ) ) ) );
+			auto const high = static_cast<unsigned>( _mm_movemask_epi8( input ) );
+			result.newlines |= static_cast<uint64_t>( newlines ) << n;
+			result.non_ascii |= static_cast<uint64_t>( high ) << n;
+		}
+		if( n != count ) {
+			auto const tail = scalar::scan_lines( first + n, count - n );
+			result.newlines |= tail.newlines << n;
+			result.non_ascii |= tail.non_ascii << n;
+		}
+		return result;
+	}
+} // namespace daw::utf8::simd::sse42
+
+#endif
@@ -0,0 +1,260 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "checked.h"
+#include "core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+/// Decoding where the action taken on invalid utf8 is chosen at compile time.
+/// utf_iterator<It, policy::replace> yields U+FFFD for each bad sequence,
+/// policy::skip drops them, policy::stop ends the range at the first one and
+/// policy::throw_error throws like utf8::next
+namespace daw::utf8 {
+	namespace policy {
+		enum class error_action { throw_error, replace, skip, stop };
+
+		struct throw_error {
+			static constexpr error_action action = error_action::throw_error;
+		};
+
+		/// Yield Replacement in place of each invalid sequence
+		template<uint32_t Replacement>
+		struct basic_replace {
+			static constexpr error_action action = error_action::replace;
+			static constexpr uint32_t replacement = Replacement;
+		};
+		using replace = basic_replace<0xFFFDU>;
+
+		struct skip {
+			static constexpr error_action action = error_action::skip;
+		};
+
+		struct stop {
+			static constexpr error_action action = error_action::stop;
+		};
+
+		template<typename, typename = void>
+		inline constexpr bool is_policy_v = false;
+
+		template<typename T>
+		inline constexpr bool is_policy_v<
+		  T, std::void_t<decltype( T::action )>> =
+		  std::is_same_v<std::remove_cv_t<decltype( T::action )>, error_action>;
+	} // namespace policy
+
+	namespace internal {
+		/// Move past an invalid sequence, one replacement covers the lead and
+		/// the trail octets that follow it.  Matches replace_invalid
+		template<typename octet_iterator>
+		constexpr void skip_invalid( octet_iterator &it, octet_iterator end,
+		                             utf_error err ) noexcept {
+			++it;
+			if( err == utf_error::INVALID_LEAD ) {
+				return;
+			}
+			while( it != end and utf8::internal::is_trail( *it ) ) {
+				++it;
+			}
+		}
+	} // namespace internal
+
+	/// Decode the code point at it, it != end, and move it past what was
+	/// consumed.  Returns false, leaving it at the invalid sequence, when
+	/// Policy is stop or when Policy is skip and only invalid octets remain
+	template<typename Policy, typename Engine = engine::classic,
+	         typename octet_iterator>
+	constexpr bool decode_next( octet_iterator &it, octet_iterator end,
+	                            uint32_t &code_point ) {
+		static_assert( policy::is_policy_v<Policy> );
+		if constexpr( Policy::action == policy::error_action::throw_error ) {
+			code_point = utf8::next<Engine>( it, end );
+			return true;
+		} else {
+			while( it != end ) {
+				auto const err = Engine::validate_next( it, end, code_point );
+				if( err == internal::utf_error::UTF8_OK ) {
+					return true;
+				}
+				if constexpr( Policy::action == policy::error_action::stop ) {
+					return false;
+				} else if constexpr( Policy::action ==
+				                     policy::error_action::replace ) {
+					internal::skip_invalid( it, end, err );
+					code_point = Policy::replacement;
+					return true;
+				} else {
+					internal::skip_invalid( it, end, err );
+				}
+			}
+			return false;
+		}
+	}
+
+	/// Decode [first, last) to out with Policy handling invalid sequences.
+	/// When Policy is stop decoding ends at the first invalid sequence,
+	/// find_invalid gives where.  Returns the end of the output
+	template<typename Policy, typename Engine = engine::classic,
+	         typename octet_iterator, typename u32bit_iterator>
+	constexpr u32bit_iterator decode( octet_iterator first, octet_iterator last,
+	                                  u32bit_iterator out ) {
+		uint32_t cp = 0;
+		while( first != last ) {
+			if( not utf8::decode_next<Policy, Engine>( first, last, cp ) ) {
+				break;
+			}
+			*out++ = cp;
+		}
+		return out;
+	}
+
+	/// Forward iterator over the code points of [first, last).  The code point
+	/// is decoded when the iterator moves, so dereferencing is free
+	template<typename octet_iterator, typename Policy = policy::throw_error,
+	         typename Engine = engine::classic>
+	class utf_iterator {
+		static_assert( policy::is_policy_v<Policy> );
+		static_assert( engine::is_engine_v<Engine> );
+
+		octet_iterator m_pos{ };
+		octet_iterator m_next{ };
+		octet_iterator m_last{ };
+		uint32_t m_code_point = 0;
+
+		constexpr void decode( ) {
+			if( m_next == m_last ) {
+				m_pos = m_last;
+				return;
+			}
+			if( not utf8::decode_next<Policy, Engine>( m_next, m_last,
+			                                           m_code_point ) ) {
+				// Only stop and skip get here, either way there is nothing left
+				m_pos = m_last;
+				m_next = m_last;
+			}
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = value_type const *;
+		using reference = value_type const &;
+		using policy_type = Policy;
+
+		constexpr utf_iterator( ) noexcept(
+		  std::is_nothrow_default_constructible_v<octet_iterator> ) = default;
+
+		constexpr utf_iterator( octet_iterator first, octet_iterator last )
+		  : m_pos( first )
+		  , m_next( first )
+		  , m_last( last ) {
+			decode( );
+		}
+
+		constexpr octet_iterator base( ) const {
+			return m_pos;
+		}
+
+		constexpr reference operator*( ) const noexcept {
+			return m_code_point;
+		}
+
+		constexpr pointer operator->( ) const noexcept {
+			return &m_code_point;
+		}
+
+		constexpr utf_iterator &operator++( ) {
+			m_pos = m_next;
+			decode( );
+			return *this;
+		}
+
+		constexpr utf_iterator operator++( int ) {
+			auto result = *this;
+			operator++( );
+			return result;
+		}
+
+		constexpr bool operator==( utf_iterator const &rhs ) const {
+			return m_pos == rhs.m_pos;
+		}
+
+		constexpr bool operator!=( utf_iterator const &rhs ) const {
+			return m_pos != rhs.m_pos;
+		}
+	}; // utf_iterator
+
+	/// The code points of [first, last) decoded with Policy, e.g.
+	/// policy_range<char const *, policy::skip>
+	template<typename octet_iterator, typename Policy = policy::throw_error,
+	         typename Engine = engine::classic>
+	class policy_range {
+		octet_iterator m_first{ };
+		octet_iterator m_last{ };
+
+	public:
+		using iterator = utf_iterator<octet_iterator, Policy, Engine>;
+		using const_iterator = iterator;
+		using value_type = uint32_t;
+		using policy_type = Policy;
+
+		constexpr policy_range( ) = default;
+
+		constexpr policy_range( octet_iterator first, octet_iterator last )
+		  : m_first( first )
+		  , m_last( last ) {}
+
+		template<
+		  typename Container,
+		  std::enable_if_t<not std::is_same_v<
+		                     policy_range,
+		                     std::remove_cv_t<std::remove_reference_t<Container>>>,
+		                   std::nullptr_t> = nullptr>
+		constexpr explicit policy_range( Container &&c )
+		  : m_first( std::begin( c ) )
+		  , m_last( std::end( c ) ) {}
+
+		constexpr iterator begin( ) const {
+			return iterator( m_first, m_last );
+		}
+
+		constexpr iterator end( ) const {
+			return iterator( m_last, m_last );
+		}
+
+		constexpr octet_iterator raw_begin( ) const {
+			return m_first;
+		}
+
+		constexpr octet_iterator raw_end( ) const {
+			return m_last;
+		}
+
+		/// Decoded code points, invalid sequences handled by Policy
+		inline std::u32string to_u32string( ) const {
+			auto result = std::u32string( );
+			utf8::decode<Policy, Engine>( m_first, m_last,
+			                              std::back_inserter( result ) );
+			return result;
+		}
+	}; // policy_range
+
+	template<typename Policy, typename Engine = engine::classic,
+	         typename octet_iterator>
+	constexpr policy_range<octet_iterator, Policy, Engine>
+	make_policy_range( octet_iterator first, octet_iterator last ) {
+		return { first, last };
+	}
+} // namespace daw::utf8
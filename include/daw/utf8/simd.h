@@ -0,0 +1,144 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined( __SSE2__ ) or defined( _M_X64 ) or                               \
+  ( defined( _M_IX86_FP ) and _M_IX86_FP >= 2 )
+#include <emmintrin.h>
+#define DAW_UTF8_HAS_SSE2
+#endif
+
+/// x86-64 builds compile the ISA specific kernels that are selected at
+/// runtime by utf8/dispatch.h.  Define DAW_UTF8_NO_SIMD to only build the
+/// scalar kernels
+#if not defined( DAW_UTF8_NO_SIMD ) and                                      \
+  ( defined( __x86_64__ ) or defined( _M_X64 ) )
+#define DAW_UTF8_X86_KERNELS
+#include <immintrin.h>
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#include <intrin.h>
+// MSVC allows any intrinsic without a target flag
+#define DAW_UTF8_TARGET( ... )
+#else
+#define DAW_UTF8_TARGET( ... ) __attribute__( ( target( __VA_ARGS__ ) ) )
+#endif
+#define DAW_UTF8_TARGET_SSE42 DAW_UTF8_TARGET( "sse4.2,popcnt" )
+#define DAW_UTF8_TARGET_AVX2 DAW_UTF8_TARGET( "avx2,bmi,bmi2,popcnt" )
+#define DAW_UTF8_TARGET_AVX512                                                 \
+  DAW_UTF8_TARGET( "avx512f,avx512bw,avx512vl,avx2,bmi,bmi2,popcnt" )
+#endif
+
+/// Byte scanning helpers used by the range and string types.  Each has a SSE2
+/// path when it is available at compile time and a portable scalar path
+namespace daw::utf8::simd {
+	/// Byte order of the host, the UTF-16 kernels swap units that differ
+#if defined( __BYTE_ORDER__ ) and defined( __ORDER_BIG_ENDIAN__ ) and        \
+  __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	inline constexpr bool big_endian_host = true;
+#else
+	inline constexpr bool big_endian_host = false;
+#endif
+
+	/// Where a transcoder that can stop early stopped reading and writing
+	struct transcode_result {
+		char const *input;
+		char *output;
+	};
+
+	/// Where an advance through valid UTF-8 stopped and what was left of the
+	/// count it was given
+	struct advance_result {
+		char const *position;
+		size_t remaining;
+	};
+
+	/// The bytes of a block of up to 64 that are a newline and that are >=
+	/// 0x80, bit n is for byte n of the block
+	struct line_masks {
+		uint64_t newlines;
+		uint64_t non_ascii;
+	};
+
+	/// Nibble tables for the Teddy prefilter of range::multi_matcher.  Patterns
+	/// are grouped into up to 8 buckets, bit b of lo[k][n] is set when a
+	/// pattern in bucket b has a byte with the low nibble n at position k.  hi
+	/// is the same for the high nibble
+	struct teddy_masks {
+		alignas( 16 ) uint8_t lo[3][16];
+		alignas( 16 ) uint8_t hi[3][16];
+		/// Bytes of each pattern that are compared, 1 to 3
+		unsigned length;
+	};
+
+	/// Up to 64 positions starting at position.  A pattern from each bucket
+	/// set in buckets[n] may start at position + n, n < size, and bit n of
+	/// candidates is set when buckets[n] is not 0
+	struct teddy_block {
+		char const *position;
+		size_t size;
+		uint64_t candidates;
+	};
+
+	/// A set of bytes for find_not_in_set.  Bytes below 0x80 are always in
+	/// it, byte h * 16 + l above is when bit h - 8 of rows[l] is set so that
+	/// a vector of bytes is looked up with two shuffles
+	struct byte_set {
+		alignas( 16 ) uint8_t rows[16];
+
+		constexpr bool contains( uint8_t b ) const noexcept {
+			return b < 0x80U or
+			       ( ( rows[b & 0x0FU] >> ( ( b >> 4U ) - 8U ) ) & 1U ) != 0;
+		}
+	};
+
+	/// The set with the bytes >= 0x80 that bit b % 64 of bits[b / 64] is set
+	/// for
+	constexpr byte_set make_byte_set( uint64_t const ( &bits )[4] ) noexcept {
+		auto result = byte_set{ };
+		for( unsigned b = 0x80; b < 0x100; ++b ) {
+			if( ( ( bits[b / 64U] >> ( b % 64U ) ) & 1U ) != 0 ) {
+				result.rows[b & 0x0FU] = static_cast<uint8_t>(
+				  result.rows[b & 0x0FU] | ( 1U << ( ( b >> 4U ) - 8U ) ) );
+			}
+		}
+		return result;
+	}
+
+	/// The largest byte value in [first, last), 0 when empty
+	inline uint8_t max_byte( char const *first, char const *last ) noexcept {
+		uint8_t result = 0;
+#if defined( DAW_UTF8_HAS_SSE2 )
+		auto acc = _mm_setzero_si128( );
+		while( last - first >= 16 ) {
+			acc = _mm_max_epu8(
+			  acc, _mm_loadu_si128( reinterpret_cast<__m128i const *>( first ) ) );
+			first += 16;
+		}
+		alignas( 16 ) uint8_t lanes[16];
+		_mm_store_si128( reinterpret_cast<__m128i *>( lanes ), acc );
+		for( auto b : lanes ) {
+			result = b > result ? b : result;
+		}
+#endif
+		for( ; first != last; ++first ) {
+			auto const b = static_cast<uint8_t>( *first );
+			result = b > result ? b : result;
+		}
+		return result;
+	}
+
+	/// True when every byte in [first, last) is < 0x80
+	inline bool is_ascii( char const *first, char const *last ) noexcept {
+		return max_byte( first, last ) < 0x80U;
+	}
+} // namespace daw::utf8::simd
@@ -0,0 +1,308 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "core.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined( DAW_UTF8_STATS )
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#if defined( _MSC_VER ) and not defined( __clang__ )
+#include <intrin.h>
+#elif defined( __x86_64__ ) or defined( __i386__ )
+#include <x86intrin.h>
+#endif
+#endif
+
+/// Counters for the dispatched utf8 operations.  They are only collected when
+/// DAW_UTF8_STATS is defined, otherwise every recording function is empty and
+/// snapshot( ) returns zeros.  Each thread writes its own counters, a
+/// snapshot sums them along with those of threads that have exited
+namespace daw::utf8::stats {
+#if defined( DAW_UTF8_STATS )
+	inline constexpr bool enabled = true;
+#else
+	inline constexpr bool enabled = false;
+#endif
+
+	enum class operation : uint8_t {
+		validate,
+		count,
+		utf8to16,
+		utf8to32,
+		utf16to8,
+		utf32to8,
+		validate_utf16,
+		count_utf16,
+		latin1to8,
+		utf8tolatin1,
+		count_latin1,
+		search
+	};
+	inline constexpr size_t operation_count = 12;
+	/// Matches utf8::dispatch::isa
+	inline constexpr size_t tier_count = 4;
+	/// Indexed by utf8::internal::utf_error
+	inline constexpr size_t error_kind_count = 6;
+
+	struct operation_stats {
+		uint64_t calls = 0;
+		uint64_t bytes = 0;
+		/// TSC cycles on x86, nanoseconds elsewhere
+		uint64_t cycles = 0;
+	};
+
+	struct snapshot {
+		std::array<operation_stats, operation_count> operations = { };
+		std::array<uint64_t, tier_count> tier_calls = { };
+		std::array<uint64_t, error_kind_count> invalid = { };
+		/// ASCII bytes among the valid bytes that were validated
+		uint64_t ascii_bytes = 0;
+		uint64_t ascii_scanned = 0;
+
+		[[nodiscard]] constexpr operation_stats const &
+		operator[]( operation op ) const noexcept {
+			return operations[static_cast<size_t>( op )];
+		}
+
+		[[nodiscard]] constexpr uint64_t bytes_validated( ) const noexcept {
+			return ( *this )[operation::validate].bytes;
+		}
+
+		/// Input bytes of all the transcoding operations
+		[[nodiscard]] constexpr uint64_t bytes_transcoded( ) const noexcept {
+			uint64_t result = 0;
+			for( auto op :
+			     { operation::utf8to16, operation::utf8to32, operation::utf16to8,
+			       operation::utf32to8, operation::latin1to8,
+			       operation::utf8tolatin1 } ) {
+				result += ( *this )[op].bytes;
+			}
+			return result;
+		}
+
+		[[nodiscard]] constexpr uint64_t
+		invalid_count( utf8::internal::utf_error kind ) const noexcept {
+			return invalid[static_cast<size_t>( kind )];
+		}
+
+		[[nodiscard]] constexpr double ascii_fraction( ) const noexcept {
+			if( ascii_scanned == 0 ) {
+				return 0.0;
+			}
+			return static_cast<double>( ascii_bytes ) /
+			       static_cast<double>( ascii_scanned );
+		}
+	};
+
+#if defined( DAW_UTF8_STATS )
+	namespace internal {
+		/// Written only by its owning thread, read by snapshot( )
+		struct counter {
+			std::atomic<uint64_t> value{ 0 };
+
+			inline void add( uint64_t n ) noexcept {
+				value.store( value.load( std::memory_order_relaxed ) + n,
+				             std::memory_order_relaxed );
+			}
+
+			[[nodiscard]] inline uint64_t get( ) const noexcept {
+				return value.load( std::memory_order_relaxed );
+			}
+		};
+
+		struct counters {
+			std::array<counter, operation_count> calls;
+			std::array<counter, operation_count> bytes;
+			std::array<counter, operation_count> cycles;
+			std::array<counter, tier_count> tier_calls;
+			std::array<counter, error_kind_count> invalid;
+			counter ascii_bytes;
+			counter ascii_scanned;
+
+			inline void add_to( snapshot &s ) const noexcept {
+				for( size_t n = 0; n < operation_count; ++n ) {
+					s.operations[n].calls += calls[n].get( );
+					s.operations[n].bytes += bytes[n].get( );
+					s.operations[n].cycles += cycles[n].get( );
+				}
+				for( size_t n = 0; n < tier_count; ++n ) {
+					s.tier_calls[n] += tier_calls[n].get( );
+				}
+				for( size_t n = 0; n < error_kind_count; ++n ) {
+					s.invalid[n] += invalid[n].get( );
+				}
+				s.ascii_bytes += ascii_bytes.get( );
+				s.ascii_scanned += ascii_scanned.get( );
+			}
+		};
+
+		struct registry {
+			std::mutex mutex;
+			std::vector<counters const *> live;
+			snapshot retired;
+			/// Counts from before the last reset( ) that are subtracted
+			snapshot baseline;
+		};
+
+		inline registry &get_registry( ) {
+			static registry result;
+			return result;
+		}
+
+		/// Registers itself while its thread is alive and folds its counts into
+		/// the retired totals when the thread exits
+		struct thread_counters {
+			counters values;
+
+			inline thread_counters( ) {
+				auto &reg = get_registry( );
+				auto const lck = std::lock_guard<std::mutex>( reg.mutex );
+				reg.live.push_back( &values );
+			}
+
+			inline ~thread_counters( ) {
+				auto &reg = get_registry( );
+				auto const lck = std::lock_guard<std::mutex>( reg.mutex );
+				values.add_to( reg.retired );
+				reg.live.erase(
+				  std::find( reg.live.begin( ), reg.live.end( ), &values ) );
+			}
+
+			thread_counters( thread_counters const & ) = delete;
+			thread_counters &operator=( thread_counters const & ) = delete;
+		};
+
+		inline counters &local( ) {
+			static thread_local thread_counters result;
+			return result.values;
+		}
+
+		inline uint64_t now( ) noexcept {
+#if defined( __x86_64__ ) or defined( __i386__ ) or defined( _M_X64 ) or      \
+  defined( _M_IX86 )
+			return __rdtsc( );
+#else
+			return static_cast<uint64_t>(
+			  std::chrono::duration_cast<std::chrono::nanoseconds>(
+			    std::chrono::steady_clock::now( ).time_since_epoch( ) )
+			    .count( ) );
+#endif
+		}
+
+		inline void subtract( snapshot &s, snapshot const &base ) noexcept {
+			for( size_t n = 0; n < operation_count; ++n ) {
+				s.operations[n].calls -= base.operations[n].calls;
+				s.operations[n].bytes -= base.operations[n].bytes;
+				s.operations[n].cycles -= base.operations[n].cycles;
+			}
+			for( size_t n = 0; n < tier_count; ++n ) {
+				s.tier_calls[n] -= base.tier_calls[n];
+			}
+			for( size_t n = 0; n < error_kind_count; ++n ) {
+				s.invalid[n] -= base.invalid[n];
+			}
+			s.ascii_bytes -= base.ascii_bytes;
+			s.ascii_scanned -= base.ascii_scanned;
+		}
+
+		inline snapshot total( registry &reg ) {
+			auto result = reg.retired;
+			for( auto c : reg.live ) {
+				c->add_to( result );
+			}
+			return result;
+		}
+	} // namespace internal
+
+	/// Times one operation from construction to destruction
+	class scoped_operation {
+		operation m_op;
+		size_t m_tier;
+		uint64_t m_bytes;
+		uint64_t m_start;
+
+	public:
+		inline scoped_operation( operation op, size_t tier, size_t bytes ) noexcept
+		  : m_op( op )
+		  , m_tier( tier )
+		  , m_bytes( bytes )
+		  , m_start( internal::now( ) ) {}
+
+		inline ~scoped_operation( ) {
+			auto const elapsed = internal::now( ) - m_start;
+			auto &c = internal::local( );
+			auto const n = static_cast<size_t>( m_op );
+			c.calls[n].add( 1 );
+			c.bytes[n].add( m_bytes );
+			c.cycles[n].add( elapsed );
+			c.tier_calls[m_tier].add( 1 );
+		}
+
+		scoped_operation( scoped_operation const & ) = delete;
+		scoped_operation &operator=( scoped_operation const & ) = delete;
+	};
+
+	/// Record the share of ASCII in [first, last)
+	inline void record_ascii( char const *first, char const *last ) {
+		uint64_t ascii = 0;
+		for( auto it = first; it != last; ++it ) {
+			ascii += static_cast<unsigned char>( *it ) < 0x80U ? 1U : 0U;
+		}
+		auto &c = internal::local( );
+		c.ascii_bytes.add( ascii );
+		c.ascii_scanned.add( static_cast<uint64_t>( last - first ) );
+	}
+
+	/// Record the kind of the invalid sequence that starts at pos
+	inline void record_invalid( char const *pos, char const *last ) {
+		auto it = pos;
+		auto const kind = utf8::internal::validate_next( it, last );
+		internal::local( ).invalid[static_cast<size_t>( kind )].add( 1 );
+	}
+
+	/// Totals of every thread since the start or the last reset( )
+	inline snapshot take_snapshot( ) {
+		auto &reg = internal::get_registry( );
+		auto const lck = std::lock_guard<std::mutex>( reg.mutex );
+		auto result = internal::total( reg );
+		internal::subtract( result, reg.baseline );
+		return result;
+	}
+
+	/// Start counting from zero again
+	inline void reset( ) {
+		auto &reg = internal::get_registry( );
+		auto const lck = std::lock_guard<std::mutex>( reg.mutex );
+		reg.baseline = internal::total( reg );
+	}
+#else
+	class scoped_operation {
+	public:
+		constexpr scoped_operation( operation, size_t, size_t ) noexcept {}
+	};
+
+	constexpr void record_ascii( char const *, char const * ) noexcept {}
+
+	constexpr void record_invalid( char const *, char const * ) noexcept {}
+
+	constexpr snapshot take_snapshot( ) noexcept {
+		return { };
+	}
+
+	constexpr void reset( ) noexcept {}
+#endif
+} // namespace daw::utf8::stats
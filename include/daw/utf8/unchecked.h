@@ -67,14 +67,14 @@ namespace daw::utf8::unchecked {
 			break;
 		case 2:
 			++it;
-			cp = ( ( cp << 6 ) & 0x7ff ) + ( ( *it ) & 0x3f );
+			cp = ( ( cp << 6 ) & 0x7ff ) + ( utf8::internal::mask8( *it ) & 0x3f );
 			break;
 		case 3:
 			++it;
 			cp = ( ( cp << 12 ) & 0xffff ) +
 			     ( ( utf8::internal::mask8( *it ) << 6 ) & 0xfff );
 			++it;
-			cp += ( *it ) & 0x3f;
+			cp += utf8::internal::mask8( *it ) & 0x3f;
 			break;
 		case 4:
 			++it;
@@ -83,7 +83,7 @@ namespace daw::utf8::unchecked {
 			++it;
 			cp += ( utf8::internal::mask8( *it ) << 6 ) & 0xfff;
 			++it;
-			cp += ( *it ) & 0x3f;
+			cp += utf8::internal::mask8( *it ) & 0x3f;
 			break;
 		}
 		++it;
@@ -185,7 +185,7 @@ namespace daw::utf8::unchecked {
 	// The iterator class
 	template<typename octet_iterator>
 	class iterator {
-		octet_iterator it;
+		octet_iterator it{ };
 
 	public:
 		using iterator_category = std::bidirectional_iterator_tag;
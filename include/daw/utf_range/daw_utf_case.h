@@ -0,0 +1,318 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "daw_utf_string.h"
+#include "impl/daw_utf_case_tables.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// Full case mapping and case folding.  A code point can map to up to three,
+/// ß is SS in upper case.  The mappings of SpecialCasing.txt that depend on
+/// the language or on the text around a code point, like a final sigma,
+/// are not applied.  Runs of ASCII are mapped and compared with the
+/// dispatched kernels, other code points are looked up in tables generated
+/// by tools/gen_unicode_tables.py
+namespace daw::range {
+	namespace impl {
+		/// The columns of case_deltas
+		enum class case_mapping : uint8_t { lower, upper, fold };
+
+		/// Write the code points cp maps to to out, returns how many there are
+		inline size_t map_case( char32_t cp, case_mapping mapping,
+		                        char32_t *out ) noexcept {
+			auto const column = static_cast<unsigned>( mapping );
+			auto const kind = case_kind( cp );
+			if( kind != special_casing_kind ) {
+				*out = static_cast<char32_t>( static_cast<int32_t>( cp ) +
+				                              case_deltas[3U * kind + column] );
+				return 1;
+			}
+			auto const pos =
+			  std::lower_bound( std::begin( special_casing_code_points ),
+			                    std::end( special_casing_code_points ), cp ) -
+			  std::begin( special_casing_code_points );
+			auto units = special_casing_pool + special_casing_index[pos];
+			auto const lengths = *units++;
+			for( unsigned n = 0; n < column; ++n ) {
+				units += ( lengths >> ( 4U * n ) ) & 0x0FU;
+			}
+			auto const count =
+			  static_cast<size_t>( ( lengths >> ( 4U * column ) ) & 0x0FU );
+			std::copy( units, units + count, out );
+			return count;
+		}
+
+		/// The code points lead starts all map to themselves, lead >= 0x80
+		constexpr bool is_uncased_lead( uint8_t lead ) noexcept {
+			return ( ( uncased_leads[lead >> 6U] >> ( lead & 63U ) ) & 1U ) != 0;
+		}
+
+		/// Map [first, last) a block at a time, sink( block_first, block_last )
+		/// receives the utf8 of each.  Returns the number of code points
+		template<typename Sink>
+		size_t map_case( char const *first, char const *last,
+		                 case_mapping mapping, Sink &&sink ) {
+			// Three code points of up to three bytes each
+			constexpr std::ptrdiff_t largest = 9;
+			char buffer[512];
+			auto const buffer_last = buffer + sizeof( buffer );
+			auto out = buffer + 0;
+			bool const upper = mapping == case_mapping::upper;
+			auto const lo = static_cast<uint8_t>( upper ? 'a' : 'A' );
+			size_t result = 0;
+			while( first != last ) {
+				if( auto const b = static_cast<uint8_t>( *first ); b < 0x80U ) {
+					*out++ = static_cast<char>(
+					  static_cast<uint8_t>( b - lo ) < 26U ? b ^ 0x20U : b );
+					++first;
+					++result;
+					// The rest of a run of ASCII is mapped by the kernels, single
+					// ASCII code points like the spaces between words are not
+					// worth it
+					if( first != last and static_cast<uint8_t>( *first ) < 0x80U ) {
+						auto const block_last =
+						  first + std::min( last - first, buffer_last - out );
+						auto const stop =
+						  utf8::dispatch::ascii_case_map( first, block_last, out, upper );
+						out += stop - first;
+						result += static_cast<size_t>( stop - first );
+						first = stop;
+					}
+				} else if( is_uncased_lead( static_cast<uint8_t>( *first ) ) ) {
+					// Copied without decoding
+					auto const lead = static_cast<uint8_t>( *first );
+					auto const length = 2 + ( lead >= 0xE0U ? 1 : 0 ) +
+					                    ( lead >= 0xF0U ? 1 : 0 );
+					out = std::copy( first, first + length, out );
+					first += length;
+					++result;
+				} else {
+					char32_t mapped[3];
+					auto const count =
+					  map_case( utf8::unchecked::next( first ), mapping, mapped );
+					for( size_t n = 0; n < count; ++n ) {
+						out = utf8::unchecked::append( mapped[n], out );
+					}
+					result += count;
+				}
+				if( buffer_last - out < largest ) {
+					sink( buffer + 0, static_cast<char const *>( out ) );
+					out = buffer;
+				}
+			}
+			sink( buffer + 0, static_cast<char const *>( out ) );
+			return result;
+		}
+
+		inline utf_string map_case( utf_range const &text,
+		                            case_mapping mapping ) {
+			auto buffer = std::string( );
+			buffer.reserve( text.raw_size( ) );
+			auto const size =
+			  map_case( text.raw_begin( ), text.raw_end( ), mapping,
+			            [&]( char const *first, char const *last ) {
+				            buffer.append( first, last );
+			            } );
+			auto result = utf_range( );
+			result.set( utf_iterator( buffer.data( ) ),
+			            utf_iterator( buffer.data( ) + buffer.size( ) ),
+			            static_cast<utf_range::difference_type>( size ) );
+			return utf_string( result );
+		}
+
+		/// The case folded code points of a text, one at a time
+		class case_fold_reader {
+			char const *m_first;
+			char const *m_last;
+			char32_t m_pending[3]{ };
+			uint8_t m_pos = 0;
+			uint8_t m_size = 0;
+
+		public:
+			case_fold_reader( char const *first, char const *last ) noexcept
+			  : m_first( first )
+			  , m_last( last ) {}
+
+			/// Nothing of a code point that has been read is left
+			constexpr bool at_boundary( ) const noexcept {
+				return m_pos == m_size;
+			}
+
+			constexpr bool done( ) const noexcept {
+				return m_pos == m_size and m_first == m_last;
+			}
+
+			constexpr char const *position( ) const noexcept {
+				return m_first;
+			}
+
+			/// Skip n bytes, at_boundary( ) and they are whole code points
+			constexpr void skip( size_t n ) noexcept {
+				m_first += n;
+			}
+
+			/// The next code point, not done( )
+			char32_t next( ) noexcept {
+				if( m_pos != m_size ) {
+					return m_pending[m_pos++];
+				}
+				auto const b = static_cast<uint8_t>( *m_first );
+				if( b < 0x80U ) {
+					++m_first;
+					return static_cast<uint8_t>( b - 'A' ) < 26U ? b | 0x20U : b;
+				}
+				auto const cp = utf8::unchecked::next( m_first );
+				if( is_uncased_lead( b ) ) {
+					return cp;
+				}
+				m_size = static_cast<uint8_t>(
+				  map_case( cp, case_mapping::fold, m_pending ) );
+				m_pos = 1;
+				return m_pending[0];
+			}
+		};
+
+		/// FNV-1a of [first, last) continued from hash
+		constexpr size_t fnv1a_append( size_t hash, char const *first,
+		                               char const *last ) noexcept {
+			constexpr auto prime = static_cast<size_t>(
+			  sizeof( size_t ) == 8 ? 1099511628211ULL : 16777619ULL );
+			for( ; first != last; ++first ) {
+				hash ^= static_cast<uint8_t>( *first );
+				hash *= prime;
+			}
+			return hash;
+		}
+	} // namespace impl
+
+	/// text with each code point mapped to lower case
+	inline utf_string to_lower( utf_range const &text ) {
+		return impl::map_case( text, impl::case_mapping::lower );
+	}
+
+	inline utf_string to_lower( utf_string const &text ) {
+		return to_lower( text.utf_range( ) );
+	}
+
+	/// text with each code point mapped to upper case
+	inline utf_string to_upper( utf_range const &text ) {
+		return impl::map_case( text, impl::case_mapping::upper );
+	}
+
+	inline utf_string to_upper( utf_string const &text ) {
+		return to_upper( text.utf_range( ) );
+	}
+
+	/// The case folding of text, texts that differ only in case fold to the
+	/// same one
+	inline utf_string case_fold( utf_range const &text ) {
+		return impl::map_case( text, impl::case_mapping::fold );
+	}
+
+	inline utf_string case_fold( utf_string const &text ) {
+		return case_fold( text.utf_range( ) );
+	}
+
+	/// Compare the case foldings of lhs and rhs by code point, like
+	/// utf_range::compare.  Nothing is allocated, the texts are folded as they
+	/// are compared
+	inline int compare_icase( utf_range const &lhs,
+	                          utf_range const &rhs ) noexcept {
+		auto l = impl::case_fold_reader( lhs.raw_begin( ), lhs.raw_end( ) );
+		auto r = impl::case_fold_reader( rhs.raw_begin( ), rhs.raw_end( ) );
+		auto const l_last = lhs.raw_end( );
+		auto const r_last = rhs.raw_end( );
+		while( true ) {
+			if( l.done( ) ) {
+				return r.done( ) ? 0 : -1;
+			}
+			if( r.done( ) ) {
+				return 1;
+			}
+			auto const a = l.next( );
+			auto const b = r.next( );
+			if( a != b ) {
+				return a < b ? -1 : 1;
+			}
+			// The kernel takes over when both continue a run of ASCII, single
+			// ASCII code points like the spaces between words are not worth it
+			if( a < 0x80U and l.at_boundary( ) and r.at_boundary( ) and
+			    not l.done( ) and not r.done( ) and
+			    static_cast<uint8_t>( *l.position( ) | *r.position( ) ) < 0x80U ) {
+				auto const n = static_cast<size_t>( std::min(
+				  l_last - l.position( ), r_last - r.position( ) ) );
+				auto const same = utf8::dispatch::ascii_icase_prefix(
+				  l.position( ), r.position( ), n );
+				l.skip( same );
+				r.skip( same );
+			}
+		}
+	}
+
+	inline int compare_icase( utf_string const &lhs,
+	                          utf_string const &rhs ) noexcept {
+		return compare_icase( lhs.utf_range( ), rhs.utf_range( ) );
+	}
+
+	/// A hash of the case folding of text, texts that compare_icase finds
+	/// equal hash the same.  Nothing is allocated
+	inline size_t hash_icase( utf_range const &text ) noexcept {
+		auto result = static_cast<size_t>(
+		  sizeof( size_t ) == 8 ? 14695981039346656037ULL : 2166136261ULL );
+		(void)impl::map_case( text.raw_begin( ), text.raw_end( ),
+		                      impl::case_mapping::fold,
+		                      [&]( char const *first, char const *last ) {
+			                      result = impl::fnv1a_append( result, first, last );
+		                      } );
+		return result;
+	}
+
+	inline size_t hash_icase( utf_string const &text ) noexcept {
+		return hash_icase( text.utf_range( ) );
+	}
+
+	/// Hash for unordered containers keyed on text ignoring case
+	struct icase_hash {
+		using is_transparent = void;
+
+		inline size_t operator( )( utf_range const &text ) const noexcept {
+			return hash_icase( text );
+		}
+
+		inline size_t operator( )( utf_string const &text ) const noexcept {
+			return hash_icase( text );
+		}
+	};
+
+	/// Equality for unordered containers keyed on text ignoring case
+	struct icase_equal_to {
+		using is_transparent = void;
+
+		template<typename T, typename U>
+		inline bool operator( )( T const &lhs, U const &rhs ) const noexcept {
+			return compare_icase( as_range( lhs ), as_range( rhs ) ) == 0;
+		}
+
+	private:
+		static utf_range as_range( utf_range const &text ) noexcept {
+			return text;
+		}
+
+		static utf_range as_range( utf_string const &text ) noexcept {
+			return text.utf_range( );
+		}
+	};
+} // namespace daw::range
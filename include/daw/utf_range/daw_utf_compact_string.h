@@ -0,0 +1,468 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/simd.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "daw_utf_string.h"
+
+#include <daw/daw_exception.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace daw {
+	/// A string of code points stored with the narrowest fixed width that can
+	/// hold all of them: 1 byte per code point for Latin-1, 2 for text within
+	/// the BMP and 4 otherwise.  Indexing by code point is O(1).  A utf8 copy
+	/// is made on the first call that needs one, so concurrent first calls to
+	/// utf_range( )/to_string( ) on the same object must be synchronized.
+	/// Text that is all ASCII is already utf8 and is never copied.
+	class compact_utf_string {
+	public:
+		using value_type = range::utf_val_type;
+		using reference = value_type;
+		using const_reference = value_type;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		class const_iterator;
+		using iterator = const_iterator;
+
+	private:
+		using storage_t = std::variant<std::string, std::u16string, std::u32string>;
+
+		storage_t m_values = std::string( );
+		bool m_is_ascii = true;
+		mutable std::string m_utf8 = { };
+		mutable bool m_has_utf8 = false;
+
+		/// Code unit width needed for valid utf8 text whose largest byte is
+		/// max_byte.  Lead bytes of 0xC4 and up encode U+0100 or higher and 0xF0
+		/// and up encode code points outside the BMP
+		[[nodiscard]] static constexpr size_t
+		width_for_max_byte( uint8_t max_byte ) noexcept {
+			if( max_byte < 0xC4U ) {
+				return 1;
+			}
+			if( max_byte < 0xF0U ) {
+				return 2;
+			}
+			return 4;
+		}
+
+		/// A stored code unit as a code point.  Latin-1 is held in char, which
+		/// may be signed
+		template<typename CharT>
+		[[nodiscard]] static constexpr uint32_t code_point( CharT cu ) noexcept {
+			if constexpr( std::is_same_v<CharT, char> ) {
+				return static_cast<uint8_t>( cu );
+			} else {
+				return static_cast<uint32_t>( cu );
+			}
+		}
+
+		template<typename String>
+		[[nodiscard]] static inline String decode( range::char_iterator first,
+		                                           range::char_iterator last,
+		                                           size_t count ) {
+			auto result = String( );
+			result.resize( count );
+			auto out = result.data( );
+			while( first != last ) {
+				*out++ = static_cast<typename String::value_type>(
+				  utf8::unchecked::next( first ) );
+			}
+			assert( out == result.data( ) + result.size( ) );
+			return result;
+		}
+
+		inline void assign( range::utf_range text ) {
+			auto const first = text.raw_begin( );
+			auto const last = text.raw_end( );
+			auto const max_byte = utf8::simd::max_byte( first, last );
+			m_is_ascii = max_byte < 0x80U;
+			m_has_utf8 = false;
+			m_utf8.clear( );
+			if( m_is_ascii ) {
+				m_values = std::string( first, last );
+				return;
+			}
+			switch( width_for_max_byte( max_byte ) ) {
+			case 1:
+				m_values = decode<std::string>( first, last, text.size( ) );
+				break;
+			case 2:
+				m_values = decode<std::u16string>( first, last, text.size( ) );
+				break;
+			default:
+				m_values = decode<std::u32string>( first, last, text.size( ) );
+				break;
+			}
+		}
+
+		template<typename CharT>
+		inline void assign( std::basic_string_view<CharT> cps ) {
+			uint32_t max_cp = 0;
+			for( auto cu : cps ) {
+				auto const cp = code_point( cu );
+				daw::exception::precondition_check<utf8::invalid_code_point>(
+				  utf8::internal::is_code_point_valid( cp ), cp );
+				max_cp = std::max( max_cp, cp );
+			}
+			m_is_ascii = max_cp < 0x80U;
+			m_has_utf8 = false;
+			m_utf8.clear( );
+			if( max_cp < 0x100U ) {
+				m_values = std::string( cps.begin( ), cps.end( ) );
+			} else if( max_cp < 0x10000U ) {
+				m_values = std::u16string( cps.begin( ), cps.end( ) );
+			} else {
+				m_values = std::u32string( cps.begin( ), cps.end( ) );
+			}
+		}
+
+	public:
+		compact_utf_string( ) = default;
+
+		inline compact_utf_string( range::utf_range text ) {
+			assign( text );
+		}
+
+		inline compact_utf_string( daw::string_view text ) {
+			assign( range::create_char_range( text ) );
+		}
+
+		inline compact_utf_string( char const *text ) {
+			assign( range::create_char_range( text ) );
+		}
+
+		explicit inline compact_utf_string( utf_string const &text ) {
+			assign( text.utf_range( ) );
+		}
+
+		explicit inline compact_utf_string( std::u32string_view text ) {
+			assign( text );
+		}
+
+		/// Call func with a std::basic_string_view over the stored code units.
+		/// The code unit type is char(Latin-1), char16_t or char32_t.  Hot loops
+		/// should use this to avoid a width check per code point
+		template<typename Function>
+		inline decltype( auto ) visit( Function &&func ) const {
+			return std::visit(
+			  [&]( auto const &str ) {
+				  using char_t = typename std::decay_t<decltype( str )>::value_type;
+				  return func( std::basic_string_view<char_t>( str ) );
+			  },
+			  m_values );
+		}
+
+		/// Bytes per code point of the storage, 1, 2 or 4
+		[[nodiscard]] inline size_t char_width( ) const noexcept {
+			switch( m_values.index( ) ) {
+			case 0:
+				return 1;
+			case 1:
+				return 2;
+			default:
+				return 4;
+			}
+		}
+
+		[[nodiscard]] inline bool is_ascii( ) const noexcept {
+			return m_is_ascii;
+		}
+
+		/// Number of code points
+		[[nodiscard]] inline size_t size( ) const noexcept {
+			return std::visit( []( auto const &str ) { return str.size( ); },
+			                   m_values );
+		}
+
+		[[nodiscard]] inline bool empty( ) const noexcept {
+			return size( ) == 0;
+		}
+
+		/// The code point at pos.  pos must be < size( )
+		[[nodiscard]] inline value_type operator[]( size_t pos ) const noexcept {
+			assert( pos < size( ) );
+			switch( m_values.index( ) ) {
+			case 0:
+				return static_cast<uint8_t>(
+				  std::get_if<0>( &m_values )->data( )[pos] );
+			case 1:
+				return std::get_if<1>( &m_values )->data( )[pos];
+			default:
+				return std::get_if<2>( &m_values )->data( )[pos];
+			}
+		}
+
+		[[nodiscard]] inline value_type at( size_t pos ) const {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos < size( ), "Attempt to access compact_utf_string past end" );
+			return operator[]( pos );
+		}
+
+		/// The code points [pos, pos + length), stored in the narrowest width for
+		/// that part
+		[[nodiscard]] inline compact_utf_string substr( size_t pos,
+		                                                size_t length ) const {
+			assert( pos + length <= size( ) );
+			auto result = compact_utf_string( );
+			visit( [&]( auto sv ) { result.assign( sv.substr( pos, length ) ); } );
+			return result;
+		}
+
+		/// A range over the utf8 form of the string.  It is created on first use
+		[[nodiscard]] inline range::utf_range utf_range( ) const {
+			if( m_is_ascii ) {
+				auto const &str = *std::get_if<0>( &m_values );
+				return range::utf_range( ).set(
+				  range::utf_iterator( str.data( ) ),
+				  range::utf_iterator( str.data( ) + str.size( ) ),
+				  static_cast<difference_type>( str.size( ) ) );
+			}
+			if( not m_has_utf8 ) {
+				m_utf8.clear( );
+				visit( [&]( auto sv ) {
+					for( auto cu : sv ) {
+						utf8::unchecked::append( code_point( cu ),
+						                         std::back_inserter( m_utf8 ) );
+					}
+				} );
+				m_has_utf8 = true;
+			}
+			return range::utf_range( ).set(
+			  range::utf_iterator( m_utf8.data( ) ),
+			  range::utf_iterator( m_utf8.data( ) + m_utf8.size( ) ),
+			  static_cast<difference_type>( size( ) ) );
+		}
+
+		[[nodiscard]] inline std::string to_string( ) const {
+			return range::to_string( utf_range( ) );
+		}
+
+		[[nodiscard]] inline std::u32string to_u32string( ) const {
+			return visit( []( auto sv ) {
+				auto result = std::u32string( sv.size( ), U'\0' );
+				for( size_t n = 0; n < sv.size( ); ++n ) {
+					result[n] = static_cast<char32_t>( code_point( sv[n] ) );
+				}
+				return result;
+			} );
+		}
+
+		[[nodiscard]] inline int compare( compact_utf_string const &rhs ) const
+		  noexcept {
+			auto const sz = std::min( size( ), rhs.size( ) );
+			for( size_t n = 0; n < sz; ++n ) {
+				auto const l = operator[]( n );
+				auto const r = rhs[n];
+				if( l != r ) {
+					return l < r ? -1 : 1;
+				}
+			}
+			if( size( ) == rhs.size( ) ) {
+				return 0;
+			}
+			return size( ) < rhs.size( ) ? -1 : 1;
+		}
+
+		/// Random access iterator over the code points
+		class const_iterator {
+			compact_utf_string const *m_str = nullptr;
+			size_t m_pos = 0;
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = compact_utf_string::value_type;
+			using difference_type = std::ptrdiff_t;
+			using reference = value_type;
+
+			/// Code points are computed on access, so operator-> hands out a
+			/// proxy that owns the value
+			struct pointer {
+				value_type value;
+
+				[[nodiscard]] constexpr value_type const *
+				operator->( ) const noexcept {
+					return &value;
+				}
+			};
+
+			const_iterator( ) = default;
+
+			constexpr const_iterator( compact_utf_string const *str,
+			                          size_t pos ) noexcept
+			  : m_str( str )
+			  , m_pos( pos ) {}
+
+			[[nodiscard]] inline value_type operator*( ) const noexcept {
+				return ( *m_str )[m_pos];
+			}
+
+			[[nodiscard]] inline pointer operator->( ) const noexcept {
+				return pointer{ **this };
+			}
+
+			[[nodiscard]] inline value_type
+			operator[]( difference_type n ) const noexcept {
+				return ( *m_str )[static_cast<size_t>(
+				  static_cast<difference_type>( m_pos ) + n )];
+			}
+
+			constexpr const_iterator &operator++( ) noexcept {
+				++m_pos;
+				return *this;
+			}
+
+			constexpr const_iterator operator++( int ) noexcept {
+				auto result = *this;
+				++m_pos;
+				return result;
+			}
+
+			constexpr const_iterator &operator--( ) noexcept {
+				--m_pos;
+				return *this;
+			}
+
+			constexpr const_iterator operator--( int ) noexcept {
+				auto result = *this;
+				--m_pos;
+				return result;
+			}
+
+			constexpr const_iterator &operator+=( difference_type n ) noexcept {
+				m_pos =
+				  static_cast<size_t>( static_cast<difference_type>( m_pos ) + n );
+				return *this;
+			}
+
+			constexpr const_iterator &operator-=( difference_type n ) noexcept {
+				return *this += -n;
+			}
+
+			[[nodiscard]] friend constexpr const_iterator
+			operator+( const_iterator it, difference_type n ) noexcept {
+				return it += n;
+			}
+
+			[[nodiscard]] friend constexpr const_iterator
+			operator+( difference_type n, const_iterator it ) noexcept {
+				return it += n;
+			}
+
+			[[nodiscard]] friend constexpr const_iterator
+			operator-( const_iterator it, difference_type n ) noexcept {
+				return it -= n;
+			}
+
+			[[nodiscard]] friend constexpr difference_type
+			operator-( const_iterator const &lhs,
+			           const_iterator const &rhs ) noexcept {
+				return static_cast<difference_type>( lhs.m_pos ) -
+				       static_cast<difference_type>( rhs.m_pos );
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator==( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return lhs.m_pos == rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator!=( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return lhs.m_pos != rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator<( const_iterator const &lhs,
+			           const_iterator const &rhs ) noexcept {
+				return lhs.m_pos < rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator>( const_iterator const &lhs,
+			           const_iterator const &rhs ) noexcept {
+				return lhs.m_pos > rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator<=( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return lhs.m_pos <= rhs.m_pos;
+			}
+
+			[[nodiscard]] friend constexpr bool
+			operator>=( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return lhs.m_pos >= rhs.m_pos;
+			}
+		}; // const_iterator
+
+		[[nodiscard]] inline const_iterator begin( ) const noexcept {
+			return const_iterator( this, 0 );
+		}
+
+		[[nodiscard]] inline const_iterator cbegin( ) const noexcept {
+			return begin( );
+		}
+
+		[[nodiscard]] inline const_iterator end( ) const noexcept {
+			return const_iterator( this, size( ) );
+		}
+
+		[[nodiscard]] inline const_iterator cend( ) const noexcept {
+			return end( );
+		}
+
+		[[nodiscard]] friend inline bool
+		operator==( compact_utf_string const &lhs,
+		            compact_utf_string const &rhs ) noexcept {
+			return lhs.compare( rhs ) == 0;
+		}
+
+		[[nodiscard]] friend inline bool
+		operator!=( compact_utf_string const &lhs,
+		            compact_utf_string const &rhs ) noexcept {
+			return lhs.compare( rhs ) != 0;
+		}
+
+		[[nodiscard]] friend inline bool
+		operator<( compact_utf_string const &lhs,
+		           compact_utf_string const &rhs ) noexcept {
+			return lhs.compare( rhs ) < 0;
+		}
+	}; // compact_utf_string
+
+	inline std::string to_string( compact_utf_string const &str ) {
+		return str.to_string( );
+	}
+} // namespace daw
+
+namespace std {
+	template<>
+	struct hash<daw::compact_utf_string> {
+		inline size_t
+		operator( )( daw::compact_utf_string const &value ) const {
+			return std::hash<daw::range::utf_range>{ }( value.utf_range( ) );
+		}
+	};
+} // namespace std
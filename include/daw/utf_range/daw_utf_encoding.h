@@ -0,0 +1,401 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/core.h"
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/// The code unit types a basic_utf_range/basic_utf_string can be stored as.
+/// char, char8_t, unsigned char and std::byte hold UTF-8, char16_t holds
+/// UTF-16 and char32_t holds UTF-32.  Each gets its own iterator so text can
+/// be used in the encoding it arrived in
+namespace daw::range {
+	namespace encoding {
+		struct utf8 {};
+		struct utf16 {};
+		struct utf32 {};
+	} // namespace encoding
+
+	/// Iterator over valid UTF-16, a surrogate pair is one code point
+	template<typename u16bit_iterator>
+	class utf16_iterator {
+		u16bit_iterator it{ };
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = value_type *;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+
+		constexpr utf16_iterator( ) noexcept(
+		  std::is_nothrow_default_constructible_v<u16bit_iterator> ) = default;
+
+		constexpr explicit utf16_iterator( u16bit_iterator const &u16_it ) noexcept(
+		  std::is_nothrow_copy_constructible_v<u16bit_iterator> )
+		  : it( u16_it ) {}
+
+		constexpr u16bit_iterator base( ) const
+		  noexcept( std::is_nothrow_copy_constructible_v<u16bit_iterator> ) {
+			return it;
+		}
+
+		constexpr uint32_t operator*( ) const noexcept {
+			uint32_t const cp = utf8::internal::mask16( *it );
+			if( not utf8::internal::is_lead_surrogate( cp ) ) {
+				return cp;
+			}
+			uint32_t const trail = utf8::internal::mask16( *std::next( it ) );
+			return ( cp << 10U ) + trail + utf8::internal::SURROGATE_OFFSET;
+		}
+
+		constexpr bool operator==( utf16_iterator const &rhs ) const noexcept {
+			return it == rhs.it;
+		}
+
+		constexpr bool operator!=( utf16_iterator const &rhs ) const noexcept {
+			return it != rhs.it;
+		}
+
+		constexpr utf16_iterator &operator++( ) noexcept {
+			auto const lead = utf8::internal::mask16( *it );
+			std::advance( it, utf8::internal::is_lead_surrogate( lead ) ? 2 : 1 );
+			return *this;
+		}
+
+		constexpr utf16_iterator operator++( int ) noexcept {
+			auto temp = *this;
+			++( *this );
+			return temp;
+		}
+
+		constexpr utf16_iterator &operator--( ) noexcept {
+			--it;
+			auto const unit = utf8::internal::mask16( *it );
+			if( utf8::internal::is_trail_surrogate( unit ) ) {
+				--it;
+			}
+			return *this;
+		}
+
+		constexpr utf16_iterator operator--( int ) noexcept {
+			auto temp = *this;
+			--( *this );
+			return temp;
+		}
+
+		constexpr utf16_iterator &operator+=( difference_type n ) noexcept {
+			while( n-- > 0 ) {
+				++( *this );
+			}
+			return *this;
+		}
+
+		constexpr utf16_iterator &operator-=( difference_type n ) noexcept {
+			while( n-- > 0 ) {
+				--( *this );
+			}
+			return *this;
+		}
+	}; // utf16_iterator
+
+	template<typename u16bit_iterator>
+	constexpr utf16_iterator<u16bit_iterator>
+	operator+( utf16_iterator<u16bit_iterator> it,
+	           std::ptrdiff_t n ) noexcept {
+		return it += n;
+	}
+
+	template<typename u16bit_iterator>
+	constexpr utf16_iterator<u16bit_iterator>
+	operator-( utf16_iterator<u16bit_iterator> it,
+	           std::ptrdiff_t n ) noexcept {
+		return it -= n;
+	}
+
+	/// Iterator over UTF-32, one code unit per code point
+	template<typename u32bit_iterator>
+	class utf32_iterator {
+		u32bit_iterator it{ };
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = uint32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = value_type *;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+
+		constexpr utf32_iterator( ) noexcept(
+		  std::is_nothrow_default_constructible_v<u32bit_iterator> ) = default;
+
+		constexpr explicit utf32_iterator( u32bit_iterator const &u32_it ) noexcept(
+		  std::is_nothrow_copy_constructible_v<u32bit_iterator> )
+		  : it( u32_it ) {}
+
+		constexpr u32bit_iterator base( ) const
+		  noexcept( std::is_nothrow_copy_constructible_v<u32bit_iterator> ) {
+			return it;
+		}
+
+		constexpr uint32_t operator*( ) const noexcept {
+			return static_cast<uint32_t>( *it );
+		}
+
+		constexpr bool operator==( utf32_iterator const &rhs ) const noexcept {
+			return it == rhs.it;
+		}
+
+		constexpr bool operator!=( utf32_iterator const &rhs ) const noexcept {
+			return it != rhs.it;
+		}
+
+		constexpr utf32_iterator &operator++( ) noexcept {
+			++it;
+			return *this;
+		}
+
+		constexpr utf32_iterator operator++( int ) noexcept {
+			auto temp = *this;
+			++it;
+			return temp;
+		}
+
+		constexpr utf32_iterator &operator--( ) noexcept {
+			--it;
+			return *this;
+		}
+
+		constexpr utf32_iterator operator--( int ) noexcept {
+			auto temp = *this;
+			--it;
+			return temp;
+		}
+
+		constexpr utf32_iterator &operator+=( difference_type n ) noexcept {
+			std::advance( it, n );
+			return *this;
+		}
+
+		constexpr utf32_iterator &operator-=( difference_type n ) noexcept {
+			std::advance( it, -n );
+			return *this;
+		}
+	}; // utf32_iterator
+
+	template<typename u32bit_iterator>
+	constexpr utf32_iterator<u32bit_iterator>
+	operator+( utf32_iterator<u32bit_iterator> it,
+	           std::ptrdiff_t n ) noexcept {
+		return it += n;
+	}
+
+	template<typename u32bit_iterator>
+	constexpr utf32_iterator<u32bit_iterator>
+	operator-( utf32_iterator<u32bit_iterator> it,
+	           std::ptrdiff_t n ) noexcept {
+		return it -= n;
+	}
+
+	namespace impl {
+		/// Shared by the code unit types that hold UTF-8
+		template<typename CharT>
+		struct utf8_code_units {
+			using encoding = range::encoding::utf8;
+			using char_type = CharT;
+			using char_iterator = CharT const *;
+			using iterator = utf8::unchecked::iterator<char_iterator>;
+			/// A code point is at most this many code units
+			static constexpr size_t max_units = 4;
+
+			/// Code points in valid text, counted with the fastest kernel
+			static inline size_t count( char_iterator first,
+			                            char_iterator last ) noexcept {
+				return utf8::dispatch::count_code_points(
+				  reinterpret_cast<char const *>( first ),
+				  reinterpret_cast<char const *>( last ) );
+			}
+
+			template<typename OutputIterator>
+			static constexpr OutputIterator encode( uint32_t cp,
+			                                        OutputIterator out ) noexcept {
+				char buff[max_units]{ };
+				auto const last =
+				  utf8::unchecked::append( cp, static_cast<char *>( buff ) );
+				for( auto it = static_cast<char const *>( buff ); it != last; ++it ) {
+					*out++ = static_cast<CharT>( static_cast<unsigned char>( *it ) );
+				}
+				return out;
+			}
+
+			static constexpr char32_t *to_u32( char_iterator first,
+			                                   char_iterator last,
+			                                   char32_t *out ) noexcept {
+				return utf8::unchecked::utf8to32( first, last, out );
+			}
+		};
+	} // namespace impl
+
+	template<typename CharT>
+	struct code_unit_traits;
+
+	template<>
+	struct code_unit_traits<char> : impl::utf8_code_units<char> {};
+
+	template<>
+	struct code_unit_traits<unsigned char>
+	  : impl::utf8_code_units<unsigned char> {};
+
+	template<>
+	struct code_unit_traits<std::byte> : impl::utf8_code_units<std::byte> {};
+
+#if defined( __cpp_char8_t )
+	template<>
+	struct code_unit_traits<char8_t> : impl::utf8_code_units<char8_t> {};
+#endif
+
+	template<>
+	struct code_unit_traits<char16_t> {
+		using encoding = range::encoding::utf16;
+		using char_type = char16_t;
+		using char_iterator = char16_t const *;
+		using iterator = utf16_iterator<char_iterator>;
+		static constexpr size_t max_units = 2;
+
+		/// Every unit but a trail surrogate starts a code point
+		static inline size_t count( char_iterator first,
+		                            char_iterator last ) noexcept {
+			return utf8::dispatch::utf16_count_code_points( first, last );
+		}
+
+		template<typename OutputIterator>
+		static constexpr OutputIterator encode( uint32_t cp,
+		                                        OutputIterator out ) noexcept {
+			if( cp > 0xFFFFU ) {
+				*out++ = static_cast<char16_t>( ( cp >> 10U ) +
+				                                utf8::internal::LEAD_OFFSET );
+				*out++ = static_cast<char16_t>(
+				  ( cp & 0x3FFU ) + utf8::internal::TRAIL_SURROGATE_MIN );
+			} else {
+				*out++ = static_cast<char16_t>( cp );
+			}
+			return out;
+		}
+
+		static constexpr char32_t *to_u32( char_iterator first,
+		                                   char_iterator last,
+		                                   char32_t *out ) noexcept {
+			for( auto it = iterator( first ); it.base( ) != last; ++it ) {
+				*out++ = *it;
+			}
+			return out;
+		}
+	};
+
+	template<>
+	struct code_unit_traits<char32_t> {
+		using encoding = range::encoding::utf32;
+		using char_type = char32_t;
+		using char_iterator = char32_t const *;
+		using iterator = utf32_iterator<char_iterator>;
+		static constexpr size_t max_units = 1;
+
+		static constexpr size_t count( char_iterator first,
+		                               char_iterator last ) noexcept {
+			return static_cast<size_t>( last - first );
+		}
+
+		template<typename OutputIterator>
+		static constexpr OutputIterator encode( uint32_t cp,
+		                                        OutputIterator out ) noexcept {
+			*out++ = static_cast<char32_t>( cp );
+			return out;
+		}
+
+		static constexpr char32_t *to_u32( char_iterator first,
+		                                   char_iterator last,
+		                                   char32_t *out ) noexcept {
+			while( first != last ) {
+				*out++ = *first++;
+			}
+			return out;
+		}
+	};
+
+	template<typename, typename = void>
+	inline constexpr bool is_code_unit_v = false;
+
+	template<typename CharT>
+	inline constexpr bool is_code_unit_v<
+	  CharT, std::void_t<typename code_unit_traits<CharT>::encoding>> = true;
+
+	template<typename CharT>
+	inline constexpr bool is_utf8_code_unit_v = std::is_same_v<
+	  typename code_unit_traits<CharT>::encoding, encoding::utf8>;
+
+	namespace impl {
+		/// The first occurrence of the code units [needle, needle_last) in
+		/// [first, last), last when there is none.  UTF-8 is searched with the
+		/// fastest kernel available
+		template<typename CharT>
+		inline CharT const *find_units( CharT const *first, CharT const *last,
+		                                CharT const *needle,
+		                                CharT const *needle_last ) noexcept {
+			if constexpr( is_utf8_code_unit_v<CharT> ) {
+				auto const f = reinterpret_cast<char const *>( first );
+				auto const pos = utf8::dispatch::find_substring(
+				  f, reinterpret_cast<char const *>( last ),
+				  reinterpret_cast<char const *>( needle ),
+				  reinterpret_cast<char const *>( needle_last ) );
+				return first + ( pos - f );
+			} else {
+				return std::search( first, last, needle, needle_last );
+			}
+		}
+
+		/// The last occurrence of the code units [needle, needle_last) in
+		/// [first, last), last when there is none
+		template<typename CharT>
+		inline CharT const *rfind_units( CharT const *first, CharT const *last,
+		                                 CharT const *needle,
+		                                 CharT const *needle_last ) noexcept {
+			if constexpr( is_utf8_code_unit_v<CharT> ) {
+				auto const f = reinterpret_cast<char const *>( first );
+				auto const pos = utf8::dispatch::rfind_substring(
+				  f, reinterpret_cast<char const *>( last ),
+				  reinterpret_cast<char const *>( needle ),
+				  reinterpret_cast<char const *>( needle_last ) );
+				return first + ( pos - f );
+			} else if( needle == needle_last ) {
+				return last;
+			} else {
+				return std::find_end( first, last, needle, needle_last );
+			}
+		}
+	} // namespace impl
+
+	/// Owning storage for code units.  Types without std::char_traits are kept
+	/// in a std::vector
+	template<typename CharT>
+	using code_unit_storage_t =
+	  std::conditional_t<std::is_same_v<CharT, unsigned char> or
+	                       std::is_same_v<CharT, std::byte>,
+	                     std::vector<CharT>, std::basic_string<CharT>>;
+} // namespace daw::range
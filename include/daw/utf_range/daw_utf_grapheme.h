@@ -0,0 +1,345 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "impl/daw_utf_grapheme_tables.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+/// Extended grapheme clusters, the user-perceived characters of UAX #29.  The
+/// break properties are looked up in three stage tables generated by
+/// tools/gen_unicode_tables.py.  Two ASCII code points only form a cluster
+/// as CR LF, so ASCII is segmented without lookups and long runs of it are
+/// skipped with the dispatched kernels
+namespace daw::range {
+	/// Grapheme_Cluster_Break property values
+	enum class grapheme_break : uint8_t {
+		other,
+		cr,
+		lf,
+		control,
+		extend,
+		zwj,
+		regional_indicator,
+		prepend,
+		spacing_mark,
+		l,
+		v,
+		t,
+		lv,
+		lvt
+	};
+
+	namespace impl {
+		inline constexpr uint8_t grapheme_break_mask = 0x0FU;
+		inline constexpr uint8_t extended_pictographic = 0x10U;
+
+		/// The properties of the ASCII code point b
+		constexpr uint8_t ascii_grapheme_properties( uint8_t b ) noexcept {
+			if( b >= 0x20U and b != 0x7FU ) {
+				return static_cast<uint8_t>( grapheme_break::other );
+			}
+			if( b == '\r' ) {
+				return static_cast<uint8_t>( grapheme_break::cr );
+			}
+			if( b == '\n' ) {
+				return static_cast<uint8_t>( grapheme_break::lf );
+			}
+			return static_cast<uint8_t>( grapheme_break::control );
+		}
+
+		/// Move it past the code point there and return its properties.  Most
+		/// letters outside ASCII have a lead byte that settles them, they are
+		/// not decoded
+		inline uint8_t next_grapheme_properties( char const *&it ) noexcept {
+			auto const lead = static_cast<uint8_t>( *it );
+			if( lead < 0x80U ) {
+				++it;
+				return ascii_grapheme_properties( lead );
+			}
+			if( ( ( grapheme_other_leads[lead >> 6U] >> ( lead & 63U ) ) & 1U ) !=
+			    0 ) {
+				it += 2 + ( lead >= 0xE0U ? 1 : 0 ) + ( lead >= 0xF0U ? 1 : 0 );
+				return static_cast<uint8_t>( grapheme_break::other );
+			}
+			return grapheme_properties( utf8::unchecked::next( it ) );
+		}
+
+		/// The rules of UAX #29 that decide a boundary from more than the
+		/// code point before it.  The state moves through the text one code
+		/// point at a time, across boundaries
+		class grapheme_state {
+			uint8_t m_prev = 0;
+			/// An odd number of regional indicators end at the previous code
+			/// point
+			bool m_ri_odd = false;
+			/// 1 after ExtPict Extend*, 2 after ExtPict Extend* ZWJ
+			uint8_t m_emoji = 0;
+
+			static constexpr grapheme_break kind( uint8_t props ) noexcept {
+				return static_cast<grapheme_break>( props & grapheme_break_mask );
+			}
+
+			constexpr bool is_boundary( uint8_t next ) const noexcept {
+				using gb = grapheme_break;
+				auto const prev = kind( m_prev );
+				auto const cur = kind( next );
+				// GB3 to GB5
+				if( prev == gb::cr and cur == gb::lf ) {
+					return false;
+				}
+				if( prev == gb::cr or prev == gb::lf or prev == gb::control or
+				    cur == gb::cr or cur == gb::lf or cur == gb::control ) {
+					return true;
+				}
+				// GB6 to GB8, Hangul syllables
+				switch( prev ) {
+				case gb::l:
+					if( cur == gb::l or cur == gb::v or cur == gb::lv or
+					    cur == gb::lvt ) {
+						return false;
+					}
+					break;
+				case gb::lv:
+				case gb::v:
+					if( cur == gb::v or cur == gb::t ) {
+						return false;
+					}
+					break;
+				case gb::lvt:
+				case gb::t:
+					if( cur == gb::t ) {
+						return false;
+					}
+					break;
+				default:
+					break;
+				}
+				// GB9 to GB9b
+				if( cur == gb::extend or cur == gb::zwj or cur == gb::spacing_mark or
+				    prev == gb::prepend ) {
+					return false;
+				}
+				// GB11, emoji ZWJ sequences
+				if( m_emoji == 2 and ( next & extended_pictographic ) != 0 ) {
+					return false;
+				}
+				// GB12 and GB13, regional indicators pair up into flags
+				if( prev == gb::regional_indicator and
+				    cur == gb::regional_indicator ) {
+					return not m_ri_odd;
+				}
+				return true;
+			}
+
+		public:
+			constexpr grapheme_state( ) = default;
+
+			/// The state at the start of a text, before the code point with
+			/// properties first
+			explicit constexpr grapheme_state( uint8_t first ) noexcept {
+				(void)breaks_before( first );
+			}
+
+			/// True when there is a boundary before a code point with
+			/// properties next.  The state moves past it
+			constexpr bool breaks_before( uint8_t next ) noexcept {
+				if( next == static_cast<uint8_t>( grapheme_break::other ) ) {
+					// Only GB9b joins Other to what is before it
+					bool const result =
+					  kind( m_prev ) != grapheme_break::prepend;
+					m_prev = next;
+					m_ri_odd = false;
+					m_emoji = 0;
+					return result;
+				}
+				bool const result = is_boundary( next );
+				auto const cur = kind( next );
+				if( ( next & extended_pictographic ) != 0 ) {
+					m_emoji = 1;
+				} else if( m_emoji == 1 and cur == grapheme_break::zwj ) {
+					m_emoji = 2;
+				} else if( m_emoji != 1 or cur != grapheme_break::extend ) {
+					m_emoji = 0;
+				}
+				m_ri_odd = cur == grapheme_break::regional_indicator and not m_ri_odd;
+				m_prev = next;
+				return result;
+			}
+		};
+
+		/// The number of CR LF pairs in [first, last)
+		inline size_t count_crlf( char const *first, char const *last ) noexcept {
+			size_t result = 0;
+			while( last - first >= 2 ) {
+				auto const cr = static_cast<char const *>(
+				  std::memchr( first, '\r', static_cast<size_t>( last - first - 1 ) ) );
+				if( cr == nullptr ) {
+					break;
+				}
+				result += cr[1] == '\n' ? 1U : 0U;
+				first = cr + 1;
+			}
+			return result;
+		}
+	} // namespace impl
+
+	constexpr grapheme_break grapheme_break_property( utf_val_type cp ) noexcept {
+		return static_cast<grapheme_break>( impl::grapheme_properties( cp ) &
+		                                    impl::grapheme_break_mask );
+	}
+
+	constexpr bool is_extended_pictographic( utf_val_type cp ) noexcept {
+		return ( impl::grapheme_properties( cp ) &
+		         impl::extended_pictographic ) != 0;
+	}
+
+	/// The extended grapheme clusters of a utf8 text.  Each is a utf_range over
+	/// the same text, nothing is copied and iterating does not allocate
+	class grapheme_view {
+		utf_range m_text{ };
+
+	public:
+		class iterator {
+			char const *m_first = nullptr;
+			char const *m_last = nullptr;
+			/// Past the code point at m_last, the state has seen it
+			char const *m_after = nullptr;
+			char const *m_end = nullptr;
+			size_t m_size = 0;
+			impl::grapheme_state m_state{ };
+
+			/// Find the boundary after the code point ending at m_after
+			void find_end( ) noexcept {
+				auto it = m_after;
+				m_size = 1;
+				while( it != m_end ) {
+					auto next = it;
+					if( m_state.breaks_before(
+					      impl::next_grapheme_properties( next ) ) ) {
+						m_last = it;
+						m_after = next;
+						return;
+					}
+					it = next;
+					++m_size;
+				}
+				m_last = m_end;
+				m_after = m_end;
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = utf_range;
+			using reference = utf_range;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+
+			iterator( ) = default;
+
+			iterator( char const *first, char const *last ) noexcept
+			  : m_first( first )
+			  , m_last( first )
+			  , m_after( first )
+			  , m_end( last ) {
+				if( first != last ) {
+					m_state = impl::grapheme_state(
+					  impl::next_grapheme_properties( m_after ) );
+					find_end( );
+				}
+			}
+
+			/// The current cluster
+			utf_range operator*( ) const noexcept {
+				auto result = utf_range( );
+				result.set( utf_iterator( m_first ), utf_iterator( m_last ),
+				            static_cast<utf_range::difference_type>( m_size ) );
+				return result;
+			}
+
+			iterator &operator++( ) noexcept {
+				m_first = m_last;
+				if( m_first != m_end ) {
+					find_end( );
+				}
+				return *this;
+			}
+
+			iterator operator++( int ) noexcept {
+				auto result = *this;
+				operator++( );
+				return result;
+			}
+
+			friend bool operator==( iterator const &lhs,
+			                        iterator const &rhs ) noexcept {
+				return lhs.m_first == rhs.m_first;
+			}
+
+			friend bool operator!=( iterator const &lhs,
+			                        iterator const &rhs ) noexcept {
+				return not( lhs == rhs );
+			}
+		}; // iterator
+
+		using const_iterator = iterator;
+		using value_type = utf_range;
+
+		explicit constexpr grapheme_view( utf_range const &text ) noexcept
+		  : m_text( text ) {}
+
+		iterator begin( ) const noexcept {
+			return iterator( m_text.raw_begin( ), m_text.raw_end( ) );
+		}
+
+		iterator end( ) const noexcept {
+			return iterator( m_text.raw_end( ), m_text.raw_end( ) );
+		}
+	}; // grapheme_view
+
+	inline grapheme_view graphemes( utf_range const &text ) noexcept {
+		return grapheme_view( text );
+	}
+
+	/// The number of extended grapheme clusters in text
+	inline size_t grapheme_count( utf_range const &text ) noexcept {
+		auto it = text.raw_begin( );
+		auto const last = text.raw_end( );
+		if( it == last ) {
+			return 0;
+		}
+		auto state =
+		  impl::grapheme_state( impl::next_grapheme_properties( it ) );
+		size_t result = 1;
+		while( it != last ) {
+			auto const ascii = static_cast<uint8_t>( *it ) < 0x80U;
+			result += state.breaks_before( impl::next_grapheme_properties( it ) )
+			            ? 1U
+			            : 0U;
+			if( not ascii or it == last or static_cast<uint8_t>( *it ) >= 0x80U ) {
+				continue;
+			}
+			// Past the first byte of a run of ASCII every byte starts a cluster
+			// except the LF of a CR LF
+			auto const run = it - 1;
+			it = utf8::dispatch::find_non_ascii( it, last );
+			result += static_cast<size_t>( it - run - 1 ) -
+			          impl::count_crlf( run, it );
+			state = impl::grapheme_state(
+			  impl::ascii_grapheme_properties( static_cast<uint8_t>( it[-1] ) ) );
+		}
+		return result;
+	}
+} // namespace daw::range
@@ -0,0 +1,79 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/checked.h"
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <daw/daw_exception.h>
+#include <daw/daw_string_view.h>
+
+#include <cstddef>
+#include <string>
+
+/// Latin-1 (ISO-8859-1) to and from utf8 with the fastest kernels available.
+/// Each Latin-1 byte is the code point of the same value, so the lengths are
+/// known before transcoding and the output is sized once
+namespace daw::range {
+	/// utf8 bytes needed for the Latin-1 text latin1
+	inline size_t latin1_utf8_length( daw::string_view latin1 ) noexcept {
+		auto const first = latin1.data( );
+		return utf8::dispatch::latin1_utf8_length( first,
+		                                           first + latin1.size( ) );
+	}
+
+	/// Encode latin1 as utf8 into out, reusing its capacity.  Returns a range
+	/// over out, its size is that of latin1 and is not recounted
+	inline utf_range latin1_to_utf8( daw::string_view latin1,
+	                                 std::string &out ) {
+		auto const first = latin1.data( );
+		auto const last = first + latin1.size( );
+		out.resize( utf8::dispatch::latin1_utf8_length( first, last ) );
+		utf8::dispatch::latin1to8( first, last, out.data( ) );
+		auto result = utf_range( );
+		result.set( utf_iterator( out.data( ) ),
+		            utf_iterator( out.data( ) + out.size( ) ),
+		            static_cast<utf_range::difference_type>( latin1.size( ) ) );
+		return result;
+	}
+
+	inline std::string latin1_to_utf8( daw::string_view latin1 ) {
+		auto result = std::string( );
+		latin1_to_utf8( latin1, result );
+		return result;
+	}
+
+	/// Decode rng to Latin-1 into out, reusing its capacity.  rng.size( ) is
+	/// the exact length when every code point is below U+100.  Returns the
+	/// first code point above U+FF, out holds those before it, or rng.end( )
+	inline utf_range::iterator to_latin1( utf_range const &rng,
+	                                      std::string &out ) {
+		out.resize( rng.size( ) );
+		auto const last = rng.raw_end( );
+		auto const result =
+		  utf8::dispatch::utf8tolatin1( rng.raw_begin( ), last, out.data( ) );
+		out.resize( static_cast<size_t>( result.output - out.data( ) ) );
+		if( result.input == last ) {
+			return rng.end( );
+		}
+		return utf_iterator( result.input );
+	}
+
+	/// Decode rng to Latin-1.  Throws utf8::invalid_code_point with the first
+	/// code point above U+FF
+	inline std::string to_latin1( utf_range const &rng ) {
+		auto result = std::string( );
+		auto const bad = to_latin1( rng, result );
+		if( bad != rng.end( ) ) {
+			daw::exception::daw_throw<utf8::invalid_code_point>( *bad );
+		}
+		return result;
+	}
+} // namespace daw::range
@@ -0,0 +1,233 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Map between byte offsets and line:column positions in large texts.  The
+/// newlines are found with the dispatched kernels 64 bytes at a time and the
+/// line starts are kept as varint deltas, about a byte per line.  Columns
+/// count code points, a line that is all ASCII is flagged so its columns are
+/// bytes.  Lines end at '\n', a '\r' before it is part of the line
+namespace daw::range {
+	/// A position in a text, the line and the code point in it, both from 0
+	struct line_column {
+		size_t line;
+		size_t column;
+	};
+
+	/// The lines of a text that is indexed as it is appended to.  The index
+	/// does not hold the text, queries that count columns are given it
+	class line_index {
+		/// Every this many lines the start is stored whole, finding a line
+		/// decodes at most this many deltas
+		static constexpr size_t checkpoint_lines = 64;
+
+		struct checkpoint {
+			/// The start of line checkpoint_lines * n
+			size_t offset;
+			/// Where the delta of the line after it is in m_deltas
+			size_t delta;
+		};
+
+		/// The distance from the start of each line to the next, as LEB128
+		/// varints.  Lines that have a checkpoint have no delta
+		std::vector<uint8_t> m_deltas{ };
+		std::vector<checkpoint> m_checkpoints{ checkpoint{ 0, 0 } };
+		/// Bit n is set when line n is all ASCII
+		std::vector<uint64_t> m_ascii{ 1 };
+		size_t m_line_count = 1;
+		size_t m_last_start = 0;
+		size_t m_size = 0;
+
+		void add_line( size_t start ) {
+			if( m_line_count % checkpoint_lines == 0 ) {
+				m_checkpoints.push_back( checkpoint{ start, m_deltas.size( ) } );
+				m_ascii.push_back( 0 );
+			} else {
+				auto delta = start - m_last_start;
+				for( ; delta >= 0x80U; delta >>= 7U ) {
+					m_deltas.push_back( static_cast<uint8_t>( delta | 0x80U ) );
+				}
+				m_deltas.push_back( static_cast<uint8_t>( delta ) );
+			}
+			m_ascii.back( ) |= uint64_t{ 1 } << ( m_line_count % 64U );
+			m_last_start = start;
+			++m_line_count;
+		}
+
+		void clear_ascii( ) noexcept {
+			auto const line = m_line_count - 1U;
+			m_ascii[line / 64U] &= ~( uint64_t{ 1 } << ( line % 64U ) );
+		}
+
+		size_t read_delta( size_t &pos ) const noexcept {
+			size_t result = 0;
+			for( unsigned shift = 0;; shift += 7U ) {
+				auto const b = m_deltas[pos++];
+				result |= static_cast<size_t>( b & 0x7FU ) << shift;
+				if( b < 0x80U ) {
+					return result;
+				}
+			}
+		}
+
+		struct found_line {
+			size_t line;
+			size_t start;
+		};
+
+		/// The line offset is in and its start
+		found_line find_line( size_t offset ) const noexcept {
+			auto const cp =
+			  std::upper_bound( m_checkpoints.begin( ), m_checkpoints.end( ),
+			                    offset,
+			                    []( size_t value, checkpoint const &c ) {
+				                    return value < c.offset;
+			                    } ) -
+			  1;
+			auto line =
+			  static_cast<size_t>( cp - m_checkpoints.begin( ) ) * checkpoint_lines;
+			auto start = cp->offset;
+			auto pos = cp->delta;
+			auto const last_line =
+			  std::min( m_line_count, line + checkpoint_lines ) - 1U;
+			while( line < last_line ) {
+				auto next = pos;
+				auto const next_start = start + read_delta( next );
+				if( next_start > offset ) {
+					break;
+				}
+				pos = next;
+				start = next_start;
+				++line;
+			}
+			return { line, start };
+		}
+
+	public:
+		line_index( ) = default;
+
+		explicit line_index( utf_range const &text ) {
+			append( text );
+		}
+
+		/// Index the bytes that follow those indexed so far.  They need not end
+		/// on a code point boundary, a text can be indexed as it arrives
+		void append( char const *first, char const *last ) {
+			auto const size = static_cast<size_t>( last - first );
+			for( size_t pos = 0; pos < size; pos += 64U ) {
+				auto const count = std::min<size_t>( size - pos, 64U );
+				auto const masks = utf8::dispatch::scan_lines( first + pos, count );
+				auto non_ascii = masks.non_ascii;
+				for( auto lines = masks.newlines; lines != 0; lines &= lines - 1U ) {
+					auto const bit = utf8::simd::scalar::lowest_set_bit( lines );
+					// The bytes up to and including the newline
+					auto const line_bytes = ( uint64_t{ 2 } << bit ) - 1U;
+					if( ( non_ascii & line_bytes ) != 0 ) {
+						clear_ascii( );
+						non_ascii &= ~line_bytes;
+					}
+					add_line( m_size + pos + bit + 1U );
+				}
+				if( non_ascii != 0 ) {
+					clear_ascii( );
+				}
+			}
+			m_size += size;
+		}
+
+		void append( utf_range const &text ) {
+			append( text.raw_begin( ), text.raw_end( ) );
+		}
+
+		/// The bytes indexed
+		size_t size( ) const noexcept {
+			return m_size;
+		}
+
+		/// The lines, one more than the newlines.  A text that ends with a
+		/// newline ends with an empty line
+		size_t line_count( ) const noexcept {
+			return m_line_count;
+		}
+
+		/// The offset of the first byte of line
+		size_t line_start( size_t line ) const noexcept {
+			assert( line < m_line_count );
+			auto const &cp = m_checkpoints[line / checkpoint_lines];
+			auto start = cp.offset;
+			auto pos = cp.delta;
+			for( auto n = line % checkpoint_lines; n != 0; --n ) {
+				start += read_delta( pos );
+			}
+			return start;
+		}
+
+		/// The offset of the newline that ends line, or of the end of the text
+		/// for the last line
+		size_t line_end( size_t line ) const noexcept {
+			assert( line < m_line_count );
+			if( line + 1U == m_line_count ) {
+				return m_size;
+			}
+			return line_start( line + 1U ) - 1U;
+		}
+
+		/// True when line has no code point above U+7F, its columns are bytes
+		bool is_ascii( size_t line ) const noexcept {
+			assert( line < m_line_count );
+			return ( ( m_ascii[line / 64U] >> ( line % 64U ) ) & 1U ) != 0;
+		}
+
+		/// The line that the byte at offset is in
+		size_t line_of( size_t offset ) const noexcept {
+			assert( offset <= m_size );
+			return find_line( offset ).line;
+		}
+
+		/// The line and column of the byte at offset in text, the text that
+		/// was indexed.  An offset inside a code point is the column of the
+		/// next one
+		line_column position( utf_range const &text,
+		                      size_t offset ) const noexcept {
+			assert( offset <= m_size and m_size <= text.raw_size( ) );
+			auto const found = find_line( offset );
+			if( is_ascii( found.line ) ) {
+				return { found.line, offset - found.start };
+			}
+			auto const first = text.raw_begin( );
+			return { found.line, utf8::dispatch::count_code_points(
+			                       first + found.start, first + offset ) };
+		}
+
+		/// The offset in text, the text that was indexed, of a line and
+		/// column.  A column past the end of the line is its end
+		size_t offset( utf_range const &text,
+		               line_column pos ) const noexcept {
+			assert( m_size <= text.raw_size( ) );
+			auto const start = line_start( pos.line );
+			auto const end = line_end( pos.line );
+			if( is_ascii( pos.line ) ) {
+				return start + std::min( pos.column, end - start );
+			}
+			auto const first = text.raw_begin( );
+			return static_cast<size_t>( utf8::dispatch::advance_code_points(
+			                              first + start, first + end, pos.column ) -
+			                            first );
+		}
+	};
+} // namespace daw::range
@@ -0,0 +1,517 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/checked.h"
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <daw/daw_exception.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/// Search a text for many patterns in one pass.  Small pattern sets use the
+/// Teddy prefilter, nibble tables of the first bytes of each pattern that
+/// utf8::dispatch::teddy_find checks 16 to 64 positions at a time, and each
+/// candidate is verified.  Larger sets use an Aho-Corasick automaton over
+/// byte classes, one table lookup per byte of text
+namespace daw::range {
+	/// A pattern found in a text.  Patterns and text are valid utf8, so both
+	/// offsets are on code point boundaries
+	struct pattern_match {
+		/// Index of the pattern in those the multi_matcher was built from
+		size_t pattern;
+		size_t byte_offset;
+		size_t byte_size;
+		size_t code_point_offset;
+		size_t code_point_size;
+	};
+
+	enum class match_strategy { automatic, prefilter, automaton };
+
+	/// A set of utf8 patterns compiled once and matched against many texts.
+	/// Every occurrence is reported, including overlapping ones, ordered by
+	/// where they start and then by pattern index
+	class multi_matcher {
+	public:
+		/// Sets up to this many patterns use the prefilter when the strategy is
+		/// automatic and a SIMD kernel is active
+		static constexpr size_t prefilter_max_patterns = 64;
+
+	private:
+		static constexpr size_t bucket_count = 8;
+		/// Bytes scanned by the automaton between reordering its matches
+		static constexpr size_t reorder_chunk = 4096;
+		/// The prefilter gives way to the automaton once it has scanned this
+		/// many bytes with more than one candidate per prefilter_density bytes,
+		/// verifying that many costs more than the automaton's lookups
+		static constexpr size_t prefilter_warmup = 4096;
+		static constexpr size_t prefilter_density = 16;
+
+		std::vector<std::string> m_patterns{ };
+		std::vector<size_t> m_code_points{ };
+		size_t m_min_size = 0;
+		size_t m_max_size = 0;
+		match_strategy m_strategy = match_strategy::automatic;
+
+		// Prefilter, bucket b holds the patterns
+		// m_bucket_patterns[m_bucket_first[b], m_bucket_first[b + 1])
+		utf8::simd::teddy_masks m_masks{ };
+		std::array<uint32_t, bucket_count + 1> m_bucket_first{ };
+		std::vector<uint32_t> m_bucket_patterns{ };
+
+		// Automaton, states are premultiplied by m_class_count and those that
+		// end a pattern are numbered last, from m_match_start on.  This keeps
+		// the check off of the chain of transition lookups
+		std::array<uint8_t, 256> m_classes{ };
+		uint32_t m_class_count = 1;
+		uint32_t m_match_start = 0;
+		std::vector<uint32_t> m_transitions{ };
+		/// The patterns ending at state s are
+		/// m_outputs[m_output_first[s], m_output_first[s + 1])
+		std::vector<uint32_t> m_output_first{ };
+		std::vector<uint32_t> m_outputs{ };
+		/// The longest proper suffix of state s that ends a pattern, 0 for none
+		std::vector<uint32_t> m_output_link{ };
+
+		void add_pattern( daw::string_view pattern ) {
+			auto const first = pattern.data( );
+			auto const last = first + pattern.size( );
+			auto const bad = utf8::dispatch::find_invalid( first, last );
+			if( bad != last ) {
+				daw::exception::daw_throw<utf8::invalid_utf8>(
+				  static_cast<uint8_t>( *bad ) );
+			}
+			m_patterns.emplace_back( first, last );
+			m_code_points.push_back(
+			  utf8::dispatch::count_code_points( first, last ) );
+		}
+
+		void build( ) {
+			for( auto const &p : m_patterns ) {
+				if( p.empty( ) ) {
+					continue;
+				}
+				m_min_size = m_min_size == 0 ? p.size( )
+				                             : std::min( m_min_size, p.size( ) );
+				m_max_size = std::max( m_max_size, p.size( ) );
+			}
+			if( m_max_size == 0 ) {
+				return;
+			}
+			build_automaton( );
+			auto const small = m_patterns.size( ) <= prefilter_max_patterns;
+			if( m_strategy == match_strategy::prefilter or
+			    ( m_strategy == match_strategy::automatic and small ) ) {
+				build_prefilter( );
+			}
+		}
+
+		void build_automaton( ) {
+			for( auto const &p : m_patterns ) {
+				for( auto c : p ) {
+					m_classes[static_cast<uint8_t>( c )] = 1;
+				}
+			}
+			for( auto &c : m_classes ) {
+				if( c != 0 ) {
+					c = static_cast<uint8_t>( m_class_count++ );
+				}
+			}
+			auto const classes = m_class_count;
+			// Trie, a 0 transition is a missing child until the failure
+			// transitions are filled in and then it is the root
+			auto next = std::vector<uint32_t>( classes, 0 );
+			auto own = std::vector<std::vector<uint32_t>>( 1 );
+			for( size_t n = 0; n < m_patterns.size( ); ++n ) {
+				auto const &p = m_patterns[n];
+				if( p.empty( ) ) {
+					continue;
+				}
+				uint32_t state = 0;
+				for( auto c : p ) {
+					auto const cls = m_classes[static_cast<uint8_t>( c )];
+					auto const edge = state * classes + cls;
+					if( next[edge] == 0 ) {
+						next[edge] = static_cast<uint32_t>( own.size( ) );
+						own.emplace_back( );
+						next.resize( next.size( ) + classes, 0 );
+					}
+					state = next[edge];
+				}
+				own[state].push_back( static_cast<uint32_t>( n ) );
+			}
+			auto const states = own.size( );
+			auto fail = std::vector<uint32_t>( states, 0 );
+			auto link = std::vector<uint32_t>( states, 0 );
+			// Breadth first so the failure state's row is complete before use
+			auto queue = std::vector<uint32_t>( );
+			queue.reserve( states );
+			for( uint32_t c = 0; c < classes; ++c ) {
+				if( next[c] != 0 ) {
+					queue.push_back( next[c] );
+				}
+			}
+			for( size_t q = 0; q < queue.size( ); ++q ) {
+				auto const s = queue[q];
+				for( uint32_t c = 0; c < classes; ++c ) {
+					auto &t = next[s * classes + c];
+					auto const f = next[fail[s] * classes + c];
+					if( t == 0 ) {
+						t = f;
+						continue;
+					}
+					fail[t] = f;
+					link[t] = own[f].empty( ) ? link[f] : f;
+					queue.push_back( t );
+				}
+			}
+			// Renumber with the states that end a pattern last, the root has
+			// no patterns and stays at 0
+			auto order = std::vector<uint32_t>( );
+			order.reserve( states );
+			for( int ends = 0; ends < 2; ++ends ) {
+				for( uint32_t s = 0; s < states; ++s ) {
+					auto const e = not own[s].empty( ) or link[s] != 0;
+					if( e == ( ends != 0 ) ) {
+						if( ends != 0 and m_match_start == 0 ) {
+							m_match_start = static_cast<uint32_t>( order.size( ) ) * classes;
+						}
+						order.push_back( s );
+					}
+				}
+			}
+			auto id = std::vector<uint32_t>( states );
+			for( uint32_t n = 0; n < states; ++n ) {
+				id[order[n]] = n;
+			}
+			m_transitions.resize( next.size( ) );
+			m_output_first.assign( states + 1, 0 );
+			m_output_link.assign( states, 0 );
+			for( uint32_t n = 0; n < states; ++n ) {
+				auto const s = order[n];
+				for( uint32_t c = 0; c < classes; ++c ) {
+					m_transitions[n * classes + c] = id[next[s * classes + c]] * classes;
+				}
+				m_output_first[n + 1] =
+				  m_output_first[n] + static_cast<uint32_t>( own[s].size( ) );
+				m_outputs.insert( m_outputs.end( ), own[s].begin( ), own[s].end( ) );
+				m_output_link[n] = id[link[s]];
+			}
+		}
+
+		void build_prefilter( ) {
+			auto const length =
+			  static_cast<unsigned>( std::min( m_min_size, size_t{ 3 } ) );
+			auto order = std::vector<uint32_t>( );
+			for( size_t n = 0; n < m_patterns.size( ); ++n ) {
+				if( not m_patterns[n].empty( ) ) {
+					order.push_back( static_cast<uint32_t>( n ) );
+				}
+			}
+			// Patterns with the same leading bytes share a bucket so that
+			// fewer of them are verified at each candidate
+			if( order.size( ) > bucket_count ) {
+				std::stable_sort(
+				  order.begin( ), order.end( ), [&]( uint32_t lhs, uint32_t rhs ) {
+					  return m_patterns[lhs].compare( 0, length, m_patterns[rhs], 0,
+					                                  length ) < 0;
+				  } );
+			}
+			auto const per_bucket =
+			  ( order.size( ) + bucket_count - 1 ) / bucket_count;
+			m_masks = utf8::simd::teddy_masks{ };
+			m_masks.length = length;
+			m_bucket_patterns = order;
+			for( size_t b = 0; b < bucket_count; ++b ) {
+				auto const first = std::min( b * per_bucket, order.size( ) );
+				auto const last = std::min( first + per_bucket, order.size( ) );
+				m_bucket_first[b] = static_cast<uint32_t>( first );
+				m_bucket_first[b + 1] = static_cast<uint32_t>( last );
+				for( auto n = first; n != last; ++n ) {
+					auto const &p = m_patterns[order[n]];
+					for( unsigned k = 0; k < length; ++k ) {
+						auto const c = static_cast<uint8_t>( p[k] );
+						m_masks.lo[k][c & 0x0FU] |= static_cast<uint8_t>( 1U << b );
+						m_masks.hi[k][c >> 4U] |= static_cast<uint8_t>( 1U << b );
+					}
+				}
+			}
+		}
+
+		template<typename Func>
+		static bool invoke( Func &func, pattern_match const &m ) {
+			using result_t = std::invoke_result_t<Func &, pattern_match const &>;
+			if constexpr( std::is_same_v<result_t, bool> ) {
+				return func( m );
+			} else {
+				func( m );
+				return true;
+			}
+		}
+
+		/// Fills in the code point offsets of matches given in start order,
+		/// counting only the text between them
+		template<typename Func>
+		class reporter {
+			multi_matcher const &m_matcher;
+			char const *m_first;
+			char const *m_pos;
+			size_t m_code_points = 0;
+			Func &m_func;
+
+		public:
+			reporter( multi_matcher const &matcher, char const *first,
+			          Func &func ) noexcept
+			  : m_matcher( matcher )
+			  , m_first( first )
+			  , m_pos( first )
+			  , m_func( func ) {}
+
+			/// Returns false when func asked to stop
+			bool operator( )( uint32_t pattern, size_t byte_offset ) {
+				auto const pos = m_first + byte_offset;
+				m_code_points += utf8::dispatch::count_code_points( m_pos, pos );
+				m_pos = pos;
+				auto const m = pattern_match{
+				  pattern, byte_offset, m_matcher.m_patterns[pattern].size( ),
+				  m_code_points, m_matcher.m_code_points[pattern] };
+				return invoke( m_func, m );
+			}
+		};
+
+		/// The patterns of buckets that start at pos, in index order
+		void verify( uint8_t buckets, char const *pos, char const *last,
+		             std::vector<uint32_t> &found ) const {
+			auto const room = static_cast<size_t>( last - pos );
+			found.clear( );
+			for( size_t b = 0; b < bucket_count; ++b ) {
+				if( ( buckets & ( 1U << b ) ) == 0 ) {
+					continue;
+				}
+				for( auto n = m_bucket_first[b]; n != m_bucket_first[b + 1]; ++n ) {
+					auto const &p = m_patterns[m_bucket_patterns[n]];
+					if( p.size( ) <= room and
+					    std::memcmp( p.data( ), pos, p.size( ) ) == 0 ) {
+						found.push_back( m_bucket_patterns[n] );
+					}
+				}
+			}
+			std::sort( found.begin( ), found.end( ) );
+		}
+
+		template<typename Report>
+		bool scan_prefilter( char const *first, char const *last,
+		                     Report &report ) const {
+			auto found = std::vector<uint32_t>( );
+			uint8_t buckets[64];
+			size_t candidates = 0;
+			auto it = first;
+			while( true ) {
+				auto const scanned = static_cast<size_t>( it - first );
+				if( scanned >= prefilter_warmup and
+				    candidates > scanned / prefilter_density ) {
+					// The prefilter passes too much of this text, the matches that
+					// start before it have been reported
+					return scan_automaton( first, last, scanned, report );
+				}
+				auto const block =
+				  utf8::dispatch::teddy_find( m_masks, it, last, buckets );
+				if( block.position == last ) {
+					return true;
+				}
+				for( auto lanes = block.candidates; lanes != 0; lanes &= lanes - 1U ) {
+					auto const lane = utf8::simd::scalar::lowest_set_bit( lanes );
+					++candidates;
+					auto const pos = block.position + lane;
+					verify( buckets[lane], pos, last, found );
+					auto const offset = static_cast<size_t>( pos - first );
+					for( auto n : found ) {
+						if( not report( n, offset ) ) {
+							return false;
+						}
+					}
+				}
+				it = block.position + block.size;
+			}
+		}
+
+		/// Report the pending matches that start before limit in start order
+		template<typename Report>
+		static bool flush( std::vector<pattern_match> &pending, size_t limit,
+		                   Report &report ) {
+			std::sort( pending.begin( ), pending.end( ),
+			           []( pattern_match const &lhs, pattern_match const &rhs ) {
+				           return lhs.byte_offset != rhs.byte_offset
+				                    ? lhs.byte_offset < rhs.byte_offset
+				                    : lhs.pattern < rhs.pattern;
+			           } );
+			auto it = pending.begin( );
+			for( ; it != pending.end( ) and it->byte_offset < limit; ++it ) {
+				if( not report( static_cast<uint32_t>( it->pattern ),
+				                it->byte_offset ) ) {
+					return false;
+				}
+			}
+			pending.erase( pending.begin( ), it );
+			return true;
+		}
+
+		/// The automaton finds matches where they end, they are held until no
+		/// later match can start before them.  Scanning starts at offset begin
+		/// and only finds the matches that start there or later
+		template<typename Report>
+		bool scan_automaton( char const *first, char const *last, size_t begin,
+		                     Report &report ) const {
+			auto pending = std::vector<pattern_match>( );
+			auto const size = static_cast<size_t>( last - first );
+			auto const classes = m_class_count;
+			auto const transitions = m_transitions.data( );
+			auto const match_start = m_match_start;
+			uint32_t state = 0;
+			for( size_t pos = begin; pos < size; ) {
+				auto const chunk_end = std::min( size, pos + reorder_chunk );
+				for( ; pos < chunk_end; ++pos ) {
+					auto const c = m_classes[static_cast<uint8_t>( first[pos] )];
+					state = transitions[state + c];
+					if( state < match_start ) {
+						continue;
+					}
+					for( auto s = state / classes; s != 0; s = m_output_link[s] ) {
+						for( auto n = m_output_first[s]; n != m_output_first[s + 1];
+						     ++n ) {
+							auto const p = m_outputs[n];
+							auto const start = pos + 1 - m_patterns[p].size( );
+							pending.push_back( pattern_match{ p, start, 0, 0, 0 } );
+						}
+					}
+				}
+				// Matches found later end after pos and start after this limit
+				if( not pending.empty( ) and pos >= begin + m_max_size and
+				    not flush( pending, pos + 1 - m_max_size, report ) ) {
+					return false;
+				}
+			}
+			return flush( pending, size, report );
+		}
+
+		bool use_prefilter( ) const noexcept {
+			switch( m_strategy ) {
+			case match_strategy::prefilter:
+				return true;
+			case match_strategy::automaton:
+				return false;
+			default:
+				return not m_bucket_patterns.empty( ) and
+				       utf8::dispatch::active_isa( ) != utf8::dispatch::isa::scalar;
+			}
+		}
+
+	public:
+		/// Compile the utf8 patterns [first, last).  Throws utf8::invalid_utf8
+		/// when one is not valid, an empty pattern never matches
+		template<typename Iterator>
+		multi_matcher( Iterator first, Iterator last,
+		               match_strategy strategy = match_strategy::automatic )
+		  : m_strategy( strategy ) {
+			for( ; first != last; ++first ) {
+				add_pattern( daw::string_view( *first ) );
+			}
+			build( );
+		}
+
+		multi_matcher( std::initializer_list<daw::string_view> patterns,
+		               match_strategy strategy = match_strategy::automatic )
+		  : multi_matcher( patterns.begin( ), patterns.end( ), strategy ) {}
+
+		size_t size( ) const noexcept {
+			return m_patterns.size( );
+		}
+
+		daw::string_view pattern( size_t index ) const {
+			return daw::string_view( m_patterns[index].data( ),
+			                         m_patterns[index].size( ) );
+		}
+
+		/// True when texts are scanned with the prefilter, this depends on the
+		/// active SIMD kernels
+		bool uses_prefilter( ) const noexcept {
+			return m_max_size != 0 and use_prefilter( );
+		}
+
+		/// Call func( pattern_match const & ) for each match in text, which
+		/// must be valid utf8.  When func returns bool, false stops the search
+		template<typename Func>
+		void for_each_match( daw::string_view text, Func &&func ) const {
+			if( m_max_size == 0 ) {
+				return;
+			}
+			auto const first = text.data( );
+			auto const last = first + text.size( );
+			auto report = reporter<Func>( *this, first, func );
+			if( use_prefilter( ) ) {
+				(void)scan_prefilter( first, last, report );
+			} else {
+				(void)scan_automaton( first, last, 0, report );
+			}
+		}
+
+		template<typename Func>
+		void for_each_match( utf_range const &text, Func &&func ) const {
+			for_each_match( daw::string_view( text.raw_begin( ), text.raw_size( ) ),
+			                func );
+		}
+
+		std::vector<pattern_match> find_all( daw::string_view text ) const {
+			auto result = std::vector<pattern_match>( );
+			for_each_match( text, [&]( pattern_match const &m ) {
+				result.push_back( m );
+			} );
+			return result;
+		}
+
+		std::vector<pattern_match> find_all( utf_range const &text ) const {
+			return find_all(
+			  daw::string_view( text.raw_begin( ), text.raw_size( ) ) );
+		}
+
+		/// The match that starts first, the lowest pattern index on a tie
+		std::optional<pattern_match> find_first( daw::string_view text ) const {
+			auto result = std::optional<pattern_match>( );
+			for_each_match( text, [&]( pattern_match const &m ) {
+				result = m;
+				return false;
+			} );
+			return result;
+		}
+
+		std::optional<pattern_match> find_first( utf_range const &text ) const {
+			return find_first(
+			  daw::string_view( text.raw_begin( ), text.raw_size( ) ) );
+		}
+
+		bool contains_any( daw::string_view text ) const {
+			return find_first( text ).has_value( );
+		}
+
+		bool contains_any( utf_range const &text ) const {
+			return find_first( text ).has_value( );
+		}
+	}; // multi_matcher
+} // namespace daw::range
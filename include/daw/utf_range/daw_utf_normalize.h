@@ -0,0 +1,358 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "daw_utf_string.h"
+#include "impl/daw_utf_normalization_tables.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/// Unicode normalization, UAX #15.  Text is usually already normalized, so a
+/// quick check runs first.  The dispatched kernels skip the bytes that start
+/// code points which can neither change nor combine with what is before
+/// them, the properties of the rest are looked up.  Only the text after the
+/// first code point the quick check cannot pass is normalized
+namespace daw::range {
+	enum class normalization_form { nfc, nfd, nfkc, nfkd };
+
+	namespace impl {
+		namespace hangul {
+			inline constexpr char32_t s_base = 0xAC00;
+			inline constexpr char32_t l_base = 0x1100;
+			inline constexpr char32_t v_base = 0x1161;
+			inline constexpr char32_t t_base = 0x11A7;
+			inline constexpr char32_t l_count = 19;
+			inline constexpr char32_t v_count = 21;
+			inline constexpr char32_t t_count = 28;
+			inline constexpr char32_t s_count = l_count * v_count * t_count;
+		} // namespace hangul
+
+		enum class quick_check : uint8_t { yes, maybe, no };
+
+		constexpr uint8_t combining_class( uint16_t props ) noexcept {
+			return static_cast<uint8_t>( props & 0xFFU );
+		}
+
+		constexpr uint8_t combining_class( char32_t cp ) noexcept {
+			return combining_class( normalization_properties( cp ) );
+		}
+
+		constexpr quick_check quick_check_of( uint16_t props,
+		                                      normalization_form form ) noexcept {
+			switch( form ) {
+			case normalization_form::nfc:
+				return static_cast<quick_check>( ( props >> 8U ) & 3U );
+			case normalization_form::nfkc:
+				return static_cast<quick_check>( ( props >> 10U ) & 3U );
+			case normalization_form::nfd:
+				return ( props & 0x1000U ) != 0 ? quick_check::no : quick_check::yes;
+			case normalization_form::nfkd:
+				return ( props & 0x2000U ) != 0 ? quick_check::no : quick_check::yes;
+			}
+			return quick_check::no;
+		}
+
+		constexpr bool is_composed( normalization_form form ) noexcept {
+			return form == normalization_form::nfc or
+			       form == normalization_form::nfkc;
+		}
+
+		constexpr bool is_compatibility( normalization_form form ) noexcept {
+			return form == normalization_form::nfkc or
+			       form == normalization_form::nfkd;
+		}
+
+		/// A code point with combining class 0 that passes the quick check.
+		/// Nothing before it changes how it or what follows it normalizes
+		constexpr bool is_boundary( uint16_t props,
+		                            normalization_form form ) noexcept {
+			return combining_class( props ) == 0 and
+			       quick_check_of( props, form ) == quick_check::yes;
+		}
+
+		/// Continuation bytes and the lead bytes of code points that are all
+		/// boundaries for form
+		constexpr utf8::simd::byte_set
+		boundary_bytes( normalization_form form ) noexcept {
+			auto const &leads =
+			  normalization_safe_leads[static_cast<size_t>( form )];
+			uint64_t const bits[4] = { 0, 0, ~0ULL, leads[3] };
+			return utf8::simd::make_byte_set( bits );
+		}
+
+		inline constexpr utf8::simd::byte_set normalization_boundary_bytes[4] = {
+		  boundary_bytes( normalization_form::nfc ),
+		  boundary_bytes( normalization_form::nfd ),
+		  boundary_bytes( normalization_form::nfkc ),
+		  boundary_bytes( normalization_form::nfkd ) };
+
+		/// The start of the last boundary before the first code point of
+		/// [first, last) that fails the quick check, where normalizing has to
+		/// start.  It is last, and result is yes, when there is no such code
+		/// point.  Otherwise result is no or maybe, maybe needs the text to be
+		/// normalized to know
+		inline char const *normalization_start( char const *first,
+		                                        char const *last,
+		                                        normalization_form form,
+		                                        quick_check &result ) noexcept {
+			auto const &safe =
+			  normalization_boundary_bytes[static_cast<size_t>( form )];
+			auto start = first;
+			uint8_t last_class = 0;
+			auto it = first;
+			while( true ) {
+				if( it != last and safe.contains( static_cast<uint8_t>( *it ) ) ) {
+					it = utf8::dispatch::find_not_in_set( safe, it, last );
+					start = it - 1;
+					while( ( static_cast<uint8_t>( *start ) & 0xC0U ) == 0x80U ) {
+						--start;
+					}
+					last_class = 0;
+				}
+				if( it == last ) {
+					result = quick_check::yes;
+					return last;
+				}
+				auto const pos = it;
+				auto const props =
+				  normalization_properties( utf8::unchecked::next( it ) );
+				auto const cls = combining_class( props );
+				if( cls != 0 and last_class > cls ) {
+					result = quick_check::no;
+					return start;
+				}
+				result = quick_check_of( props, form );
+				if( result != quick_check::yes ) {
+					return start;
+				}
+				if( cls == 0 ) {
+					start = pos;
+				}
+				last_class = cls;
+			}
+		}
+
+		/// Append the full decomposition of cp to out
+		inline void decompose( char32_t cp, bool compatibility,
+		                       std::u32string &out ) {
+			if( cp - hangul::s_base < hangul::s_count ) {
+				auto const s = cp - hangul::s_base;
+				out.push_back( hangul::l_base +
+				               s / ( hangul::v_count * hangul::t_count ) );
+				out.push_back( hangul::v_base +
+				               ( s % ( hangul::v_count * hangul::t_count ) ) /
+				                 hangul::t_count );
+				if( s % hangul::t_count != 0 ) {
+					out.push_back( hangul::t_base + s % hangul::t_count );
+				}
+				return;
+			}
+			auto const index = decomposition_index( cp );
+			auto const header = decomposition_pool[index];
+			auto units = decomposition_pool + index + 1;
+			size_t count = header & 0xFFU;
+			if( compatibility and ( header >> 8U ) != 0 ) {
+				units += count;
+				count = header >> 8U;
+			}
+			if( index == 0 or count == 0 ) {
+				out.push_back( cp );
+				return;
+			}
+			auto const units_last = units + count;
+			while( units != units_last ) {
+				char32_t u = *units++;
+				if( u - 0xD800U < 0x400U ) {
+					u = 0x10000U + ( ( u - 0xD800U ) << 10U ) + ( *units++ - 0xDC00U );
+				}
+				out.push_back( u );
+			}
+		}
+
+		/// Sort each run of code points with a non-zero combining class by it,
+		/// keeping the order of those with the same class
+		inline void canonical_order( std::u32string &buf ) noexcept {
+			for( size_t n = 1; n < buf.size( ); ++n ) {
+				auto const cp = buf[n];
+				auto const cls = combining_class( cp );
+				if( cls == 0 ) {
+					continue;
+				}
+				auto pos = n;
+				for( ; pos > 0 and combining_class( buf[pos - 1] ) > cls; --pos ) {
+					buf[pos] = buf[pos - 1];
+				}
+				buf[pos] = cp;
+			}
+		}
+
+		/// The primary composite of first and second, 0 when there is none
+		inline char32_t compose_pair( char32_t first, char32_t second ) noexcept {
+			if( first - hangul::l_base < hangul::l_count and
+			    second - hangul::v_base < hangul::v_count ) {
+				return hangul::s_base +
+				       ( ( first - hangul::l_base ) * hangul::v_count +
+				         ( second - hangul::v_base ) ) *
+				         hangul::t_count;
+			}
+			if( first - hangul::s_base < hangul::s_count and
+			    ( first - hangul::s_base ) % hangul::t_count == 0 and
+			    second - hangul::t_base - 1U < hangul::t_count - 1U ) {
+				return first + ( second - hangul::t_base );
+			}
+			auto const key = ( static_cast<uint64_t>( first ) << 21U ) | second;
+			auto const pairs_last = std::end( composition_pairs );
+			auto const pos =
+			  std::lower_bound( std::begin( composition_pairs ), pairs_last, key );
+			if( pos == pairs_last or *pos != key ) {
+				return 0;
+			}
+			return composition_values[pos - std::begin( composition_pairs )];
+		}
+
+		/// Compose the canonically ordered buf in place.  A code point joins
+		/// the last starter when nothing between them has combining class 0
+		/// or one at least its own
+		inline void compose( std::u32string &buf ) noexcept {
+			if( buf.empty( ) ) {
+				return;
+			}
+			constexpr auto none = static_cast<size_t>( -1 );
+			auto starter = combining_class( buf[0] ) == 0 ? size_t{ 0 } : none;
+			uint8_t last_class = 0;
+			size_t size = 1;
+			for( size_t n = 1; n < buf.size( ); ++n ) {
+				auto const cp = buf[n];
+				auto const cls = combining_class( cp );
+				if( starter != none and
+				    ( size == starter + 1 or
+				      ( last_class != 0 and last_class < cls ) ) ) {
+					if( auto const composite = compose_pair( buf[starter], cp );
+					    composite != 0 ) {
+						buf[starter] = composite;
+						continue;
+					}
+				}
+				if( cls == 0 ) {
+					starter = size;
+				}
+				last_class = cls;
+				buf[size++] = cp;
+			}
+			buf.resize( size );
+		}
+
+		/// Append [first, last) in form to out.  Returns the number of code
+		/// points appended
+		inline size_t normalize_to( char const *first, char const *last,
+		                            normalization_form form, std::string &out ) {
+			auto buf = std::u32string( );
+			size_t result = 0;
+			while( true ) {
+				auto qc = quick_check::yes;
+				auto const start = normalization_start( first, last, form, qc );
+				out.append( first, start );
+				result += utf8::dispatch::count_code_points( first, start );
+				if( start == last ) {
+					return result;
+				}
+				// The segment runs to the first boundary after its start
+				buf.clear( );
+				auto it = start;
+				do {
+					decompose( utf8::unchecked::next( it ), is_compatibility( form ),
+					           buf );
+					auto next = it;
+					if( it == last or
+					    is_boundary(
+					      normalization_properties( utf8::unchecked::next( next ) ),
+					      form ) ) {
+						break;
+					}
+				} while( true );
+				canonical_order( buf );
+				if( is_composed( form ) ) {
+					compose( buf );
+				}
+				auto out_it = std::back_inserter( out );
+				for( auto cp : buf ) {
+					out_it = utf8::unchecked::append( cp, out_it );
+				}
+				result += buf.size( );
+				first = it;
+			}
+		}
+	} // namespace impl
+
+	/// True when text is in form.  Text that the quick check cannot settle
+	/// is normalized from the first code point it stopped at to find out
+	inline bool
+	is_normalized( utf_range const &text,
+	               normalization_form form = normalization_form::nfc ) {
+		auto const first = text.raw_begin( );
+		auto const last = text.raw_end( );
+		auto qc = impl::quick_check::yes;
+		auto const start = impl::normalization_start( first, last, form, qc );
+		if( qc != impl::quick_check::maybe ) {
+			return qc == impl::quick_check::yes;
+		}
+		auto normalized = std::string( );
+		(void)impl::normalize_to( start, last, form, normalized );
+		return normalized.size( ) == static_cast<size_t>( last - start ) and
+		       std::memcmp( normalized.data( ), start, normalized.size( ) ) == 0;
+	}
+
+	/// text in form.  When it already is, which is usual and found by the
+	/// quick check without decoding most of it, text is returned and out is
+	/// left alone.  Otherwise out receives the normalized text, reusing its
+	/// capacity, and a range over it is returned
+	inline utf_range normalize( utf_range const &text, normalization_form form,
+	                            std::string &out ) {
+		auto const first = text.raw_begin( );
+		auto const last = text.raw_end( );
+		auto qc = impl::quick_check::yes;
+		auto const start = impl::normalization_start( first, last, form, qc );
+		if( qc == impl::quick_check::yes ) {
+			return text;
+		}
+		out.assign( first, start );
+		auto size = utf8::dispatch::count_code_points( first, start );
+		size += impl::normalize_to( start, last, form, out );
+		auto result = utf_range( );
+		result.set( utf_iterator( out.data( ) ),
+		            utf_iterator( out.data( ) + out.size( ) ),
+		            static_cast<utf_range::difference_type>( size ) );
+		return result;
+	}
+
+	/// A copy of text in form
+	inline utf_string
+	normalize( utf_range const &text,
+	           normalization_form form = normalization_form::nfc ) {
+		auto buffer = std::string( );
+		return utf_string( normalize( text, form, buffer ) );
+	}
+
+	/// Put str in form, nothing is allocated when it already is
+	inline void normalize( utf_string &str,
+	                       normalization_form form = normalization_form::nfc ) {
+		auto buffer = std::string( );
+		auto const result = normalize( str.utf_range( ), form, buffer );
+		if( result.raw_begin( ) != str.raw_begin( ) ) {
+			str = utf_string( result );
+		}
+	}
+} // namespace daw::range
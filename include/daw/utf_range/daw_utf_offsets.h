@@ -0,0 +1,151 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/// Convert positions in a text between byte offsets, code point indices and
+/// UTF-16 indices as used by JavaScript and LSP.  Positions are given sorted
+/// in ascending order and are all resolved in one pass over the text, the
+/// gap between each and the next is counted or skipped with the dispatched
+/// kernels.  Positions past the end of the text give its end
+namespace daw::range {
+	namespace impl {
+		/// out[n] is count( first of text, first of text + positions[n] ),
+		/// summed one gap at a time
+		template<typename Count>
+		size_t *from_byte_offsets( utf_range const &text, size_t const *first,
+		                           size_t const *last, size_t *out,
+		                           Count count ) {
+			auto pos = text.raw_begin( );
+			size_t index = 0;
+			for( ; first != last; ++first ) {
+				auto const next =
+				  text.raw_begin( ) + std::min( *first, text.raw_size( ) );
+				assert( pos <= next and "Offsets must be sorted" );
+				index += count( pos, next );
+				pos = next;
+				*out++ = index;
+			}
+			return out;
+		}
+
+		template<typename Convert>
+		std::vector<size_t> convert_offsets( std::vector<size_t> const &offsets,
+		                                     Convert convert ) {
+			auto result = std::vector<size_t>( offsets.size( ) );
+			(void)convert( offsets.data( ), offsets.data( ) + offsets.size( ),
+			               result.data( ) );
+			return result;
+		}
+	} // namespace impl
+
+	/// The index of the code point at each of the byte offsets [first, last)
+	/// into text, written to out.  An offset inside a code point gives the
+	/// index of the next one.  Returns the end of out
+	inline size_t *byte_to_code_point( utf_range const &text,
+	                                   size_t const *first, size_t const *last,
+	                                   size_t *out ) noexcept {
+		return impl::from_byte_offsets(
+		  text, first, last, out, []( char const *f, char const *l ) {
+			  return utf8::dispatch::count_code_points( f, l );
+		  } );
+	}
+
+	inline std::vector<size_t>
+	byte_to_code_point( utf_range const &text,
+	                    std::vector<size_t> const &offsets ) {
+		return impl::convert_offsets(
+		  offsets, [&]( size_t const *f, size_t const *l, size_t *out ) {
+			  return byte_to_code_point( text, f, l, out );
+		  } );
+	}
+
+	/// The UTF-16 index of each of the byte offsets [first, last) into text,
+	/// written to out.  An offset inside a code point gives the index of the
+	/// next one.  Returns the end of out
+	inline size_t *byte_to_utf16_index( utf_range const &text,
+	                                    size_t const *first, size_t const *last,
+	                                    size_t *out ) noexcept {
+		return impl::from_byte_offsets(
+		  text, first, last, out, []( char const *f, char const *l ) {
+			  return utf8::dispatch::utf8_utf16_length( f, l );
+		  } );
+	}
+
+	inline std::vector<size_t>
+	byte_to_utf16_index( utf_range const &text,
+	                     std::vector<size_t> const &offsets ) {
+		return impl::convert_offsets(
+		  offsets, [&]( size_t const *f, size_t const *l, size_t *out ) {
+			  return byte_to_utf16_index( text, f, l, out );
+		  } );
+	}
+
+	/// The byte offset of each of the code point indices [first, last) into
+	/// text, written to out.  Returns the end of out
+	inline size_t *code_point_to_byte( utf_range const &text,
+	                                   size_t const *first, size_t const *last,
+	                                   size_t *out ) noexcept {
+		auto pos = text.raw_begin( );
+		size_t index = 0;
+		for( ; first != last; ++first ) {
+			assert( index <= *first and "Indices must be sorted" );
+			pos = utf8::dispatch::advance_code_points( pos, text.raw_end( ),
+			                                           *first - index );
+			index = *first;
+			*out++ = static_cast<size_t>( pos - text.raw_begin( ) );
+		}
+		return out;
+	}
+
+	inline std::vector<size_t>
+	code_point_to_byte( utf_range const &text,
+	                    std::vector<size_t> const &indices ) {
+		return impl::convert_offsets(
+		  indices, [&]( size_t const *f, size_t const *l, size_t *out ) {
+			  return code_point_to_byte( text, f, l, out );
+		  } );
+	}
+
+	/// The byte offset of each of the UTF-16 indices [first, last) into text,
+	/// written to out.  An index between the two units of a surrogate pair
+	/// gives the offset of its code point.  Returns the end of out
+	inline size_t *utf16_index_to_byte( utf_range const &text,
+	                                    size_t const *first, size_t const *last,
+	                                    size_t *out ) noexcept {
+		auto pos = text.raw_begin( );
+		// The UTF-16 index of pos
+		size_t index = 0;
+		for( ; first != last; ++first ) {
+			assert( index <= *first and "Indices must be sorted" );
+			auto const result = utf8::dispatch::advance_utf16_units(
+			  pos, text.raw_end( ), *first - index );
+			pos = result.position;
+			index = *first - result.remaining;
+			*out++ = static_cast<size_t>( pos - text.raw_begin( ) );
+		}
+		return out;
+	}
+
+	inline std::vector<size_t>
+	utf16_index_to_byte( utf_range const &text,
+	                     std::vector<size_t> const &indices ) {
+		return impl::convert_offsets(
+		  indices, [&]( size_t const *f, size_t const *l, size_t *out ) {
+			  return utf16_index_to_byte( text, f, l, out );
+		  } );
+	}
+} // namespace daw::range
@@ -8,17 +8,23 @@
 
 #pragma once
 
+#include "../utf8/checked.h"
 #include "../utf8/unchecked.h"
+#include "daw_utf_encoding.h"
 
 #include <daw/cpp_17.h>
 #include <daw/daw_algorithm.h>
+#include <daw/daw_exception.h>
 #include <daw/daw_fnv1a_hash.h>
 #include <daw/daw_string_view.h>
 #include <daw/daw_traits.h>
 
+#include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace daw {
@@ -33,13 +39,19 @@ namespace daw {
 			  first, static_cast<size_t>( daw::distance( first, last ) ) );
 		}
 
-		struct utf_range {
-			using iterator = utf_iterator;
-			using const_iterator = utf_iterator const;
-			using reference = utf_iterator::reference;
-			using value_type = utf_iterator::value_type;
+		/// A view of the code points in [Begin, End) stored as CharT code units.
+		/// See code_unit_traits for the supported types and their encodings
+		template<typename CharT>
+		struct basic_utf_range {
+			using traits_type = code_unit_traits<CharT>;
+			using char_type = CharT;
+			using char_iterator = typename traits_type::char_iterator;
+			using iterator = typename traits_type::iterator;
+			using const_iterator = iterator const;
+			using reference = typename iterator::reference;
+			using value_type = typename iterator::value_type;
 			using const_reference = value_type const &;
-			using difference_type = utf_iterator::difference_type;
+			using difference_type = typename iterator::difference_type;
 
 		private:
 			iterator m_begin{ };
@@ -47,9 +59,9 @@ namespace daw {
 			size_t m_size = 0;
 
 		public:
-			constexpr utf_range( ) noexcept = default;
+			constexpr basic_utf_range( ) noexcept = default;
 
-			constexpr utf_range( iterator Begin, iterator End ) noexcept(
+			constexpr basic_utf_range( iterator Begin, iterator End ) noexcept(
 			  std::is_nothrow_copy_constructible_v<iterator> )
 			  : m_begin( Begin )
 			  , m_end( End )
@@ -84,21 +96,21 @@ namespace daw {
 				return m_size == 0;
 			}
 
-			constexpr utf_range &operator++( ) noexcept {
+			constexpr basic_utf_range &operator++( ) noexcept {
 				++m_begin;
 				--m_size;
 				return *this;
 			}
 
-			constexpr utf_range operator++( int ) noexcept {
-				utf_range result( *this );
+			constexpr basic_utf_range operator++( int ) noexcept {
+				basic_utf_range result( *this );
 				++( *this );
 				return result;
 			}
 
 			constexpr void advance( size_t const n ) noexcept {
 				assert( n <= m_size );
-				utf8::unchecked::advance( m_begin, n );
+				m_begin += static_cast<difference_type>( n );
 				m_size -= n;
 			}
 
@@ -110,8 +122,8 @@ namespace daw {
 				}
 			}
 
-			constexpr utf_range &set( iterator Begin, iterator End,
-			                          difference_type Size = -1 ) noexcept {
+			constexpr basic_utf_range &set( iterator Begin, iterator End,
+			                                difference_type Size = -1 ) noexcept {
 				m_begin = Begin;
 				m_end = End;
 				if( Size < 0 ) {
@@ -122,17 +134,17 @@ namespace daw {
 				return *this;
 			}
 
-			constexpr utf_range &set_begin( iterator Begin,
-			                                difference_type Size = -1 ) noexcept {
+			constexpr basic_utf_range &
+			set_begin( iterator Begin, difference_type Size = -1 ) noexcept {
 				return set( Begin, this->m_end, Size );
 			}
 
-			constexpr utf_range &set_end( iterator End,
-			                              difference_type Size = -1 ) noexcept {
+			constexpr basic_utf_range &set_end( iterator End,
+			                                    difference_type Size = -1 ) noexcept {
 				return set( this->m_begin, End, Size );
 			}
 
-			constexpr utf_range &operator+=( size_t const n ) noexcept {
+			constexpr basic_utf_range &operator+=( size_t const n ) noexcept {
 				advance( n );
 				return *this;
 			}
@@ -145,38 +157,105 @@ namespace daw {
 				return m_end.base( );
 			}
 
+			/// Number of code units
 			constexpr size_t raw_size( ) const noexcept {
 				return static_cast<size_t>(
 				  daw::distance( m_begin.base( ), m_end.base( ) ) );
 			}
 
-			constexpr utf_range copy( ) const noexcept {
+			constexpr basic_utf_range copy( ) const noexcept {
 				return *this;
 			}
 
-			constexpr utf_range substr( size_t pos, size_t length ) const noexcept {
+			constexpr basic_utf_range substr( size_t pos, size_t length ) const
+			  noexcept {
 				assert( pos + length <= size( ) );
 				auto result = copy( );
 				auto f = result.begin( ) + static_cast<difference_type>( pos );
 				auto l = f + static_cast<difference_type>( length );
-				result.set( f, l );
+				result.set( f, l, static_cast<difference_type>( length ) );
+				return result;
+			}
+
+			/// Number of bytes needed to hold the text as utf8
+			constexpr size_t u8_size( ) const noexcept {
+				if constexpr( is_utf8_code_unit_v<CharT> ) {
+					return raw_size( );
+				} else {
+					size_t result = 0;
+					for( auto cp : *this ) {
+						result += cp < 0x80U      ? 1U
+						          : cp < 0x800U   ? 2U
+						          : cp < 0x10000U ? 3U
+						                          : 4U;
+					}
+					return result;
+				}
+			}
+
+			/// The text as utf8, for utf8 storage this is a copy of the code units
+			inline std::string to_raw_u8string( ) const {
+				auto result = std::string( );
+				to_raw_u8string( result );
 				return result;
 			}
 
-			inline std::string to_raw_u8string( ) const noexcept {
-				return std::string( m_begin.base( ), m_end.base( ) );
+			/// Copy the utf8 bytes into out, reusing its capacity.  Returns
+			/// the number of bytes
+			inline size_t to_raw_u8string( std::string &out ) const {
+				out.resize( u8_size( ) );
+				to_raw_u8string( out.data( ), out.size( ) );
+				return out.size( );
+			}
+
+			/// Copy the utf8 bytes to [out, out + out_size) when they fit.  Returns
+			/// the number of bytes, nothing is written when this is larger than
+			/// out_size
+			inline size_t to_raw_u8string( char *out, size_t out_size ) const
+			  noexcept {
+				auto const sz = u8_size( );
+				if( sz > out_size ) {
+					return sz;
+				}
+				if constexpr( is_utf8_code_unit_v<CharT> ) {
+					std::transform( raw_begin( ), raw_end( ), out, []( CharT c ) {
+						return static_cast<char>( utf8::internal::mask8( c ) );
+					} );
+				} else {
+					for( auto cp : *this ) {
+						out = utf8::unchecked::append( cp, out );
+					}
+				}
+				return sz;
 			}
 
 			inline std::u32string to_u32string( ) const noexcept {
 				auto result = std::u32string( );
-				daw::algorithm::transform(
-				  begin( ), end( ), std::back_inserter( result ),
-				  []( auto c ) { return static_cast<char32_t>( c ); } );
-
+				to_u32string( result );
 				return result;
 			}
 
-			constexpr int compare( utf_range const &rhs ) const noexcept {
+			/// Decode into out, reusing its capacity.  Returns size( )
+			inline size_t to_u32string( std::u32string &out ) const {
+				out.resize( size( ) );
+				traits_type::to_u32( raw_begin( ), raw_end( ), out.data( ) );
+				return out.size( );
+			}
+
+			/// Decode to [out, out + out_size) when the code points fit.  Returns
+			/// size( ), nothing is written when this is larger than out_size
+			constexpr size_t to_u32string( char32_t *out, size_t out_size ) const
+			  noexcept {
+				if( size( ) <= out_size ) {
+					traits_type::to_u32( raw_begin( ), raw_end( ), out );
+				}
+				return size( );
+			}
+
+			/// Compare by code point, rhs may be stored in any encoding
+			template<typename CharU>
+			constexpr int compare( basic_utf_range<CharU> const &rhs ) const
+			  noexcept {
 				auto it_lhs = begin( );
 				auto it_rhs = rhs.begin( );
 				enum compare_results_t {
@@ -200,19 +279,138 @@ namespace daw {
 				}
 				if( it_lhs != end( ) ) {
 					return greater_than;
-				} else if( it_rhs != end( ) ) {
+				} else if( it_rhs != rhs.end( ) ) {
 					return less_than;
 				}
 				return equal_to;
 			}
 
-			constexpr daw::string_view to_string_view( ) const noexcept {
-				return { raw_begin( ), static_cast<std::size_t>(
-				                         std::distance( raw_begin( ), raw_end( ) ) ) };
+			/// The code units, a daw::string_view for char storage
+			constexpr auto to_string_view( ) const noexcept {
+				if constexpr( std::is_same_v<CharT, char> ) {
+					return daw::string_view(
+					  raw_begin( ), static_cast<std::size_t>(
+					                  std::distance( raw_begin( ), raw_end( ) ) ) );
+				} else {
+					static_assert( not std::is_same_v<CharT, std::byte> and
+					                 not std::is_same_v<CharT, unsigned char>,
+					               "There is no string_view of this code unit type" );
+					return std::basic_string_view<CharT>( raw_begin( ), raw_size( ) );
+				}
+			}
+
+		private:
+			static constexpr basic_utf_range empty_at( iterator pos ) noexcept {
+				auto result = basic_utf_range( );
+				result.set( pos, pos, 0 );
+				return result;
+			}
+
+			/// The sub range at pos matching needle, or an empty range at end( )
+			/// when pos is raw_end( )
+			constexpr basic_utf_range match_at( char_iterator pos,
+			                                    basic_utf_range const &needle ) const
+			  noexcept {
+				if( pos == raw_end( ) ) {
+					return empty_at( m_end );
+				}
+				auto result = basic_utf_range( );
+				result.set( iterator( pos ), iterator( pos + needle.raw_size( ) ),
+				            static_cast<difference_type>( needle.size( ) ) );
+				return result;
+			}
+
+			/// A range over the code units of cp in buff
+			static constexpr basic_utf_range
+			encode_code_point( utf_val_type cp,
+			                   CharT ( &buff )[traits_type::max_units] ) noexcept {
+				auto const last = traits_type::encode( cp, buff + 0 );
+				auto result = basic_utf_range( );
+				result.set( iterator( buff + 0 ), iterator( last ), 1 );
+				return result;
+			}
+
+		public:
+			/// The first occurrence of needle as a sub range of this, an empty
+			/// range at end( ) when there is none.  The code units are searched
+			/// directly, UTF-8 and UTF-16 are self-synchronizing so a match of
+			/// valid text always starts and ends on a code point.  Use offset_of
+			/// for the code point position
+			inline basic_utf_range find( basic_utf_range const &needle ) const
+			  noexcept {
+				if( needle.raw_size( ) == 0 ) {
+					return empty_at( m_begin );
+				}
+				return match_at( impl::find_units( raw_begin( ), raw_end( ),
+				                                   needle.raw_begin( ),
+				                                   needle.raw_end( ) ),
+				                 needle );
+			}
+
+			inline basic_utf_range find( utf_val_type cp ) const noexcept {
+				CharT buff[traits_type::max_units]{ };
+				return find( encode_code_point( cp, buff ) );
+			}
+
+			/// The last occurrence of needle, an empty range at end( ) when there
+			/// is none
+			inline basic_utf_range rfind( basic_utf_range const &needle ) const
+			  noexcept {
+				if( needle.raw_size( ) == 0 ) {
+					return empty_at( m_end );
+				}
+				return match_at( impl::rfind_units( raw_begin( ), raw_end( ),
+				                                    needle.raw_begin( ),
+				                                    needle.raw_end( ) ),
+				                 needle );
+			}
+
+			inline basic_utf_range rfind( utf_val_type cp ) const noexcept {
+				CharT buff[traits_type::max_units]{ };
+				return rfind( encode_code_point( cp, buff ) );
+			}
+
+			inline bool contains( basic_utf_range const &needle ) const noexcept {
+				return needle.raw_size( ) == 0 or not find( needle ).empty( );
+			}
+
+			inline bool contains( utf_val_type cp ) const noexcept {
+				return not find( cp ).empty( );
+			}
+
+			constexpr bool starts_with( basic_utf_range const &needle ) const
+			  noexcept {
+				return needle.raw_size( ) <= raw_size( ) and
+				       std::equal( needle.raw_begin( ), needle.raw_end( ),
+				                   raw_begin( ) );
+			}
+
+			constexpr bool starts_with( utf_val_type cp ) const noexcept {
+				return not empty( ) and *begin( ) == cp;
 			}
-		}; // struct utf_range
 
-		constexpr utf_range operator+( utf_range range, size_t const n ) noexcept {
+			constexpr bool ends_with( basic_utf_range const &needle ) const
+			  noexcept {
+				return needle.raw_size( ) <= raw_size( ) and
+				       std::equal( needle.raw_begin( ), needle.raw_end( ),
+				                   raw_end( ) - needle.raw_size( ) );
+			}
+
+			/// Code point index in this of the start of sub, a sub range such as
+			/// one returned by find.  Counted when asked for, so searching does not
+			/// pay for it
+			inline size_t offset_of( basic_utf_range const &sub ) const noexcept {
+				assert( raw_begin( ) <= sub.raw_begin( ) and
+				        sub.raw_begin( ) <= raw_end( ) );
+				return traits_type::count( raw_begin( ), sub.raw_begin( ) );
+			}
+		}; // basic_utf_range
+
+		using utf_range = basic_utf_range<char>;
+
+		template<typename CharT>
+		constexpr basic_utf_range<CharT> operator+( basic_utf_range<CharT> range,
+		                                            size_t const n ) noexcept {
 			range.advance( n );
 			return range;
 		}
@@ -230,7 +428,7 @@ namespace daw {
 
 		template<size_t N>
 		constexpr utf_range create_char_range( char const ( &str )[N] ) noexcept {
-			return { str, N - 1 };
+			return create_char_range( daw::string_view( str, N - 1 ) );
 		}
 
 		constexpr utf_range create_char_range( char_iterator first,
@@ -245,6 +443,45 @@ namespace daw {
 			return create_char_range( sv );
 		}
 
+		/// A range over code units of any supported type, e.g. UTF-16 text in a
+		/// char16_t buffer
+		template<typename CharT,
+		         std::enable_if_t<is_code_unit_v<CharT>, std::nullptr_t> = nullptr>
+		constexpr basic_utf_range<CharT>
+		create_char_range( CharT const *first, CharT const *last ) noexcept {
+			using iterator = typename basic_utf_range<CharT>::iterator;
+			return { iterator( first ), iterator( last ) };
+		}
+
+		template<typename CharT, size_t N,
+		         std::enable_if_t<is_code_unit_v<CharT>, std::nullptr_t> = nullptr>
+		constexpr basic_utf_range<CharT>
+		create_char_range( CharT const ( &str )[N] ) noexcept {
+			return create_char_range( str, str + ( N - 1 ) );
+		}
+
+		template<typename CharT,
+		         std::enable_if_t<is_code_unit_v<CharT>, std::nullptr_t> = nullptr>
+		constexpr basic_utf_range<CharT>
+		create_char_range( std::basic_string_view<CharT> str ) noexcept {
+			return create_char_range( str.data( ), str.data( ) + str.size( ) );
+		}
+
+		template<typename CharT,
+		         std::enable_if_t<is_code_unit_v<CharT>, std::nullptr_t> = nullptr>
+		inline basic_utf_range<CharT>
+		create_char_range( std::basic_string<CharT> const &str ) noexcept {
+			return create_char_range( str.data( ), str.data( ) + str.size( ) );
+		}
+
+		/// Code units in a std::vector, used for unsigned char and std::byte
+		template<typename CharT,
+		         std::enable_if_t<is_code_unit_v<CharT>, std::nullptr_t> = nullptr>
+		inline basic_utf_range<CharT>
+		create_char_range( std::vector<CharT> const &buff ) noexcept {
+			return create_char_range( buff.data( ), buff.data( ) + buff.size( ) );
+		}
+
 		constexpr bool operator==( utf_range const &lhs,
 		                           utf_range const &rhs ) noexcept {
 			return lhs.compare( rhs ) == 0;
@@ -280,6 +517,43 @@ namespace daw {
 			return lhs.compare( rhs ) >= 0;
 		}
 
+		/// Comparisons by code point across any pair of code unit types
+		template<typename CharT, typename CharU>
+		constexpr bool operator==( basic_utf_range<CharT> const &lhs,
+		                           basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) == 0;
+		}
+
+		template<typename CharT, typename CharU>
+		constexpr bool operator!=( basic_utf_range<CharT> const &lhs,
+		                           basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) != 0;
+		}
+
+		template<typename CharT, typename CharU>
+		constexpr bool operator<( basic_utf_range<CharT> const &lhs,
+		                          basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) < 0;
+		}
+
+		template<typename CharT, typename CharU>
+		constexpr bool operator>( basic_utf_range<CharT> const &lhs,
+		                          basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) > 0;
+		}
+
+		template<typename CharT, typename CharU>
+		constexpr bool operator<=( basic_utf_range<CharT> const &lhs,
+		                           basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) <= 0;
+		}
+
+		template<typename CharT, typename CharU>
+		constexpr bool operator>=( basic_utf_range<CharT> const &lhs,
+		                           basic_utf_range<CharU> const &rhs ) noexcept {
+			return lhs.compare( rhs ) >= 0;
+		}
+
 		constexpr void clear( utf_range &str ) noexcept {
 			str.advance( str.size( ) );
 		}
@@ -290,6 +564,12 @@ namespace daw {
 			                      str.begin( ).base( ), str.end( ).base( ) ) ) };
 		}
 
+		/// Copy the utf8 bytes of str into out, reusing its capacity.  Returns the
+		/// number of bytes
+		inline size_t to_string( utf_range const &str, std::string &out ) {
+			return str.to_raw_u8string( out );
+		}
+
 		template<typename OStream,
 		         std::enable_if_t<daw::traits::is_ostream_like_v<OStream, char>,
 		                          std::nullptr_t> = nullptr>
@@ -301,6 +581,16 @@ namespace daw {
 			return os;
 		}
 
+		/// Writes the text as utf8
+		template<typename OStream, typename CharT,
+		         std::enable_if_t<daw::traits::is_ostream_like_v<OStream, char> and
+		                            not std::is_same_v<CharT, char>,
+		                          std::nullptr_t> = nullptr>
+		OStream &operator<<( OStream &os, basic_utf_range<CharT> const &value ) {
+			os << value.to_raw_u8string( );
+			return os;
+		}
+
 		constexpr daw::string_view to_string_view( utf_range const &str ) noexcept {
 			return str.to_string_view( );
 		}
@@ -317,12 +607,135 @@ namespace daw {
 			return result;
 		}
 
+		/// Decode [first, last) into out, reusing its capacity.  Returns the
+		/// number of code points
+		inline size_t to_u32string( utf_iterator first, utf_iterator last,
+		                            std::u32string &out ) {
+			out.clear( );
+			std::transform( first, last, std::back_inserter( out ),
+			                []( auto c ) { return static_cast<char32_t>( c ); } );
+			return out.size( );
+		}
+
+		/// A utf8 literal that has been validated and had its code point count
+		/// and hash computed when it was created.  Create it in a constant
+		/// expression with make_utf_literal or the _utf literal so invalid text
+		/// fails to compile
+		class utf_literal {
+			utf_range m_range;
+			size_t m_hash;
+
+			static constexpr utf_range validate( char const *str, size_t len ) {
+				auto const last = str + len;
+				auto const bad = utf8::find_invalid( str, last );
+				if( bad != last ) {
+					daw::exception::daw_throw<utf8::invalid_utf8>(
+					  static_cast<uint8_t>( *bad ) );
+				}
+				return utf_range( utf_iterator( str ), utf_iterator( last ) );
+			}
+
+		public:
+			using iterator = utf_range::iterator;
+			using const_iterator = utf_range::const_iterator;
+			using value_type = utf_range::value_type;
+
+			/// Throws utf8::invalid_utf8 when [str, str + len) is not valid utf8.
+			/// In a constant expression this is a compile error
+			constexpr utf_literal( char const *str, size_t len )
+			  : m_range( validate( str, len ) )
+			  , m_hash( hash_sequence( str, str + len ) ) {}
+
+			constexpr utf_range const &range( ) const noexcept {
+				return m_range;
+			}
+
+			constexpr operator utf_range const &( ) const noexcept {
+				return m_range;
+			}
+
+			constexpr const_iterator begin( ) const noexcept {
+				return m_range.begin( );
+			}
+
+			constexpr const_iterator end( ) const noexcept {
+				return m_range.end( );
+			}
+
+			/// Number of code points
+			constexpr size_t size( ) const noexcept {
+				return m_range.size( );
+			}
+
+			constexpr bool empty( ) const noexcept {
+				return m_range.empty( );
+			}
+
+			constexpr char_iterator raw_begin( ) const noexcept {
+				return m_range.raw_begin( );
+			}
+
+			constexpr char_iterator raw_end( ) const noexcept {
+				return m_range.raw_end( );
+			}
+
+			constexpr size_t raw_size( ) const noexcept {
+				return m_range.raw_size( );
+			}
+
+			/// Same value as std::hash<utf_range> for the same text
+			constexpr size_t hash( ) const noexcept {
+				return m_hash;
+			}
+		}; // utf_literal
+
+#if defined( __cpp_consteval )
+#define DAW_UTF_CONSTEVAL consteval
+#else
+#define DAW_UTF_CONSTEVAL constexpr
+#endif
+
+		/// Validate str and compute its size and hash.  This is consteval when
+		/// supported, otherwise assign the result to a constexpr variable to have
+		/// it checked at compile time
+		template<size_t N>
+		DAW_UTF_CONSTEVAL utf_literal make_utf_literal( char const ( &str )[N] ) {
+			return utf_literal( str, N - 1 );
+		}
 	} // namespace range
 
+	namespace utf_literals {
+		DAW_UTF_CONSTEVAL range::utf_literal operator""_utf( char const *str,
+		                                                      size_t len ) {
+			return range::utf_literal( str, len );
+		}
+	} // namespace utf_literals
+
+#undef DAW_UTF_CONSTEVAL
+
+	/// Encode other as utf8 into out, reusing its capacity.  Returns the number
+	/// of bytes
+	inline size_t from_u32string( std::u32string_view other, std::string &out ) {
+		out.resize( utf8::encoded_length( other.begin( ), other.end( ) ) );
+		utf8::unchecked::utf32to8( other.begin( ), other.end( ), out.data( ) );
+		return out.size( );
+	}
+
+	/// Encode other as utf8 to [out, out + out_size) when it fits.  Returns the
+	/// number of bytes required, nothing is written when this is larger than
+	/// out_size
+	inline size_t from_u32string( std::u32string_view other, char *out,
+	                              size_t out_size ) noexcept {
+		auto const sz = utf8::encoded_length( other.begin( ), other.end( ) );
+		if( sz <= out_size ) {
+			utf8::unchecked::utf32to8( other.begin( ), other.end( ), out );
+		}
+		return sz;
+	}
+
 	inline std::string from_u32string( std::u32string const &other ) {
 		std::string result;
-		utf8::unchecked::utf32to8( other.begin( ), other.end( ),
-		                           std::back_inserter( result ) );
+		from_u32string( other, result );
 		return result;
 	}
 } // namespace daw
@@ -336,4 +749,23 @@ namespace std {
 			                                  value.end( ).base( ) );
 		}
 	};
+
+	/// Hashes the code units, so equal text in different encodings differs
+	template<typename CharT>
+	struct hash<daw::range::basic_utf_range<CharT>> {
+		inline size_t operator( )(
+		  daw::range::basic_utf_range<CharT> const &value ) const noexcept {
+			return daw::fnv1a_hash(
+			  reinterpret_cast<char const *>( value.raw_begin( ) ),
+			  value.raw_size( ) * sizeof( CharT ) );
+		}
+	};
+
+	template<>
+	struct hash<daw::range::utf_literal> {
+		constexpr size_t
+		operator( )( daw::range::utf_literal const &value ) const noexcept {
+			return value.hash( );
+		}
+	};
 } // namespace std
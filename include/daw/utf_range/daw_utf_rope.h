@@ -0,0 +1,673 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/header_libraries
+//
+
+#pragma once
+
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "daw_utf_string.h"
+
+#include <daw/daw_exception.h>
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace daw {
+	/// A utf8 text container for large documents that are edited in place.
+	/// The text lives in append only buffers and is described by a sequence of
+	/// utf_range pieces held in a balanced tree(treap) ordered by position.
+	/// Every node caches the code point, byte and newline counts of its subtree
+	/// so insert, erase and indexing by code point are O(log n).  Any
+	/// modification invalidates iterators.
+	class utf_rope {
+	public:
+		class const_iterator;
+		using iterator = const_iterator;
+		using value_type = range::utf_val_type;
+		using reference = value_type;
+		using const_reference = value_type;
+		using difference_type = std::ptrdiff_t;
+		using size_type = size_t;
+
+		static constexpr size_t npos = static_cast<size_t>( -1 );
+
+		/// The largest piece, in bytes, created from inserted text.  This bounds
+		/// the walk within a piece when splitting or indexing
+		static constexpr size_t max_piece_size = 1024U;
+
+	private:
+		static constexpr size_t buffer_block_size = 4096U;
+
+		struct node {
+			range::utf_range piece{ };
+			size_t piece_newlines = 0;
+			// Totals for the subtree rooted at this node
+			size_t cp_count = 0;
+			size_t byte_count = 0;
+			size_t newline_count = 0;
+			size_t left = npos;
+			size_t right = npos;
+			size_t parent = npos;
+			uint32_t priority = 0;
+		};
+
+		std::deque<std::string> m_buffers{ };
+		std::vector<node> m_nodes{ };
+		std::vector<size_t> m_free{ };
+		size_t m_root = npos;
+		uint32_t m_seed = 0x9E37'79B9U;
+
+		[[nodiscard]] static inline size_t
+		count_newlines( range::utf_range const &piece ) noexcept {
+			return static_cast<size_t>(
+			  std::count( piece.raw_begin( ), piece.raw_end( ), '\n' ) );
+		}
+
+		[[nodiscard]] inline uint32_t next_priority( ) noexcept {
+			// xorshift32
+			m_seed ^= m_seed << 13U;
+			m_seed ^= m_seed >> 17U;
+			m_seed ^= m_seed << 5U;
+			return m_seed;
+		}
+
+		/// Copy text into the append only storage.  Buffers are never grown past
+		/// their reserved capacity so pieces pointing into them stay valid
+		[[nodiscard]] inline range::char_iterator store( char const *first,
+		                                                 size_t count ) {
+			if( m_buffers.empty( ) or
+			    m_buffers.back( ).capacity( ) - m_buffers.back( ).size( ) < count ) {
+				m_buffers.emplace_back( );
+				m_buffers.back( ).reserve( std::max( buffer_block_size, count ) );
+			}
+			auto &buff = m_buffers.back( );
+			auto const pos = buff.size( );
+			buff.append( first, count );
+			return buff.data( ) + pos;
+		}
+
+		/// Where the next stored byte will be placed if it fits in the current
+		/// buffer
+		[[nodiscard]] inline range::char_iterator store_end( ) const noexcept {
+			if( m_buffers.empty( ) ) {
+				return nullptr;
+			}
+			return m_buffers.back( ).data( ) + m_buffers.back( ).size( );
+		}
+
+		[[nodiscard]] inline size_t store_room( ) const noexcept {
+			if( m_buffers.empty( ) ) {
+				return 0;
+			}
+			return m_buffers.back( ).capacity( ) - m_buffers.back( ).size( );
+		}
+
+		[[nodiscard]] inline size_t make_node( range::utf_range piece ) {
+			auto n = node{ };
+			n.piece = piece;
+			n.piece_newlines = count_newlines( piece );
+			n.priority = next_priority( );
+			size_t idx = 0;
+			if( m_free.empty( ) ) {
+				idx = m_nodes.size( );
+				m_nodes.push_back( n );
+			} else {
+				idx = m_free.back( );
+				m_free.pop_back( );
+				m_nodes[idx] = n;
+			}
+			update( idx );
+			return idx;
+		}
+
+		inline void release( size_t t ) {
+			auto pending = std::vector<size_t>( );
+			if( t != npos ) {
+				pending.push_back( t );
+			}
+			while( not pending.empty( ) ) {
+				auto const n = pending.back( );
+				pending.pop_back( );
+				for( auto child : { m_nodes[n].left, m_nodes[n].right } ) {
+					if( child != npos ) {
+						pending.push_back( child );
+					}
+				}
+				m_nodes[n] = node{ };
+				m_free.push_back( n );
+			}
+		}
+
+		inline void update( size_t t ) noexcept {
+			auto &n = m_nodes[t];
+			n.cp_count = n.piece.size( );
+			n.byte_count = n.piece.raw_size( );
+			n.newline_count = n.piece_newlines;
+			for( auto child : { n.left, n.right } ) {
+				if( child != npos ) {
+					auto &c = m_nodes[child];
+					n.cp_count += c.cp_count;
+					n.byte_count += c.byte_count;
+					n.newline_count += c.newline_count;
+					c.parent = t;
+				}
+			}
+		}
+
+		inline void set_root( size_t t ) noexcept {
+			m_root = t;
+			if( t != npos ) {
+				m_nodes[t].parent = npos;
+			}
+		}
+
+		[[nodiscard]] inline size_t merge( size_t a, size_t b ) noexcept {
+			if( a == npos ) {
+				return b;
+			}
+			if( b == npos ) {
+				return a;
+			}
+			if( m_nodes[a].priority > m_nodes[b].priority ) {
+				m_nodes[a].right = merge( m_nodes[a].right, b );
+				update( a );
+				return a;
+			}
+			m_nodes[b].left = merge( a, m_nodes[b].left );
+			update( b );
+			return b;
+		}
+
+		/// Split t into the code points [0, pos) and [pos, size).  A piece
+		/// straddling pos is cut in two
+		[[nodiscard]] inline std::pair<size_t, size_t> split( size_t t,
+		                                                      size_t pos ) {
+			if( t == npos ) {
+				return { npos, npos };
+			}
+			auto const l = m_nodes[t].left;
+			auto const left_count = l == npos ? 0 : m_nodes[l].cp_count;
+			auto const piece_count = m_nodes[t].piece.size( );
+			if( pos <= left_count ) {
+				auto const [ll, lr] = split( l, pos );
+				m_nodes[t].left = lr;
+				update( t );
+				return { ll, t };
+			}
+			if( pos >= left_count + piece_count ) {
+				auto const [rl, rr] =
+				  split( m_nodes[t].right, pos - left_count - piece_count );
+				m_nodes[t].right = rl;
+				update( t );
+				return { t, rr };
+			}
+			auto const offset = pos - left_count;
+			auto head = m_nodes[t].piece;
+			auto const total_newlines = m_nodes[t].piece_newlines;
+			auto const mid = head.begin( ) + static_cast<difference_type>( offset );
+			auto const tail = make_node( range::utf_range( head ).set_begin(
+			  mid, static_cast<difference_type>( piece_count - offset ) ) );
+			head.set_end( mid, static_cast<difference_type>( offset ) );
+			auto const r = m_nodes[t].right;
+			m_nodes[t].piece = head;
+			m_nodes[t].piece_newlines = total_newlines - m_nodes[tail].piece_newlines;
+			m_nodes[t].right = npos;
+			update( t );
+			return { t, merge( tail, r ) };
+		}
+
+		/// Try to grow the last piece of t in place when it ends where the next
+		/// stored bytes will go.  This keeps runs of small appends, e.g. typing,
+		/// from creating a node per edit
+		[[nodiscard]] inline bool try_extend( size_t t,
+		                                      range::utf_range const &text ) {
+			if( t == npos or store_room( ) < text.raw_size( ) ) {
+				return false;
+			}
+			auto path = std::vector<size_t>( );
+			for( auto n = t; n != npos; n = m_nodes[n].right ) {
+				path.push_back( n );
+			}
+			auto &last = m_nodes[path.back( )];
+			if( last.piece.raw_end( ) != store_end( ) or
+			    last.piece.raw_size( ) + text.raw_size( ) > max_piece_size ) {
+				return false;
+			}
+			auto const first = store( text.raw_begin( ), text.raw_size( ) );
+			last.piece.set_end(
+			  range::utf_iterator( first + text.raw_size( ) ),
+			  static_cast<difference_type>( last.piece.size( ) + text.size( ) ) );
+			last.piece_newlines += count_newlines( text );
+			for( auto it = path.rbegin( ); it != path.rend( ); ++it ) {
+				update( *it );
+			}
+			return true;
+		}
+
+		/// Store text and build a subtree of pieces no larger than max_piece_size
+		[[nodiscard]] inline size_t build( range::utf_range text ) {
+			auto result = npos;
+			auto first = text.raw_begin( );
+			auto const last = text.raw_end( );
+			while( first != last ) {
+				auto const avail = static_cast<size_t>( last - first );
+				auto count = std::min( avail, max_piece_size );
+				if( count < avail ) {
+					// Back up to the lead byte so no code point is split
+					while( count > 0 and utf8::internal::is_trail( first[count] ) ) {
+						--count;
+					}
+				}
+				auto const p = store( first, count );
+				result = merge(
+				  result, make_node( range::create_char_range( p, p + count ) ) );
+				first += count;
+			}
+			return result;
+		}
+
+		/// Find the node holding the code point at pos and the offset into its
+		/// piece
+		[[nodiscard]] inline std::pair<size_t, size_t>
+		find( size_t pos ) const noexcept {
+			auto t = m_root;
+			while( t != npos ) {
+				auto const &n = m_nodes[t];
+				auto const left_count = n.left == npos ? 0 : m_nodes[n.left].cp_count;
+				if( pos < left_count ) {
+					t = n.left;
+				} else if( pos < left_count + n.piece.size( ) ) {
+					return { t, pos - left_count };
+				} else {
+					pos -= left_count + n.piece.size( );
+					t = n.right;
+				}
+			}
+			return { npos, 0 };
+		}
+
+		[[nodiscard]] inline size_t leftmost( size_t t ) const noexcept {
+			if( t == npos ) {
+				return t;
+			}
+			while( m_nodes[t].left != npos ) {
+				t = m_nodes[t].left;
+			}
+			return t;
+		}
+
+		[[nodiscard]] inline size_t rightmost( size_t t ) const noexcept {
+			if( t == npos ) {
+				return t;
+			}
+			while( m_nodes[t].right != npos ) {
+				t = m_nodes[t].right;
+			}
+			return t;
+		}
+
+		[[nodiscard]] inline size_t next_node( size_t t ) const noexcept {
+			if( m_nodes[t].right != npos ) {
+				return leftmost( m_nodes[t].right );
+			}
+			auto p = m_nodes[t].parent;
+			while( p != npos and m_nodes[p].right == t ) {
+				t = p;
+				p = m_nodes[t].parent;
+			}
+			return p;
+		}
+
+		[[nodiscard]] inline size_t prev_node( size_t t ) const noexcept {
+			if( m_nodes[t].left != npos ) {
+				return rightmost( m_nodes[t].left );
+			}
+			auto p = m_nodes[t].parent;
+			while( p != npos and m_nodes[p].left == t ) {
+				t = p;
+				p = m_nodes[t].parent;
+			}
+			return p;
+		}
+
+		template<typename Function>
+		inline void for_each_piece( Function &&func ) const {
+			for( auto t = leftmost( m_root ); t != npos; t = next_node( t ) ) {
+				func( m_nodes[t].piece );
+			}
+		}
+
+	public:
+		utf_rope( ) = default;
+
+		inline utf_rope( range::utf_range text ) {
+			set_root( build( text ) );
+		}
+
+		inline utf_rope( daw::string_view text )
+		  : utf_rope( range::create_char_range( text ) ) {}
+
+		inline utf_rope( char const *text )
+		  : utf_rope( range::create_char_range( text ) ) {}
+
+		explicit inline utf_rope( utf_string const &text )
+		  : utf_rope( text.utf_range( ) ) {}
+
+		/// Copies are compacted into a single run of storage
+		inline utf_rope( utf_rope const &other ) {
+			m_buffers.emplace_back( );
+			m_buffers.back( ).reserve( std::max( buffer_block_size,
+			                                     other.raw_size( ) ) );
+			other.for_each_piece( [&]( range::utf_range const &piece ) {
+				auto const p = store( piece.raw_begin( ), piece.raw_size( ) );
+				auto const t = make_node( range::utf_range( ).set(
+				  range::utf_iterator( p ),
+				  range::utf_iterator( p + piece.raw_size( ) ),
+				  static_cast<difference_type>( piece.size( ) ) ) );
+				m_root = merge( m_root, t );
+			} );
+			set_root( m_root );
+		}
+
+		/// The buffers' heap storage is taken over as is, so pieces remain valid.
+		/// other is left empty
+		inline utf_rope( utf_rope &&other ) noexcept
+		  : m_buffers( std::move( other.m_buffers ) )
+		  , m_nodes( std::move( other.m_nodes ) )
+		  , m_free( std::move( other.m_free ) )
+		  , m_root( std::exchange( other.m_root, npos ) )
+		  , m_seed( other.m_seed ) {
+			other.clear( );
+		}
+
+		inline utf_rope &operator=( utf_rope &&rhs ) noexcept {
+			if( this != &rhs ) {
+				m_buffers = std::move( rhs.m_buffers );
+				m_nodes = std::move( rhs.m_nodes );
+				m_free = std::move( rhs.m_free );
+				m_root = std::exchange( rhs.m_root, npos );
+				m_seed = rhs.m_seed;
+				rhs.clear( );
+			}
+			return *this;
+		}
+
+		inline utf_rope &operator=( utf_rope const &rhs ) {
+			if( this != &rhs ) {
+				auto tmp = utf_rope( rhs );
+				*this = std::move( tmp );
+			}
+			return *this;
+		}
+
+		~utf_rope( ) = default;
+
+		/// Number of code points
+		[[nodiscard]] inline size_t size( ) const noexcept {
+			return m_root == npos ? 0 : m_nodes[m_root].cp_count;
+		}
+
+		[[nodiscard]] inline size_t raw_size( ) const noexcept {
+			return m_root == npos ? 0 : m_nodes[m_root].byte_count;
+		}
+
+		[[nodiscard]] inline bool empty( ) const noexcept {
+			return m_root == npos;
+		}
+
+		[[nodiscard]] inline size_t newline_count( ) const noexcept {
+			return m_root == npos ? 0 : m_nodes[m_root].newline_count;
+		}
+
+		[[nodiscard]] inline size_t line_count( ) const noexcept {
+			return newline_count( ) + 1;
+		}
+
+		/// The code point position of the first code point of line, or npos when
+		/// line >= line_count( ).  Lines are zero based and separated by '\n'
+		[[nodiscard]] inline size_t line_start( size_t line ) const noexcept {
+			if( line == 0 ) {
+				return 0;
+			}
+			if( line > newline_count( ) ) {
+				return npos;
+			}
+			// Find the piece holding the line'th newline, counting code points
+			// before it.  The check above means there is one
+			auto remaining = line;
+			size_t pos = 0;
+			auto t = m_root;
+			while( true ) {
+				auto const &n = m_nodes[t];
+				auto const left_nl = n.left == npos ? 0 : m_nodes[n.left].newline_count;
+				auto const left_cp = n.left == npos ? 0 : m_nodes[n.left].cp_count;
+				if( remaining <= left_nl ) {
+					t = n.left;
+					continue;
+				}
+				remaining -= left_nl;
+				pos += left_cp;
+				if( remaining <= n.piece_newlines ) {
+					break;
+				}
+				remaining -= n.piece_newlines;
+				pos += n.piece.size( );
+				t = n.right;
+			}
+			for( auto it = m_nodes[t].piece.begin( ); remaining > 0; ++it ) {
+				++pos;
+				if( *it.base( ) == '\n' ) {
+					--remaining;
+				}
+			}
+			return pos;
+		}
+
+		/// The code point at pos.  pos must be < size( )
+		[[nodiscard]] inline value_type operator[]( size_t pos ) const noexcept {
+			assert( pos < size( ) );
+			auto const [t, offset] = find( pos );
+			return *( m_nodes[t].piece.begin( ) +
+			          static_cast<difference_type>( offset ) );
+		}
+
+		/// Insert text before the code point at pos.  Throws std::out_of_range
+		/// when pos > size( )
+		inline utf_rope &insert( size_t pos, range::utf_range text ) {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos <= size( ), "Attempt to insert past end of utf_rope" );
+			if( text.empty( ) ) {
+				return *this;
+			}
+			auto const [l, r] = split( m_root, pos );
+			if( try_extend( l, text ) ) {
+				set_root( merge( l, r ) );
+			} else {
+				auto const m = build( text );
+				set_root( merge( merge( l, m ), r ) );
+			}
+			return *this;
+		}
+
+		inline utf_rope &insert( size_t pos, daw::string_view text ) {
+			return insert( pos, range::create_char_range( text ) );
+		}
+
+		inline utf_rope &append( range::utf_range text ) {
+			return insert( size( ), text );
+		}
+
+		inline utf_rope &append( daw::string_view text ) {
+			return insert( size( ), range::create_char_range( text ) );
+		}
+
+		/// Remove up to count code points starting at pos.  Throws
+		/// std::out_of_range when pos > size( )
+		inline utf_rope &erase( size_t pos, size_t count = npos ) {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos <= size( ), "Attempt to erase past end of utf_rope" );
+			count = std::min( count, size( ) - pos );
+			if( count == 0 ) {
+				return *this;
+			}
+			auto const [l, rest] = split( m_root, pos );
+			auto const [m, r] = split( rest, count );
+			release( m );
+			set_root( merge( l, r ) );
+			return *this;
+		}
+
+		inline void clear( ) noexcept {
+			m_buffers.clear( );
+			m_nodes.clear( );
+			m_free.clear( );
+			m_root = npos;
+		}
+
+		[[nodiscard]] inline std::string to_string( ) const {
+			auto result = std::string( );
+			result.reserve( raw_size( ) );
+			for_each_piece( [&]( range::utf_range const &piece ) {
+				result.append( piece.raw_begin( ), piece.raw_size( ) );
+			} );
+			return result;
+		}
+
+		[[nodiscard]] inline utf_string to_utf_string( ) const {
+			auto result = utf_string( );
+			result.reserve( raw_size( ) );
+			for_each_piece(
+			  [&]( range::utf_range const &piece ) { result.append( piece ); } );
+			return result;
+		}
+
+		/// Bidirectional iterator over the code points.  Within a piece it is a
+		/// range::utf_iterator
+		class const_iterator {
+			utf_rope const *m_rope = nullptr;
+			size_t m_node = npos;
+			range::utf_iterator m_it{ };
+
+			friend class utf_rope;
+
+			inline const_iterator( utf_rope const *rope, size_t n ) noexcept
+			  : m_rope( rope )
+			  , m_node( n ) {
+				if( n != npos ) {
+					m_it = m_rope->m_nodes[n].piece.begin( );
+				}
+			}
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = range::utf_val_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type const *;
+			using reference = value_type;
+
+			const_iterator( ) = default;
+
+			[[nodiscard]] inline value_type operator*( ) const noexcept {
+				return *m_it;
+			}
+
+			inline const_iterator &operator++( ) noexcept {
+				++m_it;
+				if( m_it == m_rope->m_nodes[m_node].piece.end( ) ) {
+					m_node = m_rope->next_node( m_node );
+					m_it = m_node == npos ? range::utf_iterator( )
+					                      : m_rope->m_nodes[m_node].piece.begin( );
+				}
+				return *this;
+			}
+
+			inline const_iterator operator++( int ) noexcept {
+				auto result = *this;
+				++( *this );
+				return result;
+			}
+
+			inline const_iterator &operator--( ) noexcept {
+				if( m_node == npos ) {
+					m_node = m_rope->rightmost( m_rope->m_root );
+					m_it = m_rope->m_nodes[m_node].piece.end( );
+				} else if( m_it == m_rope->m_nodes[m_node].piece.begin( ) ) {
+					m_node = m_rope->prev_node( m_node );
+					m_it = m_rope->m_nodes[m_node].piece.end( );
+				}
+				--m_it;
+				return *this;
+			}
+
+			inline const_iterator operator--( int ) noexcept {
+				auto result = *this;
+				--( *this );
+				return result;
+			}
+
+			/// The piece the iterator is currently in
+			[[nodiscard]] inline range::utf_range piece( ) const noexcept {
+				return m_rope->m_nodes[m_node].piece;
+			}
+
+			[[nodiscard]] friend inline bool
+			operator==( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return lhs.m_node == rhs.m_node and
+				       ( lhs.m_node == npos or lhs.m_it == rhs.m_it );
+			}
+
+			[[nodiscard]] friend inline bool
+			operator!=( const_iterator const &lhs,
+			            const_iterator const &rhs ) noexcept {
+				return not( lhs == rhs );
+			}
+		}; // const_iterator
+
+		[[nodiscard]] inline const_iterator begin( ) const noexcept {
+			return const_iterator( this, leftmost( m_root ) );
+		}
+
+		[[nodiscard]] inline const_iterator cbegin( ) const noexcept {
+			return begin( );
+		}
+
+		[[nodiscard]] inline const_iterator end( ) const noexcept {
+			return const_iterator( this, npos );
+		}
+
+		[[nodiscard]] inline const_iterator cend( ) const noexcept {
+			return end( );
+		}
+
+		/// An iterator to the code point at pos.  Throws std::out_of_range when
+		/// pos > size( )
+		[[nodiscard]] inline const_iterator iterator_at( size_t pos ) const {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos <= size( ), "Attempt to access utf_rope past end" );
+			auto const [t, offset] = find( pos );
+			auto result = const_iterator( this, t );
+			if( t != npos ) {
+				result.m_it += static_cast<difference_type>( offset );
+			}
+			return result;
+		}
+	}; // utf_rope
+
+	inline std::string to_string( utf_rope const &str ) {
+		return str.to_string( );
+	}
+} // namespace daw
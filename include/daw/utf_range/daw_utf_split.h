@@ -0,0 +1,367 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+
+#include <daw/daw_string_view.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Lazy views of the pieces of a utf_range between delimiters.  Each piece is
+/// a utf_range over the same text, nothing is copied and iterating does not
+/// allocate.  Delimiters are found with the dispatched SIMD kernels and the
+/// code points of each piece are counted with them
+namespace daw::range {
+	/// Where a delimiter is in the text, first is the end of the text when
+	/// there is none
+	struct delimiter_match {
+		char const *first;
+		char const *last;
+	};
+
+	namespace impl {
+		/// The candidates of the last utf8::dispatch::teddy_find block.  A
+		/// split_view iterator keeps one so that a block holding several
+		/// delimiters is only scanned once
+		struct lane_cache {
+			utf8::simd::teddy_block block{ nullptr, 0, 0 };
+			uint8_t buckets[64];
+		};
+
+		/// The first candidate of masks at or after first that match( pos )
+		/// returns the end of a delimiter for, it returns nullptr for the
+		/// candidates that are not one
+		template<typename Match>
+		delimiter_match find_lanes( utf8::simd::teddy_masks const &masks,
+		                            char const *first, char const *last,
+		                            lane_cache &cache, Match const &match ) {
+			auto &block = cache.block;
+			while( true ) {
+				if( first < block.position or
+				    first >= block.position + block.size ) {
+					block = utf8::dispatch::teddy_find( masks, first, last,
+					                                    cache.buckets );
+					if( block.position == last ) {
+						return { last, last };
+					}
+					first = block.position;
+				}
+				auto const skip = static_cast<unsigned>( first - block.position );
+				auto lanes = block.candidates >> skip;
+				while( lanes != 0 ) {
+					auto const lane = utf8::simd::scalar::lowest_set_bit( lanes );
+					auto const pos = first + lane;
+					if( auto const end = match( pos ); end != nullptr ) {
+						return { pos, end };
+					}
+					lanes &= lanes - 1U;
+				}
+				first = block.position + block.size;
+			}
+		}
+	} // namespace impl
+
+	/// A single code point
+	class code_point_delimiter {
+		utf8::simd::teddy_masks m_masks{ };
+		char m_units[4]{ };
+		size_t m_size = 0;
+
+	public:
+		using cache_type = impl::lane_cache;
+
+		explicit code_point_delimiter( utf_val_type cp ) noexcept
+		  : m_size( static_cast<size_t>(
+		      utf8::unchecked::append( cp, m_units + 0 ) - m_units ) ) {
+			auto const lead = static_cast<uint8_t>( m_units[0] );
+			m_masks.lo[0][lead & 0x0FU] = 1;
+			m_masks.hi[0][lead >> 4U] = 1;
+			m_masks.length = 1;
+		}
+
+		delimiter_match find( char const *first, char const *last,
+		                      cache_type &cache ) const noexcept {
+			return impl::find_lanes(
+			  m_masks, first, last, cache, [&]( char const *pos ) {
+				  if( static_cast<size_t>( last - pos ) < m_size ) {
+					  return static_cast<char const *>( nullptr );
+				  }
+				  for( size_t n = 0; n < m_size; ++n ) {
+					  if( pos[n] != m_units[n] ) {
+						  return static_cast<char const *>( nullptr );
+					  }
+				  }
+				  return pos + m_size;
+			  } );
+		}
+	};
+
+	/// A sequence of code points.  The text is not owned, an empty delimiter
+	/// never matches
+	class string_delimiter {
+		char const *m_first = nullptr;
+		char const *m_last = nullptr;
+
+	public:
+		struct cache_type {};
+
+		explicit string_delimiter( utf_range const &delimiter ) noexcept
+		  : m_first( delimiter.raw_begin( ) )
+		  , m_last( delimiter.raw_end( ) ) {}
+
+		delimiter_match find( char const *first, char const *last,
+		                      cache_type & ) const noexcept {
+			if( m_first == m_last ) {
+				return { last, last };
+			}
+			auto const pos =
+			  utf8::dispatch::find_substring( first, last, m_first, m_last );
+			return { pos, pos == last ? last : pos + ( m_last - m_first ) };
+		}
+	};
+
+	/// Any one of a set of code points.  The lead bytes of the set are found
+	/// with utf8::dispatch::teddy_find, a one byte Teddy with a single bucket,
+	/// and each candidate is checked exactly
+	class code_point_set_delimiter {
+		utf8::simd::teddy_masks m_masks{ };
+		std::array<bool, 256> m_leads{ };
+		/// The members above U+7F, sorted
+		std::vector<utf_val_type> m_multi_byte{ };
+
+		void add( utf_val_type cp ) {
+			char units[4];
+			utf8::unchecked::append( cp, units + 0 );
+			auto const lead = static_cast<uint8_t>( units[0] );
+			m_leads[lead] = true;
+			m_masks.lo[0][lead & 0x0FU] = 1;
+			m_masks.hi[0][lead >> 4U] = 1;
+			if( cp >= 0x80U ) {
+				m_multi_byte.push_back( cp );
+			}
+		}
+
+		template<typename Iterator>
+		void add( Iterator first, Iterator last ) {
+			m_masks.length = 1;
+			for( ; first != last; ++first ) {
+				add( static_cast<utf_val_type>( *first ) );
+			}
+			std::sort( m_multi_byte.begin( ), m_multi_byte.end( ) );
+		}
+
+	public:
+		using cache_type = impl::lane_cache;
+
+		explicit code_point_set_delimiter(
+		  std::initializer_list<utf_val_type> code_points ) {
+			add( code_points.begin( ), code_points.end( ) );
+		}
+
+		/// Each code point of code_points is a delimiter
+		explicit code_point_set_delimiter( utf_range const &code_points ) {
+			add( code_points.begin( ), code_points.end( ) );
+		}
+
+		delimiter_match find( char const *first, char const *last,
+		                      cache_type &cache ) const noexcept {
+			return impl::find_lanes(
+			  m_masks, first, last, cache, [&]( char const *pos ) {
+				  auto const lead = static_cast<uint8_t>( *pos );
+				  if( not m_leads[lead] ) {
+					  return static_cast<char const *>( nullptr );
+				  }
+				  if( lead < 0x80U ) {
+					  return pos + 1;
+				  }
+				  auto next = pos;
+				  auto const cp = utf8::unchecked::next( next );
+				  auto const found = std::binary_search(
+				    m_multi_byte.begin( ), m_multi_byte.end( ), cp );
+				  return found ? next : nullptr;
+			  } );
+		}
+	};
+
+	enum class empty_pieces { keep, skip };
+
+	/// The pieces of a utf8 text between the matches of Delimiter, a type with
+	/// a default constructible cache_type that each iterator keeps and
+	/// delimiter_match find( char const *first, char const *last,
+	///                       cache_type &cache ) const.  With
+	/// empty_pieces::keep n delimiters give n + 1 pieces, an empty text is one
+	/// empty piece.  empty_pieces::skip leaves out the empty ones
+	template<typename Delimiter>
+	class split_view {
+		utf_range m_text{ };
+		Delimiter m_delimiter;
+		empty_pieces m_empty = empty_pieces::keep;
+
+	public:
+		class iterator {
+			split_view const *m_view = nullptr;
+			char const *m_first = nullptr;
+			/// The delimiter after the current piece
+			delimiter_match m_next{ };
+			bool m_done = true;
+			typename Delimiter::cache_type m_cache{ };
+
+			constexpr char const *text_end( ) const noexcept {
+				return m_view->m_text.raw_end( );
+			}
+
+			void find_from( char const *pos ) noexcept {
+				auto const last = text_end( );
+				while( true ) {
+					m_first = pos;
+					m_next = m_view->m_delimiter.find( pos, last, m_cache );
+					if( m_view->m_empty == empty_pieces::keep or
+					    m_next.first != m_first ) {
+						return;
+					}
+					if( m_next.first == last ) {
+						m_done = true;
+						return;
+					}
+					pos = m_next.last;
+				}
+			}
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = utf_range;
+			using reference = utf_range;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+
+			iterator( ) = default;
+
+			explicit iterator( split_view const &view ) noexcept
+			  : m_view( &view )
+			  , m_done( false ) {
+				find_from( view.m_text.raw_begin( ) );
+			}
+
+			/// The current piece, its code points are counted here
+			utf_range operator*( ) const noexcept {
+				auto result = utf_range( );
+				result.set( utf_iterator( m_first ), utf_iterator( m_next.first ),
+				            static_cast<utf_range::difference_type>(
+				              utf8::dispatch::count_code_points( m_first,
+				                                                 m_next.first ) ) );
+				return result;
+			}
+
+			iterator &operator++( ) noexcept {
+				if( m_next.first == text_end( ) ) {
+					m_done = true;
+				} else {
+					find_from( m_next.last );
+				}
+				return *this;
+			}
+
+			iterator operator++( int ) noexcept {
+				auto result = *this;
+				operator++( );
+				return result;
+			}
+
+			/// The delimiter after the current piece, empty at the end of the
+			/// text for the last piece
+			utf_range delimiter( ) const noexcept {
+				return utf_range( utf_iterator( m_next.first ),
+				                  utf_iterator( m_next.last ) );
+			}
+
+			friend bool operator==( iterator const &lhs,
+			                        iterator const &rhs ) noexcept {
+				if( lhs.m_done or rhs.m_done ) {
+					return lhs.m_done == rhs.m_done;
+				}
+				return lhs.m_first == rhs.m_first;
+			}
+
+			friend bool operator!=( iterator const &lhs,
+			                        iterator const &rhs ) noexcept {
+				return not( lhs == rhs );
+			}
+		}; // iterator
+
+		using const_iterator = iterator;
+		using value_type = utf_range;
+
+		split_view( utf_range const &text, Delimiter delimiter,
+		            empty_pieces empty = empty_pieces::keep ) noexcept(
+		  std::is_nothrow_move_constructible_v<Delimiter> )
+		  : m_text( text )
+		  , m_delimiter( std::move( delimiter ) )
+		  , m_empty( empty ) {}
+
+		/// The view refers to itself, it must outlive its iterators
+		iterator begin( ) const noexcept {
+			return iterator( *this );
+		}
+
+		iterator end( ) const noexcept {
+			return iterator( );
+		}
+	}; // split_view
+
+	/// Split text on each occurrence of the code point delimiter
+	inline split_view<code_point_delimiter>
+	split( utf_range const &text, utf_val_type delimiter,
+	       empty_pieces empty = empty_pieces::keep ) noexcept {
+		return { text, code_point_delimiter( delimiter ), empty };
+	}
+
+	/// Split text on each occurrence of delimiter, which is not copied
+	inline split_view<string_delimiter>
+	split( utf_range const &text, utf_range const &delimiter,
+	       empty_pieces empty = empty_pieces::keep ) noexcept {
+		return { text, string_delimiter( delimiter ), empty };
+	}
+
+	/// Split text on each occurrence of the utf8 delimiter, which is not
+	/// copied
+	inline split_view<string_delimiter>
+	split( utf_range const &text, daw::string_view delimiter,
+	       empty_pieces empty = empty_pieces::keep ) noexcept {
+		auto const first = delimiter.data( );
+		auto const rng = utf_range( utf_iterator( first ),
+		                            utf_iterator( first + delimiter.size( ) ) );
+		return split( text, rng, empty );
+	}
+
+	/// Split text on each occurrence of any of the code points
+	inline split_view<code_point_set_delimiter>
+	split_any( utf_range const &text,
+	           std::initializer_list<utf_val_type> code_points,
+	           empty_pieces empty = empty_pieces::keep ) {
+		return { text, code_point_set_delimiter( code_points ), empty };
+	}
+
+	/// Split text on each occurrence of any code point of code_points
+	inline split_view<code_point_set_delimiter>
+	split_any( utf_range const &text, utf_range const &code_points,
+	           empty_pieces empty = empty_pieces::keep ) {
+		return { text, code_point_set_delimiter( code_points ), empty };
+	}
+} // namespace daw::range
@@ -8,17 +8,22 @@
 
 #pragma once
 
+#include "../utf8/checked.h"
+#include "../utf8/dispatch.h"
 #include "../utf8/unchecked.h"
 #include "daw_utf_range.h"
 
 #include <daw/cpp_17.h>
 #include <daw/daw_algorithm.h>
+#include <daw/daw_exception.h>
 #include <daw/daw_fnv1a_hash.h>
 #include <daw/daw_string_view.h>
 #include <daw/daw_traits.h>
 
 #include <daw/stdinc/move_fwd_exch.h>
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 namespace daw {
@@ -34,46 +39,152 @@ namespace daw {
 		inline std::string copy_to_string( char const *const str ) {
 			return std::string( str );
 		}
+
+		/// Code units before the first zero unit
+		template<typename CharT>
+		constexpr size_t c_str_length( CharT const *str ) noexcept {
+			size_t result = 0;
+			while( str[result] != CharT{ } ) {
+				++result;
+			}
+			return result;
+		}
 	} // namespace details
 
-	struct utf_string {
-		using iterator = range::utf_iterator;
-		using const_iterator = range::utf_iterator const;
-		using reference = range::utf_iterator::reference;
-		using value_type = range::utf_iterator::value_type;
+	/// An owning string of code points stored as CharT code units, see
+	/// range::code_unit_traits for the supported types.  utf_string holds utf8
+	/// in a std::string
+	template<typename CharT>
+	struct basic_utf_string {
+		using range_type = range::basic_utf_range<CharT>;
+		using traits_type = typename range_type::traits_type;
+		using storage_type = range::code_unit_storage_t<CharT>;
+		using char_type = CharT;
+		using char_iterator = typename range_type::char_iterator;
+		using iterator = typename range_type::iterator;
+		using const_iterator = iterator const;
+		using reference = typename iterator::reference;
+		using value_type = typename iterator::value_type;
 		using const_reference = value_type const &;
-		using difference_type = range::utf_iterator::difference_type;
+		using difference_type = typename iterator::difference_type;
 
 	private:
-		std::string m_values = { };
-		daw::range::utf_range m_range = daw::range::create_char_range( m_values );
+		template<typename C>
+		using enable_if_char_t =
+		  std::enable_if_t<std::is_same_v<C, char>, std::nullptr_t>;
+
+		storage_type m_values = { };
+		range_type m_range = make_range( m_values, 0 );
+
+		/// Create a range over values whose code point count is already known
+		[[nodiscard]] static inline range_type
+		make_range( storage_type const &values, size_t size ) noexcept {
+			auto result = range_type( );
+			result.set( iterator( values.data( ) ),
+			            iterator( values.data( ) + values.size( ) ),
+			            static_cast<difference_type>( size ) );
+			return result;
+		}
+
+		/// Create a range over values, counting with the fastest kernel available
+		[[nodiscard]] static inline range_type
+		make_range( storage_type const &values ) noexcept {
+			auto const first = values.data( );
+			return make_range(
+			  values, traits_type::count( first, first + values.size( ) ) );
+		}
+
+		/// Rebind m_range after m_values has been modified in place
+		inline void update_range( size_t size ) noexcept {
+			m_range = make_range( m_values, size );
+		}
+
+		/// Code unit offset of the code point at pos, raw_size( ) when
+		/// pos == size( ).  Throws std::out_of_range if pos > size( )
+		[[nodiscard]] inline size_t raw_offset( size_t pos ) const {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos <= size( ), "Attempt to access utf_string past end" );
+			auto it = begin( );
+			it += static_cast<difference_type>( pos );
+			return static_cast<size_t>( it.base( ) - raw_begin( ) );
+		}
+
+		[[nodiscard]] inline auto raw_position( size_t offset ) noexcept {
+			return std::next( m_values.begin( ),
+			                  static_cast<difference_type>( offset ) );
+		}
 
 	public:
-		utf_string( ) = default;
+		basic_utf_string( ) = default;
+
+		inline basic_utf_string( basic_utf_string const &other )
+		  : m_values( other.m_values )
+		  , m_range( make_range( m_values, other.size( ) ) ) {}
+
+		inline basic_utf_string( basic_utf_string &&other ) noexcept
+		  : m_values( std::move( other.m_values ) )
+		  , m_range( make_range( m_values, other.size( ) ) ) {
+			other.m_values.clear( );
+			other.update_range( 0 );
+		}
+
+		inline basic_utf_string &operator=( basic_utf_string const &rhs ) {
+			if( this != &rhs ) {
+				m_values = rhs.m_values;
+				update_range( rhs.size( ) );
+			}
+			return *this;
+		}
+
+		inline basic_utf_string &operator=( basic_utf_string &&rhs ) noexcept {
+			if( this != &rhs ) {
+				auto const sz = rhs.size( );
+				m_values = std::move( rhs.m_values );
+				update_range( sz );
+				rhs.m_values.clear( );
+				rhs.update_range( 0 );
+			}
+			return *this;
+		}
+
+		~basic_utf_string( ) = default;
 
 		template<size_t N>
-		utf_string( char const ( &str )[N] )
-		  : m_values( str, N - 1 )
-		  , m_range( daw::range::create_char_range( m_values ) ) {}
+		basic_utf_string( CharT const ( &str )[N] )
+		  : m_values( str, str + ( N - 1 ) )
+		  , m_range( make_range( m_values ) ) {}
 
 		template<size_t N>
-		utf_string &operator=( char const ( &str )[N] ) {
-			m_values = str;
-			m_range = daw::range::create_char_range( m_values );
+		basic_utf_string &operator=( CharT const ( &str )[N] ) {
+			m_values.assign( str, str + ( N - 1 ) );
+			m_range = make_range( m_values );
 			return *this;
 		}
 
-		inline utf_string( daw::string_view other )
-		  : m_values( details::copy_to_string( other ) )
-		  , m_range( daw::range::create_char_range( m_values ) ) {}
+		/// Copy the valid code units [first, last)
+		inline basic_utf_string( char_iterator first, char_iterator last )
+		  : m_values( first, last )
+		  , m_range( make_range( m_values ) ) {}
 
-		inline utf_string( daw::range::utf_range other )
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string( daw::string_view other )
 		  : m_values( details::copy_to_string( other ) )
-		  , m_range( daw::range::create_char_range( m_values ) ) {}
+		  , m_range( make_range( m_values ) ) {}
 
-		inline utf_string( char const *other )
-		  : m_values( details::copy_to_string( other ) )
-		  , m_range( daw::range::create_char_range( m_values ) ) {}
+		inline basic_utf_string( range_type other )
+		  : m_values( other.raw_begin( ), other.raw_end( ) )
+		  , m_range( make_range( m_values, other.size( ) ) ) {}
+
+		/// The code point count of a literal is reused instead of recounted
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string( range::utf_literal const &other )
+		  : m_values( other.raw_begin( ), other.raw_end( ) )
+		  , m_range( make_range( m_values, other.size( ) ) ) {}
+
+		/// Copy the zero terminated code units at other
+		inline basic_utf_string( CharT const *other )
+		  : m_values( other, other + details::c_str_length( other ) )
+		  , m_range( make_range( m_values ) ) {}
 
 		[[nodiscard]] inline const_iterator begin( ) const noexcept {
 			return m_range.begin( );
@@ -99,105 +210,271 @@ namespace daw {
 			return m_range.empty( );
 		}
 
-		[[nodiscard]] inline range::char_iterator raw_begin( ) const noexcept {
+		[[nodiscard]] inline char_iterator raw_begin( ) const noexcept {
 			return m_range.raw_begin( );
 		}
 
-		[[nodiscard]] inline range::char_iterator raw_end( ) const noexcept {
+		[[nodiscard]] inline char_iterator raw_end( ) const noexcept {
 			return m_range.raw_end( );
 		}
 
-		inline utf_string &operator=( daw::string_view rhs ) {
-			auto tmp = utf_string( rhs );
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string &operator=( daw::string_view rhs ) {
+			auto tmp = basic_utf_string( rhs );
 			using std::swap;
 			swap( *this, tmp );
 			return *this;
 		}
 
-		inline utf_string &operator=( char const *rhs ) {
-			auto tmp = utf_string( rhs );
+		inline basic_utf_string &operator=( CharT const *rhs ) {
+			auto tmp = basic_utf_string( rhs );
 			using std::swap;
 			swap( *this, tmp );
 			return *this;
 		}
 
-		inline utf_string &operator=( std::string const &rhs ) {
-			auto tmp = utf_string( rhs );
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string &operator=( std::string const &rhs ) {
+			auto tmp = basic_utf_string( daw::string_view( rhs ) );
 			using std::swap;
 			swap( *this, tmp );
 			return *this;
 		}
 
+		/// Number of code units
 		[[nodiscard]] inline size_t raw_size( ) const noexcept {
 			return m_range.raw_size( );
 		}
 
-		[[nodiscard]] inline utf_string substr( size_t pos, size_t length ) const {
-			return utf_string( m_range.substr( pos, length ) );
+		/// Number of code units that can be held without reallocating
+		[[nodiscard]] inline size_t capacity( ) const noexcept {
+			return m_values.capacity( );
+		}
+
+		/// Ensure room for at least raw_count code units
+		inline void reserve( size_t raw_count ) {
+			if( raw_count <= m_values.capacity( ) ) {
+				return;
+			}
+			auto const sz = size( );
+			m_values.reserve( raw_count );
+			update_range( sz );
 		}
 
-		[[nodiscard]] inline std::string const &to_string( ) const &noexcept {
+		inline void clear( ) noexcept {
+			m_values.clear( );
+			update_range( 0 );
+		}
+
+		/// Encode cp and append it.  Throws utf8::invalid_code_point if cp is a
+		/// surrogate or is out of range
+		inline void push_back( char32_t cp ) {
+			daw::exception::precondition_check<utf8::invalid_code_point>(
+			  utf8::internal::is_code_point_valid( static_cast<uint32_t>( cp ) ),
+			  static_cast<uint32_t>( cp ) );
+			CharT buff[traits_type::max_units]{ };
+			auto const last = traits_type::encode( static_cast<uint32_t>( cp ),
+			                                       static_cast<CharT *>( buff ) );
+			auto const sz = size( );
+			m_values.insert( m_values.end( ), static_cast<CharT const *>( buff ),
+			                 static_cast<CharT const *>( last ) );
+			update_range( sz + 1 );
+		}
+
+		inline basic_utf_string &append( char32_t cp ) {
+			push_back( cp );
+			return *this;
+		}
+
+		inline basic_utf_string &append( range_type other ) {
+			auto const sz = size( ) + other.size( );
+			m_values.insert( m_values.end( ), other.raw_begin( ), other.raw_end( ) );
+			update_range( sz );
+			return *this;
+		}
+
+		inline basic_utf_string &append( basic_utf_string const &other ) {
+			return append( other.utf_range( ) );
+		}
+
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string &append( daw::string_view other ) {
+			return append( range::create_char_range( other ) );
+		}
+
+		inline basic_utf_string &operator+=( char32_t cp ) {
+			return append( cp );
+		}
+
+		inline basic_utf_string &operator+=( range_type other ) {
+			return append( other );
+		}
+
+		inline basic_utf_string &operator+=( basic_utf_string const &other ) {
+			return append( other );
+		}
+
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string &operator+=( daw::string_view other ) {
+			return append( other );
+		}
+
+		/// Insert other before the code point at pos.  Throws std::out_of_range
+		/// if pos > size( )
+		inline basic_utf_string &insert( size_t pos, range_type other ) {
+			auto const sz = size( ) + other.size( );
+			m_values.insert( raw_position( raw_offset( pos ) ), other.raw_begin( ),
+			                 other.raw_end( ) );
+			update_range( sz );
+			return *this;
+		}
+
+		inline basic_utf_string &insert( size_t pos,
+		                                 basic_utf_string const &other ) {
+			return insert( pos, other.utf_range( ) );
+		}
+
+		template<typename C = CharT, enable_if_char_t<C> = nullptr>
+		inline basic_utf_string &insert( size_t pos, daw::string_view other ) {
+			return insert( pos, range::create_char_range( other ) );
+		}
+
+		/// Throws utf8::invalid_code_point if cp is a surrogate or is out of
+		/// range
+		inline basic_utf_string &insert( size_t pos, char32_t cp ) {
+			daw::exception::precondition_check<utf8::invalid_code_point>(
+			  utf8::internal::is_code_point_valid( static_cast<uint32_t>( cp ) ),
+			  static_cast<uint32_t>( cp ) );
+			CharT buff[traits_type::max_units]{ };
+			auto const last = traits_type::encode( static_cast<uint32_t>( cp ),
+			                                       static_cast<CharT *>( buff ) );
+			return insert( pos, range::create_char_range(
+			                      static_cast<CharT const *>( buff ),
+			                      static_cast<CharT const *>( last ) ) );
+		}
+
+		/// Remove up to count code points starting at pos.  Throws
+		/// std::out_of_range if pos > size( )
+		inline basic_utf_string &erase( size_t pos,
+		                                size_t count = static_cast<size_t>( -1 ) ) {
+			daw::exception::precondition_check<std::out_of_range>(
+			  pos <= size( ), "Attempt to erase past end of utf_string" );
+			count = std::min( count, size( ) - pos );
+			auto const first = raw_offset( pos );
+			auto last = iterator( raw_begin( ) + first );
+			last += static_cast<difference_type>( count );
+			auto const last_offset =
+			  static_cast<size_t>( last.base( ) - raw_begin( ) );
+			auto const sz = size( ) - count;
+			m_values.erase( raw_position( first ), raw_position( last_offset ) );
+			update_range( sz );
+			return *this;
+		}
+
+		/// Throws std::out_of_range if the string is empty
+		inline void pop_back( ) {
+			daw::exception::precondition_check<std::out_of_range>(
+			  !empty( ), "Attempt to pop_back an empty utf_string" );
+			auto last = end( );
+			--last;
+			auto const sz = size( ) - 1;
+			m_values.resize( static_cast<size_t>( last.base( ) - raw_begin( ) ) );
+			update_range( sz );
+		}
+
+		[[nodiscard]] inline basic_utf_string substr( size_t pos,
+		                                              size_t length ) const {
+			return basic_utf_string( m_range.substr( pos, length ) );
+		}
+
+		/// The stored code units
+		[[nodiscard]] inline storage_type const &to_string( ) const &noexcept {
 			return m_values;
 		}
 
-		[[nodiscard]] inline std::string to_string( ) &&noexcept {
+		[[nodiscard]] inline storage_type to_string( ) &&noexcept {
 			auto result = std::move( m_values );
-			m_range = range::create_char_range( m_values );
-			return std::move( m_values );
+			m_values.clear( );
+			update_range( 0 );
+			return result;
 		}
 
 		[[nodiscard]] inline std::u32string to_u32string( ) const {
 			return m_range.to_u32string( );
 		}
 
-		[[nodiscard]] inline range::utf_range const &utf_range( ) const noexcept {
+		/// Decode into out, reusing its capacity.  Returns size( )
+		inline size_t to_u32string( std::u32string &out ) const {
+			return m_range.to_u32string( out );
+		}
+
+		/// Decode to [out, out + out_size) when the code points fit.  Returns
+		/// size( ), nothing is written when this is larger than out_size
+		inline size_t to_u32string( char32_t *out, size_t out_size ) const
+		  noexcept {
+			return m_range.to_u32string( out, out_size );
+		}
+
+		[[nodiscard]] inline range_type const &utf_range( ) const noexcept {
 			return m_range;
 		}
 
-		[[nodiscard]] inline int compare( utf_string const &rhs ) const noexcept {
+		[[nodiscard]] inline int compare( basic_utf_string const &rhs ) const
+		  noexcept {
 			return m_range.compare( rhs.m_range );
 		}
 
 		inline void sort( ) {
 			auto result = to_u32string( );
-			std::copy( cbegin( ), cend( ), std::back_inserter( result ) );
 			std::sort( result.begin( ), result.end( ) );
 			m_values.clear( );
-			utf8::unchecked::utf32to8( result.cbegin( ), result.cend( ),
-			                           std::back_inserter( m_values ) );
-			m_range = daw::range::create_char_range( m_values );
+			auto out = std::back_inserter( m_values );
+			for( auto cp : result ) {
+				out = traits_type::encode( static_cast<uint32_t>( cp ), out );
+			}
+			update_range( result.size( ) );
 		}
 
 		[[nodiscard]] friend inline bool
-		operator==( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator==( basic_utf_string const &lhs,
+		            basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) == 0;
 		}
 
 		[[nodiscard]] friend inline bool
-		operator!=( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator!=( basic_utf_string const &lhs,
+		            basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) != 0;
 		}
 
 		[[nodiscard]] friend inline bool
-		operator<( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator<( basic_utf_string const &lhs,
+		           basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) < 0;
 		}
 
 		[[nodiscard]] friend inline bool
-		operator>( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator>( basic_utf_string const &lhs,
+		           basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) > 0;
 		}
 
 		[[nodiscard]] friend inline bool
-		operator<=( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator<=( basic_utf_string const &lhs,
+		            basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) <= 0;
 		}
 
 		[[nodiscard]] friend inline bool
-		operator>=( utf_string const &lhs, utf_string const &rhs ) noexcept {
+		operator>=( basic_utf_string const &lhs,
+		            basic_utf_string const &rhs ) noexcept {
 			return lhs.compare( rhs ) >= 0;
 		}
-	}; // utf_string
+	}; // basic_utf_string
+
+	using utf_string = basic_utf_string<char>;
+	using utf16_string = basic_utf_string<char16_t>;
+	using utf32_string = basic_utf_string<char32_t>;
 
 	inline std::string to_string( utf_string const &str ) {
 		return str.to_string( );
@@ -207,10 +484,10 @@ namespace daw {
 		return to_string_view( str.utf_range( ) );
 	}
 
-	template<typename OStream,
+	template<typename OStream, typename CharT,
 	         std::enable_if_t<daw::traits::is_ostream_like_v<OStream, char>,
 	                          std::nullptr_t> = nullptr>
-	OStream &operator<<( OStream &os, utf_string const &value ) {
+	OStream &operator<<( OStream &os, basic_utf_string<CharT> const &value ) {
 		os << value.utf_range( );
 		return os;
 	}
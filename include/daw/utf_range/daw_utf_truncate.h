@@ -0,0 +1,90 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/core.h"
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <cstddef>
+
+/// Cut a utf_range to a number of bytes or code points without splitting a
+/// code point.  The results are utf_ranges over the same text with their
+/// size known.  It is counted from the size of text and the code points of
+/// the shorter of the part kept and the part dropped, with the dispatched
+/// kernels
+namespace daw::range {
+	namespace impl {
+		/// The range [first, last) of text with its size counted from
+		/// whichever side of the cut is shorter
+		inline utf_range sub_range( utf_range const &text, char const *first,
+		                            char const *last ) noexcept {
+			auto const kept = last - first;
+			auto const dropped = text.raw_size( ) - static_cast<size_t>( kept );
+			size_t size = 0;
+			if( static_cast<size_t>( kept ) <= dropped ) {
+				size = utf8::dispatch::count_code_points( first, last );
+			} else {
+				size = text.size( ) -
+				       utf8::dispatch::count_code_points( text.raw_begin( ), first ) -
+				       utf8::dispatch::count_code_points( last, text.raw_end( ) );
+			}
+			auto result = utf_range( );
+			result.set( utf_iterator( first ), utf_iterator( last ),
+			            static_cast<utf_range::difference_type>( size ) );
+			return result;
+		}
+	} // namespace impl
+
+	/// The longest start of text that is at most max_bytes bytes.  The cut is
+	/// found in O(1) by backing up at most 3 bytes to a lead byte
+	inline utf_range truncate_bytes( utf_range const &text,
+	                                 size_t max_bytes ) noexcept {
+		if( max_bytes >= text.raw_size( ) ) {
+			return text;
+		}
+		auto const first = text.raw_begin( );
+		auto last = first + max_bytes;
+		while( last != first and utf8::internal::is_trail( *last ) ) {
+			--last;
+		}
+		return impl::sub_range( text, first, last );
+	}
+
+	/// The longest end of text that is at most max_bytes bytes.  The cut is
+	/// found in O(1) by skipping at most 3 continuation bytes
+	inline utf_range take_last_bytes( utf_range const &text,
+	                                  size_t max_bytes ) noexcept {
+		if( max_bytes >= text.raw_size( ) ) {
+			return text;
+		}
+		auto const last = text.raw_end( );
+		auto first = last - max_bytes;
+		while( first != last and utf8::internal::is_trail( *first ) ) {
+			++first;
+		}
+		return impl::sub_range( text, first, last );
+	}
+
+	/// The first count code points of text, all of it when it is shorter.  The
+	/// end is found with the dispatched kernels
+	inline utf_range truncate_code_points( utf_range const &text,
+	                                       size_t count ) noexcept {
+		if( count >= text.size( ) ) {
+			return text;
+		}
+		auto const first = text.raw_begin( );
+		auto result = utf_range( );
+		result.set( utf_iterator( first ),
+		            utf_iterator( utf8::dispatch::advance_code_points(
+		              first, text.raw_end( ), count ) ),
+		            static_cast<utf_range::difference_type>( count ) );
+		return result;
+	}
+} // namespace daw::range
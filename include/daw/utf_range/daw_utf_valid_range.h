@@ -0,0 +1,198 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/checked.h"
+#include "../utf8/dispatch.h"
+#include "daw_utf_range.h"
+
+#include <daw/daw_exception.h>
+#include <daw/daw_string_view.h>
+
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace daw::range {
+	/// Tag for text the caller guarantees is valid utf8, nothing is checked
+	struct known_valid_t {
+		explicit known_valid_t( ) = default;
+	};
+	inline constexpr known_valid_t known_valid{ };
+
+	/// A utf_range over text that has been validated once when it was created.
+	/// Iteration uses the unchecked iterator, the type records that this is
+	/// safe.  The text is not owned and must outlive the range
+	class valid_utf_range {
+		utf_range m_range;
+
+		constexpr valid_utf_range( char_iterator first, char_iterator last,
+		                           size_t size ) noexcept
+		  : m_range( ) {
+			m_range.set( utf_iterator( first ), utf_iterator( last ),
+			             static_cast<utf_range::difference_type>( size ) );
+		}
+
+		constexpr explicit valid_utf_range( utf_range const &rng ) noexcept
+		  : m_range( rng ) {}
+
+		friend valid_utf_range create_valid_range( known_valid_t,
+		                                           daw::string_view str ) noexcept;
+
+	public:
+		using iterator = utf_range::iterator;
+		using const_iterator = utf_range::const_iterator;
+		using value_type = utf_range::value_type;
+		using difference_type = utf_range::difference_type;
+
+		constexpr valid_utf_range( ) noexcept = default;
+
+		constexpr utf_range const &range( ) const noexcept {
+			return m_range;
+		}
+
+		constexpr operator utf_range const &( ) const noexcept {
+			return m_range;
+		}
+
+		constexpr const_iterator begin( ) const noexcept {
+			return m_range.begin( );
+		}
+
+		constexpr const_iterator end( ) const noexcept {
+			return m_range.end( );
+		}
+
+		/// Number of code points
+		constexpr size_t size( ) const noexcept {
+			return m_range.size( );
+		}
+
+		constexpr bool empty( ) const noexcept {
+			return m_range.empty( );
+		}
+
+		constexpr char_iterator raw_begin( ) const noexcept {
+			return m_range.raw_begin( );
+		}
+
+		constexpr char_iterator raw_end( ) const noexcept {
+			return m_range.raw_end( );
+		}
+
+		constexpr size_t raw_size( ) const noexcept {
+			return m_range.raw_size( );
+		}
+
+		/// Code points [pos, pos + length), a sub range of valid text is valid
+		constexpr valid_utf_range substr( size_t pos, size_t length ) const
+		  noexcept {
+			return valid_utf_range( m_range.substr( pos, length ) );
+		}
+
+		constexpr daw::string_view to_string_view( ) const noexcept {
+			return m_range.to_string_view( );
+		}
+
+		inline std::string to_raw_u8string( ) const {
+			return m_range.to_raw_u8string( );
+		}
+
+		/// Decode into out with the fastest kernel available, reusing its
+		/// capacity.  Returns size( )
+		inline size_t to_u32string( std::u32string &out ) const {
+			out.resize( size( ) );
+			utf8::dispatch::utf8to32( raw_begin( ), raw_end( ), out.data( ) );
+			return out.size( );
+		}
+
+		inline std::u32string to_u32string( ) const {
+			auto result = std::u32string( );
+			to_u32string( result );
+			return result;
+		}
+
+		/// Encode as UTF-16 with the fastest kernel available
+		inline std::u16string to_u16string( ) const {
+			auto result = std::u16string( raw_size( ), u'\0' );
+			auto const last = utf8::dispatch::utf8to16( raw_begin( ), raw_end( ),
+			                                            result.data( ) );
+			result.resize( static_cast<size_t>( last - result.data( ) ) );
+			return result;
+		}
+	}; // valid_utf_range
+
+	/// Wrap str without checking it, counting code points with the fastest
+	/// kernel available
+	inline valid_utf_range create_valid_range( known_valid_t,
+	                                           daw::string_view str ) noexcept {
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		assert( utf8::dispatch::find_invalid( first, last ) == last );
+		return valid_utf_range( first, last,
+		                        utf8::dispatch::count_code_points( first, last ) );
+	}
+
+	/// Validate str once with the fastest kernel available.  Returns an empty
+	/// optional when it is not valid utf8, bad_pos is set to the offset of the
+	/// first invalid sequence when it is not null
+	inline std::optional<valid_utf_range>
+	try_create_valid_range( daw::string_view str,
+	                        size_t *bad_pos = nullptr ) noexcept {
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto const bad = utf8::dispatch::find_invalid( first, last );
+		if( bad != last ) {
+			if( bad_pos != nullptr ) {
+				*bad_pos = static_cast<size_t>( bad - first );
+			}
+			return std::nullopt;
+		}
+		return create_valid_range( known_valid, str );
+	}
+
+	/// Validate str once with the fastest kernel available.  Throws
+	/// utf8::invalid_utf8 with the first bad octet when it is not valid utf8
+	inline valid_utf_range create_valid_range( daw::string_view str ) {
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto const bad = utf8::dispatch::find_invalid( first, last );
+		if( bad != last ) {
+			daw::exception::daw_throw<utf8::invalid_utf8>(
+			  static_cast<uint8_t>( *bad ) );
+		}
+		return create_valid_range( known_valid, str );
+	}
+
+	constexpr bool operator==( valid_utf_range const &lhs,
+	                           valid_utf_range const &rhs ) noexcept {
+		return lhs.range( ) == rhs.range( );
+	}
+
+	constexpr bool operator!=( valid_utf_range const &lhs,
+	                           valid_utf_range const &rhs ) noexcept {
+		return lhs.range( ) != rhs.range( );
+	}
+
+	constexpr bool operator<( valid_utf_range const &lhs,
+	                          valid_utf_range const &rhs ) noexcept {
+		return lhs.range( ) < rhs.range( );
+	}
+} // namespace daw::range
+
+namespace std {
+	template<>
+	struct hash<daw::range::valid_utf_range> {
+		constexpr size_t
+		operator( )( daw::range::valid_utf_range const &value ) const noexcept {
+			return daw::range::hash_sequence( value.raw_begin( ), value.raw_end( ) );
+		}
+	};
+} // namespace std
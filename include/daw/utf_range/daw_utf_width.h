@@ -0,0 +1,135 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "../utf8/dispatch.h"
+#include "../utf8/unchecked.h"
+#include "daw_utf_range.h"
+#include "impl/daw_utf_width_tables.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/// The columns text takes in a fixed width terminal.  Widths come from tables
+/// generated by tools/gen_unicode_tables.py instead of the locale, wcwidth
+/// gives the same for printable code points.  Runs of printable ASCII are
+/// measured with the dispatched kernels and most other code points by their
+/// lead byte alone.  Widths are summed per code point as wcswidth does, an
+/// emoji ZWJ sequence counts each emoji it joins
+namespace daw::range {
+	/// The columns cp takes, 0 for controls, combining marks and format
+	/// characters, 2 for East Asian Wide and Fullwidth and 1 for the rest
+	constexpr size_t display_width( utf_val_type cp ) noexcept {
+		return impl::code_point_width( cp );
+	}
+
+	namespace impl {
+		constexpr bool has_lead( uint64_t const ( &leads )[4],
+		                         uint8_t lead ) noexcept {
+			return ( ( leads[lead >> 6U] >> ( lead & 63U ) ) & 1U ) != 0;
+		}
+
+		/// Where a walk through a text stopped
+		struct width_position {
+			char const *position;
+			size_t width;
+			size_t code_points;
+		};
+
+		/// Walk [first, last) while the width is at most max_width.  The code
+		/// points with no width after the last one that fits are included
+		inline width_position advance_width( char const *first, char const *last,
+		                                     size_t max_width ) noexcept {
+			size_t width = 0;
+			size_t code_points = 0;
+			while( first != last ) {
+				auto const lead = static_cast<uint8_t>( *first );
+				if( static_cast<uint8_t>( lead - 0x20U ) < 0x5FU ) {
+					auto const run_last =
+					  utf8::dispatch::find_non_printable_ascii( first, last );
+					auto const run = static_cast<size_t>( run_last - first );
+					if( run > max_width - width ) {
+						auto const fits = max_width - width;
+						return { first + fits, max_width, code_points + fits };
+					}
+					first = run_last;
+					width += run;
+					code_points += run;
+					continue;
+				}
+				auto next = first;
+				size_t cp_width = 0;
+				if( lead < 0x80U ) {
+					++next;
+				} else if( has_lead( narrow_leads, lead ) ) {
+					next += 2 + ( lead >= 0xE0U ? 1 : 0 ) + ( lead >= 0xF0U ? 1 : 0 );
+					cp_width = 1;
+				} else if( has_lead( wide_leads, lead ) ) {
+					next += 3;
+					cp_width = 2;
+				} else {
+					cp_width = code_point_width( utf8::unchecked::next( next ) );
+				}
+				if( cp_width > max_width - width ) {
+					break;
+				}
+				first = next;
+				width += cp_width;
+				++code_points;
+			}
+			return { first, width, code_points };
+		}
+
+		inline utf_range make_prefix( utf_range const &text,
+		                              width_position const &pos ) noexcept {
+			if( pos.position == text.raw_end( ) ) {
+				return text;
+			}
+			auto result = utf_range( );
+			result.set( utf_iterator( text.raw_begin( ) ),
+			            utf_iterator( pos.position ),
+			            static_cast<utf_range::difference_type>( pos.code_points ) );
+			return result;
+		}
+	} // namespace impl
+
+	/// The columns text takes, the sum of the widths of its code points
+	inline size_t display_width( utf_range const &text ) noexcept {
+		return impl::advance_width( text.raw_begin( ), text.raw_end( ),
+		                            std::numeric_limits<size_t>::max( ) )
+		  .width;
+	}
+
+	/// The longest start of text that is at most max_width columns wide.  A
+	/// wide code point that would straddle the edge is left out, combining
+	/// marks after the last code point are kept.  Nothing is copied
+	inline utf_range truncate_to_width( utf_range const &text,
+	                                    size_t max_width ) noexcept {
+		return impl::make_prefix(
+		  text,
+		  impl::advance_width( text.raw_begin( ), text.raw_end( ), max_width ) );
+	}
+
+	/// A text cut to fit a column and the spaces that fill the rest of it
+	struct padded_range {
+		utf_range text;
+		size_t padding;
+	};
+
+	/// text truncated to width columns and the number of spaces needed to
+	/// fill them, before or after it to align it right or left.  Nothing is
+	/// copied
+	inline padded_range pad_to_width( utf_range const &text,
+	                                  size_t width ) noexcept {
+		auto const pos =
+		  impl::advance_width( text.raw_begin( ), text.raw_end( ), width );
+		return { impl::make_prefix( text, pos ), width - pos.width };
+	}
+} // namespace daw::range
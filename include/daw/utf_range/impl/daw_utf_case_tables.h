@@ -0,0 +1,341 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+// Generated by tools/gen_unicode_tables.py from Unicode 14.0.0, do not edit
+//
+
+#pragma once
+
+#include <cstdint>
+
+/// The Unicode data for full case mapping and case folding, without
+/// the mappings of SpecialCasing.txt that depend on context or
+/// language
+namespace daw::range::impl {
+	/// The kind of the case mappings of a code point, an index into
+	/// case_deltas or special_casing_kind
+	inline constexpr uint8_t case_kind_stage1[1088] = {
+	  0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10, 11, 2, 12, 2, 13, 2, 2, 14, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+	inline constexpr uint8_t case_kind_stage2[1088] = {
+	  0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 5, 6, 7, 8, 9, 10, 10, 10, 11, 12, 10, 10,
+	  13, 14, 15, 16, 17, 18, 19, 10, 20, 10, 10, 21, 22, 23, 24, 25, 26, 27, 28,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 30, 31, 32, 33, 34, 35, 36, 10, 37,
+	  38, 6, 6, 8, 8, 39, 10, 10, 40, 10, 10, 10, 41, 10, 10, 10, 10, 10, 10, 42,
+	  43, 44, 45, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 49, 50,
+	  50, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52,
+	  52, 53, 0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 57, 58, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 59,
+	  10, 10, 10, 10, 10, 10, 60, 61, 60, 60, 61, 62, 60, 63, 64, 64, 64, 65, 66,
+	  67, 68, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 71,
+	  72, 0, 73, 74, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 76, 77, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 43, 43, 46, 46, 46, 80, 81, 10, 10, 10,
+	  10, 10, 10, 82, 83, 84, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 86, 0, 10, 87,
+	  0, 0, 0, 0, 0, 0, 0, 0, 88, 88, 10, 10, 10, 89, 90, 91, 92, 93, 94, 95, 0,
+	  96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 97, 0, 98, 98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 101,
+	  102, 103, 103, 0, 0, 0, 0, 0, 0, 101, 101, 104, 103, 105, 0, 0, 0, 0, 0, 0,
+	  0, 106, 106, 107, 108, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 110, 110, 110, 111, 112, 112, 112, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+	  6, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 8, 8, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 114, 114, 115, 116, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	inline constexpr uint8_t case_kind_stage3[1888] = {
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 2,
+	  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+	  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+	  1, 1, 178, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+	  5, 6, 178, 7, 5, 6, 5, 6, 5, 6, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+	  6, 5, 6, 178, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 8, 5, 6, 5, 6, 5,
+	  6, 9, 10, 11, 5, 6, 5, 6, 12, 5, 6, 13, 13, 5, 6, 0, 14, 15, 16, 5, 6, 13,
+	  17, 18, 19, 20, 5, 6, 21, 0, 19, 22, 23, 24, 5, 6, 5, 6, 5, 6, 25, 5, 6,
+	  25, 0, 0, 5, 6, 25, 5, 6, 26, 26, 5, 6, 5, 6, 27, 5, 6, 0, 0, 5, 6, 0, 28,
+	  0, 0, 0, 0, 29, 30, 31, 29, 30, 31, 29, 30, 31, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+	  6, 5, 6, 5, 6, 5, 6, 32, 5, 6, 178, 29, 30, 31, 5, 6, 33, 34, 5, 6, 5, 6,
+	  5, 6, 5, 6, 35, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0,
+	  0, 0, 0, 0, 0, 36, 5, 6, 37, 38, 39, 39, 5, 6, 40, 41, 42, 5, 6, 5, 6, 5,
+	  6, 5, 6, 5, 6, 43, 44, 45, 46, 47, 0, 48, 48, 0, 49, 0, 50, 51, 0, 0, 0,
+	  48, 52, 0, 53, 0, 54, 55, 0, 56, 57, 55, 58, 59, 0, 0, 57, 0, 60, 61, 0, 0,
+	  62, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 64, 0, 65, 64, 0, 0, 0, 66, 64, 67, 68,
+	  68, 69, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 72, 0, 0, 0,
+	  0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 5, 6, 0, 0, 5, 6, 0, 0, 0,
+	  23, 23, 23, 0, 74, 0, 0, 0, 0, 0, 0, 75, 0, 76, 76, 76, 0, 77, 0, 78, 78,
+	  178, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+	  1, 1, 1, 1, 79, 80, 80, 80, 178, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	  2, 2, 2, 81, 2, 2, 2, 2, 2, 2, 2, 2, 2, 82, 83, 83, 84, 85, 86, 0, 0, 0,
+	  87, 88, 89, 5, 6, 5, 6, 5, 6, 5, 6, 90, 91, 92, 93, 94, 95, 0, 5, 6, 96, 5,
+	  6, 0, 35, 35, 35, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+	  97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 5,
+	  6, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 5, 6, 5, 6, 99, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+	  6, 5, 6, 5, 6, 100, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+	  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+	  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+	  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 178, 0, 0, 0,
+	  0, 0, 0, 0, 0, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 0, 103, 0, 0, 0, 0, 0,
+	  103, 0, 0, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+	  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 0, 0,
+	  104, 104, 104, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+	  105, 105, 105, 105, 106, 106, 106, 106, 106, 106, 0, 0, 107, 107, 107, 107,
+	  107, 107, 0, 0, 108, 109, 110, 111, 111, 112, 113, 114, 115, 0, 0, 0, 0, 0,
+	  0, 0, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+	  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 0, 0, 116,
+	  116, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 5, 6, 5, 6, 5, 6, 178, 178, 178, 178,
+	  178, 120, 0, 0, 178, 0, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122,
+	  122, 122, 122, 122, 122, 122, 121, 121, 121, 121, 121, 121, 0, 0, 122, 122,
+	  122, 122, 122, 122, 0, 0, 178, 121, 178, 121, 178, 121, 178, 121, 0, 122,
+	  0, 122, 0, 122, 0, 122, 123, 123, 124, 124, 124, 124, 125, 125, 126, 126,
+	  127, 127, 128, 128, 0, 0, 178, 178, 178, 178, 178, 178, 178, 178, 178, 178,
+	  178, 178, 178, 178, 178, 178, 121, 121, 178, 178, 178, 0, 178, 178, 122,
+	  122, 129, 129, 178, 0, 130, 0, 0, 0, 178, 178, 178, 0, 178, 178, 131, 131,
+	  131, 131, 178, 0, 0, 0, 121, 121, 178, 178, 0, 0, 178, 178, 122, 122, 132,
+	  132, 0, 0, 0, 0, 121, 121, 178, 178, 178, 92, 178, 178, 122, 122, 133, 133,
+	  96, 0, 0, 0, 0, 0, 178, 178, 178, 0, 178, 178, 134, 134, 135, 135, 178, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 137, 138, 0, 0, 0, 0, 0, 0, 139, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 140, 0, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+	  141, 141, 141, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+	  142, 142, 142, 142, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+	  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0, 0, 0, 0, 0, 0, 5, 6,
+	  145, 146, 147, 148, 149, 5, 6, 5, 6, 5, 6, 150, 151, 152, 153, 0, 5, 6, 0,
+	  5, 6, 0, 0, 0, 0, 0, 0, 0, 154, 154, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 5, 6,
+	  5, 6, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 155, 155,
+	  155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+	  155, 155, 155, 155, 0, 155, 0, 0, 0, 0, 0, 155, 0, 0, 5, 6, 5, 6, 5, 6, 5,
+	  6, 5, 6, 5, 6, 5, 6, 0, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 0, 0,
+	  0, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  5, 6, 5, 6, 156, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 0, 0, 0, 5, 6, 157, 0, 0, 5,
+	  6, 5, 6, 158, 0, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+	  6, 159, 160, 161, 162, 159, 0, 163, 164, 165, 166, 5, 6, 5, 6, 5, 6, 5, 6,
+	  5, 6, 5, 6, 5, 6, 5, 6, 167, 168, 169, 5, 6, 5, 6, 0, 0, 0, 0, 0, 5, 6, 0,
+	  0, 0, 0, 5, 6, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 171,
+	  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 178,
+	  178, 178, 178, 178, 178, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 178,
+	  178, 178, 178, 0, 0, 0, 0, 0, 0, 0, 0, 172, 172, 172, 172, 172, 172, 172,
+	  172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+	  172, 172, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+	  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 172, 172, 172, 172,
+	  0, 0, 0, 0, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+	  173, 173, 173, 173, 173, 173, 173, 173, 0, 0, 0, 0, 174, 174, 174, 174,
+	  174, 174, 174, 174, 174, 174, 174, 0, 174, 174, 174, 174, 174, 174, 174, 0,
+	  174, 174, 0, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 0, 175,
+	  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 0,
+	  175, 175, 175, 175, 175, 175, 175, 0, 175, 175, 0, 0, 0, 77, 77, 77, 77,
+	  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+	  82, 82, 82, 82, 82, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 176, 176,
+	  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+	  176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+	  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+	  177, 177, 177, 177, 177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	constexpr uint8_t case_kind( char32_t cp ) noexcept {
+		if( cp >= 0x110000U ) {
+			return 0;
+		}
+		unsigned const c = cp;
+		unsigned const mid = case_kind_stage1[c >> 10U];
+		unsigned const low =
+		  case_kind_stage2[( mid << 6U ) | ( ( c >> 4U ) & 63U )];
+		return case_kind_stage3[( low << 4U ) | ( c & 15U )];
+	}
+
+	/// What is added to a code point of each kind to map it to lower case,
+	/// upper case and to fold its case
+	inline constexpr int32_t case_deltas[534] = {
+	  0, 0, 0, 32, 0, 32, 0, -32, 0, 0, 743, 775, 0, 121, 0, 1, 0, 1, 0, -1, 0,
+	  0, -232, 0, -121, 0, -121, 0, -300, -268, 0, 195, 0, 210, 0, 210, 206, 0,
+	  206, 205, 0, 205, 79, 0, 79, 202, 0, 202, 203, 0, 203, 207, 0, 207, 0, 97,
+	  0, 211, 0, 211, 209, 0, 209, 0, 163, 0, 213, 0, 213, 0, 130, 0, 214, 0,
+	  214, 218, 0, 218, 217, 0, 217, 219, 0, 219, 0, 56, 0, 2, 0, 2, 1, -1, 1, 0,
+	  -2, 0, 0, -79, 0, -97, 0, -97, -56, 0, -56, -130, 0, -130, 10795, 0, 10795,
+	  -163, 0, -163, 10792, 0, 10792, 0, 10815, 0, -195, 0, -195, 69, 0, 69, 71,
+	  0, 71, 0, 10783, 0, 0, 10780, 0, 0, 10782, 0, 0, -210, 0, 0, -206, 0, 0,
+	  -205, 0, 0, -202, 0, 0, -203, 0, 0, 42319, 0, 0, 42315, 0, 0, -207, 0, 0,
+	  42280, 0, 0, 42308, 0, 0, -209, 0, 0, -211, 0, 0, 10743, 0, 0, 42305, 0, 0,
+	  10749, 0, 0, -213, 0, 0, -214, 0, 0, 10727, 0, 0, -218, 0, 0, 42307, 0, 0,
+	  42282, 0, 0, -69, 0, 0, -217, 0, 0, -71, 0, 0, -219, 0, 0, 42261, 0, 0,
+	  42258, 0, 0, 84, 116, 116, 0, 116, 38, 0, 38, 37, 0, 37, 64, 0, 64, 63, 0,
+	  63, 0, -38, 0, 0, -37, 0, 0, -31, 1, 0, -64, 0, 0, -63, 0, 8, 0, 8, 0, -62,
+	  -30, 0, -57, -25, 0, -47, -15, 0, -54, -22, 0, -8, 0, 0, -86, -54, 0, -80,
+	  -48, 0, 7, 0, 0, -116, 0, -60, 0, -60, 0, -96, -64, -7, 0, -7, 80, 0, 80,
+	  0, -80, 0, 15, 0, 15, 0, -15, 0, 48, 0, 48, 0, -48, 0, 7264, 0, 7264, 0,
+	  3008, 0, 38864, 0, 0, 8, 0, 0, 0, -8, -8, 0, -6254, -6222, 0, -6253, -6221,
+	  0, -6244, -6212, 0, -6242, -6210, 0, -6243, -6211, 0, -6236, -6204, 0,
+	  -6181, -6180, 0, 35266, 35267, -3008, 0, -3008, 0, 35332, 0, 0, 3814, 0, 0,
+	  35384, 0, 0, -59, -58, 0, 8, 0, -8, 0, -8, 0, 74, 0, 0, 86, 0, 0, 100, 0,
+	  0, 128, 0, 0, 112, 0, 0, 126, 0, -74, 0, -74, 0, -7205, -7173, -86, 0, -86,
+	  -100, 0, -100, -112, 0, -112, -128, 0, -128, -126, 0, -126, -7517, 0,
+	  -7517, -8383, 0, -8383, -8262, 0, -8262, 28, 0, 28, 0, -28, 0, 16, 0, 16,
+	  0, -16, 0, 26, 0, 26, 0, -26, 0, -10743, 0, -10743, -3814, 0, -3814,
+	  -10727, 0, -10727, 0, -10795, 0, 0, -10792, 0, -10780, 0, -10780, -10749,
+	  0, -10749, -10783, 0, -10783, -10782, 0, -10782, -10815, 0, -10815, 0,
+	  -7264, 0, -35332, 0, -35332, -42280, 0, -42280, 0, 48, 0, -42308, 0,
+	  -42308, -42319, 0, -42319, -42315, 0, -42315, -42305, 0, -42305, -42258, 0,
+	  -42258, -42282, 0, -42282, -42261, 0, -42261, 928, 0, 928, -48, 0, -48,
+	  -42307, 0, -42307, -35384, 0, -35384, 0, -928, 0, 0, -38864, -38864, 40, 0,
+	  40, 0, -40, 0, 39, 0, 39, 0, -39, 0, 34, 0, 34, 0, -34, 0 };
+
+	/// The kind of the code points with a mapping to more than one code
+	/// point, they are in special_casing_code_points
+	inline constexpr uint8_t special_casing_kind = 178;
+
+	/// Sorted, with where their mappings are in special_casing_pool
+	inline constexpr char32_t special_casing_code_points[104] = {
+	  223, 304, 329, 496, 912, 944, 1415, 7830, 7831, 7832, 7833, 7834, 7838,
+	  8016, 8018, 8020, 8022, 8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071,
+	  8072, 8073, 8074, 8075, 8076, 8077, 8078, 8079, 8080, 8081, 8082, 8083,
+	  8084, 8085, 8086, 8087, 8088, 8089, 8090, 8091, 8092, 8093, 8094, 8095,
+	  8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107,
+	  8108, 8109, 8110, 8111, 8114, 8115, 8116, 8118, 8119, 8124, 8130, 8131,
+	  8132, 8134, 8135, 8140, 8146, 8147, 8150, 8151, 8162, 8163, 8164, 8166,
+	  8167, 8178, 8179, 8180, 8182, 8183, 8188, 64256, 64257, 64258, 64259,
+	  64260, 64261, 64262, 64275, 64276, 64277, 64278, 64279 };
+	inline constexpr uint16_t special_casing_index[104] = {
+	  0, 6, 12, 18, 24, 32, 40, 46, 52, 58, 64, 70, 76, 81, 87, 95, 103, 111,
+	  117, 123, 129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189, 195, 201,
+	  207, 213, 219, 225, 231, 237, 243, 249, 255, 261, 267, 273, 279, 285, 291,
+	  297, 303, 309, 315, 321, 327, 333, 339, 345, 351, 357, 363, 369, 375, 381,
+	  387, 393, 399, 405, 411, 417, 423, 431, 437, 443, 449, 455, 461, 469, 475,
+	  483, 491, 497, 505, 513, 521, 527, 533, 541, 547, 553, 559, 565, 573, 579,
+	  585, 591, 597, 605, 613, 619, 625, 631, 637, 643, 649 };
+
+	/// A unit with the lengths of the lower case, upper case and case
+	/// folded mappings in its nibbles from the lowest, then each of them.
+	/// They are all below U+10000
+	inline constexpr uint16_t special_casing_pool[655] = {
+	  545, 223, 83, 83, 115, 115, 530, 105, 775, 304, 105, 775, 545, 329, 700,
+	  78, 700, 110, 545, 496, 74, 780, 106, 780, 817, 912, 921, 776, 769, 953,
+	  776, 769, 817, 944, 933, 776, 769, 965, 776, 769, 545, 1415, 1333, 1362,
+	  1381, 1410, 545, 7830, 72, 817, 104, 817, 545, 7831, 84, 776, 116, 776,
+	  545, 7832, 87, 778, 119, 778, 545, 7833, 89, 778, 121, 778, 545, 7834, 65,
+	  702, 97, 702, 529, 223, 7838, 115, 115, 545, 8016, 933, 787, 965, 787, 817,
+	  8018, 933, 787, 768, 965, 787, 768, 817, 8020, 933, 787, 769, 965, 787,
+	  769, 817, 8022, 933, 787, 834, 965, 787, 834, 545, 8064, 7944, 921, 7936,
+	  953, 545, 8065, 7945, 921, 7937, 953, 545, 8066, 7946, 921, 7938, 953, 545,
+	  8067, 7947, 921, 7939, 953, 545, 8068, 7948, 921, 7940, 953, 545, 8069,
+	  7949, 921, 7941, 953, 545, 8070, 7950, 921, 7942, 953, 545, 8071, 7951,
+	  921, 7943, 953, 545, 8064, 7944, 921, 7936, 953, 545, 8065, 7945, 921,
+	  7937, 953, 545, 8066, 7946, 921, 7938, 953, 545, 8067, 7947, 921, 7939,
+	  953, 545, 8068, 7948, 921, 7940, 953, 545, 8069, 7949, 921, 7941, 953, 545,
+	  8070, 7950, 921, 7942, 953, 545, 8071, 7951, 921, 7943, 953, 545, 8080,
+	  7976, 921, 7968, 953, 545, 8081, 7977, 921, 7969, 953, 545, 8082, 7978,
+	  921, 7970, 953, 545, 8083, 7979, 921, 7971, 953, 545, 8084, 7980, 921,
+	  7972, 953, 545, 8085, 7981, 921, 7973, 953, 545, 8086, 7982, 921, 7974,
+	  953, 545, 8087, 7983, 921, 7975, 953, 545, 8080, 7976, 921, 7968, 953, 545,
+	  8081, 7977, 921, 7969, 953, 545, 8082, 7978, 921, 7970, 953, 545, 8083,
+	  7979, 921, 7971, 953, 545, 8084, 7980, 921, 7972, 953, 545, 8085, 7981,
+	  921, 7973, 953, 545, 8086, 7982, 921, 7974, 953, 545, 8087, 7983, 921,
+	  7975, 953, 545, 8096, 8040, 921, 8032, 953, 545, 8097, 8041, 921, 8033,
+	  953, 545, 8098, 8042, 921, 8034, 953, 545, 8099, 8043, 921, 8035, 953, 545,
+	  8100, 8044, 921, 8036, 953, 545, 8101, 8045, 921, 8037, 953, 545, 8102,
+	  8046, 921, 8038, 953, 545, 8103, 8047, 921, 8039, 953, 545, 8096, 8040,
+	  921, 8032, 953, 545, 8097, 8041, 921, 8033, 953, 545, 8098, 8042, 921,
+	  8034, 953, 545, 8099, 8043, 921, 8035, 953, 545, 8100, 8044, 921, 8036,
+	  953, 545, 8101, 8045, 921, 8037, 953, 545, 8102, 8046, 921, 8038, 953, 545,
+	  8103, 8047, 921, 8039, 953, 545, 8114, 8122, 921, 8048, 953, 545, 8115,
+	  913, 921, 945, 953, 545, 8116, 902, 921, 940, 953, 545, 8118, 913, 834,
+	  945, 834, 817, 8119, 913, 834, 921, 945, 834, 953, 545, 8115, 913, 921,
+	  945, 953, 545, 8130, 8138, 921, 8052, 953, 545, 8131, 919, 921, 951, 953,
+	  545, 8132, 905, 921, 942, 953, 545, 8134, 919, 834, 951, 834, 817, 8135,
+	  919, 834, 921, 951, 834, 953, 545, 8131, 919, 921, 951, 953, 817, 8146,
+	  921, 776, 768, 953, 776, 768, 817, 8147, 921, 776, 769, 953, 776, 769, 545,
+	  8150, 921, 834, 953, 834, 817, 8151, 921, 776, 834, 953, 776, 834, 817,
+	  8162, 933, 776, 768, 965, 776, 768, 817, 8163, 933, 776, 769, 965, 776,
+	  769, 545, 8164, 929, 787, 961, 787, 545, 8166, 933, 834, 965, 834, 817,
+	  8167, 933, 776, 834, 965, 776, 834, 545, 8178, 8186, 921, 8060, 953, 545,
+	  8179, 937, 921, 969, 953, 545, 8180, 911, 921, 974, 953, 545, 8182, 937,
+	  834, 969, 834, 817, 8183, 937, 834, 921, 969, 834, 953, 545, 8179, 937,
+	  921, 969, 953, 545, 64256, 70, 70, 102, 102, 545, 64257, 70, 73, 102, 105,
+	  545, 64258, 70, 76, 102, 108, 817, 64259, 70, 70, 73, 102, 102, 105, 817,
+	  64260, 70, 70, 76, 102, 102, 108, 545, 64261, 83, 84, 115, 116, 545, 64262,
+	  83, 84, 115, 116, 545, 64275, 1348, 1350, 1396, 1398, 545, 64276, 1348,
+	  1333, 1396, 1381, 545, 64277, 1348, 1339, 1396, 1387, 545, 64278, 1358,
+	  1350, 1406, 1398, 545, 64279, 1348, 1341, 1396, 1389 };
+
+	/// A bit for each lead byte whose code points all map to themselves
+	inline constexpr uint64_t uncased_leads[4] = {
+	  0x0000000000000000ULL, 0x0000000000000000ULL,
+	  0x0000000000000000ULL, 0x001E7BF8FF801800ULL };
+} // namespace daw::range::impl
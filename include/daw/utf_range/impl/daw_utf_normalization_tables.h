@@ -0,0 +1,2593 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+// Generated by tools/gen_unicode_tables.py from Unicode 14.0.0, do not edit
+//
+
+#pragma once
+
+#include <cstdint>
+
+/// The Unicode data for normalization
+namespace daw::range::impl {
+	/// Canonical_Combining_Class in the low 8 bits, NFC_Quick_Check and
+	/// NFKC_Quick_Check in the next 2 bit pairs as 0 for Yes, 1 for Maybe
+	/// and 2 for No, then a bit for NFD_Quick_Check and one for
+	/// NFKD_Quick_Check being No
+	inline constexpr uint8_t normalization_properties_stage1[1088] = {
+	  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 14, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 13, 13, 13, 13, 13,
+	  13, 13, 13, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 28, 29, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 30, 13, 13, 13, 13,
+	  31, 32, 13, 13, 33, 13, 34, 35, 36, 13, 37, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 38, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	  13, 13, 13 };
+	inline constexpr uint16_t normalization_properties_stage2[2496] = {
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 3, 5, 6, 7, 8, 9, 10, 11, 8, 12,
+	  0, 0, 13, 14, 15, 16, 17, 18, 6, 19, 20, 21, 0, 0, 0, 0, 0, 0, 0, 22, 0,
+	  23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 14, 34, 14, 35, 36, 0, 37,
+	  38, 39, 0, 39, 0, 38, 0, 40, 41, 0, 0, 0, 42, 43, 44, 45, 0, 0, 0, 0, 0, 0,
+	  0, 0, 46, 47, 48, 49, 50, 0, 0, 0, 0, 51, 52, 0, 53, 54, 0, 55, 0, 0, 0, 0,
+	  56, 57, 58, 0, 0, 59, 0, 60, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 63, 0, 64,
+	  65, 0, 0, 66, 0, 0, 0, 67, 0, 0, 68, 69, 70, 71, 0, 0, 39, 72, 73, 74, 0,
+	  0, 0, 0, 0, 75, 76, 77, 0, 78, 0, 0, 0, 79, 73, 80, 0, 0, 0, 0, 0, 81, 73,
+	  0, 0, 0, 0, 0, 0, 75, 82, 83, 0, 0, 0, 84, 0, 85, 86, 87, 0, 0, 0, 0, 0,
+	  81, 88, 89, 0, 0, 0, 0, 0, 81, 90, 91, 0, 0, 0, 0, 0, 92, 86, 87, 0, 0, 0,
+	  0, 0, 0, 93, 94, 0, 0, 0, 0, 0, 95, 96, 0, 0, 0, 0, 0, 0, 97, 98, 99, 0, 0,
+	  100, 101, 0, 102, 103, 104, 105, 106, 107, 103, 104, 105, 108, 0, 0, 0, 0,
+	  0, 109, 110, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 112,
+	  113, 0, 0, 114, 115, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0, 119, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 0, 0, 0,
+	  0, 0, 0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0,
+	  124, 125, 0, 0, 0, 126, 127, 0, 0, 0, 128, 129, 0, 130, 131, 0, 132, 133,
+	  0, 0, 134, 0, 0, 0, 135, 136, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138,
+	  139, 140, 0, 0, 141, 142, 143, 144, 145, 146, 0, 147, 144, 144, 148, 149,
+	  150, 151, 6, 6, 6, 6, 6, 6, 6, 6, 6, 152, 6, 6, 6, 6, 6, 153, 6, 154, 6, 6,
+	  154, 155, 6, 156, 6, 6, 6, 157, 158, 159, 160, 161, 162, 163, 164, 165,
+	  166, 167, 0, 168, 169, 170, 146, 0, 0, 171, 172, 173, 174, 175, 176, 177,
+	  178, 144, 144, 144, 179, 180, 181, 0, 182, 0, 0, 0, 183, 0, 184, 185, 186,
+	  0, 187, 188, 188, 0, 189, 0, 0, 0, 190, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 144, 144, 144, 144,
+	  145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 0, 193, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99,
+	  0, 0, 0, 0, 0, 0, 194, 195, 0, 0, 0, 0, 0, 0, 196, 197, 0, 0, 0, 0, 0, 0,
+	  150, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 0, 198, 144, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 199, 0, 0, 185, 0,
+	  200, 201, 202, 203, 204, 205, 0, 206, 202, 203, 204, 205, 0, 207, 0, 0, 0,
+	  208, 144, 144, 144, 144, 169, 209, 0, 0, 0, 0, 0, 0, 144, 169, 144, 144,
+	  210, 144, 144, 169, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  194, 211, 0, 212, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 185, 0, 0, 0, 0,
+	  0, 0, 0, 213, 214, 0, 215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 150, 195, 0,
+	  0, 216, 0, 0, 217, 0, 0, 0, 0, 0, 218, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 219, 220, 0, 0, 214, 0, 0, 0, 0, 0, 221, 179, 0, 0, 0, 0, 0, 0,
+	  0, 73, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	  21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222,
+	  222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	  223, 224, 225, 222, 222, 222, 223, 222, 222, 222, 222, 222, 222, 226, 0, 0,
+	  227, 228, 229, 230, 231, 144, 144, 144, 144, 144, 144, 232, 0, 233, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	  144, 144, 144, 144, 144, 234, 0, 144, 144, 144, 144, 209, 144, 144, 210, 0,
+	  0, 170, 0, 235, 236, 144, 237, 238, 239, 240, 144, 144, 144, 144, 144, 144,
+	  144, 170, 208, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 169, 241,
+	  242, 243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 244, 0, 0, 0, 0, 0, 0, 0, 0, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 246, 144, 144, 247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 249, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 252, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 253, 244, 0, 0, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  214, 0, 0, 255, 0, 256, 257, 258, 0, 0, 0, 0, 259, 0, 260, 261, 0, 0, 0,
+	  218, 0, 0, 0, 0, 262, 0, 0, 0, 0, 0, 0, 263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  264, 0, 0, 0, 0, 265, 76, 87, 266, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  268, 78, 0, 0, 0, 0, 0, 269, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  271, 272, 273, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 274, 0, 0, 0, 0,
+	  0, 0, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 276, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 277, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124,
+	  0, 0, 0, 0, 119, 278, 0, 0, 0, 0, 279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 280, 0, 0, 0, 0, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 281,
+	  0, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 283, 0, 0, 0, 0, 0, 0, 0, 0, 0, 284, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287, 288, 0,
+	  289, 290, 291, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 144, 144, 144, 144,
+	  293, 144, 144, 144, 294, 295, 296, 297, 144, 144, 144, 298, 299, 144, 300,
+	  301, 302, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+	  144, 144, 144, 144, 144, 144, 144, 303, 144, 144, 144, 144, 144, 144, 144,
+	  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 304, 144, 144, 144, 305,
+	  306, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 308, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 309, 0, 0, 0, 0, 0, 0, 310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 297, 144, 311, 312, 313, 314, 315,
+	  316, 317, 318, 319, 318, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 144, 169,
+	  144, 144, 0, 320, 0, 0, 185, 0, 0, 0, 0, 0, 0, 321, 144, 144, 318, 22, 232,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 222, 222, 222, 222, 222,
+	  222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+	  222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 223, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0 };
+	inline constexpr uint16_t normalization_properties_stage3[5152] = {
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0,
+	  10240, 0, 10240, 0, 0, 0, 0, 10240, 0, 0, 10240, 10240, 10240, 10240, 0, 0,
+	  10240, 10240, 10240, 0, 10240, 10240, 10240, 0, 12288, 12288, 12288, 12288,
+	  12288, 12288, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 0, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0, 12288, 12288,
+	  12288, 12288, 12288, 0, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 0,
+	  0, 12288, 12288, 12288, 12288, 12288, 0, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 0, 10240, 10240, 12288, 12288, 12288, 12288, 0, 12288, 12288, 12288,
+	  12288, 12288, 12288, 10240, 10240, 0, 0, 12288, 12288, 12288, 12288, 12288,
+	  12288, 10240, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 10240, 12288, 12288, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 0, 12288, 12288,
+	  12288, 12288, 12288, 12288, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 10240, 10240, 10240, 12288, 12288, 0, 0,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0,
+	  12288, 12288, 0, 0, 0, 0, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 1510, 1510, 1510, 1510, 1510, 230, 1510, 1510, 1510,
+	  1510, 1510, 1510, 1510, 230, 230, 1510, 230, 1510, 230, 1510, 1510, 232,
+	  220, 220, 220, 220, 232, 1496, 220, 220, 220, 220, 220, 202, 202, 1500,
+	  1500, 1500, 1500, 1482, 1482, 220, 220, 220, 220, 1500, 1500, 220, 1500,
+	  1500, 220, 220, 1, 1, 1, 1, 1281, 220, 220, 220, 220, 230, 230, 230, 15078,
+	  15078, 1510, 15078, 15078, 1520, 230, 220, 220, 220, 230, 230, 230, 220,
+	  220, 0, 230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233,
+	  234, 234, 233, 234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	  230, 230, 230, 230, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 0, 10240, 0, 0, 0,
+	  14848, 0, 0, 0, 0, 0, 10240, 14336, 12288, 14848, 12288, 12288, 12288, 0,
+	  12288, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 12288,
+	  12288, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 12288,
+	  12288, 12288, 0, 10240, 10240, 10240, 14336, 14336, 10240, 10240, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 10240, 10240, 0, 0, 0, 10240, 0,
+	  0, 0, 0, 0, 0, 12288, 12288, 0, 12288, 0, 0, 0, 12288, 0, 0, 0, 0, 12288,
+	  12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+	  230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 12288, 12288, 12288, 12288, 0, 0, 12288, 12288, 0, 0, 12288,
+	  12288, 12288, 12288, 12288, 12288, 0, 0, 12288, 12288, 12288, 12288, 12288,
+	  12288, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 230, 230, 230, 230, 220, 230,
+	  230, 230, 222, 220, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220,
+	  220, 230, 230, 220, 230, 230, 222, 228, 230, 10, 11, 12, 13, 14, 15, 16,
+	  17, 18, 19, 19, 20, 21, 22, 0, 23, 0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0,
+	  0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0,
+	  0, 0, 0, 0, 12288, 12288, 12288, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34, 1510,
+	  1510, 1500, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220, 35, 0, 0, 0,
+	  0, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 12288, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 230, 230, 230, 230,
+	  230, 230, 230, 0, 0, 230, 230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220,
+	  230, 230, 220, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+	  220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+	  230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 220, 230, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0,
+	  230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230,
+	  230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 230,
+	  230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 220,
+	  230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29,
+	  230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 0, 12288,
+	  0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 1287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 9, 0, 0, 0, 230, 220, 230, 230, 0, 0, 0, 14848, 14848, 14848,
+	  14848, 14848, 14848, 14848, 14848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	  0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 9, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 14848, 14848, 0, 14848, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 14848, 0, 0, 14848, 0, 0, 0, 0, 0,
+	  7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14848, 14848, 14848, 0, 0, 14848, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  12288, 0, 0, 12288, 12288, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 1280, 0, 0, 0,
+	  0, 14848, 14848, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 12288, 12288, 12288, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+	  0, 84, 1371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 1280, 0, 0, 0, 0, 12288,
+	  12288, 0, 12288, 12288, 0, 9, 0, 0, 0, 0, 0, 0, 0, 1280, 1280, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1280, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 1289, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  12288, 0, 12288, 12288, 12288, 1280, 0, 0, 0, 10240, 0, 0, 0, 0, 103, 103,
+	  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+	  0, 0, 0, 10240, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 122, 122, 122, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0,
+	  220, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  14848, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 14848, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 0, 0, 0, 129, 130, 14848, 132,
+	  14848, 14848, 10240, 14848, 10240, 130, 130, 130, 130, 0, 0, 130, 14848,
+	  230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 1280,
+	  0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 220, 0, 0, 0, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+	  1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+	  1280, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280,
+	  1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+	  1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+	  1280, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  230, 220, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220, 230,
+	  230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+	  220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230,
+	  0, 0, 0, 0, 0, 0, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 0,
+	  0, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 1280, 0, 0,
+	  0, 0, 0, 12288, 0, 12288, 0, 0, 12288, 12288, 0, 12288, 9, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+	  230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	  0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230,
+	  230, 220, 220, 220, 220, 230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0,
+	  0, 0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240,
+	  10240, 230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230,
+	  234, 214, 220, 202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	  230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	  230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 228, 228, 220,
+	  218, 230, 233, 220, 230, 220, 12288, 12288, 12288, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 10240, 14336, 0, 0, 0, 0, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0, 0, 0, 0, 0, 12288,
+	  12288, 12288, 12288, 12288, 12288, 0, 0, 12288, 12288, 12288, 12288, 12288,
+	  12288, 0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 0,
+	  12288, 0, 12288, 0, 12288, 0, 12288, 12288, 14848, 12288, 14848, 12288,
+	  14848, 12288, 14848, 12288, 14848, 12288, 14848, 12288, 14848, 0, 0, 12288,
+	  12288, 12288, 12288, 12288, 0, 12288, 12288, 12288, 12288, 12288, 14848,
+	  12288, 10240, 14848, 10240, 10240, 14336, 12288, 12288, 12288, 0, 12288,
+	  12288, 12288, 14848, 12288, 14848, 12288, 14336, 14336, 14336, 12288,
+	  12288, 12288, 14848, 0, 0, 12288, 12288, 12288, 12288, 12288, 14848, 0,
+	  14336, 14336, 14336, 12288, 12288, 12288, 14848, 12288, 12288, 12288,
+	  12288, 12288, 12288, 12288, 14848, 12288, 14336, 14848, 14848, 0, 0, 12288,
+	  12288, 12288, 0, 12288, 12288, 12288, 14848, 12288, 14848, 12288, 14848,
+	  10240, 0, 14848, 14848, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0,
+	  0, 0, 10240, 10240, 0, 10240, 10240, 0, 0, 0, 0, 10240, 0, 10240, 0, 0, 0,
+	  0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  10240, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 230, 230, 1, 1,
+	  230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0, 0, 230, 0, 0, 0, 1, 1, 230,
+	  220, 230, 1, 1, 220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 0, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0,
+	  10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240,
+	  10240, 0, 10240, 0, 14848, 0, 10240, 0, 14848, 14848, 10240, 10240, 0,
+	  10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0,
+	  10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 10240, 10240, 10240,
+	  10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 12288, 12288, 12288, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 12288, 0, 0,
+	  12288, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 12288, 0, 0, 0, 0, 0, 10240, 10240,
+	  0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0,
+	  0, 12288, 0, 0, 12288, 0, 12288, 0, 0, 0, 0, 0, 0, 12288, 0, 12288, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 12288, 12288, 12288, 12288, 12288, 0, 0, 12288,
+	  12288, 0, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 12288, 0, 0, 0, 0,
+	  0, 0, 12288, 12288, 12288, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14848,
+	  14848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14848, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224, 0, 0, 0,
+	  0, 0, 0, 10240, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0,
+	  12288, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 12288, 0, 0, 12288, 0,
+	  12288, 0, 12288, 0, 0, 0, 0, 0, 0, 12288, 12288, 0, 12288, 12288, 0, 12288,
+	  12288, 0, 12288, 12288, 0, 12288, 12288, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0,
+	  0, 1288, 1288, 10240, 10240, 0, 12288, 10240, 0, 0, 0, 0, 12288, 0, 0,
+	  12288, 12288, 12288, 12288, 0, 0, 0, 12288, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+	  230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 10240, 10240, 230, 230, 0, 0, 10240, 10240, 10240, 0, 0, 0, 10240,
+	  10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 220, 220, 220, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0,
+	  230, 230, 0, 0, 0, 0, 0, 230, 230, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 0, 0,
+	  14848, 0, 14848, 0, 0, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 14848, 0, 14848, 0, 14848, 0, 0, 14848, 14848, 0, 0, 0,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 14848, 14848, 14848, 14848, 0, 0, 0, 0, 0, 0, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 14848, 26, 14848, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 14848,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 0, 14848, 14848, 14848, 14848, 14848, 0, 14848, 0, 14848,
+	  14848, 0, 14848, 14848, 0, 14848, 14848, 14848, 14848, 14848, 14848, 14848,
+	  14848, 14848, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0,
+	  230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230,
+	  230, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 0, 0, 0, 0, 10240, 10240, 10240, 0, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0,
+	  10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 0, 0,
+	  0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 10240,
+	  10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  220, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9, 0, 0, 0,
+	  0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220, 0, 0,
+	  230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 12288, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 9, 1287, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 12288, 12288, 0,
+	  0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	  7, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+	  0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+	  0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280,
+	  12288, 12288, 1280, 12288, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 12288, 12288, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0,
+	  0, 1280, 0, 0, 0, 0, 0, 0, 0, 12288, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0,
+	  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+	  0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  14848, 14848, 14848, 14848, 14848, 14848, 14848, 216, 216, 1, 1, 1, 0, 0,
+	  0, 226, 216, 216, 216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220,
+	  220, 220, 220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 14848, 14848, 14848, 14848, 14848, 14848, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240,
+	  10240, 0, 0, 10240, 0, 0, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240,
+	  0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 0, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240,
+	  10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 0, 10240, 0, 0,
+	  0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 230,
+	  230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+	  230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+	  230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 220, 220, 220, 220, 220,
+	  220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+	  230, 7, 0, 0, 0, 0, 0, 0, 10240, 10240, 0, 10240, 0, 0, 10240, 0, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240,
+	  10240, 10240, 10240, 0, 10240, 0, 10240, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0,
+	  0, 10240, 0, 10240, 0, 10240, 0, 10240, 10240, 10240, 0, 10240, 10240, 0,
+	  10240, 0, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 0, 10240,
+	  10240, 0, 10240, 0, 0, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 0, 10240, 10240,
+	  10240, 10240, 0, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+	  10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0,
+	  0, 0, 0, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 0,
+	  10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+	  10240, 10240, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0 };
+
+	constexpr uint16_t normalization_properties( char32_t cp ) noexcept {
+		if( cp >= 0x110000U ) {
+			return 0;
+		}
+		unsigned const c = cp;
+		unsigned const mid = normalization_properties_stage1[c >> 10U];
+		unsigned const low =
+		  normalization_properties_stage2[( mid << 6U ) | ( ( c >> 4U ) & 63U )];
+		return normalization_properties_stage3[( low << 4U ) | ( c & 15U )];
+	}
+
+	/// Where the full decomposition of a code point starts in
+	/// decomposition_pool, 0 when it has none or is a Hangul syllable
+	inline constexpr uint8_t decomposition_index_stage1[1088] = {
+	  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 13, 14, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 16, 5, 17, 5, 5, 18, 19, 20,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 21, 22, 5, 5,
+	  5, 5, 5, 23, 24, 5, 25, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 26, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5 };
+	inline constexpr uint16_t decomposition_index_stage2[1728] = {
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+	  14, 0, 0, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 25,
+	  0, 26, 27, 0, 0, 0, 0, 0, 28, 0, 0, 29, 30, 31, 32, 33, 34, 35, 0, 36, 37,
+	  38, 0, 39, 0, 40, 0, 41, 0, 0, 0, 0, 42, 43, 44, 45, 0, 0, 0, 0, 0, 0, 0,
+	  0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 48, 0, 0, 0, 0, 49, 50,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0, 53, 0, 0, 0, 0, 0, 0, 54, 55,
+	  0, 0, 0, 0, 0, 56, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 59,
+	  0, 0, 0, 60, 0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 63, 0,
+	  0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 66, 0, 0,
+	  0, 0, 0, 0, 0, 67, 0, 68, 0, 0, 69, 0, 0, 0, 70, 71, 72, 73, 74, 75, 76,
+	  77, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 80, 81, 0, 82, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 85, 86, 87, 88, 89,
+	  0, 90, 91, 92, 0, 0, 0, 0, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+	  104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+	  119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 0, 131, 132,
+	  133, 134, 0, 0, 0, 0, 0, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+	  145, 0, 146, 0, 0, 0, 147, 0, 148, 149, 150, 0, 151, 152, 153, 0, 154, 0,
+	  0, 0, 155, 0, 0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 157, 158, 159, 160, 161, 162, 163, 164, 165, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166,
+	  0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  171, 0, 0, 0, 0, 0, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+	  183, 184, 185, 186, 0, 0, 187, 0, 0, 188, 189, 190, 191, 192, 0, 193, 194,
+	  195, 196, 197, 0, 198, 0, 0, 0, 199, 200, 201, 202, 203, 204, 205, 0, 0, 0,
+	  0, 0, 0, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218,
+	  219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+	  234, 235, 236, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 0, 240, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 241, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+	  255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269,
+	  270, 271, 272, 0, 0, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+	  284, 0, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297,
+	  298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 0, 308, 309, 310, 311,
+	  312, 313, 314, 315, 0, 0, 316, 0, 317, 0, 318, 319, 320, 321, 322, 323,
+	  324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+	  339, 340, 341, 342, 343, 344, 345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 346, 347, 348,
+	  349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 351, 0, 0, 0, 0, 0, 0, 0,
+	  352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 356, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  357, 358, 0, 0, 0, 0, 359, 360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 361, 362,
+	  363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377,
+	  378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392,
+	  393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
+	  408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+	  423, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 425, 426, 427, 428, 429, 430, 431, 432, 433,
+	  434, 435, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 437, 438, 439, 440, 441, 0,
+	  442, 0, 0, 443, 0, 0, 0, 0, 0, 0, 444, 445, 446, 447, 448, 449, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+	  459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473,
+	  474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	inline constexpr uint16_t decomposition_index_stage3[7760] = {
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3,
+	  0, 6, 0, 0, 0, 0, 8, 0, 0, 11, 13, 15, 18, 0, 0, 20, 23, 25, 0, 27, 31, 35,
+	  0, 39, 42, 45, 48, 51, 54, 0, 57, 60, 63, 66, 69, 72, 75, 78, 81, 0, 84,
+	  87, 90, 93, 96, 99, 0, 0, 102, 105, 108, 111, 114, 0, 0, 117, 120, 123,
+	  126, 129, 132, 0, 135, 138, 141, 144, 147, 150, 153, 156, 159, 0, 162, 165,
+	  168, 171, 174, 177, 0, 0, 180, 183, 186, 189, 192, 0, 195, 198, 201, 204,
+	  207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 0, 0, 246,
+	  249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285, 288, 291,
+	  294, 297, 300, 303, 0, 0, 306, 309, 312, 315, 318, 321, 324, 327, 330, 0,
+	  333, 336, 339, 342, 345, 348, 0, 351, 354, 357, 360, 363, 366, 369, 372, 0,
+	  0, 375, 378, 381, 384, 387, 390, 393, 0, 0, 396, 399, 402, 405, 408, 411,
+	  0, 0, 414, 417, 420, 423, 426, 429, 432, 435, 438, 441, 444, 447, 450, 453,
+	  456, 459, 462, 465, 0, 0, 468, 471, 474, 477, 480, 483, 486, 489, 492, 495,
+	  498, 501, 504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537, 539,
+	  542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 545, 548, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 551, 555, 559, 563, 566, 569, 572, 575,
+	  578, 581, 584, 587, 590, 593, 596, 599, 602, 605, 609, 613, 617, 621, 625,
+	  629, 633, 0, 637, 641, 645, 649, 653, 656, 0, 0, 659, 662, 665, 668, 671,
+	  674, 677, 681, 685, 688, 691, 694, 697, 700, 703, 706, 0, 0, 709, 712, 715,
+	  719, 723, 726, 729, 732, 735, 738, 741, 744, 747, 750, 753, 756, 759, 762,
+	  765, 768, 771, 774, 777, 780, 783, 786, 789, 792, 795, 798, 801, 804, 807,
+	  810, 813, 816, 0, 0, 819, 822, 0, 0, 0, 0, 0, 0, 825, 828, 831, 834, 837,
+	  841, 845, 849, 853, 856, 859, 863, 867, 870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 873, 875, 877, 879, 881, 883, 885, 887, 889, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 891, 894, 897, 900, 903, 906, 0, 0, 909, 911, 913,
+	  915, 917, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 919, 921, 0, 923, 925, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 928, 0, 0, 0, 0, 0, 930, 0, 0, 0, 933,
+	  0, 0, 0, 0, 0, 935, 938, 944, 947, 949, 952, 955, 0, 958, 0, 961, 964, 967,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  971, 974, 977, 980, 983, 986, 989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 993, 996, 999, 1002, 1005, 0, 1008,
+	  1010, 1012, 1014, 1019, 1024, 1026, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1028, 1030,
+	  1032, 0, 1034, 1036, 0, 0, 0, 1038, 0, 0, 0, 0, 0, 0, 1040, 1043, 0, 1046,
+	  0, 0, 0, 1049, 0, 0, 0, 0, 1052, 1055, 1058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  1061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1064, 0, 0, 0, 0, 0, 0,
+	  1067, 1070, 0, 1073, 0, 0, 0, 1076, 0, 0, 0, 0, 1079, 1082, 1085, 0, 0, 0,
+	  0, 0, 0, 0, 1088, 1091, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1094, 1097, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1100, 1103, 1106, 1109, 0, 0, 1112, 1115, 0, 0,
+	  1118, 1121, 1124, 1127, 1130, 1133, 0, 0, 1136, 1139, 1142, 1145, 1148,
+	  1151, 0, 0, 1154, 1157, 1160, 1163, 1166, 1169, 1172, 1175, 1178, 1181,
+	  1184, 1187, 0, 0, 1190, 1193, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1196,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1199, 1202, 1205, 1208, 1211, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1214, 1217, 1220, 1223, 0, 0, 0, 0, 0, 0, 0,
+	  1226, 0, 1229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1232, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1235, 0, 0, 0, 0,
+	  0, 0, 0, 1238, 0, 0, 1241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 1244, 1247, 1250, 1253, 1256, 1259, 1262, 1265, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 1268, 1271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  1274, 1277, 0, 1280, 0, 0, 0, 1283, 0, 0, 1286, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1289, 1292, 1295, 0, 0, 1298, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 1301, 0, 0, 1304, 1307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 1310, 1313, 0, 0, 0, 0, 0, 0, 1316, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1319, 1322, 1325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 1328, 0, 0, 0, 0, 0, 0, 0, 1331, 0, 0, 0, 0, 0, 0, 1334, 1337, 0, 1340,
+	  1343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1347, 1350, 1353, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1356, 0, 1359, 1362, 1366, 0, 0, 0, 0, 1369,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1372, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1375, 1378, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 1381, 0, 0, 0, 0, 0, 0, 1383, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 1386, 0, 0, 0, 0, 1389, 0, 0, 0, 0, 1392, 0, 0, 0, 0, 1395, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1401, 0,
+	  1404, 1407, 1410, 1414, 1417, 0, 0, 0, 0, 0, 0, 0, 1421, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1427, 0,
+	  0, 0, 0, 1430, 0, 0, 0, 0, 1433, 0, 0, 0, 0, 1436, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 1439, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1442, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1445, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 1447, 0, 1450, 0, 1453, 0, 1456, 0, 1459, 0, 0, 0, 1462, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1465, 0, 1468,
+	  0, 0, 1471, 1474, 0, 1477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 1480, 1482, 1484, 0, 1486, 1488, 1490, 1492, 1494,
+	  1496, 1498, 1500, 1502, 1504, 1506, 0, 1508, 1510, 1512, 1514, 1516, 1518,
+	  1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534, 1536, 1538, 1540, 1542, 0,
+	  1544, 1546, 1548, 1550, 1552, 1554, 1556, 1558, 1560, 1562, 1564, 1566,
+	  1568, 1570, 1572, 1574, 1576, 1578, 1580, 1582, 1584, 1586, 1588, 1590,
+	  1592, 1594, 1596, 1598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1600, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1602, 1604, 1606, 1608,
+	  1610, 1612, 1614, 1616, 1618, 1620, 1622, 1624, 1626, 1628, 1630, 1632,
+	  1634, 1636, 1638, 1640, 1642, 1644, 1646, 1648, 1650, 1652, 1654, 1656,
+	  1658, 1660, 1662, 1664, 1666, 1668, 1670, 1672, 1674, 1676, 1679, 1682,
+	  1685, 1688, 1691, 1694, 1697, 1700, 1704, 1708, 1711, 1714, 1717, 1720,
+	  1723, 1726, 1729, 1732, 1735, 1738, 1742, 1746, 1750, 1754, 1757, 1760,
+	  1763, 1766, 1770, 1774, 1777, 1780, 1783, 1786, 1789, 1792, 1795, 1798,
+	  1801, 1804, 1807, 1810, 1813, 1816, 1819, 1822, 1826, 1830, 1833, 1836,
+	  1839, 1842, 1845, 1848, 1851, 1854, 1858, 1862, 1865, 1868, 1871, 1874,
+	  1877, 1880, 1883, 1886, 1889, 1892, 1895, 1898, 1901, 1904, 1907, 1910,
+	  1913, 1916, 1920, 1924, 1928, 1932, 1936, 1940, 1944, 1948, 1951, 1954,
+	  1957, 1960, 1963, 1966, 1969, 1972, 1976, 1980, 1983, 1986, 1989, 1992,
+	  1995, 1998, 2002, 2006, 2010, 2014, 2018, 2022, 2025, 2028, 2031, 2034,
+	  2037, 2040, 2043, 2046, 2049, 2052, 2055, 2058, 2061, 2064, 2068, 2072,
+	  2076, 2080, 2083, 2086, 2089, 2092, 2095, 2098, 2101, 2104, 2107, 2110,
+	  2113, 2116, 2119, 2122, 2125, 2128, 2131, 2134, 2137, 2140, 2143, 2146,
+	  2149, 2152, 2155, 2158, 2161, 2164, 2167, 2170, 2173, 0, 0, 0, 0, 2178,
+	  2181, 2184, 2187, 2190, 2194, 2198, 2202, 2206, 2210, 2214, 2218, 2222,
+	  2226, 2230, 2234, 2238, 2242, 2246, 2250, 2254, 2258, 2262, 2266, 2270,
+	  2273, 2276, 2279, 2282, 2285, 2288, 2292, 2296, 2300, 2304, 2308, 2312,
+	  2316, 2320, 2324, 2328, 2331, 2334, 2337, 2340, 2343, 2346, 2349, 2352,
+	  2356, 2360, 2364, 2368, 2372, 2376, 2380, 2384, 2388, 2392, 2396, 2400,
+	  2404, 2408, 2412, 2416, 2420, 2424, 2428, 2432, 2435, 2438, 2441, 2444,
+	  2448, 2452, 2456, 2460, 2464, 2468, 2472, 2476, 2480, 2484, 2487, 2490,
+	  2493, 2496, 2499, 2502, 2505, 0, 0, 0, 0, 0, 0, 2508, 2511, 2514, 2518,
+	  2522, 2526, 2530, 2534, 2538, 2541, 2544, 2548, 2552, 2556, 2560, 2564,
+	  2568, 2571, 2574, 2578, 2582, 2586, 0, 0, 2590, 2593, 2596, 2600, 2604,
+	  2608, 0, 0, 2612, 2615, 2618, 2622, 2626, 2630, 2634, 2638, 2642, 2645,
+	  2648, 2652, 2656, 2660, 2664, 2668, 2672, 2675, 2678, 2682, 2686, 2690,
+	  2694, 2698, 2702, 2705, 2708, 2712, 2716, 2720, 2724, 2728, 2732, 2735,
+	  2738, 2742, 2746, 2750, 0, 0, 2754, 2757, 2760, 2764, 2768, 2772, 0, 0,
+	  2776, 2779, 2782, 2786, 2790, 2794, 2798, 2802, 0, 2806, 0, 2809, 0, 2813,
+	  0, 2817, 2821, 2824, 2827, 2831, 2835, 2839, 2843, 2847, 2851, 2854, 2857,
+	  2861, 2865, 2869, 2873, 2877, 2881, 2884, 2887, 2890, 2893, 2896, 2899,
+	  2902, 2905, 2908, 2911, 2914, 2917, 2920, 0, 0, 2923, 2927, 2931, 2936,
+	  2941, 2946, 2951, 2956, 2961, 2965, 2969, 2974, 2979, 2984, 2989, 2994,
+	  2999, 3003, 3007, 3012, 3017, 3022, 3027, 3032, 3037, 3041, 3045, 3050,
+	  3055, 3060, 3065, 3070, 3075, 3079, 3083, 3088, 3093, 3098, 3103, 3108,
+	  3113, 3117, 3121, 3126, 3131, 3136, 3141, 3146, 3151, 3154, 3157, 3161,
+	  3164, 0, 3168, 3171, 3175, 3178, 3181, 3184, 3187, 3190, 3193, 3195, 3198,
+	  3201, 3207, 3211, 3214, 0, 3218, 3221, 3225, 3228, 3231, 3234, 3237, 3240,
+	  3246, 3252, 3258, 3261, 3264, 3268, 0, 0, 3272, 3275, 3279, 3282, 3285,
+	  3288, 0, 3291, 3297, 3303, 3309, 3312, 3315, 3319, 3323, 3326, 3329, 3332,
+	  3336, 3339, 3342, 3345, 3348, 3351, 3357, 3363, 0, 0, 3365, 3369, 3372, 0,
+	  3376, 3379, 3383, 3386, 3389, 3392, 3395, 3398, 3402, 0, 3405, 3408, 3411,
+	  3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 0, 0, 0, 0, 0, 0, 3429, 0,
+	  0, 0, 0, 0, 3431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3434, 3436, 3439, 0,
+	  0, 0, 0, 0, 0, 0, 0, 3443, 0, 0, 0, 3445, 3448, 0, 3452, 3455, 0, 0, 0, 0,
+	  3459, 0, 3462, 0, 0, 0, 0, 0, 0, 0, 0, 3465, 3468, 3471, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 3474, 0, 0, 0, 0, 0, 0, 0, 3479, 3481, 3483, 0, 0,
+	  3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505, 3507,
+	  3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527, 3529, 3531,
+	  3533, 3535, 3537, 0, 3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555,
+	  3557, 3559, 3561, 3563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3565, 0, 0, 0, 0,
+	  0, 0, 0, 3568, 3572, 3576, 3578, 0, 3581, 3585, 3589, 0, 3591, 3594, 3596,
+	  3598, 3600, 3602, 3604, 3606, 3608, 3610, 3612, 0, 3614, 3616, 0, 0, 3619,
+	  3621, 3623, 3625, 3627, 0, 0, 3629, 3632, 3636, 0, 3639, 0, 3641, 0, 3643,
+	  0, 3645, 3647, 3650, 3652, 0, 3654, 3656, 3658, 0, 3660, 3662, 3664, 3666,
+	  3668, 3670, 3672, 0, 3674, 3678, 3680, 3682, 3684, 3686, 0, 0, 0, 0, 3688,
+	  3690, 3692, 3694, 3696, 0, 0, 0, 0, 0, 0, 3698, 3702, 3706, 3711, 3715,
+	  3719, 3723, 3727, 3731, 3735, 3739, 3743, 3747, 3751, 3755, 3759, 3762,
+	  3764, 3767, 3771, 3774, 3776, 3779, 3783, 3788, 3791, 3793, 3796, 3800,
+	  3802, 3804, 3806, 3808, 3810, 3813, 3817, 3820, 3822, 3825, 3829, 3834,
+	  3837, 3839, 3842, 3846, 3848, 3850, 3852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3854,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3858, 3861, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3864, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 3867, 3870, 3873, 0, 0, 0, 0, 3876, 0, 0, 0, 0, 3879, 0, 0,
+	  3882, 0, 0, 0, 0, 0, 0, 0, 3885, 0, 3888, 0, 0, 0, 0, 0, 3891, 3894, 0,
+	  3898, 3901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3905, 0, 0,
+	  3908, 0, 0, 3911, 0, 3914, 0, 0, 0, 0, 0, 0, 3917, 0, 3920, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 3923, 3926, 3929, 3932, 3935, 0, 0, 3938, 3941, 0, 0, 3944,
+	  3947, 0, 0, 0, 0, 0, 0, 3950, 3953, 0, 0, 3956, 3959, 0, 0, 3962, 3965, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3968, 3971, 3974, 3977,
+	  3980, 3983, 3986, 3989, 0, 0, 0, 0, 0, 0, 3992, 3995, 3998, 4001, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 4004, 4006, 0, 0, 0, 0, 0, 4008, 4010, 4012, 4014,
+	  4016, 4018, 4020, 4022, 4024, 4026, 4029, 4032, 4035, 4038, 4041, 4044,
+	  4047, 4050, 4053, 4056, 4059, 4063, 4067, 4071, 4075, 4079, 4083, 4087,
+	  4091, 4095, 4100, 4105, 4110, 4115, 4120, 4125, 4130, 4135, 4140, 4145,
+	  4150, 4153, 4156, 4159, 4162, 4165, 4168, 4171, 4174, 4177, 4181, 4185,
+	  4189, 4193, 4197, 4201, 4205, 4209, 4213, 4217, 4221, 4225, 4229, 4233,
+	  4237, 4241, 4245, 4249, 4253, 4257, 4261, 4265, 4269, 4273, 4277, 4281,
+	  4285, 4289, 4293, 4297, 4301, 4305, 4309, 4313, 4317, 4321, 4325, 4327,
+	  4329, 4331, 4333, 4335, 4337, 4339, 4341, 4343, 4345, 4347, 4349, 4351,
+	  4353, 4355, 4357, 4359, 4361, 4363, 4365, 4367, 4369, 4371, 4373, 4375,
+	  4377, 4379, 4381, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4399,
+	  4401, 4403, 4405, 4407, 4409, 4411, 4413, 4415, 4417, 4419, 4421, 4423,
+	  4425, 4427, 4429, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4431,
+	  0, 0, 0, 0, 0, 0, 0, 4436, 4440, 4443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 4447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 4450, 4452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4454, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4456, 0, 0, 0, 4458, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474,
+	  4476, 4478, 4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498,
+	  4500, 4502, 4504, 4506, 4508, 4510, 4512, 4514, 4516, 4518, 4520, 4522,
+	  4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542, 4544, 4546,
+	  4548, 4550, 4552, 4554, 4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570,
+	  4572, 4574, 4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594,
+	  4596, 4598, 4600, 4602, 4604, 4606, 4608, 4610, 4612, 4614, 4616, 4618,
+	  4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638, 4640, 4642,
+	  4644, 4646, 4648, 4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666,
+	  4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690,
+	  4692, 4694, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714,
+	  4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738,
+	  4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762,
+	  4764, 4766, 4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4784, 4786,
+	  4788, 4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804, 4806, 4808, 4810,
+	  4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834,
+	  4836, 4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858,
+	  4860, 4862, 4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878, 4880, 4882,
+	  4884, 4886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4888, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4890, 0, 4892, 4894, 4896, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4898, 0, 4901, 0, 4904, 0, 4907, 0,
+	  4910, 0, 4913, 0, 4916, 0, 4919, 0, 4922, 0, 4925, 0, 4928, 0, 4931, 0, 0,
+	  4934, 0, 4937, 0, 4940, 0, 0, 0, 0, 0, 0, 4943, 4946, 0, 4949, 4952, 0,
+	  4955, 4958, 0, 4961, 4964, 0, 4967, 4970, 0, 0, 0, 0, 0, 0, 4973, 0, 0, 0,
+	  0, 0, 0, 4976, 4979, 0, 4982, 4985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  4988, 0, 4991, 0, 4994, 0, 4997, 0, 5000, 0, 5003, 0, 5006, 0, 5009, 0,
+	  5012, 0, 5015, 0, 5018, 0, 5021, 0, 0, 5024, 0, 5027, 0, 5030, 0, 0, 0, 0,
+	  0, 0, 5033, 5036, 0, 5039, 5042, 0, 5045, 5048, 0, 5051, 5054, 0, 5057,
+	  5060, 0, 0, 0, 0, 0, 0, 5063, 0, 0, 5066, 5069, 5072, 5075, 0, 0, 0, 5078,
+	  5081, 0, 5084, 5086, 5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102, 5104,
+	  5106, 5108, 5110, 5112, 5114, 5116, 5118, 5120, 5122, 5124, 5126, 5128,
+	  5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148, 5150, 5152,
+	  5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176,
+	  5178, 5180, 5182, 5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200,
+	  5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216, 5218, 5220, 5222, 5224,
+	  5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246, 5248,
+	  5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268, 5270, 0, 0, 0,
+	  5272, 5274, 5276, 5278, 5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294,
+	  5296, 5298, 5300, 5304, 5308, 5312, 5316, 5320, 5324, 5328, 5332, 5336,
+	  5340, 5344, 5348, 5352, 5356, 5361, 5366, 5371, 5376, 5381, 5386, 5391,
+	  5396, 5401, 5406, 5411, 5416, 5421, 5426, 5431, 5439, 0, 5446, 5450, 5454,
+	  5458, 5462, 5466, 5470, 5474, 5478, 5482, 5486, 5490, 5494, 5498, 5502,
+	  5506, 5510, 5514, 5518, 5522, 5526, 5530, 5534, 5538, 5542, 5546, 5550,
+	  5554, 5558, 5562, 5566, 5570, 5574, 5578, 5582, 5586, 5590, 5592, 5594,
+	  5596, 0, 0, 0, 0, 0, 0, 0, 0, 5598, 5602, 5605, 5608, 5611, 5614, 5617,
+	  5620, 5623, 5626, 5629, 5632, 5635, 5638, 5641, 5644, 5647, 5649, 5651,
+	  5653, 5655, 5657, 5659, 5661, 5663, 5665, 5667, 5669, 5671, 5673, 5675,
+	  5678, 5681, 5684, 5687, 5690, 5693, 5696, 5699, 5702, 5705, 5708, 5711,
+	  5714, 5717, 5723, 5728, 0, 5731, 5733, 5735, 5737, 5739, 5741, 5743, 5745,
+	  5747, 5749, 5751, 5753, 5755, 5757, 5759, 5761, 5763, 5765, 5767, 5769,
+	  5771, 5773, 5775, 5777, 5779, 5781, 5783, 5785, 5787, 5789, 5791, 5793,
+	  5795, 5797, 5799, 5801, 5803, 5805, 5807, 5809, 5811, 5813, 5815, 5817,
+	  5819, 5821, 5823, 5825, 5827, 5829, 5832, 5835, 5838, 5841, 5844, 5847,
+	  5850, 5853, 5856, 5859, 5862, 5865, 5868, 5871, 5874, 5877, 5880, 5883,
+	  5886, 5889, 5892, 5895, 5898, 5901, 5905, 5909, 5913, 5916, 5920, 5923,
+	  5927, 5929, 5931, 5933, 5935, 5937, 5939, 5941, 5943, 5945, 5947, 5949,
+	  5951, 5953, 5955, 5957, 5959, 5961, 5963, 5965, 5967, 5969, 5971, 5973,
+	  5975, 5977, 5979, 5981, 5983, 5985, 5987, 5989, 5991, 5993, 5995, 5997,
+	  5999, 6001, 6003, 6005, 6007, 6009, 6011, 6013, 6015, 6017, 6019, 6021,
+	  6024, 6030, 6035, 6041, 6045, 6051, 6055, 6059, 6066, 6071, 6075, 6079,
+	  6083, 6088, 6093, 6098, 6103, 6108, 6113, 6118, 6125, 6128, 6135, 6142,
+	  6148, 6153, 6160, 6167, 6172, 6176, 6180, 6185, 6190, 6196, 6202, 6206,
+	  6210, 6215, 6219, 6223, 6226, 6229, 6233, 6237, 6244, 6249, 6255, 6262,
+	  6267, 6271, 6275, 6282, 6287, 6294, 6298, 6304, 6308, 6313, 6317, 6322,
+	  6328, 6333, 6339, 6344, 6347, 6353, 6357, 6361, 6366, 6370, 6374, 6378,
+	  6384, 6389, 6392, 6399, 6403, 6409, 6414, 6419, 6423, 6427, 6432, 6435,
+	  6440, 6446, 6449, 6456, 6460, 6463, 6466, 6469, 6472, 6475, 6478, 6481,
+	  6484, 6487, 6490, 6494, 6498, 6502, 6506, 6510, 6514, 6518, 6522, 6526,
+	  6530, 6534, 6538, 6542, 6546, 6550, 6554, 6557, 6560, 6564, 6567, 6570,
+	  6573, 6577, 6581, 6584, 6587, 6590, 6593, 6596, 6601, 6604, 6607, 6610,
+	  6613, 6616, 6619, 6622, 6625, 6629, 6634, 6637, 6640, 6643, 6646, 6649,
+	  6652, 6655, 6659, 6663, 6667, 6671, 6674, 6677, 6680, 6683, 6686, 6689,
+	  6692, 6695, 6698, 6701, 6705, 6709, 6712, 6716, 6720, 6724, 6727, 6731,
+	  6735, 6740, 6743, 6747, 6751, 6755, 6759, 6765, 6772, 6775, 6778, 6781,
+	  6784, 6787, 6790, 6793, 6796, 6799, 6802, 6805, 6808, 6811, 6814, 6817,
+	  6820, 6823, 6826, 6831, 6834, 6837, 6840, 6845, 6849, 6852, 6855, 6858,
+	  6861, 6864, 6867, 6870, 6873, 6876, 6879, 6883, 6886, 6889, 6893, 6897,
+	  6900, 6905, 6909, 6912, 6915, 6918, 6921, 6925, 6929, 6932, 6935, 6938,
+	  6941, 6944, 6947, 6950, 6953, 6956, 6960, 6964, 6968, 6972, 6976, 6980,
+	  6984, 6988, 6992, 6996, 7000, 7004, 7008, 7012, 7016, 7020, 7024, 7028,
+	  7032, 7036, 7040, 7044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7048, 7050, 0,
+	  0, 7052, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7054, 7056,
+	  7058, 0, 0, 0, 7060, 7062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 7064, 7066, 7068, 7070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7072, 0, 0, 0, 0,
+	  0, 0, 7074, 7076, 7078, 7080, 7082, 7084, 7086, 7088, 7090, 7092, 7094,
+	  7096, 7098, 7100, 7102, 7104, 7106, 7108, 7110, 7112, 7114, 7116, 7118,
+	  7120, 7122, 7124, 7126, 7128, 7130, 7132, 7134, 7136, 7138, 7140, 7142,
+	  7144, 7146, 7148, 7150, 7152, 7154, 7156, 7158, 7160, 7162, 7164, 7166,
+	  7168, 7170, 7172, 7174, 7176, 7178, 7180, 7182, 7184, 7186, 7188, 7190,
+	  7192, 7194, 7196, 7198, 7200, 7202, 7204, 7206, 7208, 7210, 7212, 7214,
+	  7216, 7218, 7220, 7222, 7224, 7226, 7228, 7230, 7232, 7234, 7236, 7238,
+	  7240, 7242, 7244, 7246, 7248, 7250, 7252, 7254, 7256, 7258, 7260, 7262,
+	  7264, 7266, 7268, 7270, 7272, 7274, 7276, 7278, 7280, 7282, 7284, 7286,
+	  7288, 7290, 7292, 7294, 7296, 7298, 7300, 7302, 7304, 7306, 7308, 7310,
+	  7312, 7314, 7316, 7318, 7320, 7322, 7324, 7326, 7328, 7330, 7332, 7334,
+	  7336, 7338, 7340, 7342, 7344, 7346, 7348, 7350, 7352, 7354, 7356, 7358,
+	  7360, 7362, 7364, 7366, 7368, 7370, 7372, 7374, 7376, 7378, 7380, 7382,
+	  7384, 7386, 7388, 7390, 7392, 7394, 7396, 7398, 7400, 7402, 7404, 7406,
+	  7408, 7410, 7412, 7414, 7416, 7418, 7420, 7422, 7424, 7426, 7428, 7430,
+	  7432, 7434, 7436, 7438, 7440, 7442, 7444, 7446, 7448, 7450, 7452, 7454,
+	  7456, 7458, 7460, 7462, 7464, 7466, 7468, 7470, 7472, 7474, 7476, 7478,
+	  7480, 7482, 7484, 7486, 7488, 7490, 7492, 7494, 7496, 7498, 7500, 7502,
+	  7504, 7506, 7508, 7510, 7512, 7514, 7516, 7518, 7520, 7522, 7524, 7526,
+	  7528, 7530, 7532, 7534, 7536, 7538, 7540, 7542, 7544, 7546, 7548, 7550,
+	  7552, 7554, 7556, 7558, 7560, 7562, 7564, 7566, 7568, 7570, 7572, 7574,
+	  7576, 7578, 7580, 7582, 7584, 7586, 7588, 7590, 7592, 7594, 7596, 7598,
+	  7600, 7602, 7604, 7606, 7608, 7610, 7612, 0, 0, 7614, 0, 7616, 0, 0, 7618,
+	  7620, 7622, 7624, 7626, 7628, 7630, 7632, 7634, 7636, 0, 7638, 0, 7640, 0,
+	  0, 7642, 7644, 0, 0, 0, 7646, 7648, 7650, 7652, 7654, 7656, 7658, 7660,
+	  7662, 7664, 7666, 7668, 7670, 7672, 7674, 7676, 7678, 7680, 7682, 7684,
+	  7686, 7688, 7690, 7692, 7694, 7696, 7698, 7700, 7702, 7704, 7706, 7708,
+	  7710, 7712, 7714, 7716, 7718, 7720, 7722, 7724, 7726, 7728, 7730, 7732,
+	  7734, 7736, 7738, 7740, 7742, 7744, 7746, 7748, 7750, 7752, 7754, 7756,
+	  7758, 7760, 7762, 7764, 7766, 7768, 7770, 7772, 7774, 7776, 7778, 7781, 0,
+	  0, 7783, 7785, 7787, 7789, 7791, 7793, 7795, 7797, 7799, 7801, 7803, 7805,
+	  7807, 7809, 7811, 7813, 7815, 7817, 7819, 7821, 7823, 7825, 7827, 7829,
+	  7831, 7833, 7835, 7837, 7839, 7841, 7843, 7845, 7847, 7849, 7851, 7853,
+	  7855, 7857, 7859, 7861, 7863, 7865, 7867, 7869, 7871, 7873, 7875, 7877,
+	  7879, 7881, 7883, 7885, 7887, 7889, 7891, 7893, 7895, 7897, 7899, 7901,
+	  7903, 7905, 7907, 7909, 7911, 7913, 7915, 7917, 7919, 7921, 7923, 7925,
+	  7927, 7929, 7931, 7933, 7935, 7937, 7939, 7941, 7943, 7945, 7947, 7949,
+	  7951, 7953, 7955, 7957, 7959, 7961, 7963, 7965, 7967, 7969, 7971, 7973,
+	  7976, 7979, 7982, 7984, 7986, 7988, 7991, 7994, 7997, 7999, 0, 0, 0, 0, 0,
+	  0, 8001, 8004, 8007, 8010, 8014, 8018, 8021, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 8024, 8027, 8030, 8033, 8036, 0, 0, 0, 0, 0, 8039, 0, 8042, 8045,
+	  8047, 8049, 8051, 8053, 8055, 8057, 8059, 8061, 8063, 8065, 8068, 8071,
+	  8075, 8079, 8082, 8085, 8088, 8091, 8094, 8097, 8100, 8103, 0, 8106, 8109,
+	  8112, 8115, 8118, 0, 8121, 0, 8124, 8127, 0, 8130, 8133, 0, 8136, 8139,
+	  8142, 8145, 8148, 8151, 8154, 8157, 8160, 8163, 8166, 8168, 8170, 8172,
+	  8174, 8176, 8178, 8180, 8182, 8184, 8186, 8188, 8190, 8192, 8194, 8196,
+	  8198, 8200, 8202, 8204, 8206, 8208, 8210, 8212, 8214, 8216, 8218, 8220,
+	  8222, 8224, 8226, 8228, 8230, 8232, 8234, 8236, 8238, 8240, 8242, 8244,
+	  8246, 8248, 8250, 8252, 8254, 8256, 8258, 8260, 8262, 8264, 8266, 8268,
+	  8270, 8272, 8274, 8276, 8278, 8280, 8282, 8284, 8286, 8288, 8290, 8292,
+	  8294, 8296, 8298, 8300, 8302, 8304, 8306, 8308, 8310, 8312, 8314, 8316,
+	  8318, 8320, 8322, 8324, 8326, 8328, 8330, 8332, 8334, 8337, 8340, 8342,
+	  8344, 8346, 8348, 8350, 8352, 8354, 8356, 8358, 8360, 8363, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8366, 8368, 8370, 8372, 8374, 8376,
+	  8378, 8380, 8382, 8384, 8386, 8389, 8391, 8393, 8395, 8397, 8399, 8401,
+	  8403, 8405, 8407, 8409, 8411, 8413, 8417, 8421, 8425, 8429, 8433, 8437,
+	  8441, 8445, 8449, 8453, 8457, 8461, 8465, 8469, 8473, 8477, 8481, 8485,
+	  8487, 8489, 8491, 8493, 8497, 8501, 8505, 8509, 8513, 8516, 8519, 8522,
+	  8525, 8528, 8531, 8534, 8537, 8540, 8543, 8546, 8549, 8552, 8555, 8558,
+	  8561, 8564, 8567, 8570, 8573, 8576, 8579, 8582, 8585, 8588, 8591, 8594,
+	  8597, 8600, 8603, 8606, 8609, 8612, 8615, 8618, 8621, 8624, 8627, 8630,
+	  8633, 8636, 8639, 8642, 8645, 8648, 8651, 8654, 8657, 8660, 8663, 8666,
+	  8669, 8672, 8675, 8678, 8681, 8684, 8687, 8690, 8693, 8696, 8699, 8702,
+	  8705, 8708, 8711, 8714, 8717, 8720, 8723, 8726, 8729, 8732, 8735, 8738,
+	  8741, 8744, 8747, 8750, 8753, 8756, 8759, 8762, 8765, 8768, 8771, 8774,
+	  8777, 8780, 8784, 8788, 8792, 8796, 8800, 8804, 8808, 8812, 8816, 8820,
+	  8824, 8828, 8831, 8834, 8837, 8840, 8843, 8846, 8849, 8852, 8855, 8858,
+	  8861, 8864, 8867, 8870, 8873, 8876, 8879, 8882, 8885, 8888, 8891, 8894,
+	  8897, 8900, 8903, 8906, 8909, 8912, 8915, 8918, 8921, 8924, 8927, 8930,
+	  8933, 8936, 8939, 8942, 8945, 8948, 8951, 8954, 8957, 8960, 8963, 8967,
+	  8971, 8975, 8979, 8983, 8986, 8989, 8992, 8995, 8998, 9001, 9004, 9007,
+	  9010, 9013, 9016, 9019, 9022, 9025, 9028, 9031, 9034, 9037, 9040, 9043,
+	  9046, 9049, 9052, 9055, 9058, 9061, 9064, 9067, 9070, 9073, 9076, 9079,
+	  9082, 9085, 9088, 9091, 9094, 9097, 9100, 9103, 9106, 9109, 9112, 9115,
+	  9118, 9121, 9124, 9127, 9130, 9133, 9136, 9139, 9142, 9145, 9148, 9151,
+	  9154, 9157, 9160, 9163, 9166, 9169, 9172, 9175, 9178, 9181, 9184, 9188,
+	  9192, 9195, 9198, 9201, 9204, 9207, 9210, 9213, 9216, 9219, 9222, 9225,
+	  9228, 9231, 9234, 9237, 9240, 9243, 9247, 9251, 9255, 9258, 9261, 9264,
+	  9267, 9270, 9273, 9276, 9279, 9282, 9285, 9288, 9291, 9294, 9297, 9300,
+	  9303, 9306, 9309, 9312, 9315, 9318, 9321, 9324, 9327, 9330, 9333, 9336,
+	  9339, 9342, 9345, 9348, 9351, 9354, 9357, 9360, 9363, 9366, 9369, 9372,
+	  9375, 9378, 9381, 9384, 9387, 9390, 9393, 9396, 9399, 9402, 9405, 9408,
+	  9411, 9414, 9417, 9420, 9423, 9426, 9429, 9432, 9435, 9438, 9441, 9444,
+	  9447, 9450, 9453, 9456, 9459, 9462, 9465, 9468, 9471, 0, 0, 9474, 9478,
+	  9482, 9486, 9490, 9494, 9498, 9502, 9506, 9510, 9514, 9518, 9522, 9526,
+	  9530, 9534, 9538, 9542, 9546, 9550, 9554, 9558, 9562, 9566, 9570, 9574,
+	  9578, 9582, 9586, 9590, 9594, 9598, 9602, 9606, 9610, 9614, 9618, 9622,
+	  9626, 9630, 9634, 9638, 9642, 9646, 9650, 9654, 9658, 9662, 9666, 9670,
+	  9674, 9678, 9682, 9686, 9690, 9694, 9698, 9702, 9706, 9710, 9714, 9718,
+	  9722, 9726, 0, 0, 9730, 9734, 9738, 9742, 9746, 9750, 9754, 9758, 9762,
+	  9766, 9770, 9774, 9778, 9782, 9786, 9790, 9794, 9798, 9802, 9806, 9810,
+	  9814, 9818, 9822, 9826, 9830, 9834, 9838, 9842, 9846, 9850, 9854, 9858,
+	  9862, 9866, 9870, 9874, 9878, 9882, 9886, 9890, 9894, 9898, 9902, 9906,
+	  9910, 9914, 9918, 9922, 9926, 9930, 9934, 9938, 9942, 0, 0, 0, 0, 0, 0, 0,
+	  0, 9946, 9950, 9954, 9959, 9964, 9969, 9974, 9979, 9984, 9989, 9993, 10012,
+	  10021, 0, 0, 0, 10026, 10028, 10030, 10032, 10034, 10036, 10038, 10040,
+	  10042, 10044, 0, 0, 0, 0, 0, 0, 10048, 10051, 10053, 10055, 10057, 10059,
+	  10061, 10063, 10065, 10067, 10069, 10071, 10073, 10075, 10077, 10079,
+	  10081, 10083, 10085, 10087, 10089, 0, 0, 10091, 10093, 10095, 10098, 10101,
+	  10104, 10107, 10109, 10111, 10113, 10115, 10117, 0, 10119, 10121, 10123,
+	  10125, 10127, 10129, 10131, 10133, 10135, 10137, 10139, 10141, 10143,
+	  10145, 10147, 10149, 10151, 10153, 10155, 0, 10157, 10159, 10161, 10163, 0,
+	  0, 0, 0, 10165, 10168, 10171, 0, 10174, 0, 10177, 10180, 10183, 10186,
+	  10189, 10192, 10195, 10198, 10201, 10204, 10207, 10209, 10212, 10215,
+	  10218, 10221, 10224, 10227, 10230, 10233, 10236, 10239, 10242, 10245,
+	  10247, 10249, 10251, 10253, 10255, 10257, 10259, 10261, 10263, 10265,
+	  10267, 10269, 10271, 10273, 10275, 10277, 10279, 10281, 10283, 10285,
+	  10287, 10289, 10291, 10293, 10295, 10297, 10299, 10301, 10303, 10305,
+	  10307, 10309, 10311, 10313, 10315, 10317, 10319, 10321, 10323, 10325,
+	  10327, 10329, 10331, 10333, 10335, 10337, 10339, 10341, 10343, 10345,
+	  10347, 10349, 10351, 10353, 10355, 10357, 10359, 10361, 10363, 10365,
+	  10367, 10369, 10371, 10373, 10375, 10377, 10379, 10381, 10383, 10385,
+	  10387, 10389, 10391, 10393, 10395, 10397, 10399, 10401, 10403, 10405,
+	  10407, 10409, 10411, 10413, 10415, 10417, 10419, 10421, 10423, 10425,
+	  10427, 10429, 10431, 10433, 10435, 10437, 10439, 10441, 10443, 10445,
+	  10447, 10449, 10451, 10453, 10457, 10461, 10465, 10469, 10473, 10477,
+	  10480, 0, 0, 0, 0, 10483, 10485, 10487, 10489, 10491, 10493, 10495, 10497,
+	  10499, 10501, 10503, 10505, 10507, 10509, 10511, 10513, 10515, 10517,
+	  10519, 10521, 10523, 10525, 10527, 10529, 10531, 10533, 10535, 10537,
+	  10539, 10541, 10543, 10545, 10547, 10549, 10551, 10553, 10555, 10557,
+	  10559, 10561, 10563, 10565, 10567, 10569, 10571, 10573, 10575, 10577,
+	  10579, 10581, 10583, 10585, 10587, 10589, 10591, 10593, 10595, 10597,
+	  10599, 10601, 10603, 10605, 10607, 10609, 10611, 10613, 10615, 10617,
+	  10619, 10621, 10623, 10625, 10627, 10629, 10631, 10633, 10635, 10637,
+	  10639, 10641, 10643, 10645, 10647, 10649, 10651, 10653, 10655, 10657,
+	  10659, 10661, 10663, 10665, 10667, 10669, 10671, 10673, 10675, 10677,
+	  10679, 10681, 10683, 10685, 10687, 10689, 10691, 10693, 10695, 10697,
+	  10699, 10701, 10703, 10705, 10707, 10709, 10711, 10713, 10715, 10717,
+	  10719, 10721, 10723, 10725, 10727, 10729, 10731, 10733, 10735, 10737,
+	  10739, 10741, 10743, 10745, 10747, 10749, 10751, 10753, 10755, 10757,
+	  10759, 10761, 10763, 10765, 10767, 10769, 10771, 10773, 10775, 10777,
+	  10779, 10781, 10783, 10785, 10787, 10789, 10791, 10793, 10795, 10797,
+	  10799, 10801, 10803, 10805, 10807, 10809, 10811, 10813, 10815, 10817,
+	  10819, 10821, 10823, 10825, 10827, 10829, 10831, 10833, 10835, 10837,
+	  10839, 10841, 10843, 10845, 10847, 10849, 10851, 10853, 10855, 10857,
+	  10859, 10861, 0, 0, 0, 10863, 10865, 10867, 10869, 10871, 10873, 0, 0,
+	  10875, 10877, 10879, 10881, 10883, 10885, 0, 0, 10887, 10889, 10891, 10893,
+	  10895, 10897, 0, 0, 10899, 10901, 10903, 0, 0, 0, 10905, 10907, 10909,
+	  10911, 10914, 10916, 10918, 0, 10920, 10922, 10924, 10926, 10928, 10930,
+	  10932, 0, 0, 10934, 10936, 10938, 10940, 10942, 0, 10944, 10946, 10948,
+	  10950, 10952, 10954, 10956, 10958, 10960, 10962, 10964, 10966, 10968,
+	  10970, 10972, 10974, 10976, 10978, 10980, 10982, 10984, 10986, 10989,
+	  10991, 10993, 10996, 10998, 11001, 11003, 11005, 11007, 11009, 11011,
+	  11014, 11016, 11018, 11020, 11022, 11024, 11026, 11028, 11030, 0, 11032,
+	  11034, 11036, 11038, 11040, 11042, 11044, 11046, 11049, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 11052, 0, 11057, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 11062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  11067, 11072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11077, 11082, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 11087, 11092, 0, 11097, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 11102, 11107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11112, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11117, 11122, 11127,
+	  11134, 11141, 11148, 11155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 11162, 11167, 11172, 11179, 11186, 11193, 0, 0, 0, 0, 0,
+	  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11200, 11202, 11204, 11206, 11208, 11210,
+	  11212, 11214, 11216, 11218, 11220, 11222, 11224, 11226, 11228, 11230,
+	  11232, 11234, 11236, 11238, 11240, 11242, 11244, 11246, 11248, 11250,
+	  11252, 11254, 11256, 11258, 11260, 11262, 11264, 11266, 11268, 11270,
+	  11272, 11274, 11276, 11278, 11280, 11282, 11284, 11286, 11288, 11290,
+	  11292, 11294, 11296, 11298, 11300, 11302, 11304, 11306, 11308, 11310,
+	  11312, 11314, 11316, 11318, 11320, 11322, 11324, 11326, 11328, 11330,
+	  11332, 11334, 11336, 11338, 11340, 11342, 11344, 11346, 11348, 11350,
+	  11352, 11354, 11356, 11358, 11360, 11362, 11364, 11366, 11368, 0, 11370,
+	  11372, 11374, 11376, 11378, 11380, 11382, 11384, 11386, 11388, 11390,
+	  11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406, 11408, 11410,
+	  11412, 11414, 11416, 11418, 11420, 11422, 11424, 11426, 11428, 11430,
+	  11432, 11434, 11436, 11438, 11440, 11442, 11444, 11446, 11448, 11450,
+	  11452, 11454, 11456, 11458, 11460, 11462, 11464, 11466, 11468, 11470,
+	  11472, 11474, 11476, 11478, 11480, 11482, 11484, 11486, 11488, 11490,
+	  11492, 11494, 11496, 11498, 11500, 11502, 11504, 11506, 11508, 11510, 0,
+	  11512, 11514, 0, 0, 11516, 0, 0, 11518, 11520, 0, 0, 11522, 11524, 11526,
+	  11528, 0, 11530, 11532, 11534, 11536, 11538, 11540, 11542, 11544, 11546,
+	  11548, 11550, 11552, 0, 11554, 0, 11556, 11558, 11560, 11562, 11564, 11566,
+	  11568, 0, 11570, 11572, 11574, 11576, 11578, 11580, 11582, 11584, 11586,
+	  11588, 11590, 11592, 11594, 11596, 11598, 11600, 11602, 11604, 11606,
+	  11608, 11610, 11612, 11614, 11616, 11618, 11620, 11622, 11624, 11626,
+	  11628, 11630, 11632, 11634, 11636, 11638, 11640, 11642, 11644, 11646,
+	  11648, 11650, 11652, 11654, 11656, 11658, 11660, 11662, 11664, 11666,
+	  11668, 11670, 11672, 11674, 11676, 11678, 11680, 11682, 11684, 11686,
+	  11688, 11690, 11692, 11694, 11696, 11698, 0, 11700, 11702, 11704, 11706, 0,
+	  0, 11708, 11710, 11712, 11714, 11716, 11718, 11720, 11722, 0, 11724, 11726,
+	  11728, 11730, 11732, 11734, 11736, 0, 11738, 11740, 11742, 11744, 11746,
+	  11748, 11750, 11752, 11754, 11756, 11758, 11760, 11762, 11764, 11766,
+	  11768, 11770, 11772, 11774, 11776, 11778, 11780, 11782, 11784, 11786,
+	  11788, 11790, 11792, 0, 11794, 11796, 11798, 11800, 0, 11802, 11804, 11806,
+	  11808, 11810, 0, 11812, 0, 0, 0, 11814, 11816, 11818, 11820, 11822, 11824,
+	  11826, 0, 11828, 11830, 11832, 11834, 11836, 11838, 11840, 11842, 11844,
+	  11846, 11848, 11850, 11852, 11854, 11856, 11858, 11860, 11862, 11864,
+	  11866, 11868, 11870, 11872, 11874, 11876, 11878, 11880, 11882, 11884,
+	  11886, 11888, 11890, 11892, 11894, 11896, 11898, 11900, 11902, 11904,
+	  11906, 11908, 11910, 11912, 11914, 11916, 11918, 11920, 11922, 11924,
+	  11926, 11928, 11930, 11932, 11934, 11936, 11938, 11940, 11942, 11944,
+	  11946, 11948, 11950, 11952, 11954, 11956, 11958, 11960, 11962, 11964,
+	  11966, 11968, 11970, 11972, 11974, 11976, 11978, 11980, 11982, 11984,
+	  11986, 11988, 11990, 11992, 11994, 11996, 11998, 12000, 12002, 12004,
+	  12006, 12008, 12010, 12012, 12014, 12016, 12018, 12020, 12022, 12024,
+	  12026, 12028, 12030, 12032, 12034, 12036, 12038, 12040, 12042, 12044,
+	  12046, 12048, 12050, 12052, 12054, 12056, 12058, 12060, 12062, 12064,
+	  12066, 12068, 12070, 12072, 12074, 12076, 12078, 12080, 12082, 12084,
+	  12086, 12088, 12090, 12092, 12094, 12096, 12098, 12100, 12102, 12104,
+	  12106, 12108, 12110, 12112, 12114, 12116, 12118, 12120, 12122, 12124,
+	  12126, 12128, 12130, 12132, 12134, 12136, 12138, 12140, 12142, 12144,
+	  12146, 12148, 12150, 12152, 12154, 12156, 12158, 12160, 12162, 12164,
+	  12166, 12168, 12170, 12172, 12174, 12176, 12178, 12180, 12182, 12184,
+	  12186, 12188, 12190, 12192, 12194, 12196, 12198, 12200, 12202, 12204,
+	  12206, 12208, 12210, 12212, 12214, 12216, 12218, 12220, 12222, 12224,
+	  12226, 12228, 12230, 12232, 12234, 12236, 12238, 12240, 12242, 12244,
+	  12246, 12248, 12250, 12252, 12254, 12256, 12258, 12260, 12262, 12264,
+	  12266, 12268, 12270, 12272, 12274, 12276, 12278, 12280, 12282, 12284,
+	  12286, 12288, 12290, 12292, 12294, 12296, 12298, 12300, 12302, 12304,
+	  12306, 12308, 12310, 12312, 12314, 12316, 12318, 12320, 12322, 12324,
+	  12326, 12328, 12330, 12332, 12334, 12336, 12338, 12340, 12342, 12344,
+	  12346, 12348, 12350, 12352, 12354, 12356, 12358, 12360, 12362, 12364,
+	  12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380, 12382, 12384,
+	  12386, 12388, 12390, 12392, 12394, 12396, 12398, 12400, 12402, 12404,
+	  12406, 12408, 12410, 12412, 12414, 12416, 12418, 12420, 12422, 12424,
+	  12426, 12428, 12430, 12432, 12434, 12436, 12438, 12440, 12442, 12444,
+	  12446, 12448, 12450, 12452, 12454, 12456, 12458, 12460, 12462, 12464,
+	  12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12484,
+	  12486, 12488, 12490, 12492, 12494, 12496, 12498, 12500, 12502, 12504,
+	  12506, 0, 0, 12508, 12510, 12512, 12514, 12516, 12518, 12520, 12522, 12524,
+	  12526, 12528, 12530, 12532, 12534, 12536, 12538, 12540, 12542, 12544,
+	  12546, 12548, 12550, 12552, 12554, 12556, 12558, 12560, 12562, 12564,
+	  12566, 12568, 12570, 12572, 12574, 12576, 12578, 12580, 12582, 12584,
+	  12586, 12588, 12590, 12592, 12594, 12596, 12598, 12600, 12602, 12604,
+	  12606, 12608, 12610, 12612, 12614, 12616, 12618, 12620, 12622, 12624,
+	  12626, 12628, 12630, 12632, 12634, 12636, 12638, 12640, 12642, 12644,
+	  12646, 12648, 12650, 12652, 12654, 12656, 12658, 12660, 12662, 12664,
+	  12666, 12668, 12670, 12672, 12674, 12676, 12678, 12680, 12682, 12684,
+	  12686, 12688, 12690, 12692, 12694, 12696, 12698, 12700, 12702, 12704,
+	  12706, 12708, 12710, 12712, 12714, 12716, 12718, 12720, 12722, 12724,
+	  12726, 12728, 12730, 12732, 12734, 12736, 12738, 12740, 12742, 12744,
+	  12746, 12748, 12750, 12752, 12754, 12756, 12758, 12760, 12762, 12764,
+	  12766, 12768, 12770, 12772, 12774, 12776, 12778, 12780, 12782, 12784,
+	  12786, 12788, 12790, 12792, 12794, 12796, 12798, 12800, 12802, 12804,
+	  12806, 12808, 12810, 12812, 12814, 12816, 12818, 12820, 12822, 12824,
+	  12826, 12828, 12830, 12832, 12834, 12836, 12838, 12840, 12842, 12844,
+	  12846, 12848, 12850, 12852, 12854, 12856, 12858, 12860, 12862, 12864,
+	  12866, 12868, 12870, 12872, 12874, 12876, 12878, 12880, 12882, 12884,
+	  12886, 12888, 12890, 12892, 12894, 12896, 12898, 12900, 12902, 12904,
+	  12906, 12908, 12910, 12912, 12914, 12916, 12918, 12920, 12922, 12924,
+	  12926, 12928, 12930, 12932, 12934, 12936, 12938, 12940, 12942, 12944,
+	  12946, 12948, 12950, 12952, 12954, 12956, 12958, 12960, 12962, 12964,
+	  12966, 12968, 12970, 12972, 12974, 12976, 12978, 12980, 12982, 12984,
+	  12986, 12988, 12990, 12992, 12994, 12996, 12998, 13000, 13002, 13004,
+	  13006, 13008, 13010, 13012, 13014, 13016, 13018, 13020, 13022, 13024,
+	  13026, 13028, 13030, 13032, 13034, 13036, 13038, 13040, 13042, 13044,
+	  13046, 13048, 13050, 13052, 13054, 13056, 13058, 13060, 13062, 13064,
+	  13066, 13068, 13070, 13072, 13074, 13076, 13078, 13080, 13082, 13084,
+	  13086, 13088, 13090, 0, 0, 13092, 13094, 13096, 13098, 13100, 13102, 13104,
+	  13106, 13108, 13110, 13112, 13114, 13116, 13118, 13120, 13122, 13124,
+	  13126, 13128, 13130, 13132, 13134, 13136, 13138, 13140, 13142, 13144,
+	  13146, 13148, 13150, 13152, 13154, 13156, 13158, 13160, 13162, 13164,
+	  13166, 13168, 13170, 13172, 13174, 13176, 13178, 13180, 13182, 13184,
+	  13186, 13188, 13190, 13192, 13194, 13196, 13198, 0, 13200, 13202, 13204,
+	  13206, 13208, 13210, 13212, 13214, 13216, 13218, 13220, 13222, 13224,
+	  13226, 13228, 13230, 13232, 13234, 13236, 13238, 13240, 13242, 13244,
+	  13246, 13248, 13250, 13252, 0, 13254, 13256, 0, 13258, 0, 0, 13260, 0,
+	  13262, 13264, 13266, 13268, 13270, 13272, 13274, 13276, 13278, 13280, 0,
+	  13282, 13284, 13286, 13288, 0, 13290, 0, 13292, 0, 0, 0, 0, 0, 0, 13294, 0,
+	  0, 0, 0, 13296, 0, 13298, 0, 13300, 0, 13302, 13304, 13306, 0, 13308,
+	  13310, 0, 13312, 0, 0, 13314, 0, 13316, 0, 13318, 0, 13320, 0, 13322, 0,
+	  13324, 13326, 0, 13328, 0, 0, 13330, 13332, 13334, 13336, 0, 13338, 13340,
+	  13342, 13344, 13346, 13348, 13350, 0, 13352, 13354, 13356, 13358, 0, 13360,
+	  13362, 13364, 13366, 0, 13368, 0, 13370, 13372, 13374, 13376, 13378, 13380,
+	  13382, 13384, 13386, 13388, 0, 13390, 13392, 13394, 13396, 13398, 13400,
+	  13402, 13404, 13406, 13408, 13410, 13412, 13414, 13416, 13418, 13420,
+	  13422, 0, 0, 0, 0, 0, 13424, 13426, 13428, 0, 13430, 13432, 13434, 13436,
+	  13438, 0, 13440, 13442, 13444, 13446, 13448, 13450, 13452, 13454, 13456,
+	  13458, 13460, 13462, 13464, 13466, 13468, 13470, 13472, 0, 0, 0, 0, 13474,
+	  13477, 13480, 13483, 13486, 13489, 13492, 13495, 13498, 13501, 13504, 0, 0,
+	  0, 0, 0, 13507, 13511, 13515, 13519, 13523, 13527, 13531, 13535, 13539,
+	  13543, 13547, 13551, 13555, 13559, 13563, 13567, 13571, 13575, 13579,
+	  13583, 13587, 13591, 13595, 13599, 13603, 13607, 13611, 13615, 13617,
+	  13619, 13622, 0, 13625, 13627, 13629, 13631, 13633, 13635, 13637, 13639,
+	  13641, 13643, 13645, 13647, 13649, 13651, 13653, 13655, 13657, 13659,
+	  13661, 13663, 13665, 13667, 13669, 13671, 13673, 13675, 13677, 13680,
+	  13683, 13686, 13689, 13693, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13696, 13699,
+	  13702, 0, 0, 0, 13705, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13708,
+	  13711, 13714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13716, 13718, 13720,
+	  13722, 13725, 13727, 13729, 13731, 13733, 13735, 13737, 13739, 13741,
+	  13743, 13745, 13747, 13749, 13751, 13753, 13755, 13757, 13759, 13761,
+	  13763, 13765, 13767, 13769, 13771, 13773, 13775, 13777, 13779, 13781,
+	  13783, 13785, 13787, 13789, 13791, 13793, 13795, 13797, 13799, 13801,
+	  13803, 0, 0, 0, 0, 13805, 13809, 13813, 13817, 13821, 13825, 13829, 13833,
+	  13837, 0, 0, 0, 0, 0, 0, 0, 13841, 13843, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	  0, 0, 0, 13845, 13847, 13849, 13851, 13853, 13855, 13857, 13859, 13861,
+	  13863, 0, 0, 0, 0, 0, 0, 13865, 13867, 13869, 13871, 13874, 13876, 13878,
+	  13880, 13882, 13884, 13886, 13888, 13890, 13892, 13895, 13897, 13899,
+	  13901, 13903, 13906, 13908, 13910, 13912, 13915, 13917, 13919, 13921,
+	  13923, 13925, 13928, 13930, 13932, 13934, 13936, 13938, 13940, 13942,
+	  13944, 13946, 13948, 13950, 13952, 13954, 13956, 13958, 13960, 13962,
+	  13964, 13966, 13968, 13970, 13972, 13974, 13977, 13979, 13981, 13983,
+	  13986, 13988, 13990, 13992, 13994, 13996, 13998, 14000, 14002, 14004,
+	  14006, 14008, 14010, 14012, 14014, 14016, 14018, 14020, 14022, 14024,
+	  14026, 14028, 14030, 14032, 14034, 14036, 14038, 14040, 14042, 14044,
+	  14046, 14048, 14050, 14053, 14055, 14057, 14059, 14061, 14063, 14065,
+	  14068, 14071, 14073, 14075, 14077, 14079, 14081, 14083, 14085, 14087,
+	  14089, 14091, 14094, 14096, 14098, 14100, 14102, 14105, 14107, 14109,
+	  14111, 14113, 14115, 14117, 14119, 14121, 14123, 14126, 14128, 14131,
+	  14133, 14135, 14137, 14139, 14141, 14143, 14145, 14147, 14149, 14151,
+	  14153, 14156, 14158, 14160, 14162, 14164, 14166, 14169, 14171, 14174,
+	  14177, 14179, 14181, 14183, 14185, 14188, 14191, 14193, 14195, 14197,
+	  14199, 14201, 14203, 14205, 14207, 14209, 14211, 14213, 14216, 14218,
+	  14220, 14222, 14224, 14226, 14228, 14230, 14232, 14234, 14236, 14238,
+	  14240, 14242, 14244, 14246, 14248, 14250, 14252, 14254, 14257, 14259,
+	  14261, 14263, 14265, 14267, 14270, 14272, 14274, 14276, 14278, 14280,
+	  14282, 14284, 14286, 14288, 14290, 14292, 14295, 14297, 14299, 14301,
+	  14303, 14305, 14307, 14309, 14311, 14313, 14315, 14317, 14319, 14321,
+	  14323, 14325, 14327, 14329, 14331, 14334, 14336, 14338, 14340, 14342,
+	  14344, 14347, 14349, 14351, 14353, 14355, 14357, 14359, 14361, 14363,
+	  14366, 14368, 14370, 14372, 14375, 14377, 14379, 14381, 14383, 14385,
+	  14387, 14390, 14393, 14396, 14398, 14401, 14403, 14405, 14407, 14409,
+	  14411, 14413, 14415, 14417, 14419, 14421, 14424, 14426, 14428, 14430,
+	  14432, 14434, 14436, 14439, 14441, 14443, 14446, 14449, 14451, 14453,
+	  14455, 14457, 14459, 14461, 14463, 14465, 14467, 14470, 14472, 14475,
+	  14477, 14480, 14482, 14484, 14486, 14489, 14491, 14493, 14496, 14499,
+	  14501, 14503, 14505, 14507, 14509, 14511, 14513, 14515, 14517, 14519,
+	  14521, 14523, 14525, 14528, 14530, 14533, 14535, 14538, 14540, 14543,
+	  14546, 14549, 14551, 14553, 14555, 14558, 14561, 14564, 14567, 14569,
+	  14571, 14573, 14575, 14577, 14579, 14581, 14583, 14586, 14588, 14590,
+	  14592, 14594, 14597, 14599, 14602, 14605, 14607, 14609, 14611, 14613,
+	  14615, 14617, 14620, 14623, 14626, 14628, 14630, 14633, 14635, 14637,
+	  14639, 14642, 14644, 14646, 14648, 14650, 14652, 14655, 14657, 14659,
+	  14661, 14663, 14665, 14667, 14670, 14673, 14675, 14678, 14680, 14683,
+	  14685, 14687, 14689, 14692, 14695, 14697, 14700, 14702, 14705, 14707,
+	  14709, 14711, 14713, 14715, 14717, 14720, 14723, 14726, 14729, 14731,
+	  14733, 14735, 14737, 14739, 14741, 14743, 14745, 14747, 14749, 14751,
+	  14753, 14756, 14758, 14760, 14762, 14764, 14766, 14768, 14770, 14772,
+	  14774, 14776, 14778, 14780, 14783, 14786, 14789, 14791, 14793, 14795,
+	  14797, 14800, 14802, 14805, 14807, 14809, 14812, 14815, 14817, 14819,
+	  14821, 14823, 14825, 14827, 14829, 14831, 14833, 14835, 14837, 14839,
+	  14841, 14843, 14845, 14847, 14849, 14851, 14853, 14856, 14858, 14860,
+	  14862, 14864, 14866, 14869, 14872, 14874, 14876, 14878, 14880, 14882,
+	  14884, 14887, 14889, 14891, 14893, 14895, 14898, 14901, 14903, 14905,
+	  14907, 14910, 14912, 14914, 14917, 14920, 14922, 14924, 14926, 14929,
+	  14931, 14933, 14935, 14937, 14939, 14941, 14943, 14946, 14948, 14950,
+	  14952, 14955, 14957, 14959, 14961, 14963, 14966, 14969, 14971, 14973,
+	  14975, 14978, 14980, 14983, 14985, 14987, 14989, 14992, 14994, 14996,
+	  14998, 15000, 15002, 15004, 15006, 15009, 15011, 15013, 15015, 15017,
+	  15019, 15021, 15024, 15026, 15029, 15032, 15035, 15037, 15039, 15041,
+	  15043, 15045, 15047, 15049, 15051, 0, 0 };
+
+	constexpr uint16_t decomposition_index( char32_t cp ) noexcept {
+		if( cp >= 0x110000U ) {
+			return 0;
+		}
+		unsigned const c = cp;
+		unsigned const mid = decomposition_index_stage1[c >> 10U];
+		unsigned const low =
+		  decomposition_index_stage2[( mid << 6U ) | ( ( c >> 4U ) & 63U )];
+		return decomposition_index_stage3[( low << 4U ) | ( c & 15U )];
+	}
+
+	/// The canonical decomposition in UTF-16 then the compatibility one
+	/// after a unit with their lengths, in the low and high byte.  A
+	/// compatibility length of 0 is the canonical decomposition
+	inline constexpr uint16_t decomposition_pool[15054] = {
+	  0, 256, 32, 512, 32, 776, 256, 97, 512, 32, 772, 256, 50, 256, 51, 512, 32,
+	  769, 256, 956, 512, 32, 807, 256, 49, 256, 111, 768, 49, 8260, 52, 768, 49,
+	  8260, 50, 768, 51, 8260, 52, 2, 65, 768, 2, 65, 769, 2, 65, 770, 2, 65,
+	  771, 2, 65, 776, 2, 65, 778, 2, 67, 807, 2, 69, 768, 2, 69, 769, 2, 69,
+	  770, 2, 69, 776, 2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776, 2, 78,
+	  771, 2, 79, 768, 2, 79, 769, 2, 79, 770, 2, 79, 771, 2, 79, 776, 2, 85,
+	  768, 2, 85, 769, 2, 85, 770, 2, 85, 776, 2, 89, 769, 2, 97, 768, 2, 97,
+	  769, 2, 97, 770, 2, 97, 771, 2, 97, 776, 2, 97, 778, 2, 99, 807, 2, 101,
+	  768, 2, 101, 769, 2, 101, 770, 2, 101, 776, 2, 105, 768, 2, 105, 769, 2,
+	  105, 770, 2, 105, 776, 2, 110, 771, 2, 111, 768, 2, 111, 769, 2, 111, 770,
+	  2, 111, 771, 2, 111, 776, 2, 117, 768, 2, 117, 769, 2, 117, 770, 2, 117,
+	  776, 2, 121, 769, 2, 121, 776, 2, 65, 772, 2, 97, 772, 2, 65, 774, 2, 97,
+	  774, 2, 65, 808, 2, 97, 808, 2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99,
+	  770, 2, 67, 775, 2, 99, 775, 2, 67, 780, 2, 99, 780, 2, 68, 780, 2, 100,
+	  780, 2, 69, 772, 2, 101, 772, 2, 69, 774, 2, 101, 774, 2, 69, 775, 2, 101,
+	  775, 2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780, 2, 71, 770, 2, 103,
+	  770, 2, 71, 774, 2, 103, 774, 2, 71, 775, 2, 103, 775, 2, 71, 807, 2, 103,
+	  807, 2, 72, 770, 2, 104, 770, 2, 73, 771, 2, 105, 771, 2, 73, 772, 2, 105,
+	  772, 2, 73, 774, 2, 105, 774, 2, 73, 808, 2, 105, 808, 2, 73, 775, 512, 73,
+	  74, 512, 105, 106, 2, 74, 770, 2, 106, 770, 2, 75, 807, 2, 107, 807, 2, 76,
+	  769, 2, 108, 769, 2, 76, 807, 2, 108, 807, 2, 76, 780, 2, 108, 780, 512,
+	  76, 183, 512, 108, 183, 2, 78, 769, 2, 110, 769, 2, 78, 807, 2, 110, 807,
+	  2, 78, 780, 2, 110, 780, 512, 700, 110, 2, 79, 772, 2, 111, 772, 2, 79,
+	  774, 2, 111, 774, 2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769, 2, 82,
+	  807, 2, 114, 807, 2, 82, 780, 2, 114, 780, 2, 83, 769, 2, 115, 769, 2, 83,
+	  770, 2, 115, 770, 2, 83, 807, 2, 115, 807, 2, 83, 780, 2, 115, 780, 2, 84,
+	  807, 2, 116, 807, 2, 84, 780, 2, 116, 780, 2, 85, 771, 2, 117, 771, 2, 85,
+	  772, 2, 117, 772, 2, 85, 774, 2, 117, 774, 2, 85, 778, 2, 117, 778, 2, 85,
+	  779, 2, 117, 779, 2, 85, 808, 2, 117, 808, 2, 87, 770, 2, 119, 770, 2, 89,
+	  770, 2, 121, 770, 2, 89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775, 2, 122,
+	  775, 2, 90, 780, 2, 122, 780, 256, 115, 2, 79, 795, 2, 111, 795, 2, 85,
+	  795, 2, 117, 795, 768, 68, 90, 780, 768, 68, 122, 780, 768, 100, 122, 780,
+	  512, 76, 74, 512, 76, 106, 512, 108, 106, 512, 78, 74, 512, 78, 106, 512,
+	  110, 106, 2, 65, 780, 2, 97, 780, 2, 73, 780, 2, 105, 780, 2, 79, 780, 2,
+	  111, 780, 2, 85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776, 772, 3,
+	  85, 776, 769, 3, 117, 776, 769, 3, 85, 776, 780, 3, 117, 776, 780, 3, 85,
+	  776, 768, 3, 117, 776, 768, 3, 65, 776, 772, 3, 97, 776, 772, 3, 65, 775,
+	  772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2, 71, 780, 2, 103, 780, 2,
+	  75, 780, 2, 107, 780, 2, 79, 808, 2, 111, 808, 3, 79, 808, 772, 3, 111,
+	  808, 772, 2, 439, 780, 2, 658, 780, 2, 106, 780, 512, 68, 90, 512, 68, 122,
+	  512, 100, 122, 2, 71, 769, 2, 103, 769, 2, 78, 768, 2, 110, 768, 3, 65,
+	  778, 769, 3, 97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216, 769, 2, 248,
+	  769, 2, 65, 783, 2, 97, 783, 2, 65, 785, 2, 97, 785, 2, 69, 783, 2, 101,
+	  783, 2, 69, 785, 2, 101, 785, 2, 73, 783, 2, 105, 783, 2, 73, 785, 2, 105,
+	  785, 2, 79, 783, 2, 111, 783, 2, 79, 785, 2, 111, 785, 2, 82, 783, 2, 114,
+	  783, 2, 82, 785, 2, 114, 785, 2, 85, 783, 2, 117, 783, 2, 85, 785, 2, 117,
+	  785, 2, 83, 806, 2, 115, 806, 2, 84, 806, 2, 116, 806, 2, 72, 780, 2, 104,
+	  780, 2, 65, 775, 2, 97, 775, 2, 69, 807, 2, 101, 807, 3, 79, 776, 772, 3,
+	  111, 776, 772, 3, 79, 771, 772, 3, 111, 771, 772, 2, 79, 775, 2, 111, 775,
+	  3, 79, 775, 772, 3, 111, 775, 772, 2, 89, 772, 2, 121, 772, 256, 104, 256,
+	  614, 256, 106, 256, 114, 256, 633, 256, 635, 256, 641, 256, 119, 256, 121,
+	  512, 32, 774, 512, 32, 775, 512, 32, 778, 512, 32, 808, 512, 32, 771, 512,
+	  32, 779, 256, 611, 256, 108, 256, 115, 256, 120, 256, 661, 1, 768, 1, 769,
+	  1, 787, 2, 776, 769, 1, 697, 512, 32, 837, 1, 59, 512, 32, 769, 770, 168,
+	  769, 32, 776, 769, 2, 913, 769, 1, 183, 2, 917, 769, 2, 919, 769, 2, 921,
+	  769, 2, 927, 769, 2, 933, 769, 2, 937, 769, 3, 953, 776, 769, 2, 921, 776,
+	  2, 933, 776, 2, 945, 769, 2, 949, 769, 2, 951, 769, 2, 953, 769, 3, 965,
+	  776, 769, 2, 953, 776, 2, 965, 776, 2, 959, 769, 2, 965, 769, 2, 969, 769,
+	  256, 946, 256, 952, 256, 933, 514, 978, 769, 933, 769, 514, 978, 776, 933,
+	  776, 256, 966, 256, 960, 256, 954, 256, 961, 256, 962, 256, 920, 256, 949,
+	  256, 931, 2, 1045, 768, 2, 1045, 776, 2, 1043, 769, 2, 1030, 776, 2, 1050,
+	  769, 2, 1048, 768, 2, 1059, 774, 2, 1048, 774, 2, 1080, 774, 2, 1077, 768,
+	  2, 1077, 776, 2, 1075, 769, 2, 1110, 776, 2, 1082, 769, 2, 1080, 768, 2,
+	  1091, 774, 2, 1140, 783, 2, 1141, 783, 2, 1046, 774, 2, 1078, 774, 2, 1040,
+	  774, 2, 1072, 774, 2, 1040, 776, 2, 1072, 776, 2, 1045, 774, 2, 1077, 774,
+	  2, 1240, 776, 2, 1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2,
+	  1079, 776, 2, 1048, 772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776, 2, 1054,
+	  776, 2, 1086, 776, 2, 1256, 776, 2, 1257, 776, 2, 1069, 776, 2, 1101, 776,
+	  2, 1059, 772, 2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059, 779, 2,
+	  1091, 779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776, 512,
+	  1381, 1410, 2, 1575, 1619, 2, 1575, 1620, 2, 1608, 1620, 2, 1575, 1621, 2,
+	  1610, 1620, 512, 1575, 1652, 512, 1608, 1652, 512, 1735, 1652, 512, 1610,
+	  1652, 2, 1749, 1620, 2, 1729, 1620, 2, 1746, 1620, 2, 2344, 2364, 2, 2352,
+	  2364, 2, 2355, 2364, 2, 2325, 2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332,
+	  2364, 2, 2337, 2364, 2, 2338, 2364, 2, 2347, 2364, 2, 2351, 2364, 2, 2503,
+	  2494, 2, 2503, 2519, 2, 2465, 2492, 2, 2466, 2492, 2, 2479, 2492, 2, 2610,
+	  2620, 2, 2616, 2620, 2, 2582, 2620, 2, 2583, 2620, 2, 2588, 2620, 2, 2603,
+	  2620, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903, 2, 2849, 2876, 2, 2850,
+	  2876, 2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2, 3014, 3031, 2, 3142,
+	  3158, 2, 3263, 3285, 2, 3270, 3285, 2, 3270, 3286, 2, 3270, 3266, 3, 3270,
+	  3266, 3285, 2, 3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545, 3530, 2,
+	  3545, 3535, 3, 3545, 3535, 3530, 2, 3545, 3551, 512, 3661, 3634, 512, 3789,
+	  3762, 512, 3755, 3737, 512, 3755, 3745, 256, 3851, 2, 3906, 4023, 2, 3916,
+	  4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931, 4023, 2, 3904, 4021, 2, 3953,
+	  3954, 2, 3953, 3956, 2, 4018, 3968, 768, 4018, 3953, 3968, 2, 4019, 3968,
+	  768, 4019, 3953, 3968, 2, 3953, 3968, 2, 3986, 4023, 2, 3996, 4023, 2,
+	  4001, 4023, 2, 4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133, 4142,
+	  256, 4316, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2, 6923, 6965, 2,
+	  6925, 6965, 2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2, 6974, 6965, 2,
+	  6975, 6965, 2, 6978, 6965, 256, 65, 256, 198, 256, 66, 256, 68, 256, 69,
+	  256, 398, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+	  256, 78, 256, 79, 256, 546, 256, 80, 256, 82, 256, 84, 256, 85, 256, 87,
+	  256, 97, 256, 592, 256, 593, 256, 7426, 256, 98, 256, 100, 256, 101, 256,
+	  601, 256, 603, 256, 604, 256, 103, 256, 107, 256, 109, 256, 331, 256, 111,
+	  256, 596, 256, 7446, 256, 7447, 256, 112, 256, 116, 256, 117, 256, 7453,
+	  256, 623, 256, 118, 256, 7461, 256, 946, 256, 947, 256, 948, 256, 966, 256,
+	  967, 256, 105, 256, 114, 256, 117, 256, 118, 256, 946, 256, 947, 256, 961,
+	  256, 966, 256, 967, 256, 1085, 256, 594, 256, 99, 256, 597, 256, 240, 256,
+	  604, 256, 102, 256, 607, 256, 609, 256, 613, 256, 616, 256, 617, 256, 618,
+	  256, 7547, 256, 669, 256, 621, 256, 7557, 256, 671, 256, 625, 256, 624,
+	  256, 626, 256, 627, 256, 628, 256, 629, 256, 632, 256, 642, 256, 643, 256,
+	  427, 256, 649, 256, 650, 256, 7452, 256, 651, 256, 652, 256, 122, 256, 656,
+	  256, 657, 256, 658, 256, 952, 2, 65, 805, 2, 97, 805, 2, 66, 775, 2, 98,
+	  775, 2, 66, 803, 2, 98, 803, 2, 66, 817, 2, 98, 817, 3, 67, 807, 769, 3,
+	  99, 807, 769, 2, 68, 775, 2, 100, 775, 2, 68, 803, 2, 100, 803, 2, 68, 817,
+	  2, 100, 817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100, 813, 3, 69, 772,
+	  768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101, 772, 769, 2, 69, 813, 2,
+	  101, 813, 2, 69, 816, 2, 101, 816, 3, 69, 807, 774, 3, 101, 807, 774, 2,
+	  70, 775, 2, 102, 775, 2, 71, 772, 2, 103, 772, 2, 72, 775, 2, 104, 775, 2,
+	  72, 803, 2, 104, 803, 2, 72, 776, 2, 104, 776, 2, 72, 807, 2, 104, 807, 2,
+	  72, 814, 2, 104, 814, 2, 73, 816, 2, 105, 816, 3, 73, 776, 769, 3, 105,
+	  776, 769, 2, 75, 769, 2, 107, 769, 2, 75, 803, 2, 107, 803, 2, 75, 817, 2,
+	  107, 817, 2, 76, 803, 2, 108, 803, 3, 76, 803, 772, 3, 108, 803, 772, 2,
+	  76, 817, 2, 108, 817, 2, 76, 813, 2, 108, 813, 2, 77, 769, 2, 109, 769, 2,
+	  77, 775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2, 110, 775, 2,
+	  78, 803, 2, 110, 803, 2, 78, 817, 2, 110, 817, 2, 78, 813, 2, 110, 813, 3,
+	  79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3, 111, 771, 776, 3, 79,
+	  772, 768, 3, 111, 772, 768, 3, 79, 772, 769, 3, 111, 772, 769, 2, 80, 769,
+	  2, 112, 769, 2, 80, 775, 2, 112, 775, 2, 82, 775, 2, 114, 775, 2, 82, 803,
+	  2, 114, 803, 3, 82, 803, 772, 3, 114, 803, 772, 2, 82, 817, 2, 114, 817, 2,
+	  83, 775, 2, 115, 775, 2, 83, 803, 2, 115, 803, 3, 83, 769, 775, 3, 115,
+	  769, 775, 3, 83, 780, 775, 3, 115, 780, 775, 3, 83, 803, 775, 3, 115, 803,
+	  775, 2, 84, 775, 2, 116, 775, 2, 84, 803, 2, 116, 803, 2, 84, 817, 2, 116,
+	  817, 2, 84, 813, 2, 116, 813, 2, 85, 804, 2, 117, 804, 2, 85, 816, 2, 117,
+	  816, 2, 85, 813, 2, 117, 813, 3, 85, 771, 769, 3, 117, 771, 769, 3, 85,
+	  772, 776, 3, 117, 772, 776, 2, 86, 771, 2, 118, 771, 2, 86, 803, 2, 118,
+	  803, 2, 87, 768, 2, 119, 768, 2, 87, 769, 2, 119, 769, 2, 87, 776, 2, 119,
+	  776, 2, 87, 775, 2, 119, 775, 2, 87, 803, 2, 119, 803, 2, 88, 775, 2, 120,
+	  775, 2, 88, 776, 2, 120, 776, 2, 89, 775, 2, 121, 775, 2, 90, 770, 2, 122,
+	  770, 2, 90, 803, 2, 122, 803, 2, 90, 817, 2, 122, 817, 2, 104, 817, 2, 116,
+	  776, 2, 119, 778, 2, 121, 778, 512, 97, 702, 514, 383, 775, 115, 775, 2,
+	  65, 803, 2, 97, 803, 2, 65, 777, 2, 97, 777, 3, 65, 770, 769, 3, 97, 770,
+	  769, 3, 65, 770, 768, 3, 97, 770, 768, 3, 65, 770, 777, 3, 97, 770, 777, 3,
+	  65, 770, 771, 3, 97, 770, 771, 3, 65, 803, 770, 3, 97, 803, 770, 3, 65,
+	  774, 769, 3, 97, 774, 769, 3, 65, 774, 768, 3, 97, 774, 768, 3, 65, 774,
+	  777, 3, 97, 774, 777, 3, 65, 774, 771, 3, 97, 774, 771, 3, 65, 803, 774, 3,
+	  97, 803, 774, 2, 69, 803, 2, 101, 803, 2, 69, 777, 2, 101, 777, 2, 69, 771,
+	  2, 101, 771, 3, 69, 770, 769, 3, 101, 770, 769, 3, 69, 770, 768, 3, 101,
+	  770, 768, 3, 69, 770, 777, 3, 101, 770, 777, 3, 69, 770, 771, 3, 101, 770,
+	  771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73, 777, 2, 105, 777, 2, 73,
+	  803, 2, 105, 803, 2, 79, 803, 2, 111, 803, 2, 79, 777, 2, 111, 777, 3, 79,
+	  770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111, 770, 768, 3, 79, 770,
+	  777, 3, 111, 770, 777, 3, 79, 770, 771, 3, 111, 770, 771, 3, 79, 803, 770,
+	  3, 111, 803, 770, 3, 79, 795, 769, 3, 111, 795, 769, 3, 79, 795, 768, 3,
+	  111, 795, 768, 3, 79, 795, 777, 3, 111, 795, 777, 3, 79, 795, 771, 3, 111,
+	  795, 771, 3, 79, 795, 803, 3, 111, 795, 803, 2, 85, 803, 2, 117, 803, 2,
+	  85, 777, 2, 117, 777, 3, 85, 795, 769, 3, 117, 795, 769, 3, 85, 795, 768,
+	  3, 117, 795, 768, 3, 85, 795, 777, 3, 117, 795, 777, 3, 85, 795, 771, 3,
+	  117, 795, 771, 3, 85, 795, 803, 3, 117, 795, 803, 2, 89, 768, 2, 121, 768,
+	  2, 89, 803, 2, 121, 803, 2, 89, 777, 2, 121, 777, 2, 89, 771, 2, 121, 771,
+	  2, 945, 787, 2, 945, 788, 3, 945, 787, 768, 3, 945, 788, 768, 3, 945, 787,
+	  769, 3, 945, 788, 769, 3, 945, 787, 834, 3, 945, 788, 834, 2, 913, 787, 2,
+	  913, 788, 3, 913, 787, 768, 3, 913, 788, 768, 3, 913, 787, 769, 3, 913,
+	  788, 769, 3, 913, 787, 834, 3, 913, 788, 834, 2, 949, 787, 2, 949, 788, 3,
+	  949, 787, 768, 3, 949, 788, 768, 3, 949, 787, 769, 3, 949, 788, 769, 2,
+	  917, 787, 2, 917, 788, 3, 917, 787, 768, 3, 917, 788, 768, 3, 917, 787,
+	  769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788, 3, 951, 787, 768, 3, 951,
+	  788, 768, 3, 951, 787, 769, 3, 951, 788, 769, 3, 951, 787, 834, 3, 951,
+	  788, 834, 2, 919, 787, 2, 919, 788, 3, 919, 787, 768, 3, 919, 788, 768, 3,
+	  919, 787, 769, 3, 919, 788, 769, 3, 919, 787, 834, 3, 919, 788, 834, 2,
+	  953, 787, 2, 953, 788, 3, 953, 787, 768, 3, 953, 788, 768, 3, 953, 787,
+	  769, 3, 953, 788, 769, 3, 953, 787, 834, 3, 953, 788, 834, 2, 921, 787, 2,
+	  921, 788, 3, 921, 787, 768, 3, 921, 788, 768, 3, 921, 787, 769, 3, 921,
+	  788, 769, 3, 921, 787, 834, 3, 921, 788, 834, 2, 959, 787, 2, 959, 788, 3,
+	  959, 787, 768, 3, 959, 788, 768, 3, 959, 787, 769, 3, 959, 788, 769, 2,
+	  927, 787, 2, 927, 788, 3, 927, 787, 768, 3, 927, 788, 768, 3, 927, 787,
+	  769, 3, 927, 788, 769, 2, 965, 787, 2, 965, 788, 3, 965, 787, 768, 3, 965,
+	  788, 768, 3, 965, 787, 769, 3, 965, 788, 769, 3, 965, 787, 834, 3, 965,
+	  788, 834, 2, 933, 788, 3, 933, 788, 768, 3, 933, 788, 769, 3, 933, 788,
+	  834, 2, 969, 787, 2, 969, 788, 3, 969, 787, 768, 3, 969, 788, 768, 3, 969,
+	  787, 769, 3, 969, 788, 769, 3, 969, 787, 834, 3, 969, 788, 834, 2, 937,
+	  787, 2, 937, 788, 3, 937, 787, 768, 3, 937, 788, 768, 3, 937, 787, 769, 3,
+	  937, 788, 769, 3, 937, 787, 834, 3, 937, 788, 834, 2, 945, 768, 2, 945,
+	  769, 2, 949, 768, 2, 949, 769, 2, 951, 768, 2, 951, 769, 2, 953, 768, 2,
+	  953, 769, 2, 959, 768, 2, 959, 769, 2, 965, 768, 2, 965, 769, 2, 969, 768,
+	  2, 969, 769, 3, 945, 787, 837, 3, 945, 788, 837, 4, 945, 787, 768, 837, 4,
+	  945, 788, 768, 837, 4, 945, 787, 769, 837, 4, 945, 788, 769, 837, 4, 945,
+	  787, 834, 837, 4, 945, 788, 834, 837, 3, 913, 787, 837, 3, 913, 788, 837,
+	  4, 913, 787, 768, 837, 4, 913, 788, 768, 837, 4, 913, 787, 769, 837, 4,
+	  913, 788, 769, 837, 4, 913, 787, 834, 837, 4, 913, 788, 834, 837, 3, 951,
+	  787, 837, 3, 951, 788, 837, 4, 951, 787, 768, 837, 4, 951, 788, 768, 837,
+	  4, 951, 787, 769, 837, 4, 951, 788, 769, 837, 4, 951, 787, 834, 837, 4,
+	  951, 788, 834, 837, 3, 919, 787, 837, 3, 919, 788, 837, 4, 919, 787, 768,
+	  837, 4, 919, 788, 768, 837, 4, 919, 787, 769, 837, 4, 919, 788, 769, 837,
+	  4, 919, 787, 834, 837, 4, 919, 788, 834, 837, 3, 969, 787, 837, 3, 969,
+	  788, 837, 4, 969, 787, 768, 837, 4, 969, 788, 768, 837, 4, 969, 787, 769,
+	  837, 4, 969, 788, 769, 837, 4, 969, 787, 834, 837, 4, 969, 788, 834, 837,
+	  3, 937, 787, 837, 3, 937, 788, 837, 4, 937, 787, 768, 837, 4, 937, 788,
+	  768, 837, 4, 937, 787, 769, 837, 4, 937, 788, 769, 837, 4, 937, 787, 834,
+	  837, 4, 937, 788, 834, 837, 2, 945, 774, 2, 945, 772, 3, 945, 768, 837, 2,
+	  945, 837, 3, 945, 769, 837, 2, 945, 834, 3, 945, 834, 837, 2, 913, 774, 2,
+	  913, 772, 2, 913, 768, 2, 913, 769, 2, 913, 837, 512, 32, 787, 1, 953, 512,
+	  32, 787, 512, 32, 834, 770, 168, 834, 32, 776, 834, 3, 951, 768, 837, 2,
+	  951, 837, 3, 951, 769, 837, 2, 951, 834, 3, 951, 834, 837, 2, 917, 768, 2,
+	  917, 769, 2, 919, 768, 2, 919, 769, 2, 919, 837, 770, 8127, 768, 32, 787,
+	  768, 770, 8127, 769, 32, 787, 769, 770, 8127, 834, 32, 787, 834, 2, 953,
+	  774, 2, 953, 772, 3, 953, 776, 768, 3, 953, 776, 769, 2, 953, 834, 3, 953,
+	  776, 834, 2, 921, 774, 2, 921, 772, 2, 921, 768, 2, 921, 769, 770, 8190,
+	  768, 32, 788, 768, 770, 8190, 769, 32, 788, 769, 770, 8190, 834, 32, 788,
+	  834, 2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 3, 965, 776, 769, 2, 961,
+	  787, 2, 961, 788, 2, 965, 834, 3, 965, 776, 834, 2, 933, 774, 2, 933, 772,
+	  2, 933, 768, 2, 933, 769, 2, 929, 788, 770, 168, 768, 32, 776, 768, 770,
+	  168, 769, 32, 776, 769, 1, 96, 3, 969, 768, 837, 2, 969, 837, 3, 969, 769,
+	  837, 2, 969, 834, 3, 969, 834, 837, 2, 927, 768, 2, 927, 769, 2, 937, 768,
+	  2, 937, 769, 2, 937, 837, 513, 180, 32, 769, 512, 32, 788, 257, 8194, 32,
+	  257, 8195, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256, 32, 256,
+	  32, 256, 32, 256, 32, 256, 8208, 512, 32, 819, 256, 46, 512, 46, 46, 768,
+	  46, 46, 46, 256, 32, 512, 8242, 8242, 768, 8242, 8242, 8242, 512, 8245,
+	  8245, 768, 8245, 8245, 8245, 512, 33, 33, 512, 32, 773, 512, 63, 63, 512,
+	  63, 33, 512, 33, 63, 1024, 8242, 8242, 8242, 8242, 256, 32, 256, 48, 256,
+	  105, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 43, 256,
+	  8722, 256, 61, 256, 40, 256, 41, 256, 110, 256, 48, 256, 49, 256, 50, 256,
+	  51, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 43, 256,
+	  8722, 256, 61, 256, 40, 256, 41, 256, 97, 256, 101, 256, 111, 256, 120,
+	  256, 601, 256, 104, 256, 107, 256, 108, 256, 109, 256, 110, 256, 112, 256,
+	  115, 256, 116, 512, 82, 115, 768, 97, 47, 99, 768, 97, 47, 115, 256, 67,
+	  512, 176, 67, 768, 99, 47, 111, 768, 99, 47, 117, 256, 400, 512, 176, 70,
+	  256, 103, 256, 72, 256, 72, 256, 72, 256, 104, 256, 295, 256, 73, 256, 73,
+	  256, 76, 256, 108, 256, 78, 512, 78, 111, 256, 80, 256, 81, 256, 82, 256,
+	  82, 256, 82, 512, 83, 77, 768, 84, 69, 76, 512, 84, 77, 256, 90, 1, 937,
+	  256, 90, 1, 75, 2, 65, 778, 256, 66, 256, 67, 256, 101, 256, 69, 256, 70,
+	  256, 77, 256, 111, 256, 1488, 256, 1489, 256, 1490, 256, 1491, 256, 105,
+	  768, 70, 65, 88, 256, 960, 256, 947, 256, 915, 256, 928, 256, 8721, 256,
+	  68, 256, 100, 256, 101, 256, 105, 256, 106, 768, 49, 8260, 55, 768, 49,
+	  8260, 57, 1024, 49, 8260, 49, 48, 768, 49, 8260, 51, 768, 50, 8260, 51,
+	  768, 49, 8260, 53, 768, 50, 8260, 53, 768, 51, 8260, 53, 768, 52, 8260, 53,
+	  768, 49, 8260, 54, 768, 53, 8260, 54, 768, 49, 8260, 56, 768, 51, 8260, 56,
+	  768, 53, 8260, 56, 768, 55, 8260, 56, 512, 49, 8260, 256, 73, 512, 73, 73,
+	  768, 73, 73, 73, 512, 73, 86, 256, 86, 512, 86, 73, 768, 86, 73, 73, 1024,
+	  86, 73, 73, 73, 512, 73, 88, 256, 88, 512, 88, 73, 768, 88, 73, 73, 256,
+	  76, 256, 67, 256, 68, 256, 77, 256, 105, 512, 105, 105, 768, 105, 105, 105,
+	  512, 105, 118, 256, 118, 512, 118, 105, 768, 118, 105, 105, 1024, 118, 105,
+	  105, 105, 512, 105, 120, 256, 120, 512, 120, 105, 768, 120, 105, 105, 256,
+	  108, 256, 99, 256, 100, 256, 109, 768, 48, 8260, 51, 2, 8592, 824, 2, 8594,
+	  824, 2, 8596, 824, 2, 8656, 824, 2, 8660, 824, 2, 8658, 824, 2, 8707, 824,
+	  2, 8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741, 824, 512, 8747, 8747,
+	  768, 8747, 8747, 8747, 512, 8750, 8750, 768, 8750, 8750, 8750, 2, 8764,
+	  824, 2, 8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824, 2, 8801, 824, 2,
+	  8781, 824, 2, 60, 824, 2, 62, 824, 2, 8804, 824, 2, 8805, 824, 2, 8818,
+	  824, 2, 8819, 824, 2, 8822, 824, 2, 8823, 824, 2, 8826, 824, 2, 8827, 824,
+	  2, 8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824, 2, 8866, 824, 2,
+	  8872, 824, 2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2, 8829, 824, 2, 8849,
+	  824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824, 2, 8884, 824, 2, 8885, 824,
+	  1, 12296, 1, 12297, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256, 54,
+	  256, 55, 256, 56, 256, 57, 512, 49, 48, 512, 49, 49, 512, 49, 50, 512, 49,
+	  51, 512, 49, 52, 512, 49, 53, 512, 49, 54, 512, 49, 55, 512, 49, 56, 512,
+	  49, 57, 512, 50, 48, 768, 40, 49, 41, 768, 40, 50, 41, 768, 40, 51, 41,
+	  768, 40, 52, 41, 768, 40, 53, 41, 768, 40, 54, 41, 768, 40, 55, 41, 768,
+	  40, 56, 41, 768, 40, 57, 41, 1024, 40, 49, 48, 41, 1024, 40, 49, 49, 41,
+	  1024, 40, 49, 50, 41, 1024, 40, 49, 51, 41, 1024, 40, 49, 52, 41, 1024, 40,
+	  49, 53, 41, 1024, 40, 49, 54, 41, 1024, 40, 49, 55, 41, 1024, 40, 49, 56,
+	  41, 1024, 40, 49, 57, 41, 1024, 40, 50, 48, 41, 512, 49, 46, 512, 50, 46,
+	  512, 51, 46, 512, 52, 46, 512, 53, 46, 512, 54, 46, 512, 55, 46, 512, 56,
+	  46, 512, 57, 46, 768, 49, 48, 46, 768, 49, 49, 46, 768, 49, 50, 46, 768,
+	  49, 51, 46, 768, 49, 52, 46, 768, 49, 53, 46, 768, 49, 54, 46, 768, 49, 55,
+	  46, 768, 49, 56, 46, 768, 49, 57, 46, 768, 50, 48, 46, 768, 40, 97, 41,
+	  768, 40, 98, 41, 768, 40, 99, 41, 768, 40, 100, 41, 768, 40, 101, 41, 768,
+	  40, 102, 41, 768, 40, 103, 41, 768, 40, 104, 41, 768, 40, 105, 41, 768, 40,
+	  106, 41, 768, 40, 107, 41, 768, 40, 108, 41, 768, 40, 109, 41, 768, 40,
+	  110, 41, 768, 40, 111, 41, 768, 40, 112, 41, 768, 40, 113, 41, 768, 40,
+	  114, 41, 768, 40, 115, 41, 768, 40, 116, 41, 768, 40, 117, 41, 768, 40,
+	  118, 41, 768, 40, 119, 41, 768, 40, 120, 41, 768, 40, 121, 41, 768, 40,
+	  122, 41, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71,
+	  256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+	  256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+	  256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 48, 1024,
+	  8747, 8747, 8747, 8747, 768, 58, 58, 61, 512, 61, 61, 768, 61, 61, 61, 2,
+	  10973, 824, 256, 106, 256, 86, 256, 11617, 256, 27597, 256, 40863, 256,
+	  19968, 256, 20008, 256, 20022, 256, 20031, 256, 20057, 256, 20101, 256,
+	  20108, 256, 20128, 256, 20154, 256, 20799, 256, 20837, 256, 20843, 256,
+	  20866, 256, 20886, 256, 20907, 256, 20960, 256, 20981, 256, 20992, 256,
+	  21147, 256, 21241, 256, 21269, 256, 21274, 256, 21304, 256, 21313, 256,
+	  21340, 256, 21353, 256, 21378, 256, 21430, 256, 21448, 256, 21475, 256,
+	  22231, 256, 22303, 256, 22763, 256, 22786, 256, 22794, 256, 22805, 256,
+	  22823, 256, 22899, 256, 23376, 256, 23424, 256, 23544, 256, 23567, 256,
+	  23586, 256, 23608, 256, 23662, 256, 23665, 256, 24027, 256, 24037, 256,
+	  24049, 256, 24062, 256, 24178, 256, 24186, 256, 24191, 256, 24308, 256,
+	  24318, 256, 24331, 256, 24339, 256, 24400, 256, 24417, 256, 24435, 256,
+	  24515, 256, 25096, 256, 25142, 256, 25163, 256, 25903, 256, 25908, 256,
+	  25991, 256, 26007, 256, 26020, 256, 26041, 256, 26080, 256, 26085, 256,
+	  26352, 256, 26376, 256, 26408, 256, 27424, 256, 27490, 256, 27513, 256,
+	  27571, 256, 27595, 256, 27604, 256, 27611, 256, 27663, 256, 27668, 256,
+	  27700, 256, 28779, 256, 29226, 256, 29238, 256, 29243, 256, 29247, 256,
+	  29255, 256, 29273, 256, 29275, 256, 29356, 256, 29572, 256, 29577, 256,
+	  29916, 256, 29926, 256, 29976, 256, 29983, 256, 29992, 256, 30000, 256,
+	  30091, 256, 30098, 256, 30326, 256, 30333, 256, 30382, 256, 30399, 256,
+	  30446, 256, 30683, 256, 30690, 256, 30707, 256, 31034, 256, 31160, 256,
+	  31166, 256, 31348, 256, 31435, 256, 31481, 256, 31859, 256, 31992, 256,
+	  32566, 256, 32593, 256, 32650, 256, 32701, 256, 32769, 256, 32780, 256,
+	  32786, 256, 32819, 256, 32895, 256, 32905, 256, 33251, 256, 33258, 256,
+	  33267, 256, 33276, 256, 33292, 256, 33307, 256, 33311, 256, 33390, 256,
+	  33394, 256, 33400, 256, 34381, 256, 34411, 256, 34880, 256, 34892, 256,
+	  34915, 256, 35198, 256, 35211, 256, 35282, 256, 35328, 256, 35895, 256,
+	  35910, 256, 35925, 256, 35960, 256, 35997, 256, 36196, 256, 36208, 256,
+	  36275, 256, 36523, 256, 36554, 256, 36763, 256, 36784, 256, 36789, 256,
+	  37009, 256, 37193, 256, 37318, 256, 37324, 256, 37329, 256, 38263, 256,
+	  38272, 256, 38428, 256, 38582, 256, 38585, 256, 38632, 256, 38737, 256,
+	  38750, 256, 38754, 256, 38761, 256, 38859, 256, 38893, 256, 38899, 256,
+	  38913, 256, 39080, 256, 39131, 256, 39135, 256, 39318, 256, 39321, 256,
+	  39340, 256, 39592, 256, 39640, 256, 39647, 256, 39717, 256, 39727, 256,
+	  39730, 256, 39740, 256, 39770, 256, 40165, 256, 40565, 256, 40575, 256,
+	  40613, 256, 40635, 256, 40643, 256, 40653, 256, 40657, 256, 40697, 256,
+	  40701, 256, 40718, 256, 40723, 256, 40736, 256, 40763, 256, 40778, 256,
+	  40786, 256, 40845, 256, 40860, 256, 40864, 256, 32, 256, 12306, 256, 21313,
+	  256, 21316, 256, 21317, 2, 12363, 12441, 2, 12365, 12441, 2, 12367, 12441,
+	  2, 12369, 12441, 2, 12371, 12441, 2, 12373, 12441, 2, 12375, 12441, 2,
+	  12377, 12441, 2, 12379, 12441, 2, 12381, 12441, 2, 12383, 12441, 2, 12385,
+	  12441, 2, 12388, 12441, 2, 12390, 12441, 2, 12392, 12441, 2, 12399, 12441,
+	  2, 12399, 12442, 2, 12402, 12441, 2, 12402, 12442, 2, 12405, 12441, 2,
+	  12405, 12442, 2, 12408, 12441, 2, 12408, 12442, 2, 12411, 12441, 2, 12411,
+	  12442, 2, 12358, 12441, 512, 32, 12441, 512, 32, 12442, 2, 12445, 12441,
+	  512, 12424, 12426, 2, 12459, 12441, 2, 12461, 12441, 2, 12463, 12441, 2,
+	  12465, 12441, 2, 12467, 12441, 2, 12469, 12441, 2, 12471, 12441, 2, 12473,
+	  12441, 2, 12475, 12441, 2, 12477, 12441, 2, 12479, 12441, 2, 12481, 12441,
+	  2, 12484, 12441, 2, 12486, 12441, 2, 12488, 12441, 2, 12495, 12441, 2,
+	  12495, 12442, 2, 12498, 12441, 2, 12498, 12442, 2, 12501, 12441, 2, 12501,
+	  12442, 2, 12504, 12441, 2, 12504, 12442, 2, 12507, 12441, 2, 12507, 12442,
+	  2, 12454, 12441, 2, 12527, 12441, 2, 12528, 12441, 2, 12529, 12441, 2,
+	  12530, 12441, 2, 12541, 12441, 512, 12467, 12488, 256, 4352, 256, 4353,
+	  256, 4522, 256, 4354, 256, 4524, 256, 4525, 256, 4355, 256, 4356, 256,
+	  4357, 256, 4528, 256, 4529, 256, 4530, 256, 4531, 256, 4532, 256, 4533,
+	  256, 4378, 256, 4358, 256, 4359, 256, 4360, 256, 4385, 256, 4361, 256,
+	  4362, 256, 4363, 256, 4364, 256, 4365, 256, 4366, 256, 4367, 256, 4368,
+	  256, 4369, 256, 4370, 256, 4449, 256, 4450, 256, 4451, 256, 4452, 256,
+	  4453, 256, 4454, 256, 4455, 256, 4456, 256, 4457, 256, 4458, 256, 4459,
+	  256, 4460, 256, 4461, 256, 4462, 256, 4463, 256, 4464, 256, 4465, 256,
+	  4466, 256, 4467, 256, 4468, 256, 4469, 256, 4448, 256, 4372, 256, 4373,
+	  256, 4551, 256, 4552, 256, 4556, 256, 4558, 256, 4563, 256, 4567, 256,
+	  4569, 256, 4380, 256, 4573, 256, 4575, 256, 4381, 256, 4382, 256, 4384,
+	  256, 4386, 256, 4387, 256, 4391, 256, 4393, 256, 4395, 256, 4396, 256,
+	  4397, 256, 4398, 256, 4399, 256, 4402, 256, 4406, 256, 4416, 256, 4423,
+	  256, 4428, 256, 4593, 256, 4594, 256, 4439, 256, 4440, 256, 4441, 256,
+	  4484, 256, 4485, 256, 4488, 256, 4497, 256, 4498, 256, 4500, 256, 4510,
+	  256, 4513, 256, 19968, 256, 20108, 256, 19977, 256, 22235, 256, 19978, 256,
+	  20013, 256, 19979, 256, 30002, 256, 20057, 256, 19993, 256, 19969, 256,
+	  22825, 256, 22320, 256, 20154, 768, 40, 4352, 41, 768, 40, 4354, 41, 768,
+	  40, 4355, 41, 768, 40, 4357, 41, 768, 40, 4358, 41, 768, 40, 4359, 41, 768,
+	  40, 4361, 41, 768, 40, 4363, 41, 768, 40, 4364, 41, 768, 40, 4366, 41, 768,
+	  40, 4367, 41, 768, 40, 4368, 41, 768, 40, 4369, 41, 768, 40, 4370, 41,
+	  1024, 40, 4352, 4449, 41, 1024, 40, 4354, 4449, 41, 1024, 40, 4355, 4449,
+	  41, 1024, 40, 4357, 4449, 41, 1024, 40, 4358, 4449, 41, 1024, 40, 4359,
+	  4449, 41, 1024, 40, 4361, 4449, 41, 1024, 40, 4363, 4449, 41, 1024, 40,
+	  4364, 4449, 41, 1024, 40, 4366, 4449, 41, 1024, 40, 4367, 4449, 41, 1024,
+	  40, 4368, 4449, 41, 1024, 40, 4369, 4449, 41, 1024, 40, 4370, 4449, 41,
+	  1024, 40, 4364, 4462, 41, 1792, 40, 4363, 4457, 4364, 4453, 4523, 41, 1536,
+	  40, 4363, 4457, 4370, 4462, 41, 768, 40, 19968, 41, 768, 40, 20108, 41,
+	  768, 40, 19977, 41, 768, 40, 22235, 41, 768, 40, 20116, 41, 768, 40, 20845,
+	  41, 768, 40, 19971, 41, 768, 40, 20843, 41, 768, 40, 20061, 41, 768, 40,
+	  21313, 41, 768, 40, 26376, 41, 768, 40, 28779, 41, 768, 40, 27700, 41, 768,
+	  40, 26408, 41, 768, 40, 37329, 41, 768, 40, 22303, 41, 768, 40, 26085, 41,
+	  768, 40, 26666, 41, 768, 40, 26377, 41, 768, 40, 31038, 41, 768, 40, 21517,
+	  41, 768, 40, 29305, 41, 768, 40, 36001, 41, 768, 40, 31069, 41, 768, 40,
+	  21172, 41, 768, 40, 20195, 41, 768, 40, 21628, 41, 768, 40, 23398, 41, 768,
+	  40, 30435, 41, 768, 40, 20225, 41, 768, 40, 36039, 41, 768, 40, 21332, 41,
+	  768, 40, 31085, 41, 768, 40, 20241, 41, 768, 40, 33258, 41, 768, 40, 33267,
+	  41, 256, 21839, 256, 24188, 256, 25991, 256, 31631, 768, 80, 84, 69, 512,
+	  50, 49, 512, 50, 50, 512, 50, 51, 512, 50, 52, 512, 50, 53, 512, 50, 54,
+	  512, 50, 55, 512, 50, 56, 512, 50, 57, 512, 51, 48, 512, 51, 49, 512, 51,
+	  50, 512, 51, 51, 512, 51, 52, 512, 51, 53, 256, 4352, 256, 4354, 256, 4355,
+	  256, 4357, 256, 4358, 256, 4359, 256, 4361, 256, 4363, 256, 4364, 256,
+	  4366, 256, 4367, 256, 4368, 256, 4369, 256, 4370, 512, 4352, 4449, 512,
+	  4354, 4449, 512, 4355, 4449, 512, 4357, 4449, 512, 4358, 4449, 512, 4359,
+	  4449, 512, 4361, 4449, 512, 4363, 4449, 512, 4364, 4449, 512, 4366, 4449,
+	  512, 4367, 4449, 512, 4368, 4449, 512, 4369, 4449, 512, 4370, 4449, 1280,
+	  4366, 4449, 4535, 4352, 4457, 1024, 4364, 4462, 4363, 4468, 512, 4363,
+	  4462, 256, 19968, 256, 20108, 256, 19977, 256, 22235, 256, 20116, 256,
+	  20845, 256, 19971, 256, 20843, 256, 20061, 256, 21313, 256, 26376, 256,
+	  28779, 256, 27700, 256, 26408, 256, 37329, 256, 22303, 256, 26085, 256,
+	  26666, 256, 26377, 256, 31038, 256, 21517, 256, 29305, 256, 36001, 256,
+	  31069, 256, 21172, 256, 31192, 256, 30007, 256, 22899, 256, 36969, 256,
+	  20778, 256, 21360, 256, 27880, 256, 38917, 256, 20241, 256, 20889, 256,
+	  27491, 256, 19978, 256, 20013, 256, 19979, 256, 24038, 256, 21491, 256,
+	  21307, 256, 23447, 256, 23398, 256, 30435, 256, 20225, 256, 36039, 256,
+	  21332, 256, 22812, 512, 51, 54, 512, 51, 55, 512, 51, 56, 512, 51, 57, 512,
+	  52, 48, 512, 52, 49, 512, 52, 50, 512, 52, 51, 512, 52, 52, 512, 52, 53,
+	  512, 52, 54, 512, 52, 55, 512, 52, 56, 512, 52, 57, 512, 53, 48, 512, 49,
+	  26376, 512, 50, 26376, 512, 51, 26376, 512, 52, 26376, 512, 53, 26376, 512,
+	  54, 26376, 512, 55, 26376, 512, 56, 26376, 512, 57, 26376, 768, 49, 48,
+	  26376, 768, 49, 49, 26376, 768, 49, 50, 26376, 512, 72, 103, 768, 101, 114,
+	  103, 512, 101, 86, 768, 76, 84, 68, 256, 12450, 256, 12452, 256, 12454,
+	  256, 12456, 256, 12458, 256, 12459, 256, 12461, 256, 12463, 256, 12465,
+	  256, 12467, 256, 12469, 256, 12471, 256, 12473, 256, 12475, 256, 12477,
+	  256, 12479, 256, 12481, 256, 12484, 256, 12486, 256, 12488, 256, 12490,
+	  256, 12491, 256, 12492, 256, 12493, 256, 12494, 256, 12495, 256, 12498,
+	  256, 12501, 256, 12504, 256, 12507, 256, 12510, 256, 12511, 256, 12512,
+	  256, 12513, 256, 12514, 256, 12516, 256, 12518, 256, 12520, 256, 12521,
+	  256, 12522, 256, 12523, 256, 12524, 256, 12525, 256, 12527, 256, 12528,
+	  256, 12529, 256, 12530, 512, 20196, 21644, 1280, 12450, 12495, 12442,
+	  12540, 12488, 1024, 12450, 12523, 12501, 12449, 1280, 12450, 12531, 12504,
+	  12442, 12450, 768, 12450, 12540, 12523, 1280, 12452, 12491, 12531, 12463,
+	  12441, 768, 12452, 12531, 12481, 768, 12454, 12457, 12531, 1536, 12456,
+	  12473, 12463, 12540, 12488, 12441, 1024, 12456, 12540, 12459, 12540, 768,
+	  12458, 12531, 12473, 768, 12458, 12540, 12512, 768, 12459, 12452, 12522,
+	  1024, 12459, 12521, 12483, 12488, 1024, 12459, 12525, 12522, 12540, 1024,
+	  12459, 12441, 12525, 12531, 1024, 12459, 12441, 12531, 12510, 1024, 12461,
+	  12441, 12459, 12441, 1024, 12461, 12441, 12491, 12540, 1024, 12461, 12517,
+	  12522, 12540, 1536, 12461, 12441, 12523, 12479, 12441, 12540, 512, 12461,
+	  12525, 1536, 12461, 12525, 12463, 12441, 12521, 12512, 1536, 12461, 12525,
+	  12513, 12540, 12488, 12523, 1280, 12461, 12525, 12527, 12483, 12488, 1024,
+	  12463, 12441, 12521, 12512, 1536, 12463, 12441, 12521, 12512, 12488, 12531,
+	  1536, 12463, 12523, 12475, 12441, 12452, 12525, 1024, 12463, 12525, 12540,
+	  12493, 768, 12465, 12540, 12473, 768, 12467, 12523, 12490, 1024, 12467,
+	  12540, 12507, 12442, 1024, 12469, 12452, 12463, 12523, 1280, 12469, 12531,
+	  12481, 12540, 12512, 1280, 12471, 12522, 12531, 12463, 12441, 768, 12475,
+	  12531, 12481, 768, 12475, 12531, 12488, 1024, 12479, 12441, 12540, 12473,
+	  768, 12486, 12441, 12471, 768, 12488, 12441, 12523, 512, 12488, 12531, 512,
+	  12490, 12494, 768, 12494, 12483, 12488, 768, 12495, 12452, 12484, 1536,
+	  12495, 12442, 12540, 12475, 12531, 12488, 1024, 12495, 12442, 12540, 12484,
+	  1280, 12495, 12441, 12540, 12524, 12523, 1536, 12498, 12442, 12450, 12473,
+	  12488, 12523, 1024, 12498, 12442, 12463, 12523, 768, 12498, 12442, 12467,
+	  768, 12498, 12441, 12523, 1536, 12501, 12449, 12521, 12483, 12488, 12441,
+	  1024, 12501, 12451, 12540, 12488, 1536, 12501, 12441, 12483, 12471, 12455,
+	  12523, 768, 12501, 12521, 12531, 1280, 12504, 12463, 12479, 12540, 12523,
+	  768, 12504, 12442, 12477, 1024, 12504, 12442, 12491, 12498, 768, 12504,
+	  12523, 12484, 1024, 12504, 12442, 12531, 12473, 1280, 12504, 12442, 12540,
+	  12471, 12441, 1024, 12504, 12441, 12540, 12479, 1280, 12507, 12442, 12452,
+	  12531, 12488, 1024, 12507, 12441, 12523, 12488, 512, 12507, 12531, 1280,
+	  12507, 12442, 12531, 12488, 12441, 768, 12507, 12540, 12523, 768, 12507,
+	  12540, 12531, 1024, 12510, 12452, 12463, 12525, 768, 12510, 12452, 12523,
+	  768, 12510, 12483, 12495, 768, 12510, 12523, 12463, 1280, 12510, 12531,
+	  12471, 12519, 12531, 1024, 12511, 12463, 12525, 12531, 512, 12511, 12522,
+	  1536, 12511, 12522, 12495, 12441, 12540, 12523, 768, 12513, 12459, 12441,
+	  1280, 12513, 12459, 12441, 12488, 12531, 1024, 12513, 12540, 12488, 12523,
+	  1024, 12516, 12540, 12488, 12441, 768, 12516, 12540, 12523, 768, 12518,
+	  12450, 12531, 1024, 12522, 12483, 12488, 12523, 512, 12522, 12521, 1024,
+	  12523, 12498, 12442, 12540, 1280, 12523, 12540, 12501, 12441, 12523, 512,
+	  12524, 12512, 1536, 12524, 12531, 12488, 12465, 12441, 12531, 768, 12527,
+	  12483, 12488, 512, 48, 28857, 512, 49, 28857, 512, 50, 28857, 512, 51,
+	  28857, 512, 52, 28857, 512, 53, 28857, 512, 54, 28857, 512, 55, 28857, 512,
+	  56, 28857, 512, 57, 28857, 768, 49, 48, 28857, 768, 49, 49, 28857, 768, 49,
+	  50, 28857, 768, 49, 51, 28857, 768, 49, 52, 28857, 768, 49, 53, 28857, 768,
+	  49, 54, 28857, 768, 49, 55, 28857, 768, 49, 56, 28857, 768, 49, 57, 28857,
+	  768, 50, 48, 28857, 768, 50, 49, 28857, 768, 50, 50, 28857, 768, 50, 51,
+	  28857, 768, 50, 52, 28857, 768, 104, 80, 97, 512, 100, 97, 512, 65, 85,
+	  768, 98, 97, 114, 512, 111, 86, 512, 112, 99, 512, 100, 109, 768, 100, 109,
+	  50, 768, 100, 109, 51, 512, 73, 85, 512, 24179, 25104, 512, 26157, 21644,
+	  512, 22823, 27491, 512, 26126, 27835, 1024, 26666, 24335, 20250, 31038,
+	  512, 112, 65, 512, 110, 65, 512, 956, 65, 512, 109, 65, 512, 107, 65, 512,
+	  75, 66, 512, 77, 66, 512, 71, 66, 768, 99, 97, 108, 1024, 107, 99, 97, 108,
+	  512, 112, 70, 512, 110, 70, 512, 956, 70, 512, 956, 103, 512, 109, 103,
+	  512, 107, 103, 512, 72, 122, 768, 107, 72, 122, 768, 77, 72, 122, 768, 71,
+	  72, 122, 768, 84, 72, 122, 512, 956, 108, 512, 109, 108, 512, 100, 108,
+	  512, 107, 108, 512, 102, 109, 512, 110, 109, 512, 956, 109, 512, 109, 109,
+	  512, 99, 109, 512, 107, 109, 768, 109, 109, 50, 768, 99, 109, 50, 512, 109,
+	  50, 768, 107, 109, 50, 768, 109, 109, 51, 768, 99, 109, 51, 512, 109, 51,
+	  768, 107, 109, 51, 768, 109, 8725, 115, 1024, 109, 8725, 115, 50, 512, 80,
+	  97, 768, 107, 80, 97, 768, 77, 80, 97, 768, 71, 80, 97, 768, 114, 97, 100,
+	  1280, 114, 97, 100, 8725, 115, 1536, 114, 97, 100, 8725, 115, 50, 512, 112,
+	  115, 512, 110, 115, 512, 956, 115, 512, 109, 115, 512, 112, 86, 512, 110,
+	  86, 512, 956, 86, 512, 109, 86, 512, 107, 86, 512, 77, 86, 512, 112, 87,
+	  512, 110, 87, 512, 956, 87, 512, 109, 87, 512, 107, 87, 512, 77, 87, 512,
+	  107, 937, 512, 77, 937, 1024, 97, 46, 109, 46, 512, 66, 113, 512, 99, 99,
+	  512, 99, 100, 1024, 67, 8725, 107, 103, 768, 67, 111, 46, 512, 100, 66,
+	  512, 71, 121, 512, 104, 97, 512, 72, 80, 512, 105, 110, 512, 75, 75, 512,
+	  75, 77, 512, 107, 116, 512, 108, 109, 512, 108, 110, 768, 108, 111, 103,
+	  512, 108, 120, 512, 109, 98, 768, 109, 105, 108, 768, 109, 111, 108, 512,
+	  80, 72, 1024, 112, 46, 109, 46, 768, 80, 80, 77, 512, 80, 82, 512, 115,
+	  114, 512, 83, 118, 512, 87, 98, 768, 86, 8725, 109, 768, 65, 8725, 109,
+	  512, 49, 26085, 512, 50, 26085, 512, 51, 26085, 512, 52, 26085, 512, 53,
+	  26085, 512, 54, 26085, 512, 55, 26085, 512, 56, 26085, 512, 57, 26085, 768,
+	  49, 48, 26085, 768, 49, 49, 26085, 768, 49, 50, 26085, 768, 49, 51, 26085,
+	  768, 49, 52, 26085, 768, 49, 53, 26085, 768, 49, 54, 26085, 768, 49, 55,
+	  26085, 768, 49, 56, 26085, 768, 49, 57, 26085, 768, 50, 48, 26085, 768, 50,
+	  49, 26085, 768, 50, 50, 26085, 768, 50, 51, 26085, 768, 50, 52, 26085, 768,
+	  50, 53, 26085, 768, 50, 54, 26085, 768, 50, 55, 26085, 768, 50, 56, 26085,
+	  768, 50, 57, 26085, 768, 51, 48, 26085, 768, 51, 49, 26085, 768, 103, 97,
+	  108, 256, 1098, 256, 1100, 256, 42863, 256, 67, 256, 70, 256, 81, 256, 294,
+	  256, 339, 256, 42791, 256, 43831, 256, 619, 256, 43858, 256, 653, 1, 35912,
+	  1, 26356, 1, 36554, 1, 36040, 1, 28369, 1, 20018, 1, 21477, 1, 40860, 1,
+	  40860, 1, 22865, 1, 37329, 1, 21895, 1, 22856, 1, 25078, 1, 30313, 1,
+	  32645, 1, 34367, 1, 34746, 1, 35064, 1, 37007, 1, 27138, 1, 27931, 1,
+	  28889, 1, 29662, 1, 33853, 1, 37226, 1, 39409, 1, 20098, 1, 21365, 1,
+	  27396, 1, 29211, 1, 34349, 1, 40478, 1, 23888, 1, 28651, 1, 34253, 1,
+	  35172, 1, 25289, 1, 33240, 1, 34847, 1, 24266, 1, 26391, 1, 28010, 1,
+	  29436, 1, 37070, 1, 20358, 1, 20919, 1, 21214, 1, 25796, 1, 27347, 1,
+	  29200, 1, 30439, 1, 32769, 1, 34310, 1, 34396, 1, 36335, 1, 38706, 1,
+	  39791, 1, 40442, 1, 30860, 1, 31103, 1, 32160, 1, 33737, 1, 37636, 1,
+	  40575, 1, 35542, 1, 22751, 1, 24324, 1, 31840, 1, 32894, 1, 29282, 1,
+	  30922, 1, 36034, 1, 38647, 1, 22744, 1, 23650, 1, 27155, 1, 28122, 1,
+	  28431, 1, 32047, 1, 32311, 1, 38475, 1, 21202, 1, 32907, 1, 20956, 1,
+	  20940, 1, 31260, 1, 32190, 1, 33777, 1, 38517, 1, 35712, 1, 25295, 1,
+	  27138, 1, 35582, 1, 20025, 1, 23527, 1, 24594, 1, 29575, 1, 30064, 1,
+	  21271, 1, 30971, 1, 20415, 1, 24489, 1, 19981, 1, 27852, 1, 25976, 1,
+	  32034, 1, 21443, 1, 22622, 1, 30465, 1, 33865, 1, 35498, 1, 27578, 1,
+	  36784, 1, 27784, 1, 25342, 1, 33509, 1, 25504, 1, 30053, 1, 20142, 1,
+	  20841, 1, 20937, 1, 26753, 1, 31975, 1, 33391, 1, 35538, 1, 37327, 1,
+	  21237, 1, 21570, 1, 22899, 1, 24300, 1, 26053, 1, 28670, 1, 31018, 1,
+	  38317, 1, 39530, 1, 40599, 1, 40654, 1, 21147, 1, 26310, 1, 27511, 1,
+	  36706, 1, 24180, 1, 24976, 1, 25088, 1, 25754, 1, 28451, 1, 29001, 1,
+	  29833, 1, 31178, 1, 32244, 1, 32879, 1, 36646, 1, 34030, 1, 36899, 1,
+	  37706, 1, 21015, 1, 21155, 1, 21693, 1, 28872, 1, 35010, 1, 35498, 1,
+	  24265, 1, 24565, 1, 25467, 1, 27566, 1, 31806, 1, 29557, 1, 20196, 1,
+	  22265, 1, 23527, 1, 23994, 1, 24604, 1, 29618, 1, 29801, 1, 32666, 1,
+	  32838, 1, 37428, 1, 38646, 1, 38728, 1, 38936, 1, 20363, 1, 31150, 1,
+	  37300, 1, 38584, 1, 24801, 1, 20102, 1, 20698, 1, 23534, 1, 23615, 1,
+	  26009, 1, 27138, 1, 29134, 1, 30274, 1, 34044, 1, 36988, 1, 40845, 1,
+	  26248, 1, 38446, 1, 21129, 1, 26491, 1, 26611, 1, 27969, 1, 28316, 1,
+	  29705, 1, 30041, 1, 30827, 1, 32016, 1, 39006, 1, 20845, 1, 25134, 1,
+	  38520, 1, 20523, 1, 23833, 1, 28138, 1, 36650, 1, 24459, 1, 24900, 1,
+	  26647, 1, 29575, 1, 38534, 1, 21033, 1, 21519, 1, 23653, 1, 26131, 1,
+	  26446, 1, 26792, 1, 27877, 1, 29702, 1, 30178, 1, 32633, 1, 35023, 1,
+	  35041, 1, 37324, 1, 38626, 1, 21311, 1, 28346, 1, 21533, 1, 29136, 1,
+	  29848, 1, 34298, 1, 38563, 1, 40023, 1, 40607, 1, 26519, 1, 28107, 1,
+	  33256, 1, 31435, 1, 31520, 1, 31890, 1, 29376, 1, 28825, 1, 35672, 1,
+	  20160, 1, 33590, 1, 21050, 1, 20999, 1, 24230, 1, 25299, 1, 31958, 1,
+	  23429, 1, 27934, 1, 26292, 1, 36667, 1, 34892, 1, 38477, 1, 35211, 1,
+	  24275, 1, 20800, 1, 21952, 1, 22618, 1, 26228, 1, 20958, 1, 29482, 1,
+	  30410, 1, 31036, 1, 31070, 1, 31077, 1, 31119, 1, 38742, 1, 31934, 1,
+	  32701, 1, 34322, 1, 35576, 1, 36920, 1, 37117, 1, 39151, 1, 39164, 1,
+	  39208, 1, 40372, 1, 37086, 1, 38583, 1, 20398, 1, 20711, 1, 20813, 1,
+	  21193, 1, 21220, 1, 21329, 1, 21917, 1, 22022, 1, 22120, 1, 22592, 1,
+	  22696, 1, 23652, 1, 23662, 1, 24724, 1, 24936, 1, 24974, 1, 25074, 1,
+	  25935, 1, 26082, 1, 26257, 1, 26757, 1, 28023, 1, 28186, 1, 28450, 1,
+	  29038, 1, 29227, 1, 29730, 1, 30865, 1, 31038, 1, 31049, 1, 31048, 1,
+	  31056, 1, 31062, 1, 31069, 1, 31117, 1, 31118, 1, 31296, 1, 31361, 1,
+	  31680, 1, 32244, 1, 32265, 1, 32321, 1, 32626, 1, 32773, 1, 33261, 1,
+	  33401, 1, 33401, 1, 33879, 1, 35088, 1, 35222, 1, 35585, 1, 35641, 1,
+	  36051, 1, 36104, 1, 36790, 1, 36920, 1, 38627, 1, 38911, 1, 38971, 1,
+	  24693, 2, 55376, 57070, 1, 33304, 1, 20006, 1, 20917, 1, 20840, 1, 20352,
+	  1, 20805, 1, 20864, 1, 21191, 1, 21242, 1, 21917, 1, 21845, 1, 21913, 1,
+	  21986, 1, 22618, 1, 22707, 1, 22852, 1, 22868, 1, 23138, 1, 23336, 1,
+	  24274, 1, 24281, 1, 24425, 1, 24493, 1, 24792, 1, 24910, 1, 24840, 1,
+	  24974, 1, 24928, 1, 25074, 1, 25140, 1, 25540, 1, 25628, 1, 25682, 1,
+	  25942, 1, 26228, 1, 26391, 1, 26395, 1, 26454, 1, 27513, 1, 27578, 1,
+	  27969, 1, 28379, 1, 28363, 1, 28450, 1, 28702, 1, 29038, 1, 30631, 1,
+	  29237, 1, 29359, 1, 29482, 1, 29809, 1, 29958, 1, 30011, 1, 30237, 1,
+	  30239, 1, 30410, 1, 30427, 1, 30452, 1, 30538, 1, 30528, 1, 30924, 1,
+	  31409, 1, 31680, 1, 31867, 1, 32091, 1, 32244, 1, 32574, 1, 32773, 1,
+	  33618, 1, 33775, 1, 34681, 1, 35137, 1, 35206, 1, 35222, 1, 35519, 1,
+	  35576, 1, 35531, 1, 35585, 1, 35582, 1, 35565, 1, 35641, 1, 35722, 1,
+	  36104, 1, 36664, 1, 36978, 1, 37273, 1, 37494, 1, 38524, 1, 38627, 1,
+	  38742, 1, 38875, 1, 38911, 1, 38923, 1, 38971, 1, 39698, 1, 40860, 2,
+	  55370, 56394, 2, 55370, 56388, 2, 55372, 57301, 1, 15261, 1, 16408, 1,
+	  16441, 2, 55380, 56905, 2, 55383, 56528, 2, 55391, 57043, 1, 40771, 1,
+	  40846, 512, 102, 102, 512, 102, 105, 512, 102, 108, 768, 102, 102, 105,
+	  768, 102, 102, 108, 512, 115, 116, 512, 115, 116, 512, 1396, 1398, 512,
+	  1396, 1381, 512, 1396, 1387, 512, 1406, 1398, 512, 1396, 1389, 2, 1497,
+	  1460, 2, 1522, 1463, 256, 1506, 256, 1488, 256, 1491, 256, 1492, 256, 1499,
+	  256, 1500, 256, 1501, 256, 1512, 256, 1514, 256, 43, 2, 1513, 1473, 2,
+	  1513, 1474, 3, 1513, 1468, 1473, 3, 1513, 1468, 1474, 2, 1488, 1463, 2,
+	  1488, 1464, 2, 1488, 1468, 2, 1489, 1468, 2, 1490, 1468, 2, 1491, 1468, 2,
+	  1492, 1468, 2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468, 2, 1497, 1468, 2,
+	  1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502, 1468, 2, 1504, 1468, 2,
+	  1505, 1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510, 1468, 2, 1511, 1468, 2,
+	  1512, 1468, 2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471, 2,
+	  1499, 1471, 2, 1508, 1471, 512, 1488, 1500, 256, 1649, 256, 1649, 256,
+	  1659, 256, 1659, 256, 1659, 256, 1659, 256, 1662, 256, 1662, 256, 1662,
+	  256, 1662, 256, 1664, 256, 1664, 256, 1664, 256, 1664, 256, 1658, 256,
+	  1658, 256, 1658, 256, 1658, 256, 1663, 256, 1663, 256, 1663, 256, 1663,
+	  256, 1657, 256, 1657, 256, 1657, 256, 1657, 256, 1700, 256, 1700, 256,
+	  1700, 256, 1700, 256, 1702, 256, 1702, 256, 1702, 256, 1702, 256, 1668,
+	  256, 1668, 256, 1668, 256, 1668, 256, 1667, 256, 1667, 256, 1667, 256,
+	  1667, 256, 1670, 256, 1670, 256, 1670, 256, 1670, 256, 1671, 256, 1671,
+	  256, 1671, 256, 1671, 256, 1677, 256, 1677, 256, 1676, 256, 1676, 256,
+	  1678, 256, 1678, 256, 1672, 256, 1672, 256, 1688, 256, 1688, 256, 1681,
+	  256, 1681, 256, 1705, 256, 1705, 256, 1705, 256, 1705, 256, 1711, 256,
+	  1711, 256, 1711, 256, 1711, 256, 1715, 256, 1715, 256, 1715, 256, 1715,
+	  256, 1713, 256, 1713, 256, 1713, 256, 1713, 256, 1722, 256, 1722, 256,
+	  1723, 256, 1723, 256, 1723, 256, 1723, 512, 1749, 1620, 512, 1749, 1620,
+	  256, 1729, 256, 1729, 256, 1729, 256, 1729, 256, 1726, 256, 1726, 256,
+	  1726, 256, 1726, 256, 1746, 256, 1746, 512, 1746, 1620, 512, 1746, 1620,
+	  256, 1709, 256, 1709, 256, 1709, 256, 1709, 256, 1735, 256, 1735, 256,
+	  1734, 256, 1734, 256, 1736, 256, 1736, 512, 1735, 1652, 256, 1739, 256,
+	  1739, 256, 1733, 256, 1733, 256, 1737, 256, 1737, 256, 1744, 256, 1744,
+	  256, 1744, 256, 1744, 256, 1609, 256, 1609, 768, 1610, 1620, 1575, 768,
+	  1610, 1620, 1575, 768, 1610, 1620, 1749, 768, 1610, 1620, 1749, 768, 1610,
+	  1620, 1608, 768, 1610, 1620, 1608, 768, 1610, 1620, 1735, 768, 1610, 1620,
+	  1735, 768, 1610, 1620, 1734, 768, 1610, 1620, 1734, 768, 1610, 1620, 1736,
+	  768, 1610, 1620, 1736, 768, 1610, 1620, 1744, 768, 1610, 1620, 1744, 768,
+	  1610, 1620, 1744, 768, 1610, 1620, 1609, 768, 1610, 1620, 1609, 768, 1610,
+	  1620, 1609, 256, 1740, 256, 1740, 256, 1740, 256, 1740, 768, 1610, 1620,
+	  1580, 768, 1610, 1620, 1581, 768, 1610, 1620, 1605, 768, 1610, 1620, 1609,
+	  768, 1610, 1620, 1610, 512, 1576, 1580, 512, 1576, 1581, 512, 1576, 1582,
+	  512, 1576, 1605, 512, 1576, 1609, 512, 1576, 1610, 512, 1578, 1580, 512,
+	  1578, 1581, 512, 1578, 1582, 512, 1578, 1605, 512, 1578, 1609, 512, 1578,
+	  1610, 512, 1579, 1580, 512, 1579, 1605, 512, 1579, 1609, 512, 1579, 1610,
+	  512, 1580, 1581, 512, 1580, 1605, 512, 1581, 1580, 512, 1581, 1605, 512,
+	  1582, 1580, 512, 1582, 1581, 512, 1582, 1605, 512, 1587, 1580, 512, 1587,
+	  1581, 512, 1587, 1582, 512, 1587, 1605, 512, 1589, 1581, 512, 1589, 1605,
+	  512, 1590, 1580, 512, 1590, 1581, 512, 1590, 1582, 512, 1590, 1605, 512,
+	  1591, 1581, 512, 1591, 1605, 512, 1592, 1605, 512, 1593, 1580, 512, 1593,
+	  1605, 512, 1594, 1580, 512, 1594, 1605, 512, 1601, 1580, 512, 1601, 1581,
+	  512, 1601, 1582, 512, 1601, 1605, 512, 1601, 1609, 512, 1601, 1610, 512,
+	  1602, 1581, 512, 1602, 1605, 512, 1602, 1609, 512, 1602, 1610, 512, 1603,
+	  1575, 512, 1603, 1580, 512, 1603, 1581, 512, 1603, 1582, 512, 1603, 1604,
+	  512, 1603, 1605, 512, 1603, 1609, 512, 1603, 1610, 512, 1604, 1580, 512,
+	  1604, 1581, 512, 1604, 1582, 512, 1604, 1605, 512, 1604, 1609, 512, 1604,
+	  1610, 512, 1605, 1580, 512, 1605, 1581, 512, 1605, 1582, 512, 1605, 1605,
+	  512, 1605, 1609, 512, 1605, 1610, 512, 1606, 1580, 512, 1606, 1581, 512,
+	  1606, 1582, 512, 1606, 1605, 512, 1606, 1609, 512, 1606, 1610, 512, 1607,
+	  1580, 512, 1607, 1605, 512, 1607, 1609, 512, 1607, 1610, 512, 1610, 1580,
+	  512, 1610, 1581, 512, 1610, 1582, 512, 1610, 1605, 512, 1610, 1609, 512,
+	  1610, 1610, 512, 1584, 1648, 512, 1585, 1648, 512, 1609, 1648, 768, 32,
+	  1612, 1617, 768, 32, 1613, 1617, 768, 32, 1614, 1617, 768, 32, 1615, 1617,
+	  768, 32, 1616, 1617, 768, 32, 1617, 1648, 768, 1610, 1620, 1585, 768, 1610,
+	  1620, 1586, 768, 1610, 1620, 1605, 768, 1610, 1620, 1606, 768, 1610, 1620,
+	  1609, 768, 1610, 1620, 1610, 512, 1576, 1585, 512, 1576, 1586, 512, 1576,
+	  1605, 512, 1576, 1606, 512, 1576, 1609, 512, 1576, 1610, 512, 1578, 1585,
+	  512, 1578, 1586, 512, 1578, 1605, 512, 1578, 1606, 512, 1578, 1609, 512,
+	  1578, 1610, 512, 1579, 1585, 512, 1579, 1586, 512, 1579, 1605, 512, 1579,
+	  1606, 512, 1579, 1609, 512, 1579, 1610, 512, 1601, 1609, 512, 1601, 1610,
+	  512, 1602, 1609, 512, 1602, 1610, 512, 1603, 1575, 512, 1603, 1604, 512,
+	  1603, 1605, 512, 1603, 1609, 512, 1603, 1610, 512, 1604, 1605, 512, 1604,
+	  1609, 512, 1604, 1610, 512, 1605, 1575, 512, 1605, 1605, 512, 1606, 1585,
+	  512, 1606, 1586, 512, 1606, 1605, 512, 1606, 1606, 512, 1606, 1609, 512,
+	  1606, 1610, 512, 1609, 1648, 512, 1610, 1585, 512, 1610, 1586, 512, 1610,
+	  1605, 512, 1610, 1606, 512, 1610, 1609, 512, 1610, 1610, 768, 1610, 1620,
+	  1580, 768, 1610, 1620, 1581, 768, 1610, 1620, 1582, 768, 1610, 1620, 1605,
+	  768, 1610, 1620, 1607, 512, 1576, 1580, 512, 1576, 1581, 512, 1576, 1582,
+	  512, 1576, 1605, 512, 1576, 1607, 512, 1578, 1580, 512, 1578, 1581, 512,
+	  1578, 1582, 512, 1578, 1605, 512, 1578, 1607, 512, 1579, 1605, 512, 1580,
+	  1581, 512, 1580, 1605, 512, 1581, 1580, 512, 1581, 1605, 512, 1582, 1580,
+	  512, 1582, 1605, 512, 1587, 1580, 512, 1587, 1581, 512, 1587, 1582, 512,
+	  1587, 1605, 512, 1589, 1581, 512, 1589, 1582, 512, 1589, 1605, 512, 1590,
+	  1580, 512, 1590, 1581, 512, 1590, 1582, 512, 1590, 1605, 512, 1591, 1581,
+	  512, 1592, 1605, 512, 1593, 1580, 512, 1593, 1605, 512, 1594, 1580, 512,
+	  1594, 1605, 512, 1601, 1580, 512, 1601, 1581, 512, 1601, 1582, 512, 1601,
+	  1605, 512, 1602, 1581, 512, 1602, 1605, 512, 1603, 1580, 512, 1603, 1581,
+	  512, 1603, 1582, 512, 1603, 1604, 512, 1603, 1605, 512, 1604, 1580, 512,
+	  1604, 1581, 512, 1604, 1582, 512, 1604, 1605, 512, 1604, 1607, 512, 1605,
+	  1580, 512, 1605, 1581, 512, 1605, 1582, 512, 1605, 1605, 512, 1606, 1580,
+	  512, 1606, 1581, 512, 1606, 1582, 512, 1606, 1605, 512, 1606, 1607, 512,
+	  1607, 1580, 512, 1607, 1605, 512, 1607, 1648, 512, 1610, 1580, 512, 1610,
+	  1581, 512, 1610, 1582, 512, 1610, 1605, 512, 1610, 1607, 768, 1610, 1620,
+	  1605, 768, 1610, 1620, 1607, 512, 1576, 1605, 512, 1576, 1607, 512, 1578,
+	  1605, 512, 1578, 1607, 512, 1579, 1605, 512, 1579, 1607, 512, 1587, 1605,
+	  512, 1587, 1607, 512, 1588, 1605, 512, 1588, 1607, 512, 1603, 1604, 512,
+	  1603, 1605, 512, 1604, 1605, 512, 1606, 1605, 512, 1606, 1607, 512, 1610,
+	  1605, 512, 1610, 1607, 768, 1600, 1614, 1617, 768, 1600, 1615, 1617, 768,
+	  1600, 1616, 1617, 512, 1591, 1609, 512, 1591, 1610, 512, 1593, 1609, 512,
+	  1593, 1610, 512, 1594, 1609, 512, 1594, 1610, 512, 1587, 1609, 512, 1587,
+	  1610, 512, 1588, 1609, 512, 1588, 1610, 512, 1581, 1609, 512, 1581, 1610,
+	  512, 1580, 1609, 512, 1580, 1610, 512, 1582, 1609, 512, 1582, 1610, 512,
+	  1589, 1609, 512, 1589, 1610, 512, 1590, 1609, 512, 1590, 1610, 512, 1588,
+	  1580, 512, 1588, 1581, 512, 1588, 1582, 512, 1588, 1605, 512, 1588, 1585,
+	  512, 1587, 1585, 512, 1589, 1585, 512, 1590, 1585, 512, 1591, 1609, 512,
+	  1591, 1610, 512, 1593, 1609, 512, 1593, 1610, 512, 1594, 1609, 512, 1594,
+	  1610, 512, 1587, 1609, 512, 1587, 1610, 512, 1588, 1609, 512, 1588, 1610,
+	  512, 1581, 1609, 512, 1581, 1610, 512, 1580, 1609, 512, 1580, 1610, 512,
+	  1582, 1609, 512, 1582, 1610, 512, 1589, 1609, 512, 1589, 1610, 512, 1590,
+	  1609, 512, 1590, 1610, 512, 1588, 1580, 512, 1588, 1581, 512, 1588, 1582,
+	  512, 1588, 1605, 512, 1588, 1585, 512, 1587, 1585, 512, 1589, 1585, 512,
+	  1590, 1585, 512, 1588, 1580, 512, 1588, 1581, 512, 1588, 1582, 512, 1588,
+	  1605, 512, 1587, 1607, 512, 1588, 1607, 512, 1591, 1605, 512, 1587, 1580,
+	  512, 1587, 1581, 512, 1587, 1582, 512, 1588, 1580, 512, 1588, 1581, 512,
+	  1588, 1582, 512, 1591, 1605, 512, 1592, 1605, 512, 1575, 1611, 512, 1575,
+	  1611, 768, 1578, 1580, 1605, 768, 1578, 1581, 1580, 768, 1578, 1581, 1580,
+	  768, 1578, 1581, 1605, 768, 1578, 1582, 1605, 768, 1578, 1605, 1580, 768,
+	  1578, 1605, 1581, 768, 1578, 1605, 1582, 768, 1580, 1605, 1581, 768, 1580,
+	  1605, 1581, 768, 1581, 1605, 1610, 768, 1581, 1605, 1609, 768, 1587, 1581,
+	  1580, 768, 1587, 1580, 1581, 768, 1587, 1580, 1609, 768, 1587, 1605, 1581,
+	  768, 1587, 1605, 1581, 768, 1587, 1605, 1580, 768, 1587, 1605, 1605, 768,
+	  1587, 1605, 1605, 768, 1589, 1581, 1581, 768, 1589, 1581, 1581, 768, 1589,
+	  1605, 1605, 768, 1588, 1581, 1605, 768, 1588, 1581, 1605, 768, 1588, 1580,
+	  1610, 768, 1588, 1605, 1582, 768, 1588, 1605, 1582, 768, 1588, 1605, 1605,
+	  768, 1588, 1605, 1605, 768, 1590, 1581, 1609, 768, 1590, 1582, 1605, 768,
+	  1590, 1582, 1605, 768, 1591, 1605, 1581, 768, 1591, 1605, 1581, 768, 1591,
+	  1605, 1605, 768, 1591, 1605, 1610, 768, 1593, 1580, 1605, 768, 1593, 1605,
+	  1605, 768, 1593, 1605, 1605, 768, 1593, 1605, 1609, 768, 1594, 1605, 1605,
+	  768, 1594, 1605, 1610, 768, 1594, 1605, 1609, 768, 1601, 1582, 1605, 768,
+	  1601, 1582, 1605, 768, 1602, 1605, 1581, 768, 1602, 1605, 1605, 768, 1604,
+	  1581, 1605, 768, 1604, 1581, 1610, 768, 1604, 1581, 1609, 768, 1604, 1580,
+	  1580, 768, 1604, 1580, 1580, 768, 1604, 1582, 1605, 768, 1604, 1582, 1605,
+	  768, 1604, 1605, 1581, 768, 1604, 1605, 1581, 768, 1605, 1581, 1580, 768,
+	  1605, 1581, 1605, 768, 1605, 1581, 1610, 768, 1605, 1580, 1581, 768, 1605,
+	  1580, 1605, 768, 1605, 1582, 1580, 768, 1605, 1582, 1605, 768, 1605, 1580,
+	  1582, 768, 1607, 1605, 1580, 768, 1607, 1605, 1605, 768, 1606, 1581, 1605,
+	  768, 1606, 1581, 1609, 768, 1606, 1580, 1605, 768, 1606, 1580, 1605, 768,
+	  1606, 1580, 1609, 768, 1606, 1605, 1610, 768, 1606, 1605, 1609, 768, 1610,
+	  1605, 1605, 768, 1610, 1605, 1605, 768, 1576, 1582, 1610, 768, 1578, 1580,
+	  1610, 768, 1578, 1580, 1609, 768, 1578, 1582, 1610, 768, 1578, 1582, 1609,
+	  768, 1578, 1605, 1610, 768, 1578, 1605, 1609, 768, 1580, 1605, 1610, 768,
+	  1580, 1581, 1609, 768, 1580, 1605, 1609, 768, 1587, 1582, 1609, 768, 1589,
+	  1581, 1610, 768, 1588, 1581, 1610, 768, 1590, 1581, 1610, 768, 1604, 1580,
+	  1610, 768, 1604, 1605, 1610, 768, 1610, 1581, 1610, 768, 1610, 1580, 1610,
+	  768, 1610, 1605, 1610, 768, 1605, 1605, 1610, 768, 1602, 1605, 1610, 768,
+	  1606, 1581, 1610, 768, 1602, 1605, 1581, 768, 1604, 1581, 1605, 768, 1593,
+	  1605, 1610, 768, 1603, 1605, 1610, 768, 1606, 1580, 1581, 768, 1605, 1582,
+	  1610, 768, 1604, 1580, 1605, 768, 1603, 1605, 1605, 768, 1604, 1580, 1605,
+	  768, 1606, 1580, 1581, 768, 1580, 1581, 1610, 768, 1581, 1580, 1610, 768,
+	  1605, 1580, 1610, 768, 1601, 1605, 1610, 768, 1576, 1581, 1610, 768, 1603,
+	  1605, 1605, 768, 1593, 1580, 1605, 768, 1589, 1605, 1605, 768, 1587, 1582,
+	  1610, 768, 1606, 1580, 1610, 768, 1589, 1604, 1746, 768, 1602, 1604, 1746,
+	  1024, 1575, 1604, 1604, 1607, 1024, 1575, 1603, 1576, 1585, 1024, 1605,
+	  1581, 1605, 1583, 1024, 1589, 1604, 1593, 1605, 1024, 1585, 1587, 1608,
+	  1604, 1024, 1593, 1604, 1610, 1607, 1024, 1608, 1587, 1604, 1605, 768,
+	  1589, 1604, 1609, 4608, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607, 32,
+	  1593, 1604, 1610, 1607, 32, 1608, 1587, 1604, 1605, 2048, 1580, 1604, 32,
+	  1580, 1604, 1575, 1604, 1607, 1024, 1585, 1740, 1575, 1604, 256, 44, 256,
+	  12289, 256, 12290, 256, 58, 256, 59, 256, 33, 256, 63, 256, 12310, 256,
+	  12311, 768, 46, 46, 46, 512, 46, 46, 256, 8212, 256, 8211, 256, 95, 256,
+	  95, 256, 40, 256, 41, 256, 123, 256, 125, 256, 12308, 256, 12309, 256,
+	  12304, 256, 12305, 256, 12298, 256, 12299, 256, 12296, 256, 12297, 256,
+	  12300, 256, 12301, 256, 12302, 256, 12303, 256, 91, 256, 93, 512, 32, 773,
+	  512, 32, 773, 512, 32, 773, 512, 32, 773, 256, 95, 256, 95, 256, 95, 256,
+	  44, 256, 12289, 256, 46, 256, 59, 256, 58, 256, 63, 256, 33, 256, 8212,
+	  256, 40, 256, 41, 256, 123, 256, 125, 256, 12308, 256, 12309, 256, 35, 256,
+	  38, 256, 42, 256, 43, 256, 45, 256, 60, 256, 62, 256, 61, 256, 92, 256, 36,
+	  256, 37, 256, 64, 512, 32, 1611, 512, 1600, 1611, 512, 32, 1612, 512, 32,
+	  1613, 512, 32, 1614, 512, 1600, 1614, 512, 32, 1615, 512, 1600, 1615, 512,
+	  32, 1616, 512, 1600, 1616, 512, 32, 1617, 512, 1600, 1617, 512, 32, 1618,
+	  512, 1600, 1618, 256, 1569, 512, 1575, 1619, 512, 1575, 1619, 512, 1575,
+	  1620, 512, 1575, 1620, 512, 1608, 1620, 512, 1608, 1620, 512, 1575, 1621,
+	  512, 1575, 1621, 512, 1610, 1620, 512, 1610, 1620, 512, 1610, 1620, 512,
+	  1610, 1620, 256, 1575, 256, 1575, 256, 1576, 256, 1576, 256, 1576, 256,
+	  1576, 256, 1577, 256, 1577, 256, 1578, 256, 1578, 256, 1578, 256, 1578,
+	  256, 1579, 256, 1579, 256, 1579, 256, 1579, 256, 1580, 256, 1580, 256,
+	  1580, 256, 1580, 256, 1581, 256, 1581, 256, 1581, 256, 1581, 256, 1582,
+	  256, 1582, 256, 1582, 256, 1582, 256, 1583, 256, 1583, 256, 1584, 256,
+	  1584, 256, 1585, 256, 1585, 256, 1586, 256, 1586, 256, 1587, 256, 1587,
+	  256, 1587, 256, 1587, 256, 1588, 256, 1588, 256, 1588, 256, 1588, 256,
+	  1589, 256, 1589, 256, 1589, 256, 1589, 256, 1590, 256, 1590, 256, 1590,
+	  256, 1590, 256, 1591, 256, 1591, 256, 1591, 256, 1591, 256, 1592, 256,
+	  1592, 256, 1592, 256, 1592, 256, 1593, 256, 1593, 256, 1593, 256, 1593,
+	  256, 1594, 256, 1594, 256, 1594, 256, 1594, 256, 1601, 256, 1601, 256,
+	  1601, 256, 1601, 256, 1602, 256, 1602, 256, 1602, 256, 1602, 256, 1603,
+	  256, 1603, 256, 1603, 256, 1603, 256, 1604, 256, 1604, 256, 1604, 256,
+	  1604, 256, 1605, 256, 1605, 256, 1605, 256, 1605, 256, 1606, 256, 1606,
+	  256, 1606, 256, 1606, 256, 1607, 256, 1607, 256, 1607, 256, 1607, 256,
+	  1608, 256, 1608, 256, 1609, 256, 1609, 256, 1610, 256, 1610, 256, 1610,
+	  256, 1610, 768, 1604, 1575, 1619, 768, 1604, 1575, 1619, 768, 1604, 1575,
+	  1620, 768, 1604, 1575, 1620, 768, 1604, 1575, 1621, 768, 1604, 1575, 1621,
+	  512, 1604, 1575, 512, 1604, 1575, 256, 33, 256, 34, 256, 35, 256, 36, 256,
+	  37, 256, 38, 256, 39, 256, 40, 256, 41, 256, 42, 256, 43, 256, 44, 256, 45,
+	  256, 46, 256, 47, 256, 48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53,
+	  256, 54, 256, 55, 256, 56, 256, 57, 256, 58, 256, 59, 256, 60, 256, 61,
+	  256, 62, 256, 63, 256, 64, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69,
+	  256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+	  256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85,
+	  256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 91, 256, 92, 256, 93,
+	  256, 94, 256, 95, 256, 96, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 123, 256,
+	  124, 256, 125, 256, 126, 256, 10629, 256, 10630, 256, 12290, 256, 12300,
+	  256, 12301, 256, 12289, 256, 12539, 256, 12530, 256, 12449, 256, 12451,
+	  256, 12453, 256, 12455, 256, 12457, 256, 12515, 256, 12517, 256, 12519,
+	  256, 12483, 256, 12540, 256, 12450, 256, 12452, 256, 12454, 256, 12456,
+	  256, 12458, 256, 12459, 256, 12461, 256, 12463, 256, 12465, 256, 12467,
+	  256, 12469, 256, 12471, 256, 12473, 256, 12475, 256, 12477, 256, 12479,
+	  256, 12481, 256, 12484, 256, 12486, 256, 12488, 256, 12490, 256, 12491,
+	  256, 12492, 256, 12493, 256, 12494, 256, 12495, 256, 12498, 256, 12501,
+	  256, 12504, 256, 12507, 256, 12510, 256, 12511, 256, 12512, 256, 12513,
+	  256, 12514, 256, 12516, 256, 12518, 256, 12520, 256, 12521, 256, 12522,
+	  256, 12523, 256, 12524, 256, 12525, 256, 12527, 256, 12531, 256, 12441,
+	  256, 12442, 256, 4448, 256, 4352, 256, 4353, 256, 4522, 256, 4354, 256,
+	  4524, 256, 4525, 256, 4355, 256, 4356, 256, 4357, 256, 4528, 256, 4529,
+	  256, 4530, 256, 4531, 256, 4532, 256, 4533, 256, 4378, 256, 4358, 256,
+	  4359, 256, 4360, 256, 4385, 256, 4361, 256, 4362, 256, 4363, 256, 4364,
+	  256, 4365, 256, 4366, 256, 4367, 256, 4368, 256, 4369, 256, 4370, 256,
+	  4449, 256, 4450, 256, 4451, 256, 4452, 256, 4453, 256, 4454, 256, 4455,
+	  256, 4456, 256, 4457, 256, 4458, 256, 4459, 256, 4460, 256, 4461, 256,
+	  4462, 256, 4463, 256, 4464, 256, 4465, 256, 4466, 256, 4467, 256, 4468,
+	  256, 4469, 256, 162, 256, 163, 256, 172, 512, 32, 772, 256, 166, 256, 165,
+	  256, 8361, 256, 9474, 256, 8592, 256, 8593, 256, 8594, 256, 8595, 256,
+	  9632, 256, 9675, 256, 720, 256, 721, 256, 230, 256, 665, 256, 595, 256,
+	  675, 256, 43878, 256, 677, 256, 676, 256, 598, 256, 599, 256, 7569, 256,
+	  600, 256, 606, 256, 681, 256, 612, 256, 610, 256, 608, 256, 667, 256, 295,
+	  256, 668, 256, 615, 256, 644, 256, 682, 256, 683, 256, 620, 512, 55351,
+	  57092, 256, 42894, 256, 622, 512, 55351, 57093, 256, 654, 512, 55351,
+	  57094, 256, 248, 256, 630, 256, 631, 256, 113, 256, 634, 512, 55351, 57096,
+	  256, 637, 256, 638, 256, 640, 256, 680, 256, 678, 256, 43879, 256, 679,
+	  256, 648, 256, 11377, 256, 655, 256, 673, 256, 674, 256, 664, 256, 448,
+	  256, 449, 256, 450, 512, 55351, 57098, 512, 55351, 57118, 4, 55300, 56473,
+	  55300, 56506, 4, 55300, 56475, 55300, 56506, 4, 55300, 56485, 55300, 56506,
+	  4, 55300, 56625, 55300, 56615, 4, 55300, 56626, 55300, 56615, 4, 55300,
+	  57159, 55300, 57150, 4, 55300, 57159, 55300, 57175, 4, 55301, 56505, 55301,
+	  56506, 4, 55301, 56505, 55301, 56496, 4, 55301, 56505, 55301, 56509, 4,
+	  55301, 56760, 55301, 56751, 4, 55301, 56761, 55301, 56751, 4, 55302, 56629,
+	  55302, 56624, 4, 55348, 56663, 55348, 56677, 4, 55348, 56664, 55348, 56677,
+	  6, 55348, 56664, 55348, 56677, 55348, 56686, 6, 55348, 56664, 55348, 56677,
+	  55348, 56687, 6, 55348, 56664, 55348, 56677, 55348, 56688, 6, 55348, 56664,
+	  55348, 56677, 55348, 56689, 6, 55348, 56664, 55348, 56677, 55348, 56690, 4,
+	  55348, 56761, 55348, 56677, 4, 55348, 56762, 55348, 56677, 6, 55348, 56761,
+	  55348, 56677, 55348, 56686, 6, 55348, 56762, 55348, 56677, 55348, 56686, 6,
+	  55348, 56761, 55348, 56677, 55348, 56687, 6, 55348, 56762, 55348, 56677,
+	  55348, 56687, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256,
+	  71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+	  256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+	  256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256,
+	  66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74,
+	  256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82,
+	  256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90,
+	  256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256,
+	  105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112,
+	  256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256,
+	  120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256,
+	  70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78,
+	  256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86,
+	  256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100,
+	  256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256,
+	  108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115,
+	  256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256,
+	  65, 256, 67, 256, 68, 256, 71, 256, 74, 256, 75, 256, 78, 256, 79, 256, 80,
+	  256, 81, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89,
+	  256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 102, 256, 104, 256, 105,
+	  256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 112, 256, 113, 256,
+	  114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121,
+	  256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71,
+	  256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+	  256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+	  256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256,
+	  66, 256, 68, 256, 69, 256, 70, 256, 71, 256, 74, 256, 75, 256, 76, 256, 77,
+	  256, 78, 256, 79, 256, 80, 256, 81, 256, 83, 256, 84, 256, 85, 256, 86,
+	  256, 87, 256, 88, 256, 89, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256,
+	  66, 256, 68, 256, 69, 256, 70, 256, 71, 256, 73, 256, 74, 256, 75, 256, 76,
+	  256, 77, 256, 79, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88,
+	  256, 89, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103,
+	  256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256,
+	  111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118,
+	  256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68,
+	  256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76,
+	  256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84,
+	  256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98,
+	  256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256,
+	  106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113,
+	  256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256,
+	  121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256,
+	  71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+	  256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+	  256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101,
+	  256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256,
+	  109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116,
+	  256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256,
+	  66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74,
+	  256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82,
+	  256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90,
+	  256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256,
+	  104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111,
+	  256, 112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256,
+	  119, 256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256, 67, 256, 68, 256,
+	  69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77,
+	  256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85,
+	  256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97, 256, 98, 256, 99,
+	  256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256, 105, 256, 106, 256,
+	  107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112, 256, 113, 256, 114,
+	  256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256, 120, 256, 121, 256,
+	  122, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71, 256,
+	  72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79, 256, 80,
+	  256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87, 256, 88,
+	  256, 89, 256, 90, 256, 97, 256, 98, 256, 99, 256, 100, 256, 101, 256, 102,
+	  256, 103, 256, 104, 256, 105, 256, 106, 256, 107, 256, 108, 256, 109, 256,
+	  110, 256, 111, 256, 112, 256, 113, 256, 114, 256, 115, 256, 116, 256, 117,
+	  256, 118, 256, 119, 256, 120, 256, 121, 256, 122, 256, 65, 256, 66, 256,
+	  67, 256, 68, 256, 69, 256, 70, 256, 71, 256, 72, 256, 73, 256, 74, 256, 75,
+	  256, 76, 256, 77, 256, 78, 256, 79, 256, 80, 256, 81, 256, 82, 256, 83,
+	  256, 84, 256, 85, 256, 86, 256, 87, 256, 88, 256, 89, 256, 90, 256, 97,
+	  256, 98, 256, 99, 256, 100, 256, 101, 256, 102, 256, 103, 256, 104, 256,
+	  105, 256, 106, 256, 107, 256, 108, 256, 109, 256, 110, 256, 111, 256, 112,
+	  256, 113, 256, 114, 256, 115, 256, 116, 256, 117, 256, 118, 256, 119, 256,
+	  120, 256, 121, 256, 122, 256, 305, 256, 567, 256, 913, 256, 914, 256, 915,
+	  256, 916, 256, 917, 256, 918, 256, 919, 256, 920, 256, 921, 256, 922, 256,
+	  923, 256, 924, 256, 925, 256, 926, 256, 927, 256, 928, 256, 929, 256, 920,
+	  256, 931, 256, 932, 256, 933, 256, 934, 256, 935, 256, 936, 256, 937, 256,
+	  8711, 256, 945, 256, 946, 256, 947, 256, 948, 256, 949, 256, 950, 256, 951,
+	  256, 952, 256, 953, 256, 954, 256, 955, 256, 956, 256, 957, 256, 958, 256,
+	  959, 256, 960, 256, 961, 256, 962, 256, 963, 256, 964, 256, 965, 256, 966,
+	  256, 967, 256, 968, 256, 969, 256, 8706, 256, 949, 256, 952, 256, 954, 256,
+	  966, 256, 961, 256, 960, 256, 913, 256, 914, 256, 915, 256, 916, 256, 917,
+	  256, 918, 256, 919, 256, 920, 256, 921, 256, 922, 256, 923, 256, 924, 256,
+	  925, 256, 926, 256, 927, 256, 928, 256, 929, 256, 920, 256, 931, 256, 932,
+	  256, 933, 256, 934, 256, 935, 256, 936, 256, 937, 256, 8711, 256, 945, 256,
+	  946, 256, 947, 256, 948, 256, 949, 256, 950, 256, 951, 256, 952, 256, 953,
+	  256, 954, 256, 955, 256, 956, 256, 957, 256, 958, 256, 959, 256, 960, 256,
+	  961, 256, 962, 256, 963, 256, 964, 256, 965, 256, 966, 256, 967, 256, 968,
+	  256, 969, 256, 8706, 256, 949, 256, 952, 256, 954, 256, 966, 256, 961, 256,
+	  960, 256, 913, 256, 914, 256, 915, 256, 916, 256, 917, 256, 918, 256, 919,
+	  256, 920, 256, 921, 256, 922, 256, 923, 256, 924, 256, 925, 256, 926, 256,
+	  927, 256, 928, 256, 929, 256, 920, 256, 931, 256, 932, 256, 933, 256, 934,
+	  256, 935, 256, 936, 256, 937, 256, 8711, 256, 945, 256, 946, 256, 947, 256,
+	  948, 256, 949, 256, 950, 256, 951, 256, 952, 256, 953, 256, 954, 256, 955,
+	  256, 956, 256, 957, 256, 958, 256, 959, 256, 960, 256, 961, 256, 962, 256,
+	  963, 256, 964, 256, 965, 256, 966, 256, 967, 256, 968, 256, 969, 256, 8706,
+	  256, 949, 256, 952, 256, 954, 256, 966, 256, 961, 256, 960, 256, 913, 256,
+	  914, 256, 915, 256, 916, 256, 917, 256, 918, 256, 919, 256, 920, 256, 921,
+	  256, 922, 256, 923, 256, 924, 256, 925, 256, 926, 256, 927, 256, 928, 256,
+	  929, 256, 920, 256, 931, 256, 932, 256, 933, 256, 934, 256, 935, 256, 936,
+	  256, 937, 256, 8711, 256, 945, 256, 946, 256, 947, 256, 948, 256, 949, 256,
+	  950, 256, 951, 256, 952, 256, 953, 256, 954, 256, 955, 256, 956, 256, 957,
+	  256, 958, 256, 959, 256, 960, 256, 961, 256, 962, 256, 963, 256, 964, 256,
+	  965, 256, 966, 256, 967, 256, 968, 256, 969, 256, 8706, 256, 949, 256, 952,
+	  256, 954, 256, 966, 256, 961, 256, 960, 256, 913, 256, 914, 256, 915, 256,
+	  916, 256, 917, 256, 918, 256, 919, 256, 920, 256, 921, 256, 922, 256, 923,
+	  256, 924, 256, 925, 256, 926, 256, 927, 256, 928, 256, 929, 256, 920, 256,
+	  931, 256, 932, 256, 933, 256, 934, 256, 935, 256, 936, 256, 937, 256, 8711,
+	  256, 945, 256, 946, 256, 947, 256, 948, 256, 949, 256, 950, 256, 951, 256,
+	  952, 256, 953, 256, 954, 256, 955, 256, 956, 256, 957, 256, 958, 256, 959,
+	  256, 960, 256, 961, 256, 962, 256, 963, 256, 964, 256, 965, 256, 966, 256,
+	  967, 256, 968, 256, 969, 256, 8706, 256, 949, 256, 952, 256, 954, 256, 966,
+	  256, 961, 256, 960, 256, 988, 256, 989, 256, 48, 256, 49, 256, 50, 256, 51,
+	  256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 48, 256, 49,
+	  256, 50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57,
+	  256, 48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55,
+	  256, 56, 256, 57, 256, 48, 256, 49, 256, 50, 256, 51, 256, 52, 256, 53,
+	  256, 54, 256, 55, 256, 56, 256, 57, 256, 48, 256, 49, 256, 50, 256, 51,
+	  256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 256, 1575, 256, 1576,
+	  256, 1580, 256, 1583, 256, 1608, 256, 1586, 256, 1581, 256, 1591, 256,
+	  1610, 256, 1603, 256, 1604, 256, 1605, 256, 1606, 256, 1587, 256, 1593,
+	  256, 1601, 256, 1589, 256, 1602, 256, 1585, 256, 1588, 256, 1578, 256,
+	  1579, 256, 1582, 256, 1584, 256, 1590, 256, 1592, 256, 1594, 256, 1646,
+	  256, 1722, 256, 1697, 256, 1647, 256, 1576, 256, 1580, 256, 1607, 256,
+	  1581, 256, 1610, 256, 1603, 256, 1604, 256, 1605, 256, 1606, 256, 1587,
+	  256, 1593, 256, 1601, 256, 1589, 256, 1602, 256, 1588, 256, 1578, 256,
+	  1579, 256, 1582, 256, 1590, 256, 1594, 256, 1580, 256, 1581, 256, 1610,
+	  256, 1604, 256, 1606, 256, 1587, 256, 1593, 256, 1589, 256, 1602, 256,
+	  1588, 256, 1582, 256, 1590, 256, 1594, 256, 1722, 256, 1647, 256, 1576,
+	  256, 1580, 256, 1607, 256, 1581, 256, 1591, 256, 1610, 256, 1603, 256,
+	  1605, 256, 1606, 256, 1587, 256, 1593, 256, 1601, 256, 1589, 256, 1602,
+	  256, 1588, 256, 1578, 256, 1579, 256, 1582, 256, 1590, 256, 1592, 256,
+	  1594, 256, 1646, 256, 1697, 256, 1575, 256, 1576, 256, 1580, 256, 1583,
+	  256, 1607, 256, 1608, 256, 1586, 256, 1581, 256, 1591, 256, 1610, 256,
+	  1604, 256, 1605, 256, 1606, 256, 1587, 256, 1593, 256, 1601, 256, 1589,
+	  256, 1602, 256, 1585, 256, 1588, 256, 1578, 256, 1579, 256, 1582, 256,
+	  1584, 256, 1590, 256, 1592, 256, 1594, 256, 1576, 256, 1580, 256, 1583,
+	  256, 1608, 256, 1586, 256, 1581, 256, 1591, 256, 1610, 256, 1604, 256,
+	  1605, 256, 1606, 256, 1587, 256, 1593, 256, 1601, 256, 1589, 256, 1602,
+	  256, 1585, 256, 1588, 256, 1578, 256, 1579, 256, 1582, 256, 1584, 256,
+	  1590, 256, 1592, 256, 1594, 512, 48, 46, 512, 48, 44, 512, 49, 44, 512, 50,
+	  44, 512, 51, 44, 512, 52, 44, 512, 53, 44, 512, 54, 44, 512, 55, 44, 512,
+	  56, 44, 512, 57, 44, 768, 40, 65, 41, 768, 40, 66, 41, 768, 40, 67, 41,
+	  768, 40, 68, 41, 768, 40, 69, 41, 768, 40, 70, 41, 768, 40, 71, 41, 768,
+	  40, 72, 41, 768, 40, 73, 41, 768, 40, 74, 41, 768, 40, 75, 41, 768, 40, 76,
+	  41, 768, 40, 77, 41, 768, 40, 78, 41, 768, 40, 79, 41, 768, 40, 80, 41,
+	  768, 40, 81, 41, 768, 40, 82, 41, 768, 40, 83, 41, 768, 40, 84, 41, 768,
+	  40, 85, 41, 768, 40, 86, 41, 768, 40, 87, 41, 768, 40, 88, 41, 768, 40, 89,
+	  41, 768, 40, 90, 41, 768, 12308, 83, 12309, 256, 67, 256, 82, 512, 67, 68,
+	  512, 87, 90, 256, 65, 256, 66, 256, 67, 256, 68, 256, 69, 256, 70, 256, 71,
+	  256, 72, 256, 73, 256, 74, 256, 75, 256, 76, 256, 77, 256, 78, 256, 79,
+	  256, 80, 256, 81, 256, 82, 256, 83, 256, 84, 256, 85, 256, 86, 256, 87,
+	  256, 88, 256, 89, 256, 90, 512, 72, 86, 512, 77, 86, 512, 83, 68, 512, 83,
+	  83, 768, 80, 80, 86, 512, 87, 67, 512, 77, 67, 512, 77, 68, 512, 77, 82,
+	  512, 68, 74, 512, 12411, 12363, 512, 12467, 12467, 256, 12469, 256, 25163,
+	  256, 23383, 256, 21452, 512, 12486, 12441, 256, 20108, 256, 22810, 256,
+	  35299, 256, 22825, 256, 20132, 256, 26144, 256, 28961, 256, 26009, 256,
+	  21069, 256, 24460, 256, 20877, 256, 26032, 256, 21021, 256, 32066, 256,
+	  29983, 256, 36009, 256, 22768, 256, 21561, 256, 28436, 256, 25237, 256,
+	  25429, 256, 19968, 256, 19977, 256, 36938, 256, 24038, 256, 20013, 256,
+	  21491, 256, 25351, 256, 36208, 256, 25171, 256, 31105, 256, 31354, 256,
+	  21512, 256, 28288, 256, 26377, 256, 26376, 256, 30003, 256, 21106, 256,
+	  21942, 256, 37197, 768, 12308, 26412, 12309, 768, 12308, 19977, 12309, 768,
+	  12308, 20108, 12309, 768, 12308, 23433, 12309, 768, 12308, 28857, 12309,
+	  768, 12308, 25171, 12309, 768, 12308, 30423, 12309, 768, 12308, 21213,
+	  12309, 768, 12308, 25943, 12309, 256, 24471, 256, 21487, 256, 48, 256, 49,
+	  256, 50, 256, 51, 256, 52, 256, 53, 256, 54, 256, 55, 256, 56, 256, 57, 1,
+	  20029, 1, 20024, 1, 20033, 2, 55360, 56610, 1, 20320, 1, 20398, 1, 20411,
+	  1, 20482, 1, 20602, 1, 20633, 1, 20711, 1, 20687, 1, 13470, 2, 55361,
+	  56890, 1, 20813, 1, 20820, 1, 20836, 1, 20855, 2, 55361, 56604, 1, 13497,
+	  1, 20839, 1, 20877, 2, 55361, 56651, 1, 20887, 1, 20900, 1, 20172, 1,
+	  20908, 1, 20917, 2, 55396, 56799, 1, 20981, 1, 20995, 1, 13535, 1, 21051,
+	  1, 21062, 1, 21106, 1, 21111, 1, 13589, 1, 21191, 1, 21193, 1, 21220, 1,
+	  21242, 1, 21253, 1, 21254, 1, 21271, 1, 21321, 1, 21329, 1, 21338, 1,
+	  21363, 1, 21373, 1, 21375, 1, 21375, 1, 21375, 2, 55362, 56876, 1, 28784,
+	  1, 21450, 1, 21471, 2, 55362, 57187, 1, 21483, 1, 21489, 1, 21510, 1,
+	  21662, 1, 21560, 1, 21576, 1, 21608, 1, 21666, 1, 21750, 1, 21776, 1,
+	  21843, 1, 21859, 1, 21892, 1, 21892, 1, 21913, 1, 21931, 1, 21939, 1,
+	  21954, 1, 22294, 1, 22022, 1, 22295, 1, 22097, 1, 22132, 1, 20999, 1,
+	  22766, 1, 22478, 1, 22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577, 1,
+	  22700, 2, 55365, 56548, 1, 22770, 1, 22775, 1, 22790, 1, 22810, 1, 22818,
+	  1, 22882, 2, 55365, 57000, 2, 55365, 57066, 1, 23020, 1, 23067, 1, 23079,
+	  1, 23000, 1, 23142, 1, 14062, 1, 14076, 1, 23304, 1, 23358, 1, 23358, 2,
+	  55366, 56776, 1, 23491, 1, 23512, 1, 23527, 1, 23539, 2, 55366, 57112, 1,
+	  23551, 1, 23558, 1, 24403, 1, 23586, 1, 14209, 1, 23648, 1, 23662, 1,
+	  23744, 1, 23693, 2, 55367, 56804, 1, 23875, 2, 55367, 56806, 1, 23918, 1,
+	  23915, 1, 23932, 1, 24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1,
+	  24125, 1, 24169, 1, 14434, 2, 55368, 56707, 1, 14460, 1, 24240, 1, 24243,
+	  1, 24246, 1, 24266, 2, 55400, 57234, 1, 24318, 2, 55368, 57137, 2, 55368,
+	  57137, 1, 33281, 1, 24354, 1, 24354, 1, 14535, 2, 55372, 57016, 2, 55384,
+	  56794, 1, 24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1,
+	  24569, 1, 24705, 1, 14650, 1, 14620, 1, 24724, 2, 55369, 57044, 1, 24775,
+	  1, 24904, 1, 24908, 1, 24910, 1, 24908, 1, 24954, 1, 24974, 1, 25010, 1,
+	  24996, 1, 25007, 1, 25054, 1, 25074, 1, 25078, 1, 25104, 1, 25115, 1,
+	  25181, 1, 25265, 1, 25300, 1, 25424, 2, 55370, 57100, 1, 25405, 1, 25340,
+	  1, 25448, 1, 25475, 1, 25572, 2, 55370, 57329, 1, 25634, 1, 25541, 1,
+	  25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1, 25719, 1, 14956, 1,
+	  25935, 1, 25964, 2, 55372, 56330, 1, 26083, 1, 26360, 1, 26185, 1, 15129,
+	  1, 26257, 1, 15112, 1, 15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1,
+	  32941, 1, 17369, 1, 26391, 1, 26395, 1, 26401, 1, 26462, 1, 26451, 2,
+	  55372, 57283, 1, 15177, 1, 26618, 1, 26501, 1, 26706, 1, 26757, 2, 55373,
+	  56429, 1, 26766, 1, 26655, 1, 26900, 1, 15261, 1, 26946, 1, 27043, 1,
+	  27114, 1, 27304, 2, 55373, 56995, 1, 27355, 1, 15384, 1, 27425, 2, 55374,
+	  56487, 1, 27476, 1, 15438, 1, 27506, 1, 27551, 1, 27578, 1, 27579, 2,
+	  55374, 56973, 2, 55367, 56587, 2, 55374, 57082, 1, 27726, 2, 55375, 56508,
+	  1, 27839, 1, 27853, 1, 27751, 1, 27926, 1, 27966, 1, 28023, 1, 27969, 1,
+	  28009, 1, 28024, 1, 28037, 2, 55375, 56606, 1, 27956, 1, 28207, 1, 28270,
+	  1, 15667, 1, 28363, 1, 28359, 2, 55375, 57041, 1, 28153, 1, 28526, 2,
+	  55375, 57182, 2, 55375, 57230, 1, 28614, 1, 28729, 1, 28702, 1, 28699, 1,
+	  15766, 1, 28746, 1, 28797, 1, 28791, 1, 28845, 2, 55361, 56613, 1, 28997,
+	  2, 55376, 56931, 1, 29084, 2, 55376, 57259, 1, 29224, 1, 29237, 1, 29264,
+	  2, 55377, 56840, 1, 29312, 1, 29333, 2, 55377, 57141, 2, 55378, 56340, 1,
+	  29562, 1, 29579, 1, 16044, 1, 29605, 1, 16056, 1, 16056, 1, 29767, 1,
+	  29788, 1, 29809, 1, 29829, 1, 29898, 1, 16155, 1, 29988, 2, 55379, 56374,
+	  1, 30014, 2, 55379, 56466, 1, 30064, 2, 55368, 56735, 1, 30224, 2, 55379,
+	  57249, 2, 55379, 57272, 2, 55380, 56388, 1, 16380, 1, 16392, 1, 30452, 2,
+	  55380, 56563, 2, 55380, 56562, 2, 55380, 56601, 2, 55380, 56627, 1, 30494,
+	  1, 30495, 1, 30495, 1, 30538, 1, 16441, 1, 30603, 1, 16454, 1, 16534, 2,
+	  55381, 56349, 1, 30798, 1, 30860, 1, 30924, 1, 16611, 2, 55381, 56870, 1,
+	  31062, 2, 55381, 56986, 2, 55381, 57029, 1, 31119, 1, 31211, 1, 16687, 1,
+	  31296, 1, 31306, 1, 31311, 2, 55382, 56700, 2, 55382, 56999, 2, 55382,
+	  56999, 1, 31470, 1, 16898, 2, 55382, 57259, 1, 31686, 1, 31689, 1, 16935,
+	  2, 55383, 56448, 1, 31954, 1, 17056, 1, 31976, 1, 31971, 1, 32000, 2,
+	  55383, 57222, 1, 32099, 1, 17153, 1, 32199, 1, 32258, 1, 32325, 1, 17204,
+	  2, 55384, 56872, 2, 55384, 56903, 1, 17241, 2, 55384, 57049, 1, 32634, 2,
+	  55384, 57150, 1, 32661, 1, 32762, 1, 32773, 2, 55385, 56538, 2, 55385,
+	  56611, 1, 32864, 2, 55385, 56744, 1, 32880, 2, 55372, 57183, 1, 17365, 1,
+	  32946, 1, 33027, 1, 17419, 1, 33086, 1, 23221, 2, 55385, 57255, 2, 55385,
+	  57269, 2, 55372, 57235, 2, 55372, 57244, 1, 33281, 1, 33284, 1, 36766, 1,
+	  17515, 1, 33425, 1, 33419, 1, 33437, 1, 21171, 1, 33457, 1, 33459, 1,
+	  33469, 1, 33510, 2, 55386, 57148, 1, 33509, 1, 33565, 1, 33635, 1, 33709,
+	  1, 33571, 1, 33725, 1, 33767, 1, 33879, 1, 33619, 1, 33738, 1, 33740, 1,
+	  33756, 2, 55387, 56374, 2, 55387, 56683, 2, 55387, 56533, 1, 17707, 1,
+	  34033, 1, 34035, 1, 34070, 2, 55388, 57290, 1, 34148, 2, 55387, 57132, 1,
+	  17757, 1, 17761, 2, 55387, 57265, 2, 55388, 56530, 1, 17771, 1, 34384, 1,
+	  34396, 1, 34407, 1, 34409, 1, 34473, 1, 34440, 1, 34574, 1, 34530, 1,
+	  34681, 1, 34600, 1, 34667, 1, 34694, 1, 17879, 1, 34785, 1, 34817, 1,
+	  17913, 1, 34912, 1, 34915, 2, 55389, 56935, 1, 35031, 1, 35038, 1, 17973,
+	  1, 35066, 1, 13499, 2, 55390, 56494, 2, 55390, 56678, 1, 18110, 1, 18119,
+	  1, 35488, 1, 35565, 1, 35722, 1, 35925, 2, 55391, 56488, 1, 36011, 1,
+	  36033, 1, 36123, 1, 36215, 2, 55391, 57135, 2, 55362, 56324, 1, 36299, 1,
+	  36284, 1, 36336, 2, 55362, 56542, 1, 36564, 1, 36664, 2, 55393, 56786, 2,
+	  55393, 56813, 1, 37012, 1, 37105, 1, 37137, 2, 55393, 57134, 1, 37147, 1,
+	  37432, 1, 37591, 1, 37592, 1, 37500, 1, 37881, 1, 37909, 2, 55394, 57338,
+	  1, 38283, 1, 18837, 1, 38327, 2, 55395, 56695, 1, 18918, 1, 38595, 1,
+	  23986, 1, 38691, 2, 55396, 56645, 2, 55396, 56858, 1, 19054, 1, 19062, 1,
+	  38880, 2, 55397, 56330, 1, 19122, 2, 55397, 56470, 1, 38923, 1, 38923, 1,
+	  38953, 2, 55397, 56758, 1, 39138, 1, 19251, 1, 39209, 1, 39335, 1, 39362,
+	  1, 39422, 1, 19406, 2, 55398, 57136, 1, 39698, 1, 40000, 1, 40189, 1,
+	  19662, 1, 19693, 1, 40295, 2, 55400, 56526, 1, 19704, 2, 55400, 56581, 2,
+	  55400, 56846, 2, 55400, 56977, 1, 40635, 1, 19798, 1, 40697, 1, 40702, 1,
+	  40709, 1, 40719, 1, 40726, 1, 40763, 2, 55401, 56832 };
+
+	/// The pairs that compose to a primary composite, as first << 21 |
+	/// second and sorted, and what they compose to
+	inline constexpr uint64_t composition_pairs[941] = {
+	  125829944ULL, 127927096ULL, 130024248ULL, 136315648ULL, 136315649ULL,
+	  136315650ULL, 136315651ULL, 136315652ULL, 136315654ULL, 136315655ULL,
+	  136315656ULL, 136315657ULL, 136315658ULL, 136315660ULL, 136315663ULL,
+	  136315665ULL, 136315683ULL, 136315685ULL, 136315688ULL, 138412807ULL,
+	  138412835ULL, 138412849ULL, 140509953ULL, 140509954ULL, 140509959ULL,
+	  140509964ULL, 140509991ULL, 142607111ULL, 142607116ULL, 142607139ULL,
+	  142607143ULL, 142607149ULL, 142607153ULL, 144704256ULL, 144704257ULL,
+	  144704258ULL, 144704259ULL, 144704260ULL, 144704262ULL, 144704263ULL,
+	  144704264ULL, 144704265ULL, 144704268ULL, 144704271ULL, 144704273ULL,
+	  144704291ULL, 144704295ULL, 144704296ULL, 144704301ULL, 144704304ULL,
+	  146801415ULL, 148898561ULL, 148898562ULL, 148898564ULL, 148898566ULL,
+	  148898567ULL, 148898572ULL, 148898599ULL, 150995714ULL, 150995719ULL,
+	  150995720ULL, 150995724ULL, 150995747ULL, 150995751ULL, 150995758ULL,
+	  153092864ULL, 153092865ULL, 153092866ULL, 153092867ULL, 153092868ULL,
+	  153092870ULL, 153092871ULL, 153092872ULL, 153092873ULL, 153092876ULL,
+	  153092879ULL, 153092881ULL, 153092899ULL, 153092904ULL, 153092912ULL,
+	  155190018ULL, 157287169ULL, 157287180ULL, 157287203ULL, 157287207ULL,
+	  157287217ULL, 159384321ULL, 159384332ULL, 159384355ULL, 159384359ULL,
+	  159384365ULL, 159384369ULL, 161481473ULL, 161481479ULL, 161481507ULL,
+	  163578624ULL, 163578625ULL, 163578627ULL, 163578631ULL, 163578636ULL,
+	  163578659ULL, 163578663ULL, 163578669ULL, 163578673ULL, 165675776ULL,
+	  165675777ULL, 165675778ULL, 165675779ULL, 165675780ULL, 165675782ULL,
+	  165675783ULL, 165675784ULL, 165675785ULL, 165675787ULL, 165675788ULL,
+	  165675791ULL, 165675793ULL, 165675803ULL, 165675811ULL, 165675816ULL,
+	  167772929ULL, 167772935ULL, 171967233ULL, 171967239ULL, 171967244ULL,
+	  171967247ULL, 171967249ULL, 171967267ULL, 171967271ULL, 171967281ULL,
+	  174064385ULL, 174064386ULL, 174064391ULL, 174064396ULL, 174064419ULL,
+	  174064422ULL, 174064423ULL, 176161543ULL, 176161548ULL, 176161571ULL,
+	  176161574ULL, 176161575ULL, 176161581ULL, 176161585ULL, 178258688ULL,
+	  178258689ULL, 178258690ULL, 178258691ULL, 178258692ULL, 178258694ULL,
+	  178258696ULL, 178258697ULL, 178258698ULL, 178258699ULL, 178258700ULL,
+	  178258703ULL, 178258705ULL, 178258715ULL, 178258723ULL, 178258724ULL,
+	  178258728ULL, 178258733ULL, 178258736ULL, 180355843ULL, 180355875ULL,
+	  182452992ULL, 182452993ULL, 182452994ULL, 182452999ULL, 182453000ULL,
+	  182453027ULL, 184550151ULL, 184550152ULL, 186647296ULL, 186647297ULL,
+	  186647298ULL, 186647299ULL, 186647300ULL, 186647303ULL, 186647304ULL,
+	  186647305ULL, 186647331ULL, 188744449ULL, 188744450ULL, 188744455ULL,
+	  188744460ULL, 188744483ULL, 188744497ULL, 203424512ULL, 203424513ULL,
+	  203424514ULL, 203424515ULL, 203424516ULL, 203424518ULL, 203424519ULL,
+	  203424520ULL, 203424521ULL, 203424522ULL, 203424524ULL, 203424527ULL,
+	  203424529ULL, 203424547ULL, 203424549ULL, 203424552ULL, 205521671ULL,
+	  205521699ULL, 205521713ULL, 207618817ULL, 207618818ULL, 207618823ULL,
+	  207618828ULL, 207618855ULL, 209715975ULL, 209715980ULL, 209716003ULL,
+	  209716007ULL, 209716013ULL, 209716017ULL, 211813120ULL, 211813121ULL,
+	  211813122ULL, 211813123ULL, 211813124ULL, 211813126ULL, 211813127ULL,
+	  211813128ULL, 211813129ULL, 211813132ULL, 211813135ULL, 211813137ULL,
+	  211813155ULL, 211813159ULL, 211813160ULL, 211813165ULL, 211813168ULL,
+	  213910279ULL, 216007425ULL, 216007426ULL, 216007428ULL, 216007430ULL,
+	  216007431ULL, 216007436ULL, 216007463ULL, 218104578ULL, 218104583ULL,
+	  218104584ULL, 218104588ULL, 218104611ULL, 218104615ULL, 218104622ULL,
+	  218104625ULL, 220201728ULL, 220201729ULL, 220201730ULL, 220201731ULL,
+	  220201732ULL, 220201734ULL, 220201736ULL, 220201737ULL, 220201740ULL,
+	  220201743ULL, 220201745ULL, 220201763ULL, 220201768ULL, 220201776ULL,
+	  222298882ULL, 222298892ULL, 224396033ULL, 224396044ULL, 224396067ULL,
+	  224396071ULL, 224396081ULL, 226493185ULL, 226493196ULL, 226493219ULL,
+	  226493223ULL, 226493229ULL, 226493233ULL, 228590337ULL, 228590343ULL,
+	  228590371ULL, 230687488ULL, 230687489ULL, 230687491ULL, 230687495ULL,
+	  230687500ULL, 230687523ULL, 230687527ULL, 230687533ULL, 230687537ULL,
+	  232784640ULL, 232784641ULL, 232784642ULL, 232784643ULL, 232784644ULL,
+	  232784646ULL, 232784647ULL, 232784648ULL, 232784649ULL, 232784651ULL,
+	  232784652ULL, 232784655ULL, 232784657ULL, 232784667ULL, 232784675ULL,
+	  232784680ULL, 234881793ULL, 234881799ULL, 239076097ULL, 239076103ULL,
+	  239076108ULL, 239076111ULL, 239076113ULL, 239076131ULL, 239076135ULL,
+	  239076145ULL, 241173249ULL, 241173250ULL, 241173255ULL, 241173260ULL,
+	  241173283ULL, 241173286ULL, 241173287ULL, 243270407ULL, 243270408ULL,
+	  243270412ULL, 243270435ULL, 243270438ULL, 243270439ULL, 243270445ULL,
+	  243270449ULL, 245367552ULL, 245367553ULL, 245367554ULL, 245367555ULL,
+	  245367556ULL, 245367558ULL, 245367560ULL, 245367561ULL, 245367562ULL,
+	  245367563ULL, 245367564ULL, 245367567ULL, 245367569ULL, 245367579ULL,
+	  245367587ULL, 245367588ULL, 245367592ULL, 245367597ULL, 245367600ULL,
+	  247464707ULL, 247464739ULL, 249561856ULL, 249561857ULL, 249561858ULL,
+	  249561863ULL, 249561864ULL, 249561866ULL, 249561891ULL, 251659015ULL,
+	  251659016ULL, 253756160ULL, 253756161ULL, 253756162ULL, 253756163ULL,
+	  253756164ULL, 253756167ULL, 253756168ULL, 253756169ULL, 253756170ULL,
+	  253756195ULL, 255853313ULL, 255853314ULL, 255853319ULL, 255853324ULL,
+	  255853347ULL, 255853361ULL, 352322304ULL, 352322305ULL, 352322370ULL,
+	  406848256ULL, 406848257ULL, 406848259ULL, 406848265ULL, 411042564ULL,
+	  413139713ULL, 415236865ULL, 415236868ULL, 417334017ULL, 423625472ULL,
+	  423625473ULL, 423625475ULL, 423625481ULL, 434111233ULL, 444596992ULL,
+	  444596993ULL, 444596995ULL, 444597001ULL, 446694145ULL, 446694148ULL,
+	  446694152ULL, 448791300ULL, 452985601ULL, 461374208ULL, 461374209ULL,
+	  461374212ULL, 461374220ULL, 473957120ULL, 473957121ULL, 473957123ULL,
+	  473957129ULL, 478151428ULL, 480248577ULL, 482345729ULL, 482345732ULL,
+	  484442881ULL, 490734336ULL, 490734337ULL, 490734339ULL, 490734345ULL,
+	  501220097ULL, 511705856ULL, 511705857ULL, 511705859ULL, 511705865ULL,
+	  513803009ULL, 513803012ULL, 513803016ULL, 515900164ULL, 520094465ULL,
+	  528483072ULL, 528483073ULL, 528483076ULL, 528483084ULL, 541065984ULL,
+	  541065985ULL, 541065987ULL, 541065993ULL, 543163136ULL, 543163137ULL,
+	  543163139ULL, 543163145ULL, 574620416ULL, 574620417ULL, 576717568ULL,
+	  576717569ULL, 696255232ULL, 696255233ULL, 698352384ULL, 698352385ULL,
+	  725615367ULL, 727712519ULL, 738198279ULL, 740295431ULL, 754975489ULL,
+	  757072641ULL, 759169800ULL, 761266952ULL, 803209991ULL, 872416000ULL,
+	  872416001ULL, 872416003ULL, 872416009ULL, 872416035ULL, 874513152ULL,
+	  874513153ULL, 874513155ULL, 874513161ULL, 874513187ULL, 903873280ULL,
+	  903873281ULL, 903873283ULL, 903873289ULL, 903873315ULL, 905970432ULL,
+	  905970433ULL, 905970435ULL, 905970441ULL, 905970467ULL, 920650508ULL,
+	  1027605252ULL, 1029702404ULL, 1153434372ULL, 1155531524ULL, 1157628678ULL,
+	  1159725830ULL, 1170211588ULL, 1172308740ULL, 1379926796ULL, 1914700544ULL,
+	  1914700545ULL, 1914700548ULL, 1914700550ULL, 1914700563ULL, 1914700564ULL,
+	  1914700613ULL, 1923089152ULL, 1923089153ULL, 1923089171ULL, 1923089172ULL,
+	  1927283456ULL, 1927283457ULL, 1927283475ULL, 1927283476ULL, 1927283525ULL,
+	  1931477760ULL, 1931477761ULL, 1931477764ULL, 1931477766ULL, 1931477768ULL,
+	  1931477779ULL, 1931477780ULL, 1944060672ULL, 1944060673ULL, 1944060691ULL,
+	  1944060692ULL, 1948254996ULL, 1956643584ULL, 1956643585ULL, 1956643588ULL,
+	  1956643590ULL, 1956643592ULL, 1956643604ULL, 1965032192ULL, 1965032193ULL,
+	  1965032211ULL, 1965032212ULL, 1965032261ULL, 1971323717ULL, 1975518021ULL,
+	  1981809408ULL, 1981809409ULL, 1981809412ULL, 1981809414ULL, 1981809427ULL,
+	  1981809428ULL, 1981809474ULL, 1981809477ULL, 1990198016ULL, 1990198017ULL,
+	  1990198035ULL, 1990198036ULL, 1994392320ULL, 1994392321ULL, 1994392339ULL,
+	  1994392340ULL, 1994392386ULL, 1994392389ULL, 1998586624ULL, 1998586625ULL,
+	  1998586628ULL, 1998586630ULL, 1998586632ULL, 1998586643ULL, 1998586644ULL,
+	  1998586690ULL, 2011169536ULL, 2011169537ULL, 2011169555ULL, 2011169556ULL,
+	  2015363859ULL, 2015363860ULL, 2023752448ULL, 2023752449ULL, 2023752452ULL,
+	  2023752454ULL, 2023752456ULL, 2023752467ULL, 2023752468ULL, 2023752514ULL,
+	  2032141056ULL, 2032141057ULL, 2032141075ULL, 2032141076ULL, 2032141122ULL,
+	  2032141125ULL, 2034238208ULL, 2034238209ULL, 2034238274ULL, 2036335360ULL,
+	  2036335361ULL, 2036335426ULL, 2042626885ULL, 2051015425ULL, 2051015432ULL,
+	  2160067336ULL, 2181038854ULL, 2181038856ULL, 2187330305ULL, 2191524608ULL,
+	  2191524614ULL, 2191524616ULL, 2193621766ULL, 2193621768ULL, 2195718920ULL,
+	  2197816064ULL, 2197816068ULL, 2197816070ULL, 2197816072ULL, 2202010369ULL,
+	  2210398984ULL, 2220884740ULL, 2220884742ULL, 2220884744ULL, 2220884747ULL,
+	  2229273352ULL, 2237661960ULL, 2241856264ULL, 2248147718ULL, 2248147720ULL,
+	  2254439169ULL, 2258633472ULL, 2258633478ULL, 2258633480ULL, 2260730630ULL,
+	  2260730632ULL, 2262827784ULL, 2264924928ULL, 2264924932ULL, 2264924934ULL,
+	  2264924936ULL, 2269119233ULL, 2277507848ULL, 2287993604ULL, 2287993606ULL,
+	  2287993608ULL, 2287993611ULL, 2296382216ULL, 2304770824ULL, 2308965128ULL,
+	  2327839496ULL, 2390754063ULL, 2392851215ULL, 2600469256ULL, 2602566408ULL,
+	  2634023688ULL, 2636120840ULL, 3303016019ULL, 3303016020ULL, 3303016021ULL,
+	  3372222036ULL, 3376416340ULL, 3625977428ULL, 3661629012ULL, 3667920468ULL,
+	  4915726652ULL, 4932503868ULL, 4938795324ULL, 5249173950ULL, 5249173975ULL,
+	  6054480702ULL, 6054480726ULL, 6054480727ULL, 6211767255ULL, 6320819134ULL,
+	  6320819159ULL, 6322916286ULL, 6589254742ULL, 6843010261ULL, 6857690306ULL,
+	  6857690325ULL, 6857690326ULL, 6866078933ULL, 7126125886ULL, 7126125911ULL,
+	  7128223038ULL, 7434407370ULL, 7434407375ULL, 7434407391ULL, 7440698826ULL,
+	  8667533358ULL, 14506007349ULL, 14510201653ULL, 14514395957ULL,
+	  14518590261ULL, 14522784565ULL, 14531173173ULL, 14617156405ULL,
+	  14621350709ULL, 14625545013ULL, 14627642165ULL, 14633933621ULL,
+	  16219374340ULL, 16221471492ULL, 16294871812ULL, 16296968964ULL,
+	  16311649031ULL, 16313746183ULL, 16441672450ULL, 16441672454ULL,
+	  16443769602ULL, 16443769606ULL, 16492004098ULL, 16494101250ULL,
+	  16533947138ULL, 16536044290ULL, 16642999040ULL, 16642999041ULL,
+	  16642999106ULL, 16642999109ULL, 16645096192ULL, 16645096193ULL,
+	  16645096258ULL, 16645096261ULL, 16647193413ULL, 16649290565ULL,
+	  16651387717ULL, 16653484869ULL, 16655582021ULL, 16657679173ULL,
+	  16659776256ULL, 16659776257ULL, 16659776322ULL, 16659776325ULL,
+	  16661873408ULL, 16661873409ULL, 16661873474ULL, 16661873477ULL,
+	  16663970629ULL, 16666067781ULL, 16668164933ULL, 16670262085ULL,
+	  16672359237ULL, 16674456389ULL, 16676553472ULL, 16676553473ULL,
+	  16678650624ULL, 16678650625ULL, 16693330688ULL, 16693330689ULL,
+	  16695427840ULL, 16695427841ULL, 16710107904ULL, 16710107905ULL,
+	  16710107970ULL, 16710107973ULL, 16712205056ULL, 16712205057ULL,
+	  16712205122ULL, 16712205125ULL, 16714302277ULL, 16716399429ULL,
+	  16718496581ULL, 16720593733ULL, 16722690885ULL, 16724788037ULL,
+	  16726885120ULL, 16726885121ULL, 16726885186ULL, 16726885189ULL,
+	  16728982272ULL, 16728982273ULL, 16728982338ULL, 16728982341ULL,
+	  16731079493ULL, 16733176645ULL, 16735273797ULL, 16737370949ULL,
+	  16739468101ULL, 16741565253ULL, 16743662336ULL, 16743662337ULL,
+	  16743662402ULL, 16745759488ULL, 16745759489ULL, 16745759554ULL,
+	  16760439552ULL, 16760439553ULL, 16760439618ULL, 16762536704ULL,
+	  16762536705ULL, 16762536770ULL, 16777216768ULL, 16777216769ULL,
+	  16779313920ULL, 16779313921ULL, 16793993984ULL, 16793993985ULL,
+	  16796091136ULL, 16796091137ULL, 16810771200ULL, 16810771201ULL,
+	  16810771266ULL, 16812868352ULL, 16812868353ULL, 16812868418ULL,
+	  16829645568ULL, 16829645569ULL, 16829645634ULL, 16844325632ULL,
+	  16844325633ULL, 16844325698ULL, 16844325701ULL, 16846422784ULL,
+	  16846422785ULL, 16846422850ULL, 16846422853ULL, 16848520005ULL,
+	  16850617157ULL, 16852714309ULL, 16854811461ULL, 16856908613ULL,
+	  16859005765ULL, 16861102848ULL, 16861102849ULL, 16861102914ULL,
+	  16861102917ULL, 16863200000ULL, 16863200001ULL, 16863200066ULL,
+	  16863200069ULL, 16865297221ULL, 16867394373ULL, 16869491525ULL,
+	  16871588677ULL, 16873685829ULL, 16875782981ULL, 16877880133ULL,
+	  16886268741ULL, 16903045957ULL, 17024680773ULL, 17043555072ULL,
+	  17043555073ULL, 17043555138ULL, 17058235205ULL, 17158898501ULL,
+	  17175675648ULL, 17175675649ULL, 17175675714ULL, 18018730808ULL,
+	  18022925112ULL, 18027119416ULL, 18152948536ULL, 18157142840ULL,
+	  18161337144ULL, 18259903288ULL, 18270389048ULL, 18276680504ULL,
+	  18327012152ULL, 18331206456ULL, 18379440952ULL, 18394121016ULL,
+	  18398315320ULL, 18404606776ULL, 18415092536ULL, 18457035576ULL,
+	  18463327032ULL, 18465424184ULL, 18492687160ULL, 18494784312ULL,
+	  18501075768ULL, 18503172920ULL, 18509464376ULL, 18511561528ULL,
+	  18513658680ULL, 18515755832ULL, 18526241592ULL, 18528338744ULL,
+	  18534630200ULL, 18536727352ULL, 18557698872ULL, 18559796024ULL,
+	  18593350456ULL, 18605933368ULL, 18608030520ULL, 18612224824ULL,
+	  18626904888ULL, 18629002040ULL, 18631099192ULL, 18633196344ULL,
+	  25916616857ULL, 25927102617ULL, 25931296921ULL, 25935491225ULL,
+	  25939685529ULL, 25943879833ULL, 25948074137ULL, 25952268441ULL,
+	  25956462745ULL, 25960657049ULL, 25964851353ULL, 25969045657ULL,
+	  25973239961ULL, 25979531417ULL, 25983725721ULL, 25987920025ULL,
+	  26002600089ULL, 26002600090ULL, 26008891545ULL, 26008891546ULL,
+	  26015183001ULL, 26015183002ULL, 26021474457ULL, 26021474458ULL,
+	  26027765913ULL, 26027765914ULL, 26099069081ULL, 26117943449ULL,
+	  26128429209ULL, 26132623513ULL, 26136817817ULL, 26141012121ULL,
+	  26145206425ULL, 26149400729ULL, 26153595033ULL, 26157789337ULL,
+	  26161983641ULL, 26166177945ULL, 26170372249ULL, 26174566553ULL,
+	  26180858009ULL, 26185052313ULL, 26189246617ULL, 26203926681ULL,
+	  26203926682ULL, 26210218137ULL, 26210218138ULL, 26216509593ULL,
+	  26216509594ULL, 26222801049ULL, 26222801050ULL, 26229092505ULL,
+	  26229092506ULL, 26271035545ULL, 26273132697ULL, 26275229849ULL,
+	  26277327001ULL, 26300395673ULL, 146349822138ULL, 146354016442ULL,
+	  146374987962ULL, 146668589351ULL, 146670686503ULL, 147788469054ULL,
+	  147788469079ULL, 148564415664ULL, 148564415674ULL, 148564415677ULL,
+	  149099189679ULL, 149101286831ULL, 150971947312ULL };
+	inline constexpr char32_t composition_values[941] = {
+	  8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842, 197, 461,
+	  512, 514, 7840, 7680, 260, 7682, 7684, 7686, 262, 264, 266, 268, 199, 7690,
+	  270, 7692, 7696, 7698, 7694, 200, 201, 202, 7868, 274, 276, 278, 203, 7866,
+	  282, 516, 518, 7864, 552, 280, 7704, 7706, 7710, 500, 284, 7712, 286, 288,
+	  486, 290, 292, 7714, 7718, 542, 7716, 7720, 7722, 204, 205, 206, 296, 298,
+	  300, 304, 207, 7880, 463, 520, 522, 7882, 302, 7724, 308, 7728, 488, 7730,
+	  310, 7732, 313, 317, 7734, 315, 7740, 7738, 7742, 7744, 7746, 504, 323,
+	  209, 7748, 327, 7750, 325, 7754, 7752, 210, 211, 212, 213, 332, 334, 558,
+	  214, 7886, 336, 465, 524, 526, 416, 7884, 490, 7764, 7766, 340, 7768, 344,
+	  528, 530, 7770, 342, 7774, 346, 348, 7776, 352, 7778, 536, 350, 7786, 356,
+	  7788, 538, 354, 7792, 7790, 217, 218, 219, 360, 362, 364, 220, 7910, 366,
+	  368, 467, 532, 534, 431, 7908, 7794, 370, 7798, 7796, 7804, 7806, 7808,
+	  7810, 372, 7814, 7812, 7816, 7818, 7820, 7922, 221, 374, 7928, 562, 7822,
+	  376, 7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227, 257,
+	  259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261, 7683, 7685, 7687,
+	  263, 265, 267, 269, 231, 7691, 271, 7693, 7697, 7699, 7695, 232, 233, 234,
+	  7869, 275, 277, 279, 235, 7867, 283, 517, 519, 7865, 553, 281, 7705, 7707,
+	  7711, 501, 285, 7713, 287, 289, 487, 291, 293, 7715, 7719, 543, 7717, 7721,
+	  7723, 7830, 236, 237, 238, 297, 299, 301, 239, 7881, 464, 521, 523, 7883,
+	  303, 7725, 309, 496, 7729, 489, 7731, 311, 7733, 314, 318, 7735, 316, 7741,
+	  7739, 7743, 7745, 7747, 505, 324, 241, 7749, 328, 7751, 326, 7755, 7753,
+	  242, 243, 244, 245, 333, 335, 559, 246, 7887, 337, 466, 525, 527, 417,
+	  7885, 491, 7765, 7767, 341, 7769, 345, 529, 531, 7771, 343, 7775, 347, 349,
+	  7777, 353, 7779, 537, 351, 7787, 7831, 357, 7789, 539, 355, 7793, 7791,
+	  249, 250, 251, 361, 363, 365, 252, 7911, 367, 369, 468, 533, 535, 432,
+	  7909, 7795, 371, 7799, 7797, 7805, 7807, 7809, 7811, 373, 7815, 7813, 7832,
+	  7817, 7819, 7821, 7923, 253, 375, 7929, 563, 7823, 255, 7927, 7833, 7925,
+	  378, 7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844, 7850, 7848,
+	  478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726, 7890, 7888, 7894,
+	  7892, 7756, 556, 7758, 554, 510, 475, 471, 469, 473, 7847, 7845, 7851,
+	  7849, 479, 507, 509, 483, 7689, 7873, 7871, 7877, 7875, 7727, 7891, 7889,
+	  7895, 7893, 7757, 557, 7759, 555, 511, 476, 472, 470, 474, 7856, 7854,
+	  7860, 7858, 7857, 7855, 7861, 7859, 7700, 7702, 7701, 7703, 7760, 7762,
+	  7761, 7763, 7780, 7781, 7782, 7783, 7800, 7801, 7802, 7803, 7835, 7900,
+	  7898, 7904, 7902, 7906, 7901, 7899, 7905, 7903, 7907, 7914, 7912, 7918,
+	  7916, 7920, 7915, 7913, 7919, 7917, 7921, 494, 492, 493, 480, 481, 7708,
+	  7709, 560, 561, 495, 8122, 902, 8121, 8120, 7944, 7945, 8124, 8136, 904,
+	  7960, 7961, 8138, 905, 7976, 7977, 8140, 8154, 906, 8153, 8152, 938, 7992,
+	  7993, 8184, 908, 8008, 8009, 8172, 8170, 910, 8169, 8168, 939, 8025, 8186,
+	  911, 8040, 8041, 8188, 8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118,
+	  8115, 8050, 941, 7952, 7953, 8052, 942, 7968, 7969, 8134, 8131, 8054, 943,
+	  8145, 8144, 970, 7984, 7985, 8150, 8056, 972, 8000, 8001, 8164, 8165, 8058,
+	  973, 8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032, 8033, 8182, 8179,
+	  8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980, 1031, 1232, 1234, 1027,
+	  1024, 1238, 1025, 1217, 1244, 1246, 1037, 1250, 1049, 1252, 1036, 1254,
+	  1262, 1038, 1264, 1266, 1268, 1272, 1260, 1233, 1235, 1107, 1104, 1239,
+	  1105, 1218, 1245, 1247, 1117, 1251, 1081, 1253, 1116, 1255, 1263, 1118,
+	  1265, 1267, 1269, 1273, 1261, 1111, 1142, 1143, 1242, 1243, 1258, 1259,
+	  1570, 1571, 1573, 1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356, 2507,
+	  2508, 2891, 2888, 2892, 2964, 3018, 3020, 3019, 3144, 3264, 3274, 3271,
+	  3272, 3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918, 6920,
+	  6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737, 7772,
+	  7773, 7784, 7785, 7852, 7862, 7853, 7863, 7878, 7879, 7896, 7897, 7938,
+	  7940, 7942, 8064, 7939, 7941, 7943, 8065, 8066, 8067, 8068, 8069, 8070,
+	  8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951, 8073, 8074, 8075, 8076,
+	  8077, 8078, 8079, 7954, 7956, 7955, 7957, 7962, 7964, 7963, 7965, 7970,
+	  7972, 7974, 8080, 7971, 7973, 7975, 8081, 8082, 8083, 8084, 8085, 8086,
+	  8087, 7978, 7980, 7982, 8088, 7979, 7981, 7983, 8089, 8090, 8091, 8092,
+	  8093, 8094, 8095, 7986, 7988, 7990, 7987, 7989, 7991, 7994, 7996, 7998,
+	  7995, 7997, 7999, 8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013, 8018,
+	  8020, 8022, 8019, 8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038, 8096,
+	  8035, 8037, 8039, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8042, 8044,
+	  8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110, 8111,
+	  8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157, 8158, 8159,
+	  8602, 8603, 8622, 8653, 8655, 8654, 8708, 8713, 8716, 8740, 8742, 8769,
+	  8772, 8775, 8777, 8813, 8802, 8816, 8817, 8820, 8821, 8824, 8825, 8832,
+	  8833, 8928, 8929, 8836, 8837, 8840, 8841, 8930, 8931, 8876, 8877, 8878,
+	  8879, 8938, 8939, 8940, 8941, 12436, 12364, 12366, 12368, 12370, 12372,
+	  12374, 12376, 12378, 12380, 12382, 12384, 12386, 12389, 12391, 12393,
+	  12400, 12401, 12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413,
+	  12446, 12532, 12460, 12462, 12464, 12466, 12468, 12470, 12472, 12474,
+	  12476, 12478, 12480, 12482, 12485, 12487, 12489, 12496, 12497, 12499,
+	  12500, 12502, 12503, 12505, 12506, 12508, 12509, 12535, 12536, 12537,
+	  12538, 12542, 69786, 69788, 69803, 69934, 69935, 70475, 70476, 70844,
+	  70843, 70846, 71098, 71099, 71992 };
+
+	/// For NFC, NFD, NFKC and NFKD a bit for each lead byte whose code
+	/// points are all Quick_Check Yes and combining class 0
+	inline constexpr uint64_t normalization_safe_leads[4][4] = {
+	  { 0x0000000000000000ULL, 0x0000000000000000ULL,
+	    0x0000000000000000ULL, 0x001E7BF0443B8FFCULL },
+	  { 0x0000000000000000ULL, 0x0000000000000000ULL,
+	    0x0000000000000000ULL, 0x001E43F044300E04ULL },
+	  { 0x0000000000000000ULL, 0x0000000000000000ULL,
+	    0x0000000000000000ULL, 0x001E7BF0443B0348ULL },
+	  { 0x0000000000000000ULL, 0x0000000000000000ULL,
+	    0x0000000000000000ULL, 0x001E43F044300200ULL } };
+} // namespace daw::range::impl
@@ -0,0 +1,139 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/checked.h"
+#include "daw/utf8/core.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+	using daw::utf8::internal::utf_error;
+
+	/// Both engines must agree on the error, code point and final position
+	void compare_engines( std::string const &str ) {
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto it_classic = first;
+		auto it_dfa = first;
+		uint32_t cp_classic = 0;
+		uint32_t cp_dfa = 0;
+		auto const err_classic = daw::utf8::engine::classic::validate_next(
+		  it_classic, last, cp_classic );
+		auto const err_dfa =
+		  daw::utf8::engine::dfa::validate_next( it_dfa, last, cp_dfa );
+		daw::expecting( err_classic == err_dfa );
+		daw::expecting( it_classic == it_dfa );
+		if( err_classic == utf_error::UTF8_OK ) {
+			daw::expecting( cp_classic, cp_dfa );
+		}
+		daw::expecting( daw::utf8::find_invalid( first, last ) ==
+		                daw::utf8::find_invalid<daw::utf8::engine::dfa>( first,
+		                                                                 last ) );
+	}
+
+	std::string bytes( std::initializer_list<unsigned> values ) {
+		auto result = std::string( );
+		for( auto v : values ) {
+			result.push_back( static_cast<char>( v ) );
+		}
+		return result;
+	}
+} // namespace
+
+void dfa_short_sequences_test_001( ) {
+	for( unsigned a = 0; a < 256; ++a ) {
+		compare_engines( bytes( { a } ) );
+		for( unsigned b = 0; b < 256; ++b ) {
+			compare_engines( bytes( { a, b } ) );
+		}
+	}
+}
+
+void dfa_three_octet_test_001( ) {
+	for( unsigned a = 0xC0; a < 0x100; ++a ) {
+		for( unsigned b = 0; b < 256; ++b ) {
+			for( unsigned c = 0x70; c < 0xD0; ++c ) {
+				compare_engines( bytes( { a, b, c } ) );
+			}
+		}
+	}
+}
+
+void dfa_four_octet_test_001( ) {
+	for( unsigned a = 0xF0; a < 0xF8; ++a ) {
+		for( unsigned b = 0x70; b < 0xD0; b += 3 ) {
+			for( auto c : { 0x41U, 0x80U, 0xBFU, 0xC0U } ) {
+				for( auto d : { 0x41U, 0x80U, 0x9AU, 0xBFU, 0xC0U } ) {
+					compare_engines( bytes( { a, b, c, d } ) );
+					compare_engines( bytes( { a, b, c, d, 0x41U } ) );
+				}
+			}
+		}
+	}
+}
+
+void dfa_find_invalid_test_001( ) {
+	auto const good = std::string( "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z" );
+	for( size_t n = 0; n <= good.size( ); ++n ) {
+		// Truncating mid sequence must report the start of that sequence
+		compare_engines( good.substr( 0, n ) );
+		auto const str = good.substr( 0, n );
+		daw::expecting(
+		  daw::utf8::find_invalid( str.data( ), str.data( ) + str.size( ) ) ==
+		  daw::utf8::find_invalid<daw::utf8::engine::dfa>(
+		    str.data( ), str.data( ) + str.size( ) ) );
+	}
+	auto const bad = good + "\xED\xA0\x80" + good;
+	auto const pos = daw::utf8::find_invalid<daw::utf8::engine::dfa>(
+	  bad.data( ), bad.data( ) + bad.size( ) );
+	daw::expecting( pos == bad.data( ) + good.size( ) );
+}
+
+void dfa_iterator_test_001( ) {
+	auto const str = std::string( "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z" );
+	using iterator_t =
+	  daw::utf8::iterator<std::string::const_iterator, daw::utf8::engine::dfa>;
+	auto first = iterator_t( str.begin( ), str.begin( ), str.end( ) );
+	auto const last = iterator_t( str.end( ), str.begin( ), str.end( ) );
+	auto const expected =
+	  std::vector<uint32_t>{ 0x61, 0xE9, 0x20AC, 0x1F600, 0x7A };
+	auto result = std::vector<uint32_t>( first, last );
+	daw::expecting( result == expected );
+	auto rit = last;
+	--rit;
+	--rit;
+	daw::expecting( *rit, 0x1F600U );
+	auto const bad = std::string( "a\xE2\x28\xA1" );
+	auto it = iterator_t( bad.begin( ), bad.begin( ), bad.end( ) );
+	++it;
+	bool has_thrown = false;
+	try {
+		(void)*it;
+	} catch( daw::utf8::invalid_utf8 const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+}
+
+static_assert( [] {
+	constexpr char str[] = "\xE2\x82\xAC";
+	auto it = str;
+	return daw::utf8::next<daw::utf8::engine::dfa>( it, str + 3 ) == 0x20ACU;
+}( ) );
+
+int main( ) {
+	dfa_short_sequences_test_001( );
+	dfa_three_octet_test_001( );
+	dfa_four_octet_test_001( );
+	dfa_find_invalid_test_001( );
+	dfa_iterator_test_001( );
+	std::cout << "dfa tests passed\n";
+}
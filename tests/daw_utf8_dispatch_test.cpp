@@ -0,0 +1,619 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/checked.h"
+#include "daw/utf8/dispatch.h"
+#include "daw/utf8/unchecked.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	using daw::utf8::dispatch::isa;
+
+	/// Random valid UTF-8 with long ASCII runs so every block path is hit
+	std::string random_utf8( std::mt19937 &rng, size_t count,
+	                         bool bmp_only = false ) {
+		auto result = std::string( );
+		auto pick = std::uniform_int_distribution<int>( 0, bmp_only ? 2 : 9 );
+		for( size_t n = 0; n < count; ++n ) {
+			uint32_t cp = 0;
+			switch( pick( rng ) ) {
+			case 0:
+				cp = std::uniform_int_distribution<uint32_t>( 0x80, 0x7FF )( rng );
+				break;
+			case 1:
+				cp = std::uniform_int_distribution<uint32_t>( 0x800, 0xD7FF )( rng );
+				break;
+			case 2:
+				cp = std::uniform_int_distribution<uint32_t>( 0xE000, 0xFFFF )( rng );
+				break;
+			case 3:
+				cp =
+				  std::uniform_int_distribution<uint32_t>( 0x10000, 0x10FFFF )( rng );
+				break;
+			default:
+				cp = std::uniform_int_distribution<uint32_t>( 0, 0x7F )( rng );
+				break;
+			}
+			daw::utf8::append( cp, std::back_inserter( result ) );
+		}
+		return result;
+	}
+
+	void check_tier( isa tier, std::string const &str ) {
+		daw::expecting( daw::utf8::dispatch::set_isa( tier ), tier );
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto const expected = daw::utf8::find_invalid( first, last );
+		daw::expecting( daw::utf8::dispatch::find_invalid( first, last ) - first,
+		                expected - first );
+		if( expected != last ) {
+			return;
+		}
+		daw::expecting(
+		  daw::utf8::dispatch::count_code_points( first, last ),
+		  static_cast<size_t>( daw::utf8::unchecked::distance( first, last ) ) );
+
+		auto u16 = std::u16string( str.size( ), u'\0' );
+		auto exp16 = std::u16string( str.size( ), u'\0' );
+		u16.resize( static_cast<size_t>(
+		  daw::utf8::dispatch::utf8to16( first, last, u16.data( ) ) -
+		  u16.data( ) ) );
+		exp16.resize( static_cast<size_t>(
+		  daw::utf8::unchecked::utf8to16( first, last, exp16.data( ) ) -
+		  exp16.data( ) ) );
+		daw::expecting( u16 == exp16 );
+
+		auto u32 = std::u32string( str.size( ), U'\0' );
+		auto exp32 = std::u32string( str.size( ), U'\0' );
+		u32.resize( static_cast<size_t>(
+		  daw::utf8::dispatch::utf8to32( first, last, u32.data( ) ) -
+		  u32.data( ) ) );
+		exp32.resize( static_cast<size_t>(
+		  daw::utf8::unchecked::utf8to32( first, last, exp32.data( ) ) -
+		  exp32.data( ) ) );
+		daw::expecting( u32 == exp32 );
+
+		auto back = std::string( u16.size( ) * 3U, '\0' );
+		back.resize( static_cast<size_t>(
+		  daw::utf8::dispatch::utf16to8( u16.data( ), u16.data( ) + u16.size( ),
+		                                 back.data( ) ) -
+		  back.data( ) ) );
+		daw::expecting( back, str );
+
+		back.assign( u32.size( ) * 4U, '\0' );
+		back.resize( static_cast<size_t>(
+		  daw::utf8::dispatch::utf32to8( u32.data( ), u32.data( ) + u32.size( ),
+		                                 back.data( ) ) -
+		  back.data( ) ) );
+		daw::expecting( back, str );
+	}
+
+	/// Reference validation of UTF-16 in host order
+	char16_t const *find_invalid_utf16( char16_t const *first,
+	                                    char16_t const *last ) {
+		for( auto it = first; it != last; ++it ) {
+			if( daw::utf8::internal::is_lead_surrogate( *it ) ) {
+				if( it + 1 == last or
+				    not daw::utf8::internal::is_trail_surrogate( it[1] ) ) {
+					return it;
+				}
+				++it;
+			} else if( daw::utf8::internal::is_trail_surrogate( *it ) ) {
+				return it;
+			}
+		}
+		return last;
+	}
+
+	std::u16string byte_swapped( std::u16string str ) {
+		for( auto &c : str ) {
+			c = static_cast<char16_t>( ( c >> 8U ) | ( c << 8U ) );
+		}
+		return str;
+	}
+
+	void check_utf16_tier( isa tier, std::u16string const &str ) {
+		namespace dispatch = daw::utf8::dispatch;
+		daw::expecting( dispatch::set_isa( tier ), tier );
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto const expected = find_invalid_utf16( first, last );
+		daw::expecting( dispatch::find_invalid_utf16( first, last ) - first,
+		                expected - first );
+		auto const swapped = byte_swapped( str );
+		auto const sfirst = swapped.data( );
+		auto const slast = sfirst + swapped.size( );
+		auto const found_swapped =
+		  daw::utf8::simd::big_endian_host
+		    ? dispatch::find_invalid_utf16le( sfirst, slast )
+		    : dispatch::find_invalid_utf16be( sfirst, slast );
+		daw::expecting( found_swapped - sfirst, expected - first );
+		if( expected != last ) {
+			return;
+		}
+		auto const count = static_cast<size_t>(
+		  std::count_if( first, last, []( char16_t c ) {
+			  return not daw::utf8::internal::is_trail_surrogate( c );
+		  } ) );
+		daw::expecting( dispatch::utf16_count_code_points( first, last ), count );
+		auto const count_swapped =
+		  daw::utf8::simd::big_endian_host
+		    ? dispatch::utf16le_count_code_points( sfirst, slast )
+		    : dispatch::utf16be_count_code_points( sfirst, slast );
+		daw::expecting( count_swapped, count );
+	}
+
+	std::u16string to_u16( std::string const &str ) {
+		auto result = std::u16string( );
+		daw::utf8::unchecked::utf8to16( str.begin( ), str.end( ),
+		                                std::back_inserter( result ) );
+		return result;
+	}
+	/// Random Latin-1 with ASCII runs, a code point above U+FF is put at
+	/// bad_pos when it is less than count
+	std::string random_latin1_utf8( std::mt19937 &rng, size_t count,
+	                                size_t bad_pos ) {
+		auto result = std::string( );
+		auto pick = std::uniform_int_distribution<int>( 0, 3 );
+		auto high = std::uniform_int_distribution<uint32_t>( 0x80, 0xFF );
+		auto low = std::uniform_int_distribution<uint32_t>( 0, 0x7F );
+		for( size_t n = 0; n < count; ++n ) {
+			auto const cp = n == bad_pos  ? 0x100U + high( rng )
+			                : pick( rng ) ? low( rng )
+			                              : high( rng );
+			daw::utf8::append( cp, std::back_inserter( result ) );
+		}
+		return result;
+	}
+
+	/// Buffers are sized exactly so the sanitizers catch any write past them
+	void check_latin1_tier( isa tier, std::string const &str ) {
+		namespace dispatch = daw::utf8::dispatch;
+		daw::expecting( dispatch::set_isa( tier ), tier );
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto expected = std::string( );
+		auto stop = first;
+		while( stop != last ) {
+			auto it = stop;
+			auto const cp = daw::utf8::unchecked::next( it );
+			if( cp > 0xFFU ) {
+				break;
+			}
+			expected.push_back( static_cast<char>( cp ) );
+			stop = it;
+		}
+		auto latin1 =
+		  std::vector<char>( dispatch::utf8_latin1_length( first, last ) );
+		auto const result = dispatch::utf8tolatin1( first, last, latin1.data( ) );
+		daw::expecting( result.input - first, stop - first );
+		daw::expecting( std::string( latin1.data( ), result.output ), expected );
+		if( stop != last ) {
+			return;
+		}
+		auto const lfirst = latin1.data( );
+		auto const llast = lfirst + latin1.size( );
+		auto const length = dispatch::latin1_utf8_length( lfirst, llast );
+		daw::expecting( length, str.size( ) );
+		auto utf8 = std::vector<char>( length );
+		auto const out = dispatch::latin1to8( lfirst, llast, utf8.data( ) );
+		daw::expecting( std::string( utf8.data( ), out ), str );
+	}
+	void check_search_tier( isa tier, std::string const &hay,
+	                        std::string const &needle ) {
+		namespace dispatch = daw::utf8::dispatch;
+		daw::expecting( dispatch::set_isa( tier ), tier );
+		auto const first = hay.data( );
+		auto const last = first + hay.size( );
+		auto const nfirst = needle.data( );
+		auto const nlast = nfirst + needle.size( );
+		auto const pos = hay.find( needle );
+		auto const expected = pos == std::string::npos ? last : first + pos;
+		daw::expecting( dispatch::find_substring( first, last, nfirst, nlast ) -
+		                  first,
+		                expected - first );
+		auto const rpos = needle.empty( ) ? std::string::npos : hay.rfind( needle );
+		auto const rexpected = rpos == std::string::npos ? last : first + rpos;
+		daw::expecting( dispatch::rfind_substring( first, last, nfirst, nlast ) -
+		                  first,
+		                rexpected - first );
+	}
+} // namespace
+
+void dispatch_valid_test_001( ) {
+	auto rng = std::mt19937( 1234 );
+	auto const tiers = supported_tiers( );
+	for( size_t len = 0; len < 300; ++len ) {
+		auto const str = random_utf8( rng, len );
+		auto const bmp = random_utf8( rng, len, true );
+		for( auto tier : tiers ) {
+			check_tier( tier, str );
+			check_tier( tier, bmp );
+		}
+	}
+	auto const ascii = std::string( 1000, 'a' );
+	for( auto tier : tiers ) {
+		check_tier( tier, ascii );
+	}
+}
+
+void dispatch_invalid_test_001( ) {
+	auto rng = std::mt19937( 4321 );
+	auto const tiers = supported_tiers( );
+	auto byte = std::uniform_int_distribution<int>( 0x80, 0xFF );
+	for( size_t n = 0; n < 2000; ++n ) {
+		auto str = random_utf8( rng, 20 + n % 100 );
+		auto pos = std::uniform_int_distribution<size_t>( 0, str.size( ) - 1 );
+		str[pos( rng )] = static_cast<char>( byte( rng ) );
+		if( n % 3 == 0 ) {
+			str.resize( pos( rng ) );
+		}
+		for( auto tier : tiers ) {
+			check_tier( tier, str );
+		}
+	}
+	// Errors that only show up across a block boundary
+	for( size_t offset = 0; offset < 70; ++offset ) {
+		for( auto bad : { "\xE2\x82", "\xF0\x9F\x98", "\xED\xA0\x80", "\xC0\xAF",
+		                  "\xF4\x90\x80\x80", "\x80", "\xFD\xD3\x9A" } ) {
+			auto const str = std::string( offset, 'x' ) + bad + "yz";
+			for( auto tier : tiers ) {
+				check_tier( tier, str );
+			}
+		}
+	}
+}
+
+void dispatch_utf16_test_001( ) {
+	auto rng = std::mt19937( 5678 );
+	auto const tiers = supported_tiers( );
+	for( size_t len = 0; len < 200; ++len ) {
+		auto const str = to_u16( random_utf8( rng, len ) );
+		for( auto tier : tiers ) {
+			check_utf16_tier( tier, str );
+		}
+	}
+	auto unit = std::uniform_int_distribution<int>( 0xD800, 0xDFFF );
+	for( size_t n = 0; n < 2000; ++n ) {
+		auto str = to_u16( random_utf8( rng, 10 + n % 150 ) );
+		auto pos = std::uniform_int_distribution<size_t>( 0, str.size( ) - 1 );
+		str[pos( rng )] = static_cast<char16_t>( unit( rng ) );
+		if( n % 3 == 0 ) {
+			str.resize( pos( rng ) );
+		}
+		for( auto tier : tiers ) {
+			check_utf16_tier( tier, str );
+		}
+	}
+	// Surrogates on either side of each block boundary
+	for( size_t offset = 0; offset < 140; ++offset ) {
+		for( auto bad :
+		     { u"\xD800", u"\xDC00", u"\xDC00\xD800", u"\xD83D\xDE00" } ) {
+			auto const str = std::u16string( offset, u'x' ) + bad;
+			for( auto tier : tiers ) {
+				check_utf16_tier( tier, str );
+				check_utf16_tier( tier, str + u"yz" );
+			}
+		}
+	}
+}
+
+void dispatch_latin1_test_001( ) {
+	auto rng = std::mt19937( 8765 );
+	auto const tiers = supported_tiers( );
+	for( size_t len = 0; len < 300; ++len ) {
+		auto const str = random_latin1_utf8( rng, len, len );
+		for( auto tier : tiers ) {
+			check_latin1_tier( tier, str );
+		}
+	}
+	for( size_t n = 0; n < 1000; ++n ) {
+		auto const len = 1 + n % 200;
+		auto bad = std::uniform_int_distribution<size_t>( 0, len - 1 );
+		auto const str = random_latin1_utf8( rng, len, bad( rng ) );
+		for( auto tier : tiers ) {
+			check_latin1_tier( tier, str );
+		}
+	}
+	auto const ascii = std::string( 1000, 'a' );
+	for( auto tier : tiers ) {
+		check_latin1_tier( tier, ascii );
+		check_latin1_tier( tier, ascii + "\xF0\x9F\x98\x80" + ascii );
+	}
+}
+
+void dispatch_search_test_001( ) {
+	auto rng = std::mt19937( 2468 );
+	auto const tiers = supported_tiers( );
+	// A small alphabet gives many partial matches to reject
+	auto letter = std::uniform_int_distribution<int>( 'a', 'c' );
+	for( size_t n = 0; n < 2000; ++n ) {
+		auto hay = std::string( n % 300, '\0' );
+		for( auto &c : hay ) {
+			c = static_cast<char>( letter( rng ) );
+		}
+		auto needle = std::string( 1 + n % 9, '\0' );
+		for( auto &c : needle ) {
+			c = static_cast<char>( letter( rng ) );
+		}
+		for( auto tier : tiers ) {
+			check_search_tier( tier, hay, needle );
+			check_search_tier( tier, hay, "" );
+		}
+	}
+	auto const text = random_utf8( rng, 500 );
+	for( size_t len = 1; len < 40; ++len ) {
+		auto const needle = text.substr( text.size( ) - len );
+		for( auto tier : tiers ) {
+			check_search_tier( tier, text, needle );
+			check_search_tier( tier, needle, text );
+			check_search_tier( tier, text + text, needle );
+		}
+	}
+}
+
+void dispatch_ascii_test_001( ) {
+	auto const tiers = supported_tiers( );
+	for( size_t len = 0; len < 200; ++len ) {
+		for( size_t pos = 0; pos <= len; ++pos ) {
+			auto str = std::string( len, 'a' );
+			if( pos < len ) {
+				str[pos] = static_cast<char>( 0x80 + pos % 0x80 );
+			}
+			auto const first = str.data( );
+			for( auto tier : tiers ) {
+				daw::utf8::dispatch::set_isa( tier );
+				auto const found = daw::utf8::dispatch::find_non_ascii(
+				  first, first + str.size( ) );
+				daw::expecting( static_cast<size_t>( found - first ), pos );
+			}
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_byte_set_test_001( ) {
+	auto rng = std::mt19937( 9753 );
+	auto const tiers = supported_tiers( );
+	auto word = std::uniform_int_distribution<uint64_t>( );
+	auto byte = std::uniform_int_distribution<int>( 0, 255 );
+	for( size_t n = 0; n < 2000; ++n ) {
+		uint64_t const bits[4] = { 0, 0, word( rng ) | word( rng ),
+		                           word( rng ) | word( rng ) };
+		auto const set = daw::utf8::simd::make_byte_set( bits );
+		auto str = std::string( n % 300, 'a' );
+		for( auto &c : str ) {
+			// Mostly bytes in the set so the scans run long
+			do {
+				c = static_cast<char>( byte( rng ) );
+			} while( not set.contains( static_cast<uint8_t>( c ) ) and
+			         byte( rng ) < 250 );
+		}
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto expected = first;
+		while( expected != last and
+		       set.contains( static_cast<uint8_t>( *expected ) ) ) {
+			++expected;
+		}
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			daw::expecting(
+			  daw::utf8::dispatch::find_not_in_set( set, first, last ) ==
+			  expected );
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_ascii_case_test_001( ) {
+	auto rng = std::mt19937( 8642 );
+	auto const tiers = supported_tiers( );
+	// Letters and the bytes around the letter ranges, rarely one >= 0x80
+	auto const bytes = std::string( "@AZ[`az{09 \x80\xC3" );
+	auto pick = std::uniform_int_distribution<size_t>( 0, bytes.size( ) - 1 );
+	auto rare = std::uniform_int_distribution<int>( 0, 199 );
+	for( size_t n = 0; n < 2000; ++n ) {
+		auto lhs = std::string( n % 300, 'a' );
+		for( auto &c : lhs ) {
+			do {
+				c = bytes[pick( rng )];
+			} while( static_cast<uint8_t>( c ) >= 0x80U and rare( rng ) != 0 );
+		}
+		auto rhs = lhs;
+		for( auto &c : rhs ) {
+			if( c >= 'a' and c <= 'z' and rare( rng ) < 100 ) {
+				c = static_cast<char>( c - 'a' + 'A' );
+			}
+		}
+		if( not rhs.empty( ) and rare( rng ) < 100 ) {
+			rhs[static_cast<size_t>( rare( rng ) ) % rhs.size( )] = '[';
+		}
+		auto const first = lhs.data( );
+		auto const last = first + lhs.size( );
+		auto ascii = first;
+		auto lower = std::string( );
+		auto upper = std::string( );
+		for( ; ascii != last and static_cast<uint8_t>( *ascii ) < 0x80U;
+		     ++ascii ) {
+			auto const c = *ascii;
+			lower += c >= 'A' and c <= 'Z' ? static_cast<char>( c + 32 ) : c;
+			upper += c >= 'a' and c <= 'z' ? static_cast<char>( c - 32 ) : c;
+		}
+		size_t prefix = 0;
+		while( prefix != lhs.size( ) and
+		       static_cast<uint8_t>( lhs[prefix] | rhs[prefix] ) < 0x80U and
+		       std::tolower( lhs[prefix] ) == std::tolower( rhs[prefix] ) ) {
+			++prefix;
+		}
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			auto out = std::string( lhs.size( ), '\0' );
+			auto stop =
+			  daw::utf8::dispatch::ascii_case_map( first, last, out.data( ), false );
+			daw::expecting( stop == ascii );
+			daw::expecting( out.substr( 0, lower.size( ) ), lower );
+			stop =
+			  daw::utf8::dispatch::ascii_case_map( first, last, out.data( ), true );
+			daw::expecting( stop == ascii );
+			daw::expecting( out.substr( 0, upper.size( ) ), upper );
+			daw::expecting( daw::utf8::dispatch::ascii_icase_prefix(
+			                  first, rhs.data( ), lhs.size( ) ),
+			                prefix );
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_printable_test_001( ) {
+	auto rng = std::mt19937( 7531 );
+	auto const tiers = supported_tiers( );
+	// The bytes around the printable range, rarely one outside it
+	auto const bytes = std::string( " !~}a\x1F\x7F\x80\xFF\t" );
+	auto pick = std::uniform_int_distribution<size_t>( 0, bytes.size( ) - 1 );
+	auto rare = std::uniform_int_distribution<int>( 0, 199 );
+	for( size_t n = 0; n < 2000; ++n ) {
+		auto str = std::string( n % 300, 'a' );
+		for( auto &c : str ) {
+			do {
+				c = bytes[pick( rng )];
+			} while( ( c < 0x20 or c > 0x7E ) and rare( rng ) != 0 );
+		}
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		auto expected = first;
+		while( expected != last and *expected >= 0x20 and *expected <= 0x7E ) {
+			++expected;
+		}
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			daw::expecting(
+			  daw::utf8::dispatch::find_non_printable_ascii( first, last ) ==
+			  expected );
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_advance_test_001( ) {
+	auto rng = std::mt19937( 8642 );
+	auto const tiers = supported_tiers( );
+	auto const pieces = std::vector<std::string>{
+	  "a", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80" };
+	auto pick = std::uniform_int_distribution<size_t>( 0, pieces.size( ) - 1 );
+	for( size_t n = 0; n < 300; ++n ) {
+		auto str = std::string( );
+		auto starts = std::vector<size_t>( );
+		// The byte offset of the code point at each UTF-16 index, the one
+		// before it when the index splits a surrogate pair
+		auto unit_starts = std::vector<size_t>( );
+		for( size_t k = 0; k < n; ++k ) {
+			starts.push_back( str.size( ) );
+			auto const &piece = pieces[pick( rng )];
+			unit_starts.push_back( str.size( ) );
+			if( piece.size( ) == 4 ) {
+				unit_starts.push_back( str.size( ) );
+			}
+			str += piece;
+		}
+		starts.push_back( str.size( ) );
+		unit_starts.push_back( str.size( ) );
+		auto const units = unit_starts.size( ) - 1U;
+		auto const first = str.data( );
+		auto const last = first + str.size( );
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			for( size_t count = 0; count <= n + 1; ++count ) {
+				auto const expected = first + starts[std::min( count, n )];
+				daw::expecting(
+				  daw::utf8::dispatch::advance_code_points( first, last, count ) ==
+				  expected );
+			}
+			daw::expecting( daw::utf8::dispatch::utf8_utf16_length( first, last ),
+			                units );
+			for( size_t count = 0; count <= units + 1; ++count ) {
+				auto const result =
+				  daw::utf8::dispatch::advance_utf16_units( first, last, count );
+				daw::expecting( result.position ==
+				                first + unit_starts[std::min( count, units )] );
+				auto const split = count < units and count > 0 and
+				                   unit_starts[count - 1] == unit_starts[count];
+				daw::expecting( result.remaining,
+				                count > units ? count - units : split ? 1U : 0U );
+			}
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_scan_lines_test_001( ) {
+	auto rng = std::mt19937( 9753 );
+	auto const tiers = supported_tiers( );
+	auto const bytes = std::string( "a\n\x0B\t\x8A\xC3\xFF" );
+	auto pick = std::uniform_int_distribution<size_t>( 0, bytes.size( ) - 1 );
+	for( size_t n = 0; n < 1000; ++n ) {
+		auto str = std::string( n % 65, 'a' );
+		for( auto &c : str ) {
+			c = bytes[pick( rng )];
+		}
+		uint64_t newlines = 0;
+		uint64_t non_ascii = 0;
+		for( size_t k = 0; k < str.size( ); ++k ) {
+			auto const b = static_cast<unsigned char>( str[k] );
+			newlines |= static_cast<uint64_t>( b == '\n' ) << k;
+			non_ascii |= static_cast<uint64_t>( b >= 0x80U ) << k;
+		}
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			auto const masks =
+			  daw::utf8::dispatch::scan_lines( str.data( ), str.size( ) );
+			daw::expecting( masks.newlines, newlines );
+			daw::expecting( masks.non_ascii, non_ascii );
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+void dispatch_override_test_001( ) {
+	auto const best = daw::utf8::dispatch::supported_isa( );
+	daw::expecting( daw::utf8::dispatch::set_isa( isa::scalar ), isa::scalar );
+	daw::expecting( daw::utf8::dispatch::active_isa( ), isa::scalar );
+	daw::expecting( daw::utf8::dispatch::set_isa( isa::avx512 ) <= best );
+	daw::expecting( daw::utf8::dispatch::active_isa( ),
+	                daw::utf8::dispatch::set_isa( best ) );
+}
+
+int main( ) {
+	std::cout << "supported isa: "
+	          << daw::utf8::dispatch::isa_name(
+	               daw::utf8::dispatch::supported_isa( ) )
+	          << '\n';
+	dispatch_valid_test_001( );
+	dispatch_invalid_test_001( );
+	dispatch_utf16_test_001( );
+	dispatch_latin1_test_001( );
+	dispatch_search_test_001( );
+	dispatch_ascii_test_001( );
+	dispatch_byte_set_test_001( );
+	dispatch_ascii_case_test_001( );
+	dispatch_printable_test_001( );
+	dispatch_advance_test_001( );
+	dispatch_scan_lines_test_001( );
+	dispatch_override_test_001( );
+	std::cout << "dispatch tests passed\n";
+}
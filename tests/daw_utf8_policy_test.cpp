@@ -0,0 +1,102 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/policy.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace policy = daw::utf8::policy;
+
+namespace {
+	// a, invalid lead, é, truncated €, z, overlong /, then a truncated tail
+	std::string const bad_text =
+	  "a\xFF\xC3\xA9\xE2\x82z\xC0\xAF\xF0\x9F\x98";
+
+	template<typename Policy, typename Engine = daw::utf8::engine::classic>
+	std::vector<uint32_t> decode_all( std::string const &str ) {
+		auto const rng =
+		  daw::utf8::policy_range<std::string::const_iterator, Policy, Engine>(
+		    str );
+		return std::vector<uint32_t>( rng.begin( ), rng.end( ) );
+	}
+} // namespace
+
+void policy_replace_test_001( ) {
+	auto const expected = std::vector<uint32_t>{
+	  0x61, 0xFFFD, 0xE9, 0xFFFD, 0x7A, 0xFFFD, 0xFFFD };
+	daw::expecting( decode_all<policy::replace>( bad_text ) == expected );
+	daw::expecting( decode_all<policy::replace, daw::utf8::engine::dfa>(
+	                  bad_text ) == expected );
+	// Same output as replace_invalid
+	auto replaced = std::string( );
+	daw::utf8::replace_invalid( bad_text.begin( ), bad_text.end( ) - 3,
+	                            std::back_inserter( replaced ) );
+	auto const rng = daw::utf8::make_policy_range<policy::replace>(
+	  bad_text.begin( ), bad_text.end( ) - 3 );
+	auto const direct = rng.to_u32string( );
+	auto const rng2 = daw::utf8::make_policy_range<policy::throw_error>(
+	  replaced.begin( ), replaced.end( ) );
+	daw::expecting( direct == rng2.to_u32string( ) );
+}
+
+void policy_custom_replace_test_001( ) {
+	auto const expected =
+	  std::vector<uint32_t>{ 0x61, 0x3F, 0xE9, 0x3F, 0x7A, 0x3F, 0x3F };
+	daw::expecting( decode_all<policy::basic_replace<'?'>>( bad_text ) ==
+	                expected );
+}
+
+void policy_skip_test_001( ) {
+	auto const expected = std::vector<uint32_t>{ 0x61, 0xE9, 0x7A };
+	daw::expecting( decode_all<policy::skip>( bad_text ) == expected );
+	daw::expecting( decode_all<policy::skip>( "\xFF\xFE" ).empty( ) );
+	// Writes through a pointer and returns the end of the output
+	char32_t buff[3] = { };
+	daw::expecting( daw::utf8::decode<policy::skip>(
+	                  bad_text.begin( ), bad_text.end( ), buff ) == buff + 3 );
+	daw::expecting( std::u32string( buff, 3 ) == U"a\u00E9z" );
+}
+
+void policy_stop_test_001( ) {
+	auto const expected = std::vector<uint32_t>{ 0x61 };
+	daw::expecting( decode_all<policy::stop>( bad_text ) == expected );
+	auto out = std::u32string( );
+	auto const first = bad_text.data( );
+	auto const last = first + bad_text.size( );
+	daw::utf8::decode<policy::stop>( first, last, std::back_inserter( out ) );
+	daw::expecting( out == U"a" );
+	daw::expecting( daw::utf8::find_invalid( first, last ) == first + 1 );
+}
+
+void policy_throw_test_001( ) {
+	bool has_thrown = false;
+	try {
+		(void)decode_all<policy::throw_error>( bad_text );
+	} catch( daw::utf8::invalid_utf8 const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+	auto const good = std::string( "a\xC3\xA9\xF0\x9F\x98\x80" );
+	auto const expected = std::vector<uint32_t>{ 0x61, 0xE9, 0x1F600 };
+	daw::expecting( decode_all<policy::throw_error>( good ) == expected );
+}
+
+static_assert( policy::is_policy_v<policy::replace> );
+static_assert( not policy::is_policy_v<int> );
+
+int main( ) {
+	policy_replace_test_001( );
+	policy_custom_replace_test_001( );
+	policy_skip_test_001( );
+	policy_stop_test_001( );
+	policy_throw_test_001( );
+	std::cout << "policy tests passed\n";
+}
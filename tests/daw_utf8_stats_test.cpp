@@ -0,0 +1,82 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#define DAW_UTF8_STATS
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/dispatch.h"
+#include "daw/utf8/stats.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace stats = daw::utf8::stats;
+using daw::utf8::internal::utf_error;
+
+void stats_validate_test_001( ) {
+	stats::reset( );
+	auto const str = std::string( "abcd\xC3\xA9\xE2\x82\xAC" );
+	auto const first = str.data( );
+	auto const last = first + str.size( );
+	daw::expecting( daw::utf8::dispatch::find_invalid( first, last ) == last );
+	auto const snap = stats::take_snapshot( );
+	daw::expecting( snap.bytes_validated( ), str.size( ) );
+	daw::expecting( snap[stats::operation::validate].calls, 1U );
+	daw::expecting( snap.ascii_bytes, 4U );
+	daw::expecting( snap.ascii_scanned, str.size( ) );
+	auto const tier =
+	  static_cast<size_t>( daw::utf8::dispatch::active_isa( ) );
+	daw::expecting( snap.tier_calls[tier], 1U );
+}
+
+void stats_invalid_test_001( ) {
+	stats::reset( );
+	for( auto bad : { "ab\xFF", "ab\xC3", "\xE2\x28\xA1", "\xC0\xAF",
+	                  "\xED\xA0\x80" } ) {
+		auto const str = std::string( bad );
+		auto const first = str.data( );
+		daw::utf8::dispatch::find_invalid( first, first + str.size( ) );
+	}
+	auto const snap = stats::take_snapshot( );
+	daw::expecting( snap.invalid_count( utf_error::INVALID_LEAD ), 1U );
+	daw::expecting( snap.invalid_count( utf_error::NOT_ENOUGH_ROOM ), 1U );
+	daw::expecting( snap.invalid_count( utf_error::INCOMPLETE_SEQUENCE ), 1U );
+	daw::expecting( snap.invalid_count( utf_error::OVERLONG_SEQUENCE ), 1U );
+	daw::expecting( snap.invalid_count( utf_error::INVALID_CODE_POINT ), 1U );
+}
+
+void stats_threads_test_001( ) {
+	stats::reset( );
+	auto const str = std::string( 1000, 'x' );
+	auto const work = [&] {
+		auto out = std::u32string( str.size( ), U'\0' );
+		daw::utf8::dispatch::utf8to32( str.data( ), str.data( ) + str.size( ),
+		                               out.data( ) );
+	};
+	auto t1 = std::thread( work );
+	auto t2 = std::thread( work );
+	t1.join( );
+	t2.join( );
+	work( );
+	auto const snap = stats::take_snapshot( );
+	daw::expecting( snap[stats::operation::utf8to32].calls, 3U );
+	daw::expecting( snap.bytes_transcoded( ), 3U * str.size( ) );
+	daw::expecting( snap[stats::operation::utf8to32].cycles > 0 );
+	stats::reset( );
+	daw::expecting( stats::take_snapshot( ).bytes_transcoded( ), 0U );
+}
+
+int main( ) {
+	static_assert( stats::enabled );
+	stats_validate_test_001( );
+	stats_invalid_test_001( );
+	stats_threads_test_001( );
+	std::cout << "stats tests passed\n";
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#pragma once
+
+#include "daw/utf8/dispatch.h"
+#include "daw/utf_range/daw_utf_range.h"
+
+#include <utility>
+#include <vector>
+
+/// The dispatch tiers this CPU can run, each test checks all of them against
+/// the scalar kernels
+inline std::vector<daw::utf8::dispatch::isa> supported_tiers( ) {
+	using daw::utf8::dispatch::isa;
+	auto result = std::vector<isa>( );
+	for( auto i : { isa::scalar, isa::sse42, isa::avx2, isa::avx512 } ) {
+		if( i <= daw::utf8::dispatch::supported_isa( ) ) {
+			result.push_back( i );
+		}
+	}
+	return result;
+}
+
+/// Call func with tier active, the tier active before is restored after,
+/// also when func throws
+template<typename Function>
+decltype( auto ) with_isa( daw::utf8::dispatch::isa tier, Function &&func ) {
+	struct restore_isa {
+		daw::utf8::dispatch::isa active = daw::utf8::dispatch::active_isa( );
+
+		~restore_isa( ) {
+			daw::utf8::dispatch::set_isa( active );
+		}
+	} const restore{ };
+	daw::utf8::dispatch::set_isa( tier );
+	return std::forward<Function>( func )( );
+}
+
+/// Call func once with each of supported_tiers( ) active
+template<typename Function>
+void for_each_tier( Function &&func ) {
+	for( auto tier : supported_tiers( ) ) {
+		with_isa( tier, func );
+	}
+}
+
+/// text as a range of code points
+inline daw::range::utf_range rng( daw::string_view text ) {
+	return daw::range::create_char_range( text );
+}
@@ -0,0 +1,164 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/unchecked.h"
+#include "daw/utf_range/daw_utf_case.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+using daw::utf8::dispatch::isa;
+
+namespace {
+	int compare_icase( std::string const &lhs, std::string const &rhs ) {
+		return daw::range::compare_icase( rng( lhs ), rng( rhs ) );
+	}
+} // namespace
+
+void case_mapping_test_001( ) {
+	auto const text =
+	  std::string( "Hello, \xC3\x80\xC3\xA9\xC3\x8E \xCE\xA9mega" );
+	daw::expecting( daw::range::to_lower( rng( text ) ).to_string( ),
+	                "hello, \xC3\xA0\xC3\xA9\xC3\xAE \xCF\x89mega" );
+	daw::expecting( daw::range::to_upper( rng( text ) ).to_string( ),
+	                "HELLO, \xC3\x80\xC3\x89\xC3\x8E \xCE\xA9MEGA" );
+	// ß is SS in upper case and folds to ss, İ is i with a dot above
+	auto const upper = daw::range::to_upper( rng( "stra\xC3\x9F"
+	                                              "e" ) );
+	daw::expecting( upper.to_string( ), "STRASSE" );
+	daw::expecting( upper.size( ), 7U );
+	daw::expecting(
+	  daw::range::case_fold( rng( "Stra\xC3\x9F"
+	                              "e" ) )
+	    .to_string( ),
+	  "strasse" );
+	daw::expecting( daw::range::to_lower( rng( "\xC4\xB0" ) ).to_string( ),
+	                "i\xCC\x87" );
+	// The ligature ﬃ and a Cherokee small letter
+	daw::expecting( daw::range::to_upper( rng( "\xEF\xAC\x83" ) ).to_string( ),
+	                "FFI" );
+	daw::expecting( daw::range::case_fold( rng( "\xEA\xAD\xB0" ) ).to_string( ),
+	                "\xE1\x8E\xA0" );
+	// Deseret is outside the BMP
+	daw::expecting(
+	  daw::range::to_lower( rng( "\xF0\x90\x90\x80" ) ).to_string( ),
+	  "\xF0\x90\x90\xA8" );
+	daw::expecting( daw::range::to_lower( rng( "" ) ).empty( ) );
+	auto const str = daw::utf_string( "ABC\xC3\x89" );
+	daw::expecting( daw::range::to_lower( str ).to_string( ),
+	                "abc\xC3\xA9" );
+}
+
+void case_compare_test_001( ) {
+	daw::expecting( compare_icase( "", "" ), 0 );
+	daw::expecting( compare_icase( "", "a" ), -1 );
+	daw::expecting( compare_icase( "B", "a" ), 1 );
+	daw::expecting( compare_icase( "HeLLo", "hello" ), 0 );
+	daw::expecting( compare_icase( "STRASSE", "stra\xC3\x9F"
+	                                          "e" ),
+	                0 );
+	daw::expecting( compare_icase( "stra\xC3\x9F", "STRAS" ), 1 );
+	daw::expecting( compare_icase( "\xC3\x89t\xC3\xA9", "\xC3\xA9T\xC3\x89" ),
+	                0 );
+	daw::expecting( compare_icase( "\xC3\x89t\xC3\xA9", "\xC3\xA9T\xC3\x8A" ),
+	                -1 );
+	// Case folds to what utf_range::compare orders by code point
+	daw::expecting( compare_icase( "[", "a" ), -1 );
+	daw::expecting( compare_icase( "[", "A" ), -1 );
+	daw::expecting( daw::range::hash_icase( rng( "Content-Length" ) ) ==
+	                daw::range::hash_icase( rng( "content-length" ) ) );
+	daw::expecting( daw::range::hash_icase( rng( "\xC3\x9F" ) ) ==
+	                daw::range::hash_icase( rng( "SS" ) ) );
+	daw::expecting( daw::range::hash_icase( rng( "a" ) ) !=
+	                daw::range::hash_icase( rng( "b" ) ) );
+
+	auto headers = std::unordered_map<daw::utf_string, int,
+	                                  daw::range::icase_hash,
+	                                  daw::range::icase_equal_to>( );
+	headers[daw::utf_string( "Content-Type" )] = 1;
+	headers[daw::utf_string( "X-Stra\xC3\x9F"
+	                         "e" )] = 2;
+	daw::expecting( headers.count( daw::utf_string( "content-type" ) ), 1U );
+	daw::expecting( headers.at( daw::utf_string( "x-STRASSE" ) ), 2 );
+	headers[daw::utf_string( "CONTENT-TYPE" )] = 3;
+	daw::expecting( headers.size( ), 2U );
+}
+
+void case_all_code_points_test_001( ) {
+	// Folding twice changes nothing, and only U+0131 dotless i folds
+	// differently from its upper and lower case
+	auto text = std::string( );
+	for( char32_t cp = 0; cp < 0x110000U; ++cp ) {
+		if( cp >= 0xD800U and cp < 0xE000U ) {
+			continue;
+		}
+		text.clear( );
+		daw::utf8::unchecked::append( cp, std::back_inserter( text ) );
+		auto const folded = daw::range::case_fold( rng( text ) );
+		daw::expecting( daw::range::case_fold( folded ) == folded );
+		if( cp == 0x131U ) {
+			continue;
+		}
+		auto const lower = daw::range::to_lower( rng( text ) );
+		auto const upper = daw::range::to_upper( rng( text ) );
+		daw::expecting( daw::range::compare_icase( lower, folded ), 0 );
+		daw::expecting( daw::range::compare_icase( upper, folded ), 0 );
+	}
+}
+
+void case_tiers_test_001( ) {
+	auto random = std::mt19937( 4646 );
+	// Long ASCII runs go through the kernels
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 40, 'x' ), std::string( 33, 'Q' ), "Az@[`{",
+	  "\xC3\x9F",             "\xC3\x89",             "\xC4\xB0",
+	  "\xEF\xAC\x83",         "\xE4\xB8\xAD",         "\xF0\x90\x90\x80" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 300; ++n ) {
+		auto text = std::string( );
+		for( size_t k = 0; k < n % 40; ++k ) {
+			text += alphabet[pick( random )];
+		}
+		auto const expected = with_isa( isa::scalar, [&] {
+			return std::make_tuple( daw::range::to_lower( rng( text ) ),
+			                        daw::range::to_upper( rng( text ) ),
+			                        daw::range::case_fold( rng( text ) ),
+			                        daw::range::hash_icase( rng( text ) ) );
+		} );
+		auto const &lower = std::get<0>( expected );
+		auto const &upper = std::get<1>( expected );
+		auto const &folded = std::get<2>( expected );
+		auto const hash = std::get<3>( expected );
+		for_each_tier( [&] {
+			daw::expecting( daw::range::to_lower( rng( text ) ) == lower );
+			daw::expecting( daw::range::to_upper( rng( text ) ) == upper );
+			daw::expecting( daw::range::case_fold( rng( text ) ) == folded );
+			daw::expecting( daw::range::hash_icase( upper ), hash );
+			daw::expecting( daw::range::compare_icase( upper, lower ), 0 );
+			daw::expecting( daw::range::compare_icase( rng( text ), folded ), 0 );
+		} );
+	}
+}
+
+int main( ) {
+	case_mapping_test_001( );
+	case_compare_test_001( );
+	case_all_code_points_test_001( );
+	case_tiers_test_001( );
+	std::cout << "case tests passed\n";
+}
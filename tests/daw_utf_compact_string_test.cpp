@@ -0,0 +1,101 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_compact_string.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+void compact_width_test_001( ) {
+	daw::expecting( daw::compact_utf_string( "hello" ).char_width( ), 1U );
+	daw::expecting( daw::compact_utf_string( "hello" ).is_ascii( ) );
+	daw::expecting( daw::compact_utf_string( "héllo ÿ" ).char_width( ), 1U );
+	daw::expecting( daw::compact_utf_string( "Приве́т" ).char_width( ), 2U );
+	daw::expecting( daw::compact_utf_string( "a😀" ).char_width( ), 4U );
+}
+
+void compact_index_test_001( ) {
+	auto const text = daw::utf_string( R"(Приве́т नमस्ते שָׁלוֹם 😀)" );
+	auto const str = daw::compact_utf_string( text );
+	auto const cps = text.to_u32string( );
+	daw::expecting( str.size( ), cps.size( ) );
+	for( size_t n = 0; n < cps.size( ); ++n ) {
+		daw::expecting( str[n], static_cast<uint32_t>( cps[n] ) );
+	}
+	daw::expecting( str.to_string( ), text.to_string( ) );
+	daw::expecting( str.utf_range( ) == text.utf_range( ) );
+	auto const sub = str.substr( 0, 7 );
+	daw::expecting( sub.char_width( ), 2U );
+	daw::expecting( sub.to_string( ), std::string( "Приве́т" ) );
+	daw::expecting( str.substr( 8, 2 ).char_width( ), 2U );
+	daw::expecting( str.substr( 7, 1 ).is_ascii( ) );
+	daw::expecting( str.to_u32string( ) == cps );
+	daw::expecting( std::hash<daw::compact_utf_string>{ }( str ),
+	                std::hash<daw::range::utf_range>{ }( text.utf_range( ) ) );
+}
+
+void compact_ascii_test_001( ) {
+	auto const str = daw::compact_utf_string( "plain ascii text" );
+	auto const rng = str.utf_range( );
+	daw::expecting( rng.size( ), str.size( ) );
+	daw::expecting( str.end( ) - str.begin( ), 16 );
+	daw::expecting( *( str.begin( ) + 6 ), static_cast<uint32_t>( 'a' ) );
+}
+
+void compact_iterator_test_001( ) {
+	auto const str = daw::compact_utf_string( "abcdéö" );
+	auto const first = str.begin( );
+	auto const last = str.end( );
+	daw::expecting( std::is_sorted( first, last ) );
+	auto const pos = std::lower_bound( first, last, uint32_t{ 0xE9 } );
+	daw::expecting( pos - first, 4 );
+	daw::expecting( 4 + first == pos );
+	daw::expecting( pos > first && pos <= last && last >= pos );
+	daw::expecting( *pos.operator->( ).operator->( ), uint32_t{ 0xE9 } );
+}
+
+void compact_invalid_test_001( ) {
+	for( char32_t cp : { char32_t{ 0xD800 }, char32_t{ 0x110000 } } ) {
+		auto const cps = std::u32string( { U'a', cp } );
+		bool has_thrown = false;
+		try {
+			(void)daw::compact_utf_string( std::u32string_view( cps ) );
+		} catch( daw::utf8::invalid_code_point const & ) { has_thrown = true; }
+		daw::expecting( has_thrown );
+	}
+}
+
+void compact_latin1_test_001( ) {
+	auto const text = std::string( "café naïve" );
+	auto const str = daw::compact_utf_string( text.c_str( ) );
+	daw::expecting( str.char_width( ), 1U );
+	daw::expecting( str[3], uint32_t{ 0xE9 } );
+	daw::expecting( str.to_u32string( ) == U"café naïve" );
+	daw::expecting( str.to_string( ), text );
+	auto const sub = str.substr( 2, 3 );
+	daw::expecting( sub.to_string( ), std::string( "fé " ) );
+	daw::expecting( sub.to_u32string( ) == U"fé " );
+	daw::expecting(
+	  std::hash<daw::compact_utf_string>{ }( str ),
+	  std::hash<daw::range::utf_range>{ }(
+	    daw::range::create_char_range( text.c_str( ) ) ) );
+}
+
+int main( ) {
+	compact_width_test_001( );
+	compact_index_test_001( );
+	compact_ascii_test_001( );
+	compact_iterator_test_001( );
+	compact_invalid_test_001( );
+	compact_latin1_test_001( );
+	std::cout << "compact_utf_string tests passed\n";
+}
@@ -0,0 +1,124 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_range.h"
+#include "daw/utf_range/daw_utf_string.h"
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+	std::u32string const expected = U"aé€\U0001F600z";
+	std::string const utf8_text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z";
+
+	template<typename CharT>
+	std::vector<CharT> as_units( std::string const &str ) {
+		auto result = std::vector<CharT>( );
+		for( auto c : str ) {
+			result.push_back( static_cast<CharT>( static_cast<unsigned char>( c ) ) );
+		}
+		return result;
+	}
+
+	template<typename Range>
+	void check_range( Range const &rng ) {
+		daw::expecting( rng.size( ), expected.size( ) );
+		daw::expecting( rng.to_u32string( ) == expected );
+		daw::expecting( rng.to_raw_u8string( ) == utf8_text );
+		daw::expecting( rng.u8_size( ), utf8_text.size( ) );
+		auto decoded = std::u32string( );
+		for( auto cp : rng ) {
+			decoded.push_back( static_cast<char32_t>( cp ) );
+		}
+		daw::expecting( decoded == expected );
+		auto it = rng.end( );
+		--it;
+		--it;
+		daw::expecting( *it, 0x1F600U );
+		daw::expecting( rng.substr( 2, 2 ).to_u32string( ) == U"€\U0001F600" );
+		daw::expecting( ( rng + 3 ).to_u32string( ) == U"\U0001F600z" );
+	}
+} // namespace
+
+void encoding_utf16_range_test_001( ) {
+	auto const str = std::u16string( u"aé€\U0001F600z" );
+	auto const rng = daw::range::create_char_range( str );
+	static_assert( std::is_same_v<decltype( rng )::char_type, char16_t> );
+	daw::expecting( rng.raw_size( ), 6U );
+	check_range( rng );
+	daw::expecting( rng == daw::range::create_char_range( utf8_text ) );
+	daw::expecting( rng.to_string_view( ) == std::u16string_view( str ) );
+}
+
+void encoding_utf32_range_test_001( ) {
+	auto const rng = daw::range::create_char_range( U"aé€\U0001F600z" );
+	daw::expecting( rng.raw_size( ), 5U );
+	check_range( rng );
+	daw::expecting( rng < daw::range::create_char_range( U"b" ) );
+}
+
+void encoding_byte_range_test_001( ) {
+	auto const bytes = as_units<std::byte>( utf8_text );
+	check_range( daw::range::create_char_range( bytes ) );
+	auto const uchars = as_units<unsigned char>( utf8_text );
+	check_range( daw::range::create_char_range( uchars ) );
+#if defined( __cpp_char8_t )
+	check_range( daw::range::create_char_range( u8"aé€\U0001F600z" ) );
+#endif
+}
+
+void encoding_utf16_string_test_001( ) {
+	auto str = daw::utf16_string( u"aé€" );
+	daw::expecting( str.size( ), 3U );
+	str.push_back( U'\U0001F600' );
+	str += U'z';
+	daw::expecting( str.to_u32string( ) == expected );
+	daw::expecting( str.to_string( ) == u"aé€\U0001F600z" );
+	str.insert( 1, U'\U0001F601' );
+	daw::expecting( str.to_u32string( ) == U"a\U0001F601é€\U0001F600z" );
+	str.erase( 1, 1 );
+	str.pop_back( );
+	daw::expecting( str.to_u32string( ) == U"aé€\U0001F600" );
+	str.sort( );
+	daw::expecting( str.to_u32string( ) == U"aé€\U0001F600" );
+	auto ss = std::stringstream( );
+	ss << str;
+	daw::expecting( ss.str( ) == "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" );
+	bool has_thrown = false;
+	try {
+		str.push_back( char32_t{ 0xD800 } );
+	} catch( daw::utf8::invalid_code_point const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+}
+
+void encoding_byte_string_test_001( ) {
+	auto const bytes = as_units<std::byte>( utf8_text );
+	auto str = daw::basic_utf_string<std::byte>(
+	  bytes.data( ), bytes.data( ) + bytes.size( ) );
+	daw::expecting( str.size( ), 5U );
+	str.push_back( U'é' );
+	daw::expecting( str.raw_size( ), utf8_text.size( ) + 2 );
+	daw::expecting( str.to_u32string( ) == expected + U"é" );
+	auto str32 = daw::utf32_string( U"abc" );
+	str32.append( daw::utf32_string( U"\U0001F600" ) );
+	daw::expecting( str32.size( ), 4U );
+}
+
+int main( ) {
+	encoding_utf16_range_test_001( );
+	encoding_utf32_range_test_001( );
+	encoding_byte_range_test_001( );
+	encoding_utf16_string_test_001( );
+	encoding_byte_string_test_001( );
+	std::cout << "encoding tests passed\n";
+}
@@ -0,0 +1,127 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_grapheme.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using daw::range::grapheme_break;
+using daw::utf8::dispatch::isa;
+
+namespace {
+	/// The byte size of each cluster of text
+	std::vector<size_t> cluster_sizes( std::string const &text ) {
+		auto result = std::vector<size_t>( );
+		auto const rng = daw::range::create_char_range( text );
+		for( auto g : daw::range::graphemes( rng ) ) {
+			result.push_back( g.raw_size( ) );
+		}
+		daw::expecting( daw::range::grapheme_count( rng ), result.size( ) );
+		return result;
+	}
+
+	void check_sizes( std::string const &text,
+	                  std::vector<size_t> const &expected ) {
+		daw::expecting( cluster_sizes( text ) == expected );
+	}
+} // namespace
+
+void grapheme_basic_test_001( ) {
+	auto const text = std::string( "Приве́т नमस्ते שָׁלוֹם" );
+	auto const rng = daw::range::create_char_range( text );
+	daw::expecting( rng.size( ), 22U );
+	daw::expecting( daw::range::grapheme_count( rng ), 16U );
+	auto expected = std::vector<std::u32string>{
+	  U"П", U"р", U"и", U"в", U"е́", U"т", U" ",   U"न",
+	  U"म", U"स्", U"ते", U" ", U"שָׁ", U"ל", U"וֹ", U"ם" };
+	size_t n = 0;
+	size_t code_points = 0;
+	for( auto g : daw::range::graphemes( rng ) ) {
+		daw::expecting( n < expected.size( ) );
+		daw::expecting( g.to_u32string( ) == expected[n] );
+		code_points += g.size( );
+		++n;
+	}
+	daw::expecting( n, expected.size( ) );
+	daw::expecting( code_points, rng.size( ) );
+}
+
+void grapheme_rules_test_001( ) {
+	check_sizes( "", { } );
+	check_sizes( "a\r\nb\n\r", { 1, 2, 1, 1, 1 } );
+	// Flags pair up regional indicators, an odd one is left alone
+	check_sizes( "🇺🇸🇨🇦🇫", { 8, 8, 4 } );
+	// Emoji ZWJ sequences, a family and a face with a combining mark
+	check_sizes( "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D"
+	             "\xF0\x9F\x91\xA7\xE2\x80\x8D\xF0\x9F\x91\xA6!",
+	             { 25, 1 } );
+	check_sizes( "😀\xCC\x81\xE2\x80\x8D😀", { 13 } );
+	check_sizes( "a\xE2\x80\x8D😀", { 4, 4 } );
+	// Hangul jamo L V, then an LV syllable
+	check_sizes( "\xE1\x84\x80\xE1\x85\xA1가", { 6, 3 } );
+	// U+0600 prepends to what follows unless it is a control
+	check_sizes( "\xD8\x80"
+	             "1",
+	             { 3 } );
+	check_sizes( "\xD8\x80\n", { 2, 1 } );
+	// A virama and ZWJ extend, GB9c conjuncts are not part of Unicode 14
+	check_sizes( "क्\xE2\x80\x8Dष", { 9, 3 } );
+	daw::expecting( daw::range::grapheme_break_property( U'\u0301' ) ==
+	                grapheme_break::extend );
+	daw::expecting( daw::range::grapheme_break_property( U'각' ) ==
+	                grapheme_break::lvt );
+	daw::expecting( daw::range::grapheme_break_property( U'\U0001F1E6' ) ==
+	                grapheme_break::regional_indicator );
+	daw::expecting( daw::range::is_extended_pictographic( U'©' ) );
+	daw::expecting( not daw::range::is_extended_pictographic( U'A' ) );
+}
+
+void grapheme_ascii_test_001( ) {
+	auto rng = std::mt19937( 4242 );
+	// Long runs of ASCII are counted by the kernels, a combining mark after
+	// one extends its last cluster
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 70, 'x' ), "\r\n", "\r", "\n", "ab", "\xCC\x81", "é" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 300; ++n ) {
+		auto text = std::string( );
+		for( size_t k = 0; k < n % 40; ++k ) {
+			text += alphabet[pick( rng )];
+		}
+		auto const rng_text = daw::range::create_char_range( text );
+		size_t expected = 0;
+		for( auto g : daw::range::graphemes( rng_text ) ) {
+			(void)g;
+			++expected;
+		}
+		for( auto tier : supported_tiers( ) ) {
+			daw::utf8::dispatch::set_isa( tier );
+			daw::expecting( daw::range::grapheme_count( rng_text ), expected );
+		}
+		daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+	}
+	auto expected = std::vector<size_t>( 99, 1 );
+	expected.push_back( 3 );
+	expected.push_back( 2 );
+	check_sizes( std::string( 100, 'a' ) + "\xCC\x81\r\n", expected );
+}
+
+int main( ) {
+	grapheme_basic_test_001( );
+	grapheme_rules_test_001( );
+	grapheme_ascii_test_001( );
+	std::cout << "grapheme tests passed\n";
+}
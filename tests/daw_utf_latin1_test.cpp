@@ -0,0 +1,60 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_latin1.h"
+
+#include <iostream>
+#include <string>
+
+void latin1_to_utf8_test_001( ) {
+	// café, ñ and ÿ
+	auto const latin1 = std::string( "caf\xE9 \xF1\xFF" );
+	daw::expecting( daw::range::latin1_utf8_length( latin1 ), 10U );
+	auto out = std::string( );
+	auto const rng = daw::range::latin1_to_utf8( latin1, out );
+	daw::expecting( out, std::string( "caf\xC3\xA9 \xC3\xB1\xC3\xBF" ) );
+	daw::expecting( rng.size( ), latin1.size( ) );
+	daw::expecting( rng.to_u32string( ) == U"café ñÿ" );
+	daw::expecting( daw::range::latin1_to_utf8( "abc" ), std::string( "abc" ) );
+}
+
+void utf8_to_latin1_test_001( ) {
+	auto const str = std::string( 40, 'x' ) + "caf\xC3\xA9 \xC3\xB1\xC3\xBF";
+	auto const rng = daw::range::create_char_range( str );
+	auto const latin1 = daw::range::to_latin1( rng );
+	daw::expecting( latin1, std::string( 40, 'x' ) + "caf\xE9 \xF1\xFF" );
+	daw::expecting( latin1.size( ), rng.size( ) );
+	auto back = std::string( );
+	daw::expecting( daw::range::latin1_to_utf8( latin1, back ) == rng );
+}
+
+void utf8_to_latin1_unrepresentable_test_001( ) {
+	// é then €
+	auto const str = std::string( "ab\xC3\xA9\xE2\x82\xAC" "cd" );
+	auto const rng = daw::range::create_char_range( str );
+	auto out = std::string( );
+	auto const bad = daw::range::to_latin1( rng, out );
+	daw::expecting( bad != rng.end( ) );
+	daw::expecting( *bad, 0x20ACU );
+	daw::expecting( bad.base( ) - str.data( ), 4 );
+	daw::expecting( out, std::string( "ab\xE9" ) );
+	bool has_thrown = false;
+	try {
+		(void)daw::range::to_latin1( rng );
+	} catch( daw::utf8::invalid_code_point const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+}
+
+int main( ) {
+	latin1_to_utf8_test_001( );
+	utf8_to_latin1_test_001( );
+	utf8_to_latin1_unrepresentable_test_001( );
+	std::cout << "latin1 tests passed\n";
+}
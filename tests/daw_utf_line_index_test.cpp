@@ -0,0 +1,151 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_line_index.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+void line_index_basic_test_001( ) {
+	auto const text = std::string( "ab\n\xC3\xA9t\xC3\xA9\r\n\nlast" );
+	auto const index = daw::range::line_index( rng( text ) );
+	daw::expecting( index.size( ), text.size( ) );
+	daw::expecting( index.line_count( ), 4U );
+	daw::expecting( index.line_start( 0 ), 0U );
+	daw::expecting( index.line_start( 1 ), 3U );
+	daw::expecting( index.line_start( 2 ), 10U );
+	daw::expecting( index.line_start( 3 ), 11U );
+	daw::expecting( index.line_end( 1 ), 9U );
+	daw::expecting( index.line_end( 3 ), text.size( ) );
+	daw::expecting( index.is_ascii( 0 ) );
+	daw::expecting( not index.is_ascii( 1 ) );
+	daw::expecting( index.is_ascii( 2 ) );
+	daw::expecting( index.line_of( 2 ), 0U );
+	daw::expecting( index.line_of( 3 ), 1U );
+	daw::expecting( index.line_of( text.size( ) ), 3U );
+
+	auto pos = index.position( rng( text ), 7 );
+	daw::expecting( pos.line, 1U );
+	daw::expecting( pos.column, 3U );
+	pos = index.position( rng( text ), 13 );
+	daw::expecting( pos.line, 3U );
+	daw::expecting( pos.column, 2U );
+	daw::expecting( index.offset( rng( text ), { 1, 2 } ), 6U );
+	daw::expecting( index.offset( rng( text ), { 1, 99 } ), 9U );
+	daw::expecting( index.offset( rng( text ), { 3, 4 } ), text.size( ) );
+	daw::expecting( index.offset( rng( text ), { 0, 9 } ), 2U );
+
+	auto const empty = daw::range::line_index( );
+	daw::expecting( empty.line_count( ), 1U );
+	daw::expecting( empty.line_of( 0 ), 0U );
+	daw::expecting( empty.is_ascii( 0 ) );
+}
+
+void line_index_many_lines_test_001( ) {
+	// Enough lines for several checkpoints, with deltas of one to three bytes
+	auto text = std::string( );
+	auto starts = std::vector<size_t>( );
+	for( size_t line = 0; line < 1000; ++line ) {
+		starts.push_back( text.size( ) );
+		auto const length = line == 500 ? 20000U : line * 37U % 300U;
+		text.append( length, 'z' );
+		text += '\n';
+	}
+	starts.push_back( text.size( ) );
+	auto const index = daw::range::line_index( rng( text ) );
+	daw::expecting( index.line_count( ), starts.size( ) );
+	for( size_t line = 0; line < starts.size( ); ++line ) {
+		daw::expecting( index.line_start( line ), starts[line] );
+		daw::expecting( index.line_of( starts[line] ), line );
+		if( starts[line] != 0 ) {
+			daw::expecting( index.line_of( starts[line] - 1U ), line - 1U );
+		}
+	}
+}
+
+void line_index_tiers_test_001( ) {
+	auto random = std::mt19937( 5050 );
+	// Lines long and short, some of them with a long gap between newlines
+	// and some with code points split between appends
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 70, 'x' ), "\n", "\n\n", "a", "\xC3\xA9", "\xE4\xB8\xAD",
+	  "\xF0\x9F\x98\x80", std::string( 100, 'y' ) };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 40; ++n ) {
+		auto text = std::string( );
+		for( size_t k = 0; k < n * 4; ++k ) {
+			text += alphabet[pick( random )];
+		}
+		// The line and column of each byte, columns counted at lead bytes
+		auto lines = std::vector<size_t>( );
+		auto columns = std::vector<size_t>( );
+		auto starts = std::vector<size_t>{ 0 };
+		auto ascii = std::vector<bool>{ true };
+		size_t column = 0;
+		for( size_t pos = 0; pos <= text.size( ); ++pos ) {
+			lines.push_back( starts.size( ) - 1U );
+			columns.push_back( column );
+			if( pos == text.size( ) ) {
+				break;
+			}
+			auto const b = static_cast<unsigned char>( text[pos] );
+			if( b == '\n' ) {
+				starts.push_back( pos + 1U );
+				ascii.push_back( true );
+				column = 0;
+			} else {
+				if( b >= 0x80U ) {
+					ascii.back( ) = false;
+				}
+				if( ( b & 0xC0U ) != 0x80U ) {
+					++column;
+				}
+			}
+		}
+		for_each_tier( [&] {
+			auto index = daw::range::line_index( );
+			for( size_t pos = 0; pos < text.size( ); ) {
+				auto const count =
+				  std::min<size_t>( text.size( ) - pos, random( ) % 150U );
+				index.append( text.data( ) + pos, text.data( ) + pos + count );
+				pos += count;
+			}
+			daw::expecting( index.size( ), text.size( ) );
+			daw::expecting( index.line_count( ), starts.size( ) );
+			for( size_t line = 0; line < starts.size( ); ++line ) {
+				daw::expecting( index.line_start( line ), starts[line] );
+				daw::expecting( index.is_ascii( line ), ascii[line] );
+			}
+			for( size_t pos = 0; pos <= text.size( ); ++pos ) {
+				if( pos < text.size( ) and
+				    ( static_cast<unsigned char>( text[pos] ) & 0xC0U ) == 0x80U ) {
+					continue;
+				}
+				daw::expecting( index.line_of( pos ), lines[pos] );
+				auto const found = index.position( rng( text ), pos );
+				daw::expecting( found.line, lines[pos] );
+				daw::expecting( found.column, columns[pos] );
+				daw::expecting( index.offset( rng( text ), found ), pos );
+			}
+		} );
+	}
+}
+
+int main( ) {
+	line_index_basic_test_001( );
+	line_index_many_lines_test_001( );
+	line_index_tiers_test_001( );
+	std::cout << "line index tests passed\n";
+}
@@ -0,0 +1,197 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_matcher.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using daw::range::match_strategy;
+using daw::range::multi_matcher;
+using daw::range::pattern_match;
+using daw::utf8::dispatch::isa;
+
+namespace {
+	/// Every occurrence of each pattern by start then pattern index
+	std::vector<pattern_match>
+	brute_force( std::vector<std::string> const &patterns,
+	             std::string const &text ) {
+		auto result = std::vector<pattern_match>( );
+		size_t code_points = 0;
+		for( size_t pos = 0; pos < text.size( ); ++pos ) {
+			for( size_t n = 0; n < patterns.size( ); ++n ) {
+				auto const &p = patterns[n];
+				if( not p.empty( ) and text.compare( pos, p.size( ), p ) == 0 ) {
+					auto const cps = daw::utf8::unchecked::distance(
+					  p.begin( ), p.end( ) );
+					result.push_back( pattern_match{
+					  n, pos, p.size( ), code_points,
+					  static_cast<size_t>( cps ) } );
+				}
+			}
+			if( ( static_cast<unsigned char>( text[pos] ) & 0xC0U ) != 0x80U ) {
+				++code_points;
+			}
+		}
+		return result;
+	}
+
+	bool same( std::vector<pattern_match> const &lhs,
+	           std::vector<pattern_match> const &rhs ) {
+		if( lhs.size( ) != rhs.size( ) ) {
+			return false;
+		}
+		for( size_t n = 0; n < lhs.size( ); ++n ) {
+			auto const &l = lhs[n];
+			auto const &r = rhs[n];
+			if( l.pattern != r.pattern or l.byte_offset != r.byte_offset or
+			    l.byte_size != r.byte_size or
+			    l.code_point_offset != r.code_point_offset or
+			    l.code_point_size != r.code_point_size ) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void check_all( std::vector<std::string> const &patterns,
+	                std::string const &text ) {
+		auto const expected = brute_force( patterns, text );
+		for( auto strategy :
+		     { match_strategy::automatic, match_strategy::prefilter,
+		       match_strategy::automaton } ) {
+			auto const m =
+			  multi_matcher( patterns.begin( ), patterns.end( ), strategy );
+			for( auto tier : supported_tiers( ) ) {
+				daw::utf8::dispatch::set_isa( tier );
+				daw::expecting( same( m.find_all( text ), expected ) );
+				auto const first = m.find_first( text );
+				daw::expecting( first.has_value( ), not expected.empty( ) );
+				if( first ) {
+					auto const &front = expected.front( );
+					daw::expecting( first->byte_offset, front.byte_offset );
+					daw::expecting( first->pattern, front.pattern );
+				}
+			}
+			daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+		}
+	}
+
+	std::string random_text( std::mt19937 &rng,
+	                         std::vector<std::string> const &alphabet,
+	                         size_t count ) {
+		auto pick =
+		  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+		auto result = std::string( );
+		for( size_t n = 0; n < count; ++n ) {
+			result += alphabet[pick( rng )];
+		}
+		return result;
+	}
+} // namespace
+
+void matcher_basic_test_001( ) {
+	// héllo, wörld and €
+	auto const m = multi_matcher{ "h\xC3\xA9llo", "w\xC3\xB6rld",
+	                              "\xE2\x82\xAC", "llo" };
+	daw::expecting( m.size( ), 4U );
+	auto const text = std::string( "\xE2\x82\xAC h\xC3\xA9llo w\xC3\xB6rld" );
+	auto const rng = daw::range::create_char_range( text );
+	auto const found = m.find_all( rng );
+	daw::expecting( found.size( ), 4U );
+	daw::expecting( found[0].pattern, 2U );
+	daw::expecting( found[1].pattern, 0U );
+	daw::expecting( found[1].byte_offset, 4U );
+	daw::expecting( found[1].code_point_offset, 2U );
+	daw::expecting( found[1].code_point_size, 5U );
+	daw::expecting( found[2].pattern, 3U );
+	daw::expecting( found[2].code_point_offset, 4U );
+	daw::expecting( found[3].pattern, 1U );
+	daw::expecting( found[3].code_point_offset, 8U );
+	daw::expecting( rng.substr( found[3].code_point_offset,
+	                            found[3].code_point_size )
+	                  .to_u32string( ) == U"wörld" );
+	daw::expecting( m.contains_any( rng ) );
+	daw::expecting( not m.contains_any( "goodbye" ) );
+}
+
+void matcher_stop_test_001( ) {
+	auto const m = multi_matcher{ "a", "b" };
+	size_t calls = 0;
+	m.for_each_match( "abab", [&]( pattern_match const & ) {
+		++calls;
+		return calls < 3;
+	} );
+	daw::expecting( calls, 3U );
+}
+
+void matcher_edge_test_001( ) {
+	auto const none = multi_matcher{ "" };
+	daw::expecting( none.find_all( "abc" ).empty( ) );
+	daw::expecting( not none.uses_prefilter( ) );
+	auto const dup = multi_matcher{ "ab", "ab", "b" };
+	auto const found = dup.find_all( "ab" );
+	daw::expecting( found.size( ), 3U );
+	daw::expecting( found[1].pattern, 1U );
+	bool has_thrown = false;
+	try {
+		(void)multi_matcher{ "ok", "\xC3" };
+	} catch( daw::utf8::invalid_utf8 const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+}
+
+void matcher_random_test_001( ) {
+	auto rng = std::mt19937( 1357 );
+	// A small alphabet with multi-byte code points gives many overlaps
+	auto const alphabet = std::vector<std::string>{
+	  "a", "b", "c", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+	auto len = std::uniform_int_distribution<size_t>( 1, 6 );
+	for( size_t n = 0; n < 300; ++n ) {
+		auto patterns = std::vector<std::string>( );
+		auto const count = 1 + n % 20;
+		for( size_t p = 0; p < count; ++p ) {
+			patterns.push_back( random_text( rng, alphabet, len( rng ) ) );
+		}
+		check_all( patterns, random_text( rng, alphabet, n % 200 ) );
+	}
+}
+
+void matcher_large_test_001( ) {
+	auto rng = std::mt19937( 8642 );
+	auto const alphabet = std::vector<std::string>{
+	  "a", "b", "c", "d", "e", "\xC3\xA9", "\xE2\x82\xAC" };
+	auto len = std::uniform_int_distribution<size_t>( 2, 8 );
+	auto patterns = std::vector<std::string>( );
+	for( size_t p = 0; p < 500; ++p ) {
+		patterns.push_back( random_text( rng, alphabet, len( rng ) ) );
+	}
+	// Longer than a reorder chunk so held matches are released in order
+	auto const text = random_text( rng, alphabet, 10000 );
+	auto const m = multi_matcher( patterns.begin( ), patterns.end( ) );
+	daw::expecting( not m.uses_prefilter( ) );
+	daw::expecting( same( m.find_all( text ), brute_force( patterns, text ) ) );
+	// Dense enough that the prefilter hands over to the automaton part way
+	auto const few = std::vector<std::string>( patterns.begin( ),
+	                                           patterns.begin( ) + 8 );
+	check_all( few, text );
+}
+
+int main( ) {
+	matcher_basic_test_001( );
+	matcher_stop_test_001( );
+	matcher_edge_test_001( );
+	matcher_random_test_001( );
+	matcher_large_test_001( );
+	std::cout << "matcher tests passed\n";
+}
@@ -0,0 +1,163 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/unchecked.h"
+#include "daw/utf_range/daw_utf_normalize.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+using daw::range::normalization_form;
+using daw::utf8::dispatch::isa;
+
+namespace {
+	constexpr normalization_form all_forms[] = {
+	  normalization_form::nfc, normalization_form::nfd, normalization_form::nfkc,
+	  normalization_form::nfkd };
+
+	std::string normalized( std::string const &text, normalization_form form ) {
+		auto const rng = daw::range::create_char_range( text );
+		return daw::range::normalize( rng, form ).to_string( );
+	}
+
+	void check( std::string const &text, normalization_form form,
+	            std::string const &expected ) {
+		auto const result = normalized( text, form );
+		daw::expecting( result, expected );
+		auto const rng = daw::range::create_char_range( text );
+		daw::expecting( daw::range::is_normalized( rng, form ), text == expected );
+	}
+} // namespace
+
+void normalize_basic_test_001( ) {
+	// é precomposed and as e with a combining acute
+	auto const composed = std::string( "caf\xC3\xA9" );
+	auto const decomposed = std::string( "cafe\xCC\x81" );
+	check( composed, normalization_form::nfc, composed );
+	check( decomposed, normalization_form::nfc, composed );
+	check( composed, normalization_form::nfd, decomposed );
+	check( decomposed, normalization_form::nfd, decomposed );
+	daw::expecting( daw::utf_string( composed ) !=
+	                daw::utf_string( decomposed ) );
+	auto str = daw::utf_string( decomposed );
+	daw::range::normalize( str );
+	daw::expecting( str == daw::utf_string( composed ) );
+	daw::expecting( str.size( ), 4U );
+
+	// Dot below sorts before the acute, then composes with the base first
+	check( "q\xCC\x81\xCC\xA3", normalization_form::nfd, "q\xCC\xA3\xCC\x81" );
+	check( "e\xCC\x81\xCC\xA3", normalization_form::nfc, "\xE1\xBA\xB9\xCC\x81" );
+	// Hangul syllables are composed and decomposed algorithmically
+	check( "\xEA\xB0\x81", normalization_form::nfd,
+	       "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" );
+	check( "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8", normalization_form::nfc,
+	       "\xEA\xB0\x81" );
+	// Compatibility forms, the fi ligature and a superscript two
+	check( "\xEF\xAC\x81x\xC2\xB2", normalization_form::nfkc, "fix2" );
+	check( "\xEF\xAC\x81x\xC2\xB2", normalization_form::nfc,
+	       "\xEF\xAC\x81x\xC2\xB2" );
+	check( "\xE1\xBA\x9B\xCC\xA3", normalization_form::nfkd,
+	       "s\xCC\xA3\xCC\x87" );
+	// Singletons and composition exclusions never come back
+	check( "\xE2\x84\xAB", normalization_form::nfc, "\xC3\x85" );
+	check( "\xE0\xA5\x98", normalization_form::nfc, "\xE0\xA4\x95\xE0\xA4\xBC" );
+	// A combining mark on its own and at the start stays where it is
+	check( "\xCC\x81"
+	       "a",
+	       normalization_form::nfc,
+	       "\xCC\x81"
+	       "a" );
+	check( "", normalization_form::nfkd, "" );
+}
+
+void normalize_no_copy_test_001( ) {
+	auto const text = std::string( 1000, 'x' ) + "\xC3\xA9\xE4\xB8\xAD";
+	auto const rng = daw::range::create_char_range( text );
+	for( auto form : { normalization_form::nfc, normalization_form::nfkc } ) {
+		auto buffer = std::string( );
+		auto const result = daw::range::normalize( rng, form, buffer );
+		daw::expecting( result.raw_begin( ) == rng.raw_begin( ) );
+		daw::expecting( result.raw_end( ) == rng.raw_end( ) );
+		daw::expecting( buffer.empty( ) );
+	}
+	auto buffer = std::string( );
+	auto const result =
+	  daw::range::normalize( rng, normalization_form::nfd, buffer );
+	daw::expecting( result.raw_begin( ) == buffer.data( ) );
+	daw::expecting( result.size( ), rng.size( ) + 1U );
+}
+
+void normalize_all_code_points_test_001( ) {
+	// Every code point up to the last with a decomposition, after an a and
+	// before a combining acute.  In each form the result is normalized,
+	// normalizing it again changes nothing and the composed forms are those
+	// of the decomposed forms
+	auto text = std::string( );
+	for( char32_t cp = 0; cp < 0x2FA20U; ++cp ) {
+		if( cp >= 0xD800U and cp < 0xE000U ) {
+			continue;
+		}
+		text.clear( );
+		text += 'a';
+		daw::utf8::unchecked::append( cp, std::back_inserter( text ) );
+		text += "\xCC\x81";
+		auto const nfd = normalized( text, normalization_form::nfd );
+		auto const nfkd = normalized( text, normalization_form::nfkd );
+		daw::expecting( normalized( nfd, normalization_form::nfc ),
+		                normalized( text, normalization_form::nfc ) );
+		daw::expecting( normalized( nfkd, normalization_form::nfkc ),
+		                normalized( text, normalization_form::nfkc ) );
+		for( auto form : all_forms ) {
+			auto const result = normalized( text, form );
+			auto const rng = daw::range::create_char_range( result );
+			daw::expecting( daw::range::is_normalized( rng, form ) );
+			daw::expecting( normalized( result, form ), result );
+		}
+	}
+}
+
+void normalize_tiers_test_001( ) {
+	auto rng = std::mt19937( 4545 );
+	// Long safe runs go through the kernels, the rest needs normalizing
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 40, 'x' ), "\xC3\xA9",     "e\xCC\x81",     "\xCC\xA3",
+	  "\xEA\xB0\x81",         "\xE1\x86\xA8", "\xEF\xAC\x81",  "\xE4\xB8\xAD",
+	  "\xE2\x84\xAB",         "\xC2\xB2",     "\xF0\x9F\x98\x80" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 300; ++n ) {
+		auto text = std::string( );
+		for( size_t k = 0; k < n % 30; ++k ) {
+			text += alphabet[pick( rng )];
+		}
+		for( auto form : all_forms ) {
+			daw::utf8::dispatch::set_isa( isa::scalar );
+			auto const expected = normalized( text, form );
+			for( auto tier : supported_tiers( ) ) {
+				daw::utf8::dispatch::set_isa( tier );
+				daw::expecting( normalized( text, form ), expected );
+			}
+		}
+	}
+	daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+}
+
+int main( ) {
+	normalize_basic_test_001( );
+	normalize_no_copy_test_001( );
+	normalize_all_code_points_test_001( );
+	normalize_tiers_test_001( );
+	std::cout << "normalize tests passed\n";
+}
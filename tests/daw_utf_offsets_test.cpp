@@ -0,0 +1,135 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_offsets.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	using offsets = std::vector<size_t>;
+} // namespace
+
+void offsets_basic_test_001( ) {
+	// a, é, 中 and 😀 take 1, 2, 3 and 4 bytes and 😀 is a surrogate pair
+	auto const text = std::string( "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80z" );
+	daw::expecting( daw::range::byte_to_code_point(
+	                  rng( text ), offsets{ 0, 1, 3, 6, 10, 11, 50 } ) ==
+	                offsets{ 0, 1, 2, 3, 4, 5, 5 } );
+	daw::expecting( daw::range::byte_to_utf16_index(
+	                  rng( text ), offsets{ 0, 1, 3, 6, 10, 11 } ) ==
+	                offsets{ 0, 1, 2, 3, 5, 6 } );
+	daw::expecting( daw::range::code_point_to_byte(
+	                  rng( text ), offsets{ 0, 1, 2, 2, 3, 4, 5, 9 } ) ==
+	                offsets{ 0, 1, 3, 3, 6, 10, 11, 11 } );
+	daw::expecting( daw::range::utf16_index_to_byte(
+	                  rng( text ), offsets{ 0, 1, 2, 3, 5, 6, 7 } ) ==
+	                offsets{ 0, 1, 3, 6, 10, 11, 11 } );
+	// Between the units of 😀 is the start of it, and later indices are not
+	// thrown off
+	daw::expecting( daw::range::utf16_index_to_byte( rng( text ),
+	                                                 offsets{ 4, 4, 5 } ) ==
+	                offsets{ 6, 6, 10 } );
+	// Inside a code point is the next one
+	daw::expecting( daw::range::byte_to_code_point( rng( text ),
+	                                                offsets{ 2, 7 } ) ==
+	                offsets{ 2, 4 } );
+	daw::expecting(
+	  daw::range::byte_to_code_point( rng( text ), offsets{ } ).empty( ) );
+}
+
+void offsets_tiers_test_001( ) {
+	auto random = std::mt19937( 4949 );
+	// Long ASCII runs put the positions on both sides of the kernel blocks
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 70, 'x' ), "a", "\xC3\xA9", "\xE4\xB8\xAD",
+	  "\xF0\x9F\x98\x80" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 200; ++n ) {
+		auto text = std::string( );
+		// The byte offset and UTF-16 index of each code point, and the end
+		auto bytes = offsets( );
+		auto units = offsets( );
+		size_t unit = 0;
+		for( size_t k = 0; k < n % 40; ++k ) {
+			auto const &piece = alphabet[pick( random )];
+			for( size_t pos = 0; pos < piece.size( ); ++pos ) {
+				auto const b = static_cast<unsigned char>( piece[pos] );
+				if( ( b & 0xC0U ) != 0x80U ) {
+					bytes.push_back( text.size( ) + pos );
+					units.push_back( unit );
+					unit += b >= 0xF0U ? 2U : 1U;
+				}
+			}
+			text += piece;
+		}
+		bytes.push_back( text.size( ) );
+		units.push_back( unit );
+		auto const cps = bytes.size( ) - 1U;
+
+		auto cp_indices = offsets( );
+		auto unit_indices = offsets( );
+		auto byte_offsets = offsets( );
+		for( size_t k = 0; k < 20; ++k ) {
+			cp_indices.push_back( random( ) % ( cps + 3U ) );
+			unit_indices.push_back( random( ) % ( unit + 3U ) );
+			byte_offsets.push_back( bytes[random( ) % ( cps + 1U )] );
+		}
+		std::sort( cp_indices.begin( ), cp_indices.end( ) );
+		std::sort( unit_indices.begin( ), unit_indices.end( ) );
+		std::sort( byte_offsets.begin( ), byte_offsets.end( ) );
+
+		auto expected_cp_bytes = offsets( );
+		for( auto i : cp_indices ) {
+			expected_cp_bytes.push_back( bytes[std::min( i, cps )] );
+		}
+		auto expected_unit_bytes = offsets( );
+		for( auto i : unit_indices ) {
+			// The last code point that starts at or before i
+			auto const pos = static_cast<size_t>(
+			  std::upper_bound( units.begin( ), units.end( ), i ) - units.begin( ) );
+			expected_unit_bytes.push_back( bytes[pos - 1U] );
+		}
+		auto expected_cps = offsets( );
+		auto expected_units = offsets( );
+		for( auto b : byte_offsets ) {
+			auto const pos = static_cast<size_t>(
+			  std::lower_bound( bytes.begin( ), bytes.end( ), b ) - bytes.begin( ) );
+			expected_cps.push_back( pos );
+			expected_units.push_back( units[pos] );
+		}
+		for_each_tier( [&] {
+			daw::expecting(
+			  daw::range::code_point_to_byte( rng( text ), cp_indices ) ==
+			  expected_cp_bytes );
+			daw::expecting(
+			  daw::range::utf16_index_to_byte( rng( text ), unit_indices ) ==
+			  expected_unit_bytes );
+			daw::expecting(
+			  daw::range::byte_to_code_point( rng( text ), byte_offsets ) ==
+			  expected_cps );
+			daw::expecting(
+			  daw::range::byte_to_utf16_index( rng( text ), byte_offsets ) ==
+			  expected_units );
+		} );
+	}
+}
+
+int main( ) {
+	offsets_basic_test_001( );
+	offsets_tiers_test_001( );
+	std::cout << "offsets tests passed\n";
+}
@@ -0,0 +1,587 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+// Throughput of the hot paths over generated corpora.  Each result is
+// written as one JSON object per line, or as CSV with --format=csv, so runs
+// can be compared between releases.
+//
+// daw_utf_range_bench [--size=bytes] [--runs=n] [--format=json|csv]
+//                     [--filter=text]
+
+#include "daw/utf8/checked.h"
+#include "daw/utf8/dispatch.h"
+#include "daw/utf8/unchecked.h"
+#include "daw/utf_range/daw_utf_case.h"
+#include "daw/utf_range/daw_utf_grapheme.h"
+#include "daw/utf_range/daw_utf_line_index.h"
+#include "daw/utf_range/daw_utf_matcher.h"
+#include "daw/utf_range/daw_utf_normalize.h"
+#include "daw/utf_range/daw_utf_offsets.h"
+#include "daw/utf_range/daw_utf_range.h"
+#include "daw/utf_range/daw_utf_split.h"
+#include "daw/utf_range/daw_utf_string.h"
+#include "daw/utf_range/daw_utf_truncate.h"
+#include "daw/utf_range/daw_utf_width.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+	struct options {
+		size_t size = 4U * 1024U * 1024U;
+		size_t runs = 5;
+		bool csv = false;
+		std::string filter = { };
+	};
+
+	struct cp_block {
+		uint32_t first;
+		uint32_t last;
+		unsigned weight;
+	};
+
+	struct corpus {
+		std::string name;
+		std::string text;
+		bool valid;
+	};
+
+	/// Random text of about size bytes drawn from blocks by weight.  Spaces are
+	/// mixed in as real text has them.  When error_rate is non-zero, that
+	/// fraction of the bytes is overwritten with 0xFF
+	std::string generate( std::mt19937 &rng, size_t size,
+	                      std::vector<cp_block> const &blocks,
+	                      double error_rate = 0.0 ) {
+		auto weights = std::vector<unsigned>( );
+		for( auto const &b : blocks ) {
+			weights.push_back( b.weight );
+		}
+		auto pick = std::discrete_distribution<size_t>( weights.begin( ),
+		                                                weights.end( ) );
+		auto word = std::uniform_int_distribution<int>( 2, 9 );
+		auto result = std::string( );
+		result.reserve( size + 4U );
+		while( result.size( ) < size ) {
+			for( auto n = word( rng ); n > 0; --n ) {
+				auto const &b = blocks[pick( rng )];
+				auto const cp =
+				  std::uniform_int_distribution<uint32_t>( b.first, b.last )( rng );
+				daw::utf8::unchecked::append( cp, std::back_inserter( result ) );
+			}
+			result.push_back( ' ' );
+		}
+		if( error_rate > 0.0 ) {
+			auto errors =
+			  static_cast<size_t>( static_cast<double>( size ) * error_rate );
+			auto pos = std::uniform_int_distribution<size_t>( 0, result.size( ) - 1 );
+			for( ; errors > 0; --errors ) {
+				result[pos( rng )] = static_cast<char>( 0xFF );
+			}
+		}
+		return result;
+	}
+
+	std::vector<corpus> make_corpora( size_t size ) {
+		auto rng = std::mt19937( 0x5EED );
+		auto const ascii = cp_block{ 0x21, 0x7E, 10 };
+		auto const latin = std::vector<cp_block>{ ascii, { 0xC0, 0x17F, 2 } };
+		auto const cyrillic = std::vector<cp_block>{ { 0x410, 0x44F, 10 } };
+		auto const cjk = std::vector<cp_block>{ { 0x4E00, 0x9FFF, 10 },
+		                                        { 0x3001, 0x3002, 1 } };
+		auto const emoji =
+		  std::vector<cp_block>{ ascii, { 0x1F300, 0x1FAFF, 6 } };
+		auto const mixed = std::vector<cp_block>{
+		  ascii, { 0xC0, 0x17F, 2 }, { 0x410, 0x44F, 3 }, { 0x4E00, 0x9FFF, 3 },
+		  { 0x1F300, 0x1FAFF, 1 } };
+		return {
+		  { "ascii", generate( rng, size, { ascii } ), true },
+		  { "latin", generate( rng, size, latin ), true },
+		  { "cyrillic", generate( rng, size, cyrillic ), true },
+		  { "cjk", generate( rng, size, cjk ), true },
+		  { "emoji", generate( rng, size, emoji ), true },
+		  { "mixed", generate( rng, size, mixed ), true },
+		  { "mixed_err_0.01pct", generate( rng, size, mixed, 0.0001 ), false },
+		  { "mixed_err_1pct", generate( rng, size, mixed, 0.01 ), false } };
+	}
+
+	/// Keeps results alive so the work is not optimized away
+	volatile size_t sink = 0;
+
+	class runner {
+		options m_opts;
+		bool m_first = true;
+
+	public:
+		explicit runner( options opts )
+		  : m_opts( std::move( opts ) ) {}
+
+		/// Time func, the best of the runs is reported.  bytes and code_points
+		/// are the amount of input one call processes
+		template<typename Func>
+		void operator( )( std::string const &bench, std::string const &impl,
+		                  corpus const &c, size_t bytes, size_t code_points,
+		                  Func &&func ) {
+			auto const name = bench + '/' + impl;
+			if( not m_opts.filter.empty( ) and
+			    name.find( m_opts.filter ) == std::string::npos ) {
+				return;
+			}
+			auto best = std::chrono::duration<double>::max( );
+			for( size_t n = 0; n < m_opts.runs; ++n ) {
+				auto const start = std::chrono::steady_clock::now( );
+				sink = sink + static_cast<size_t>( func( ) );
+				auto const elapsed = std::chrono::duration<double>(
+				  std::chrono::steady_clock::now( ) - start );
+				best = std::min( best, elapsed );
+			}
+			auto const seconds = best.count( );
+			auto const gbs = static_cast<double>( bytes ) / seconds / 1e9;
+			auto const mcps = static_cast<double>( code_points ) / seconds / 1e6;
+			auto const isa = daw::utf8::dispatch::isa_name(
+			  daw::utf8::dispatch::active_isa( ) );
+			if( m_opts.csv ) {
+				if( m_first ) {
+					std::cout << "benchmark,impl,isa,corpus,bytes,code_points,seconds,"
+					             "gb_per_s,mcp_per_s\n";
+				}
+				std::cout << bench << ',' << impl << ',' << isa << ',' << c.name
+				          << ',' << bytes << ',' << code_points << ',' << seconds
+				          << ',' << gbs << ',' << mcps << '\n';
+			} else {
+				std::cout << R"({"benchmark":")" << bench << R"(","impl":")" << impl
+				          << R"(","isa":")" << isa << R"(","corpus":")" << c.name
+				          << R"(","bytes":)" << bytes << R"(,"code_points":)"
+				          << code_points << R"(,"seconds":)" << seconds
+				          << R"(,"gb_per_s":)" << gbs << R"(,"mcp_per_s":)" << mcps
+				          << "}\n";
+			}
+			m_first = false;
+		}
+	};
+
+	/// Scanning benchmarks that accept invalid input
+	void bench_scanning( runner &run, corpus const &c ) {
+		auto const first = c.text.data( );
+		auto const last = first + c.text.size( );
+		auto const bytes = c.text.size( );
+		auto const cps =
+		  static_cast<size_t>( std::count_if( first, last, []( char ch ) {
+			  return not daw::utf8::internal::is_trail( ch );
+		  } ) );
+		// Every error is found, not only the first
+		auto const all_invalid = [&]( auto find ) {
+			return [=] {
+				size_t errors = 0;
+				for( auto it = find( first, last ); it != last;
+				     it = find( it + 1, last ) ) {
+					++errors;
+				}
+				return errors;
+			};
+		};
+		run( "find_invalid", "generic", c, bytes, cps,
+		     all_invalid( []( char const *f, char const *l ) {
+			     return daw::utf8::find_invalid( f, l );
+		     } ) );
+		run( "find_invalid", "dfa", c, bytes, cps,
+		     all_invalid( []( char const *f, char const *l ) {
+			     return daw::utf8::find_invalid<daw::utf8::engine::dfa>( f, l );
+		     } ) );
+		run( "find_invalid", "dispatch", c, bytes, cps,
+		     all_invalid( daw::utf8::dispatch::find_invalid ) );
+		auto out = std::string( );
+		out.reserve( bytes * 3U );
+		run( "replace_invalid", "generic", c, bytes, cps, [&] {
+			out.clear( );
+			daw::utf8::replace_invalid( first, last, std::back_inserter( out ) );
+			return out.size( );
+		} );
+	}
+
+	void bench_valid( runner &run, corpus const &c ) {
+		auto const first = c.text.data( );
+		auto const last = first + c.text.size( );
+		auto const bytes = c.text.size( );
+		auto const cps =
+		  static_cast<size_t>( daw::utf8::unchecked::distance( first, last ) );
+
+		run( "distance", "generic", c, bytes, cps, [&] {
+			return daw::utf8::unchecked::distance( first, last );
+		} );
+		run( "distance", "dispatch", c, bytes, cps, [&] {
+			return daw::utf8::dispatch::count_code_points( first, last );
+		} );
+		// Checked decoding, one code point at a time
+		auto const decode_all = [&]( auto engine ) {
+			return [=] {
+				using engine_t = decltype( engine );
+				uint32_t sum = 0;
+				for( auto it = first; it != last; ) {
+					sum += daw::utf8::next<engine_t>( it, last );
+				}
+				return sum;
+			};
+		};
+		run( "next", "classic", c, bytes, cps,
+		     decode_all( daw::utf8::engine::classic{ } ) );
+		run( "next", "dfa", c, bytes, cps,
+		     decode_all( daw::utf8::engine::dfa{ } ) );
+
+		auto u16 = std::u16string( bytes, u'\0' );
+		auto u32 = std::u32string( bytes, U'\0' );
+		auto u8 = std::string( bytes, '\0' );
+		run( "utf8to16", "generic", c, bytes, cps, [&] {
+			return daw::utf8::unchecked::utf8to16( first, last, u16.data( ) ) -
+			       u16.data( );
+		} );
+		run( "utf8to16", "dispatch", c, bytes, cps, [&] {
+			return daw::utf8::dispatch::utf8to16( first, last, u16.data( ) ) -
+			       u16.data( );
+		} );
+		u16.resize( static_cast<size_t>(
+		  daw::utf8::unchecked::utf8to16( first, last, u16.data( ) ) -
+		  u16.data( ) ) );
+		auto const u16_first = u16.data( );
+		auto const u16_last = u16_first + u16.size( );
+		run( "utf16to8", "generic", c, bytes, cps, [&] {
+			return daw::utf8::unchecked::utf16to8( u16_first, u16_last,
+			                                       u8.data( ) ) -
+			       u8.data( );
+		} );
+		run( "utf16to8", "dispatch", c, bytes, cps, [&] {
+			return daw::utf8::dispatch::utf16to8( u16_first, u16_last,
+			                                      u8.data( ) ) -
+			       u8.data( );
+		} );
+		auto const u16_bytes = u16.size( ) * sizeof( char16_t );
+		run( "find_invalid_utf16", "dispatch", c, u16_bytes, cps, [&] {
+			return daw::utf8::dispatch::find_invalid_utf16( u16_first, u16_last ) -
+			       u16_first;
+		} );
+		run( "utf16_count", "dispatch", c, u16_bytes, cps, [&] {
+			return daw::utf8::dispatch::utf16_count_code_points( u16_first,
+			                                                     u16_last );
+		} );
+		run( "utf8to32", "generic", c, bytes, cps, [&] {
+			return daw::utf8::unchecked::utf8to32( first, last, u32.data( ) ) -
+			       u32.data( );
+		} );
+		run( "utf8to32", "dispatch", c, bytes, cps, [&] {
+			return daw::utf8::dispatch::utf8to32( first, last, u32.data( ) ) -
+			       u32.data( );
+		} );
+		// The runs above are skipped when filtered out
+		daw::utf8::unchecked::utf8to32( first, last, u32.data( ) );
+		auto const u32_first = u32.data( );
+		auto const u32_last = u32_first + cps;
+		run( "utf32to8", "generic", c, bytes, cps, [&] {
+			return daw::utf8::unchecked::utf32to8( u32_first, u32_last,
+			                                       u8.data( ) ) -
+			       u8.data( );
+		} );
+		run( "utf32to8", "dispatch", c, bytes, cps, [&] {
+			return daw::utf8::dispatch::utf32to8( u32_first, u32_last,
+			                                      u8.data( ) ) -
+			       u8.data( );
+		} );
+
+		// The code points of the text truncated to 8 bits as Latin-1
+		auto latin1 = std::string( cps, '\0' );
+		std::transform( u32_first, u32_last, latin1.begin( ), []( char32_t cp ) {
+			return static_cast<char>( static_cast<unsigned char>( cp ) );
+		} );
+		auto const l1_first = latin1.data( );
+		auto const l1_last = l1_first + latin1.size( );
+		auto l1_utf8 = std::string( 2U * cps, '\0' );
+		run( "latin1to8", "generic", c, cps, cps, [&] {
+			auto out = l1_utf8.data( );
+			for( auto it = l1_first; it != l1_last; ++it ) {
+				out = daw::utf8::unchecked::append( static_cast<unsigned char>( *it ),
+				                                    out );
+			}
+			return out - l1_utf8.data( );
+		} );
+		run( "latin1to8", "dispatch", c, cps, cps, [&] {
+			return daw::utf8::dispatch::latin1to8( l1_first, l1_last,
+			                                       l1_utf8.data( ) ) -
+			       l1_utf8.data( );
+		} );
+		l1_utf8.resize( static_cast<size_t>(
+		  daw::utf8::dispatch::latin1to8( l1_first, l1_last, l1_utf8.data( ) ) -
+		  l1_utf8.data( ) ) );
+		auto const l1_u8_first = l1_utf8.data( );
+		auto const l1_u8_last = l1_u8_first + l1_utf8.size( );
+		run( "utf8tolatin1", "generic", c, l1_utf8.size( ), cps, [&] {
+			auto out = latin1.data( );
+			for( auto it = l1_u8_first; it != l1_u8_last; ) {
+				*out++ = static_cast<char>( daw::utf8::unchecked::next( it ) );
+			}
+			return out - latin1.data( );
+		} );
+		run( "utf8tolatin1", "dispatch", c, l1_utf8.size( ), cps, [&] {
+			return daw::utf8::dispatch::utf8tolatin1( l1_u8_first, l1_u8_last,
+			                                          latin1.data( ) )
+			         .output -
+			       latin1.data( );
+		} );
+
+		auto const sv = daw::string_view( first, bytes );
+		run( "utf_range", "construct", c, bytes, cps, [&] {
+			return daw::range::create_char_range( sv ).size( );
+		} );
+		auto const rng = daw::range::create_char_range( sv );
+		run( "utf_range", "substr", c, bytes, cps / 2U, [&] {
+			return rng.substr( cps / 4U, cps / 2U ).size( );
+		} );
+		auto const copy = c.text;
+		auto const rng_copy = daw::range::create_char_range( copy );
+		run( "utf_range", "compare", c, bytes, cps, [&] {
+			return static_cast<size_t>( rng.compare( rng_copy ) == 0 );
+		} );
+		run( "utf_range", "hash", c, bytes, cps, [&] {
+			return std::hash<daw::range::utf_range>{ }( rng );
+		} );
+		// The last few code points, so the whole text is scanned
+		auto const needle = rng.substr( cps - std::min<size_t>( cps, 8U ),
+		                                std::min<size_t>( cps, 8U ) );
+		run( "find", "generic", c, bytes, cps, [&] {
+			return static_cast<size_t>( std::distance(
+			  rng.begin( ),
+			  std::search( rng.begin( ), rng.end( ), needle.begin( ),
+			               needle.end( ) ) ) );
+		} );
+		run( "find", "dispatch", c, bytes, cps, [&] {
+			return static_cast<size_t>( rng.find( needle ).raw_begin( ) -
+			                            rng.raw_begin( ) );
+		} );
+		// Keywords taken from the text at even spacing so that each is found
+		auto const keywords = [&]( size_t count ) {
+			auto result = std::vector<std::string>( );
+			auto const len = std::min<size_t>( cps, 6U );
+			for( size_t n = 0; n < count; ++n ) {
+				auto const pos = ( cps - len ) / count * n;
+				result.push_back( rng.substr( pos, len ).to_raw_u8string( ) );
+			}
+			return result;
+		};
+		auto const few = keywords( 16 );
+		run( "multi_find", "generic", c, bytes, cps, [&] {
+			size_t found = 0;
+			for( auto const &k : few ) {
+				auto const keyword = daw::range::create_char_range( k );
+				auto rest = rng;
+				for( auto f = rest.find( keyword ); not f.empty( );
+				     f = rest.find( keyword ) ) {
+					++found;
+					rest = daw::range::utf_range( ++f.begin( ), rest.end( ) );
+				}
+			}
+			return found;
+		} );
+		for( auto strategy : { daw::range::match_strategy::prefilter,
+		                       daw::range::match_strategy::automaton } ) {
+			auto const m =
+			  daw::range::multi_matcher( few.begin( ), few.end( ), strategy );
+			auto const name =
+			  strategy == daw::range::match_strategy::prefilter ? "prefilter"
+			                                                    : "automaton";
+			run( "multi_find", name, c, bytes, cps, [&] {
+				size_t found = 0;
+				m.for_each_match( rng, [&]( daw::range::pattern_match const & ) {
+					++found;
+				} );
+				return found;
+			} );
+		}
+		auto const many = keywords( 2000 );
+		auto const large = daw::range::multi_matcher( many.begin( ), many.end( ) );
+		run( "multi_find_2000", "automaton", c, bytes, cps, [&] {
+			size_t found = 0;
+			large.for_each_match( rng, [&]( daw::range::pattern_match const & ) {
+				++found;
+			} );
+			return found;
+		} );
+		run( "split", "generic", c, bytes, cps, [&] {
+			size_t total = 0;
+			auto piece_first = rng.begin( );
+			while( true ) {
+				auto const pos = std::find( piece_first, rng.end( ), U' ' );
+				total += daw::range::utf_range( piece_first, pos ).size( );
+				if( pos == rng.end( ) ) {
+					return total;
+				}
+				piece_first = std::next( pos );
+			}
+		} );
+		run( "split", "dispatch", c, bytes, cps, [&] {
+			size_t total = 0;
+			for( auto piece : daw::range::split( rng, U' ' ) ) {
+				total += piece.size( );
+			}
+			return total;
+		} );
+		run( "split_any", "dispatch", c, bytes, cps, [&] {
+			size_t total = 0;
+			for( auto piece : daw::range::split_any( rng, { U' ', U'\t' } ) ) {
+				total += piece.size( );
+			}
+			return total;
+		} );
+		run( "graphemes", "code_points", c, bytes, cps, [&] {
+			size_t total = 0;
+			for( auto cp : rng ) {
+				total += cp == U' ' ? 1U : 0U;
+			}
+			return total;
+		} );
+		run( "graphemes", "iterate", c, bytes, cps, [&] {
+			size_t total = 0;
+			for( auto g : daw::range::graphemes( rng ) ) {
+				total += g.size( );
+			}
+			return total;
+		} );
+		run( "graphemes", "count", c, bytes, cps,
+		     [&] { return daw::range::grapheme_count( rng ); } );
+		// Corpus text is already in NFC, the quick check settles it
+		auto buffer = std::string( );
+		run( "normalize", "is_nfc", c, bytes, cps,
+		     [&] { return daw::range::is_normalized( rng ) ? 1U : 0U; } );
+		run( "normalize", "nfc", c, bytes, cps, [&] {
+			return daw::range::normalize( rng, daw::range::normalization_form::nfc,
+			                              buffer )
+			  .raw_size( );
+		} );
+		run( "normalize", "nfd", c, bytes, cps, [&] {
+			return daw::range::normalize( rng, daw::range::normalization_form::nfd,
+			                              buffer )
+			  .raw_size( );
+		} );
+		run( "case", "to_lower", c, bytes, cps,
+		     [&] { return daw::range::to_lower( rng ).raw_size( ); } );
+		run( "case", "case_fold", c, bytes, cps,
+		     [&] { return daw::range::case_fold( rng ).raw_size( ); } );
+		run( "case", "hash_icase", c, bytes, cps,
+		     [&] { return daw::range::hash_icase( rng ); } );
+		// Folding is idempotent, so the whole text is compared
+		auto const folded = daw::range::case_fold( rng );
+		run( "case", "compare_icase", c, bytes, cps, [&] {
+			return static_cast<size_t>(
+			  daw::range::compare_icase( rng, folded.utf_range( ) ) + 1 );
+		} );
+		run( "width", "display_width", c, bytes, cps,
+		     [&] { return daw::range::display_width( rng ); } );
+		run( "width", "truncate_to_width", c, bytes, cps, [&] {
+			return daw::range::truncate_to_width( rng, cps ).raw_size( );
+		} );
+		// Cut in the middle so the sizes are counted over half the text
+		run( "truncate", "truncate_bytes", c, bytes, cps, [&] {
+			return daw::range::truncate_bytes( rng, bytes / 2U ).size( );
+		} );
+		run( "truncate", "take_last_bytes", c, bytes, cps, [&] {
+			return daw::range::take_last_bytes( rng, bytes / 2U ).size( );
+		} );
+		run( "truncate", "truncate_code_points", c, bytes, cps, [&] {
+			return daw::range::truncate_code_points( rng, cps / 2U ).raw_size( );
+		} );
+		// A thousand positions spread over the text, resolved in one pass
+		auto byte_offsets = std::vector<size_t>( );
+		auto indices = std::vector<size_t>( );
+		for( size_t n = 0; n < 1000U; ++n ) {
+			byte_offsets.push_back( bytes / 1000U * n );
+			indices.push_back( cps / 1000U * n );
+		}
+		run( "offsets", "byte_to_code_point", c, bytes, cps, [&] {
+			return daw::range::byte_to_code_point( rng, byte_offsets ).back( );
+		} );
+		run( "offsets", "byte_to_utf16_index", c, bytes, cps, [&] {
+			return daw::range::byte_to_utf16_index( rng, byte_offsets ).back( );
+		} );
+		run( "offsets", "code_point_to_byte", c, bytes, cps, [&] {
+			return daw::range::code_point_to_byte( rng, indices ).back( );
+		} );
+		run( "offsets", "utf16_index_to_byte", c, bytes, cps, [&] {
+			return daw::range::utf16_index_to_byte( rng, indices ).back( );
+		} );
+		// Lines of ten words, about 60 to 160 bytes
+		auto lines = c.text;
+		size_t spaces = 0;
+		for( auto &ch : lines ) {
+			if( ch == ' ' and ++spaces % 10U == 0 ) {
+				ch = '\n';
+			}
+		}
+		auto const lines_rng = daw::range::create_char_range( lines );
+		run( "line_index", "build", c, bytes, cps, [&] {
+			return daw::range::line_index( lines_rng ).line_count( );
+		} );
+		auto const index = daw::range::line_index( lines_rng );
+		run( "line_index", "position", c, bytes, cps, [&] {
+			size_t result = 0;
+			for( auto offset : byte_offsets ) {
+				result += index.position( lines_rng, offset ).column;
+			}
+			return result;
+		} );
+		// Sorting is O(n log n), a smaller slice keeps the run time reasonable
+		auto const slice = rng.substr( 0, std::min<size_t>( cps, 1U << 16U ) );
+		auto const slice_str = daw::utf_string( slice );
+		run( "utf_string", "sort", c, slice.raw_size( ), slice.size( ), [&] {
+			auto str = slice_str;
+			str.sort( );
+			return str.size( );
+		} );
+	}
+
+	options parse_options( int argc, char **argv ) {
+		auto result = options{ };
+		for( int n = 1; n < argc; ++n ) {
+			auto const arg = std::string( argv[n] );
+			auto const value = [&]( std::string const &name ) {
+				return arg.substr( name.size( ) );
+			};
+			if( arg.rfind( "--size=", 0 ) == 0 ) {
+				result.size = std::stoull( value( "--size=" ) );
+			} else if( arg.rfind( "--runs=", 0 ) == 0 ) {
+				result.runs = std::max<size_t>( 1, std::stoull( value( "--runs=" ) ) );
+			} else if( arg == "--format=csv" ) {
+				result.csv = true;
+			} else if( arg == "--format=json" ) {
+				result.csv = false;
+			} else if( arg.rfind( "--filter=", 0 ) == 0 ) {
+				result.filter = value( "--filter=" );
+			} else {
+				std::cerr << "usage: " << argv[0]
+				          << " [--size=bytes] [--runs=n] [--format=json|csv]"
+				             " [--filter=text]\n";
+				std::exit( EXIT_FAILURE );
+			}
+		}
+		return result;
+	}
+} // namespace
+
+int main( int argc, char **argv ) {
+	auto const opts = parse_options( argc, argv );
+	auto run = runner( opts );
+	for( auto const &c : make_corpora( opts.size ) ) {
+		bench_scanning( run, c );
+		if( c.valid ) {
+			bench_valid( run, c );
+		}
+	}
+}
@@ -22,6 +22,8 @@
 
 #include <iostream>
 
+#include <daw/daw_benchmark.h>
+
 #include "daw/utf_range/daw_utf_range.h"
 
 void char_range_test_001( ) {
@@ -32,6 +34,102 @@ void char_range_test_001( ) {
 	}
 }
 
+void char_range_buffer_test_001( ) {
+	auto const rng = daw::range::create_char_range( "Приве́т 😀" );
+	auto u32 = std::u32string( );
+	u32.reserve( 64 );
+	auto const cap = u32.capacity( );
+	daw::expecting( rng.to_u32string( u32 ), rng.size( ) );
+	daw::expecting( u32 == rng.to_u32string( ) );
+	daw::expecting( u32.capacity( ), cap );
+
+	char32_t buff32[4]{ };
+	daw::expecting( rng.to_u32string( buff32, 4 ), rng.size( ) );
+	daw::expecting( buff32[0], char32_t{ } );
+	char32_t buff32_big[16]{ };
+	daw::expecting( rng.to_u32string( buff32_big, 16 ), rng.size( ) );
+	daw::expecting( std::u32string( buff32_big, rng.size( ) ) == u32 );
+
+	auto u8 = std::string( );
+	daw::expecting( daw::range::to_string( rng, u8 ), rng.raw_size( ) );
+	daw::expecting( u8, daw::range::to_string( rng ) );
+	char buff8[32]{ };
+	daw::expecting( rng.to_raw_u8string( buff8, 4 ), rng.raw_size( ) );
+	daw::expecting( buff8[0], '\0' );
+	daw::expecting( rng.to_raw_u8string( buff8, 32 ), rng.raw_size( ) );
+	daw::expecting( std::string( buff8, rng.raw_size( ) ), u8 );
+
+	auto back = std::string( );
+	daw::expecting( daw::from_u32string( u32, back ), u8.size( ) );
+	daw::expecting( back, u8 );
+	daw::expecting( daw::from_u32string( u32, buff8, 2 ), u8.size( ) );
+	daw::expecting( daw::from_u32string( u32 ), u8 );
+}
+
+void utf_literal_test_001( ) {
+	using namespace daw::utf_literals;
+	static constexpr auto lit = daw::range::make_utf_literal( "Приве́т 😀" );
+	static_assert( lit.size( ) == 9 );
+	static_assert( lit.raw_size( ) == 19 );
+	static constexpr auto lit2 = "Приве́т 😀"_utf;
+	static_assert( lit2.hash( ) == lit.hash( ) );
+	daw::expecting( lit.hash( ),
+	                std::hash<daw::range::utf_range>{ }( lit.range( ) ) );
+	daw::range::utf_range const &rng = lit;
+	daw::expecting( rng == daw::range::create_char_range( "Приве́т 😀" ) );
+	daw::expecting( std::u32string( U"Приве́т 😀" ) == rng.to_u32string( ) );
+}
+
+void search_test_001( ) {
+	auto const text = std::string( 100, '.' ) + "Приве́т 😀 привет Приве́т!";
+	auto const rng = daw::range::create_char_range( text );
+	auto const needle = daw::range::create_char_range( "Приве́т" );
+	auto const found = rng.find( needle );
+	daw::expecting( found == needle );
+	daw::expecting( found.size( ), needle.size( ) );
+	daw::expecting( rng.offset_of( found ), 100U );
+	auto const last = rng.rfind( needle );
+	daw::expecting( last == needle );
+	daw::expecting( rng.offset_of( last ), 100U + 17U );
+	daw::expecting( last.raw_end( ) + 1, rng.raw_end( ) );
+
+	auto const emoji = rng.find( 0x1F600U );
+	daw::expecting( emoji.size( ), 1U );
+	daw::expecting( *emoji.begin( ), 0x1F600U );
+	daw::expecting( rng.offset_of( emoji ), 108U );
+	daw::expecting( rng.rfind( U'.' ).raw_begin( ) - rng.raw_begin( ), 99 );
+
+	auto const missing = rng.find( daw::range::create_char_range( "Hello" ) );
+	daw::expecting( missing.empty( ) );
+	daw::expecting( missing.raw_begin( ), rng.raw_end( ) );
+	daw::expecting( rng.rfind( U'x' ).empty( ) );
+	daw::expecting( not rng.contains( U'x' ) );
+	daw::expecting( rng.contains( needle ) );
+	daw::expecting( rng.contains( daw::range::utf_range( ) ) );
+	// The e with a combining acute accent is not the same as e alone
+	daw::expecting( not rng.contains(
+	  daw::range::create_char_range( "Привет!" ) ) );
+
+	daw::expecting( rng.starts_with( daw::range::create_char_range( "..." ) ) );
+	daw::expecting( rng.starts_with( U'.' ) );
+	daw::expecting( not rng.starts_with( needle ) );
+	daw::expecting( rng.ends_with( daw::range::create_char_range( "т!" ) ) );
+	daw::expecting( ( rng + 100 ).starts_with( needle ) );
+}
+
+void search_utf16_test_001( ) {
+	auto const rng = daw::range::create_char_range( u"a😀b😀c" );
+	auto const found = rng.find( 0x1F600U );
+	daw::expecting( rng.offset_of( found ), 1U );
+	daw::expecting( rng.offset_of( rng.rfind( 0x1F600U ) ), 3U );
+	daw::expecting( rng.contains( daw::range::create_char_range( u"b😀" ) ) );
+	daw::expecting( not rng.contains( U'x' ) );
+}
+
 int main( ) {
 	char_range_test_001( );
+	char_range_buffer_test_001( );
+	utf_literal_test_001( );
+	search_test_001( );
+	search_utf16_test_001( );
 }
@@ -0,0 +1,139 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_rope.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+void utf_rope_test_001( ) {
+	auto rope = daw::utf_rope( R"(Приве́т नमस्ते שָׁלוֹם)" );
+	auto const str = daw::utf_string( R"(Приве́т नमस्ते שָׁלוֹם)" );
+	daw::expecting( rope.size( ), str.size( ) );
+	daw::expecting( rope.raw_size( ), str.raw_size( ) );
+	daw::expecting( rope.to_utf_string( ) == str );
+	size_t n = 0;
+	for( auto c : rope ) {
+		daw::expecting( c, rope[n++] );
+	}
+	daw::expecting( n, rope.size( ) );
+}
+
+void utf_rope_edit_001( ) {
+	auto rope = daw::utf_rope( "Прит" );
+	rope.insert( 3, daw::string_view( "ве́" ) );
+	daw::expecting( rope.to_string( ), std::string( "Приве́т" ) );
+	rope.insert( 0, daw::string_view( "😀" ) );
+	rope.append( daw::string_view( "!\n" ) );
+	daw::expecting( rope.to_string( ), std::string( "😀Приве́т!\n" ) );
+	rope.erase( 0, 1 );
+	rope.erase( 4, 2 );
+	daw::expecting( rope.to_string( ), std::string( "Привт!\n" ) );
+	daw::expecting( rope.size( ), 7U );
+	daw::expecting( rope.line_count( ), 2U );
+	rope.erase( 2 );
+	daw::expecting( rope.to_string( ), std::string( "Пр" ) );
+}
+
+void utf_rope_large_001( ) {
+	// Compare against utf_string after many scattered edits
+	auto rope = daw::utf_rope( );
+	auto str = daw::utf_string( );
+	uint32_t seed = 1;
+	auto rand = [&seed]( size_t mod ) {
+		seed = seed * 1664525U + 1013904223U;
+		return static_cast<size_t>( seed >> 8U ) % mod;
+	};
+	char const *const words[] = { "line\n", "Приве́т ", "नमस्ते", "😀", "a" };
+	for( size_t i = 0; i < 5000; ++i ) {
+		auto const pos = rand( str.size( ) + 1 );
+		if( rand( 4 ) == 0 and not str.empty( ) ) {
+			auto const count = rand( 8 );
+			rope.erase( pos, count );
+			str.erase( pos, count );
+		} else {
+			auto const w = daw::string_view( words[rand( 5 )] );
+			rope.insert( pos, w );
+			str.insert( pos, w );
+		}
+	}
+	daw::expecting( rope.size( ), str.size( ) );
+	daw::expecting( rope.to_string( ), str.to_string( ) );
+	auto const copy = rope;
+	daw::expecting( copy.to_string( ), str.to_string( ) );
+	for( size_t i = 0; i < 100; ++i ) {
+		auto const pos = rand( str.size( ) );
+		daw::expecting( rope[pos], *( str.begin( ) +
+		                              static_cast<std::ptrdiff_t>( pos ) ) );
+	}
+	// Lines
+	auto const text = str.to_string( );
+	size_t newlines = 0;
+	for( auto c : text ) {
+		newlines += c == '\n' ? 1 : 0;
+	}
+	daw::expecting( rope.line_count( ), newlines + 1 );
+	for( size_t line = 1; line < rope.line_count( ); ++line ) {
+		auto const pos = rope.line_start( line );
+		daw::expecting( rope[pos - 1], static_cast<uint32_t>( '\n' ) );
+	}
+	// Walk backwards
+	auto it = rope.end( );
+	size_t n = rope.size( );
+	while( it != rope.begin( ) ) {
+		--it;
+		--n;
+		daw::expecting( *it, rope[n] );
+	}
+	daw::expecting( n, 0U );
+	daw::expecting( *rope.iterator_at( 10 ), rope[10] );
+}
+
+void utf_rope_move_001( ) {
+	auto a = daw::utf_rope( "hello world" );
+	auto b = std::move( a );
+	daw::expecting( b.to_string( ), std::string( "hello world" ) );
+	daw::expecting( a.empty( ) );
+	daw::expecting( a.size( ), 0U );
+	a.append( daw::string_view( "again" ) );
+	daw::expecting( a.to_string( ), std::string( "again" ) );
+	a = std::move( b );
+	daw::expecting( a.to_string( ), std::string( "hello world" ) );
+	daw::expecting( b.empty( ) );
+	b.insert( 0, daw::string_view( "Привет" ) );
+	daw::expecting( b.to_string( ), std::string( "Привет" ) );
+}
+
+void utf_rope_out_of_range_001( ) {
+	auto rope = daw::utf_rope( "Пр" );
+	auto const throws = [&]( auto func ) {
+		bool has_thrown = false;
+		try {
+			func( );
+		} catch( std::out_of_range const & ) { has_thrown = true; }
+		daw::expecting( has_thrown );
+	};
+	throws( [&] { rope.insert( 3, daw::string_view( "x" ) ); } );
+	throws( [&] { rope.erase( 3 ); } );
+	throws( [&] { (void)rope.iterator_at( 3 ); } );
+	daw::expecting( rope.to_string( ), std::string( "Пр" ) );
+	daw::expecting( rope.iterator_at( 2 ) == rope.end( ) );
+}
+
+int main( ) {
+	utf_rope_test_001( );
+	utf_rope_edit_001( );
+	utf_rope_large_001( );
+	utf_rope_move_001( );
+	utf_rope_out_of_range_001( );
+	std::cout << "utf_rope tests passed\n";
+}
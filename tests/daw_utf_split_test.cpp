@@ -0,0 +1,158 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_split.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using daw::range::empty_pieces;
+using daw::utf8::dispatch::isa;
+
+namespace {
+	template<typename View>
+	std::vector<std::string> pieces( View const &view ) {
+		auto result = std::vector<std::string>( );
+		for( auto piece : view ) {
+			daw::expecting( piece.size( ), piece.to_u32string( ).size( ) );
+			result.push_back( piece.to_raw_u8string( ) );
+		}
+		return result;
+	}
+
+	/// Split on any of the delimiters, the longest delimiter is not needed as
+	/// they are all single code points here
+	std::vector<std::string> reference( std::string const &text,
+	                                    std::vector<std::string> const &delims,
+	                                    empty_pieces empty ) {
+		auto result = std::vector<std::string>( );
+		size_t start = 0;
+		size_t pos = 0;
+		auto const add = [&]( size_t last ) {
+			if( empty == empty_pieces::keep or last != start ) {
+				result.push_back( text.substr( start, last - start ) );
+			}
+		};
+		while( pos < text.size( ) ) {
+			auto len = size_t{ 0 };
+			for( auto const &d : delims ) {
+				if( text.compare( pos, d.size( ), d ) == 0 ) {
+					len = d.size( );
+					break;
+				}
+			}
+			if( len == 0 ) {
+				++pos;
+				continue;
+			}
+			add( pos );
+			pos += len;
+			start = pos;
+		}
+		add( text.size( ) );
+		return result;
+	}
+
+	using strings = std::vector<std::string>;
+} // namespace
+
+void split_code_point_test_001( ) {
+	auto const str = std::string( "a,b\xC3\xA9,,c," );
+	auto const text = daw::range::create_char_range( str );
+	daw::expecting( pieces( daw::range::split( text, U',' ) ) ==
+	                strings{ "a", "b\xC3\xA9", "", "c", "" } );
+	daw::expecting(
+	  pieces( daw::range::split( text, U',', empty_pieces::skip ) ) ==
+	  strings{ "a", "b\xC3\xA9", "c" } );
+	daw::expecting( pieces( daw::range::split( text, U'é' ) ) ==
+	                strings{ "a,b", ",,c," } );
+	auto const empty_str = std::string( );
+	auto const empty = daw::range::create_char_range( empty_str );
+	daw::expecting( pieces( daw::range::split( empty, U',' ) ) ==
+	                strings{ "" } );
+	daw::expecting(
+	  pieces( daw::range::split( empty, U',', empty_pieces::skip ) ).empty( ) );
+}
+
+void split_string_test_001( ) {
+	auto const str = std::string( "one\xE2\x82\xAC::two::::three" );
+	auto const text = daw::range::create_char_range( str );
+	daw::expecting( pieces( daw::range::split( text, "::" ) ) ==
+	                strings{ "one\xE2\x82\xAC", "two", "", "three" } );
+	daw::expecting( pieces( daw::range::split( text, "" ) ) ==
+	                strings{ str } );
+	auto view = daw::range::split( text, "::" );
+	auto it = view.begin( );
+	daw::expecting( ( *it ).size( ), 4U );
+	daw::expecting( it.delimiter( ).to_raw_u8string( ), std::string( "::" ) );
+	daw::expecting( std::distance( view.begin( ), view.end( ) ), 4 );
+}
+
+void split_any_test_001( ) {
+	// Tab, comma, € and an emoji
+	auto const str =
+	  std::string( "a\tb,c\xE2\x82\xAC" "d\xF0\x9F\x98\x80" "e\xE2\x82\xAD" );
+	auto const text = daw::range::create_char_range( str );
+	auto const view =
+	  daw::range::split_any( text, { U'\t', U',', U'€', U'\U0001F600' } );
+	daw::expecting( pieces( view ) ==
+	                strings{ "a", "b", "c", "d", "e\xE2\x82\xAD" } );
+	auto const set_str = std::string( ",\t" );
+	auto const set = daw::range::create_char_range( set_str );
+	daw::expecting( pieces( daw::range::split_any( text, set ) ) ==
+	                strings{ "a", "b", "c\xE2\x82\xAC" "d\xF0\x9F\x98\x80"
+	                                   "e\xE2\x82\xAD" } );
+}
+
+void split_random_test_001( ) {
+	auto rng = std::mt19937( 97531 );
+	auto const alphabet = std::vector<std::string>{
+	  "a", "b", ",", "\t", "\xC3\xA9", "\xE2\x82\xAC", "\xE2\x82\xAD",
+	  "\xF0\x9F\x98\x80" };
+	auto pick = std::uniform_int_distribution<size_t>( 0, 7 );
+	auto const tiers = supported_tiers( );
+	for( size_t n = 0; n < 400; ++n ) {
+		auto str = std::string( );
+		for( size_t len = n % 300; len > 0; --len ) {
+			auto const &s = alphabet[pick( rng )];
+			// Mostly plain text so the vector blocks are used
+			str += len % 3 == 0 ? s : std::string( "xyz" );
+		}
+		auto const text = daw::range::create_char_range( str );
+		for( auto tier : tiers ) {
+			daw::utf8::dispatch::set_isa( tier );
+			for( auto empty : { empty_pieces::keep, empty_pieces::skip } ) {
+				daw::expecting( pieces( daw::range::split( text, U',', empty ) ) ==
+				                reference( str, { "," }, empty ) );
+				daw::expecting(
+				  pieces( daw::range::split( text, U'€', empty ) ) ==
+				  reference( str, { "\xE2\x82\xAC" }, empty ) );
+				auto const any =
+				  daw::range::split_any( text, { U',', U'\t', U'€' }, empty );
+				daw::expecting( pieces( any ) ==
+				                reference( str, { ",", "\t", "\xE2\x82\xAC" },
+				                           empty ) );
+			}
+		}
+		daw::utf8::dispatch::set_isa( daw::utf8::dispatch::supported_isa( ) );
+	}
+}
+
+int main( ) {
+	split_code_point_test_001( );
+	split_string_test_001( );
+	split_any_test_001( );
+	split_random_test_001( );
+	std::cout << "split tests passed\n";
+}
@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #include <iostream>
+#include <stdexcept>
 
 #include <daw/daw_benchmark.h>
 
@@ -68,9 +69,81 @@ void utf_string_sort_002( ) {
 	          << '\n';
 }
 
+void utf_string_copy_001( ) {
+	daw::utf_string tst_01 = R"(Приве́т नमस्ते שָׁלוֹם)";
+	auto const tst_02 = tst_01;
+	tst_01 = "abc";
+	daw::expecting( tst_02.raw_begin( ) != tst_01.raw_begin( ) );
+	daw::expecting( tst_02 == daw::utf_string( R"(Приве́т नमस्ते שָׁלוֹם)" ) );
+	auto tst_03 = std::move( tst_01 );
+	daw::expecting( tst_03 == daw::utf_string( "abc" ) );
+	daw::expecting( tst_03.raw_end( ) - tst_03.raw_begin( ) == 3 );
+}
+
+void utf_string_append_001( ) {
+	daw::utf_string str;
+	str.reserve( 64 );
+	for( char32_t cp : U"aП\u0301न😀" ) {
+		if( cp != 0 ) {
+			str.push_back( cp );
+		}
+	}
+	daw::expecting( str.size( ), 5U );
+	daw::expecting( str == daw::utf_string( "aП́न😀" ) );
+	str.append( daw::utf_string( "xyz" ) );
+	str += U'é';
+	daw::expecting( str.size( ), 9U );
+	daw::expecting( str == daw::utf_string( "aП́न😀xyzé" ) );
+	daw::expecting( str.size( ),
+	                daw::range::create_char_range( str.to_string( ) ).size( ) );
+}
+
+void utf_string_insert_erase_001( ) {
+	daw::utf_string str = "Прит";
+	str.insert( 3, daw::utf_string( "ве́" ) );
+	daw::expecting( str == daw::utf_string( "Приве́т" ) );
+	daw::expecting( str.size( ), 7U );
+	str.insert( 0, U'😀' );
+	str.insert( str.size( ), daw::string_view( "!" ) );
+	daw::expecting( str == daw::utf_string( "😀Приве́т!" ) );
+	str.erase( 0, 1 );
+	str.erase( 4, 2 );
+	daw::expecting( str == daw::utf_string( "Привт!" ) );
+	str.pop_back( );
+	str.erase( 2 );
+	daw::expecting( str == daw::utf_string( "Пр" ) );
+	daw::expecting( str.size( ), 2U );
+	str.clear( );
+	daw::expecting( str.empty( ) );
+}
+
+void utf_string_insert_erase_002( ) {
+	daw::utf_string str = "Пр";
+	bool has_thrown = false;
+	try {
+		str.erase( 3 );
+	} catch( std::out_of_range const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+	has_thrown = false;
+	try {
+		str.insert( 3, U'x' );
+	} catch( std::out_of_range const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+	str.clear( );
+	has_thrown = false;
+	try {
+		str.pop_back( );
+	} catch( std::out_of_range const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+}
+
 int main( ) {
 	utf_string_test_001( );
 	utf_comparison_test_001( );
 	utf_string_sort_001( );
 	utf_string_sort_002( );
+	utf_string_copy_001( );
+	utf_string_append_001( );
+	utf_string_insert_erase_001( );
+	utf_string_insert_erase_002( );
 }
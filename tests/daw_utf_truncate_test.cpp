@@ -0,0 +1,107 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_truncate.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+void truncate_basic_test_001( ) {
+	// a, é, 中 and 😀 take 1, 2, 3 and 4 bytes
+	auto const text = std::string( "a\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80" );
+	auto result = daw::range::truncate_bytes( rng( text ), 5 );
+	daw::expecting( result.raw_size( ), 3U );
+	daw::expecting( result.size( ), 2U );
+	daw::expecting( result.raw_begin( ) == rng( text ).raw_begin( ) );
+	daw::expecting( daw::range::truncate_bytes( rng( text ), 0 ).empty( ) );
+	daw::expecting( daw::range::truncate_bytes( rng( text ), 9 ).size( ), 3U );
+	daw::expecting( daw::range::truncate_bytes( rng( text ), 10 ).size( ), 4U );
+	daw::expecting( daw::range::truncate_bytes( rng( text ), 99 ).size( ), 4U );
+
+	result = daw::range::take_last_bytes( rng( text ), 6 );
+	daw::expecting( result.raw_size( ), 4U );
+	daw::expecting( result.size( ), 1U );
+	daw::expecting( result.raw_end( ) == rng( text ).raw_end( ) );
+	daw::expecting( daw::range::take_last_bytes( rng( text ), 3 ).empty( ) );
+	daw::expecting( daw::range::take_last_bytes( rng( text ), 7 ).size( ), 2U );
+	daw::expecting( daw::range::take_last_bytes( rng( text ), 10 ).size( ),
+	                4U );
+
+	result = daw::range::truncate_code_points( rng( text ), 3 );
+	daw::expecting( result.raw_size( ), 6U );
+	daw::expecting( result.size( ), 3U );
+	daw::expecting( daw::range::truncate_code_points( rng( text ), 0 ).empty( ) );
+	daw::expecting(
+	  daw::range::truncate_code_points( rng( text ), 5 ).raw_size( ), 10U );
+}
+
+void truncate_tiers_test_001( ) {
+	auto random = std::mt19937( 4848 );
+	// Long ASCII runs put the cuts on both sides of the kernel blocks
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 40, 'x' ), "a", "\xC3\xA9", "\xE4\xB8\xAD",
+	  "\xF0\x9F\x98\x80" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 100; ++n ) {
+		auto text = std::string( );
+		// The byte offset each code point starts at, and the end
+		auto starts = std::vector<size_t>( );
+		for( size_t k = 0; k < n % 25; ++k ) {
+			auto const &piece = alphabet[pick( random )];
+			for( size_t pos = 0; pos < piece.size( ); ++pos ) {
+				if( ( static_cast<unsigned char>( piece[pos] ) & 0xC0U ) != 0x80U ) {
+					starts.push_back( text.size( ) + pos );
+				}
+			}
+			text += piece;
+		}
+		starts.push_back( text.size( ) );
+		auto const cps = starts.size( ) - 1U;
+		for_each_tier( [&] {
+			for( size_t max_bytes = 0; max_bytes <= text.size( ) + 1;
+			     ++max_bytes ) {
+				// The code points that end at most max_bytes in, and that start
+				// at most max_bytes from the end
+				size_t head = 0;
+				while( head < cps and starts[head + 1] <= max_bytes ) {
+					++head;
+				}
+				size_t tail = 0;
+				while( tail < cps and text.size( ) - starts[cps - tail - 1] <=
+				                        max_bytes ) {
+					++tail;
+				}
+				auto const first = daw::range::truncate_bytes( rng( text ), max_bytes );
+				daw::expecting( first.size( ), head );
+				daw::expecting( first.raw_size( ), starts[head] );
+				auto const last = daw::range::take_last_bytes( rng( text ), max_bytes );
+				daw::expecting( last.size( ), tail );
+				daw::expecting( last.raw_size( ), text.size( ) - starts[cps - tail] );
+			}
+			for( size_t count = 0; count <= cps + 1; ++count ) {
+				auto const result =
+				  daw::range::truncate_code_points( rng( text ), count );
+				daw::expecting( result.size( ), std::min( count, cps ) );
+				daw::expecting( result.raw_size( ), starts[std::min( count, cps )] );
+			}
+		} );
+	}
+}
+
+int main( ) {
+	truncate_basic_test_001( );
+	truncate_tiers_test_001( );
+	std::cout << "truncate tests passed\n";
+}
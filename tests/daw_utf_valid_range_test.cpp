@@ -0,0 +1,66 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf_range/daw_utf_valid_range.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+void valid_range_test_001( ) {
+	auto const str = std::string( "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z" );
+	auto const rng = daw::range::create_valid_range( str );
+	daw::expecting( rng.size( ), 5U );
+	daw::expecting( rng.raw_size( ), str.size( ) );
+	auto const expected =
+	  std::vector<uint32_t>{ 0x61, 0xE9, 0x20AC, 0x1F600, 0x7A };
+	daw::expecting( std::vector<uint32_t>( rng.begin( ), rng.end( ) ) ==
+	                expected );
+	daw::expecting( rng.to_u32string( ) == U"aé€\U0001F600z" );
+	daw::expecting( rng.to_u16string( ) == u"aé€\U0001F600z" );
+	auto const sub = rng.substr( 1, 2 );
+	daw::expecting( sub.size( ), 2U );
+	daw::expecting( sub.to_u32string( ) == U"é€" );
+	daw::range::utf_range const &plain = rng;
+	daw::expecting( plain.size( ), 5U );
+}
+
+void valid_range_invalid_test_001( ) {
+	auto const str = std::string( "abc\xE2\x28\xA1" );
+	bool has_thrown = false;
+	try {
+		(void)daw::range::create_valid_range( str );
+	} catch( daw::utf8::invalid_utf8 const & ) { has_thrown = true; }
+	daw::expecting( has_thrown );
+
+	size_t bad_pos = 0;
+	auto const rng = daw::range::try_create_valid_range( str, &bad_pos );
+	daw::expecting( not rng );
+	daw::expecting( bad_pos, 3U );
+	daw::expecting( daw::range::try_create_valid_range( "abc" ).has_value( ) );
+}
+
+void valid_range_known_valid_test_001( ) {
+	auto const str = std::string( 1000, 'x' ) + "\xC3\xA9";
+	auto const rng =
+	  daw::range::create_valid_range( daw::range::known_valid, str );
+	daw::expecting( rng.size( ), 1001U );
+	daw::expecting( rng == daw::range::create_valid_range( str ) );
+	daw::expecting( std::hash<daw::range::valid_utf_range>{ }( rng ) ==
+	                std::hash<daw::range::utf_range>{ }( rng.range( ) ) );
+}
+
+int main( ) {
+	valid_range_test_001( );
+	valid_range_invalid_test_001( );
+	valid_range_known_valid_test_001( );
+	std::cout << "valid range tests passed\n";
+}
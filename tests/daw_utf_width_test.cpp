@@ -0,0 +1,149 @@
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+
+#include <daw/daw_benchmark.h>
+
+#include "daw/utf8/unchecked.h"
+#include "daw/utf_range/daw_utf_width.h"
+#include "daw_utf8_test_tiers.h"
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	size_t width( std::string const &text ) {
+		return daw::range::display_width( rng( text ) );
+	}
+
+	/// The width of each code point of text, one at a time
+	std::vector<size_t> code_point_widths( std::string const &text ) {
+		auto result = std::vector<size_t>( );
+		for( auto cp : rng( text ) ) {
+			result.push_back( daw::range::display_width( cp ) );
+		}
+		return result;
+	}
+} // namespace
+
+void width_basic_test_001( ) {
+	daw::expecting( width( "" ), 0U );
+	daw::expecting( width( "hello, world" ), 12U );
+	// Controls take no columns
+	daw::expecting( width( "a\tb\r\n\x7F" ), 2U );
+	// Wide CJK, a combining acute and a Hangul syllable as jamo
+	daw::expecting( width( "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E" ), 6U );
+	daw::expecting( width( "e\xCC\x81" ), 1U );
+	daw::expecting( width( "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" ), 2U );
+	// Fullwidth A, an emoji, a zero width space and a soft hyphen
+	daw::expecting( width( "\xEF\xBC\xA1\xF0\x9F\x98\x80" ), 4U );
+	daw::expecting( width( "\xE2\x80\x8B\xC2\xAD" ), 1U );
+	daw::expecting( daw::range::display_width( U'\u0600' ), 1U );
+	daw::expecting( daw::range::display_width( U'\u200D' ), 0U );
+	daw::expecting( daw::range::display_width( U'\u3000' ), 2U );
+	daw::expecting( daw::range::display_width( U'\U0003FFFD' ), 2U );
+}
+
+void width_truncate_test_001( ) {
+	auto const text = std::string( "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E" );
+	auto result = daw::range::truncate_to_width( rng( text ), 5 );
+	daw::expecting( result.raw_size( ), 6U );
+	daw::expecting( result.size( ), 2U );
+	daw::expecting( result.raw_begin( ) == rng( text ).raw_begin( ) );
+	daw::expecting( daw::range::truncate_to_width( rng( text ), 1 ).empty( ) );
+	daw::expecting( daw::range::truncate_to_width( rng( text ), 6 ).size( ),
+	                3U );
+	// The combining mark stays with its e
+	auto const accented = std::string( "abe\xCC\x81x" );
+	result = daw::range::truncate_to_width( rng( accented ), 3 );
+	daw::expecting( result.raw_size( ), 5U );
+	daw::expecting( result.size( ), 4U );
+	result = daw::range::truncate_to_width( rng( accented ), 1 );
+	daw::expecting( result.to_raw_u8string( ), "a" );
+
+	auto padded = daw::range::pad_to_width( rng( text ), 5 );
+	daw::expecting( padded.text.size( ), 2U );
+	daw::expecting( padded.padding, 1U );
+	auto const short_text = std::string( "ab" );
+	padded = daw::range::pad_to_width( rng( short_text ), 5 );
+	daw::expecting( padded.text.to_raw_u8string( ), "ab" );
+	daw::expecting( padded.padding, 3U );
+	auto const long_text = std::string( "abcdef" );
+	padded = daw::range::pad_to_width( rng( long_text ), 4 );
+	daw::expecting( padded.text.to_raw_u8string( ), "abcd" );
+	daw::expecting( padded.padding, 0U );
+}
+
+void width_all_code_points_test_001( ) {
+	auto text = std::string( );
+	for( char32_t cp = 0; cp < 0x110000U; ++cp ) {
+		if( cp >= 0xD800U and cp < 0xE000U ) {
+			continue;
+		}
+		text.clear( );
+		daw::utf8::unchecked::append( cp, std::back_inserter( text ) );
+		auto const expected = daw::range::display_width( cp );
+		daw::expecting( expected <= 2U );
+		daw::expecting( width( text ), expected );
+	}
+}
+
+void width_tiers_test_001( ) {
+	auto random = std::mt19937( 4747 );
+	// Long printable runs go through the kernels, controls break them
+	auto const alphabet = std::vector<std::string>{
+	  std::string( 40, 'x' ), "ab c",         "\t",
+	  "\x1F",                 "\xCC\x81",     "\xC3\xA9",
+	  "\xD0\x96",             "\xE6\x97\xA5", "\xE1\x85\xA1",
+	  "\xE2\x80\x8B",         "\xF0\x9F\x98\x80" };
+	auto pick =
+	  std::uniform_int_distribution<size_t>( 0, alphabet.size( ) - 1 );
+	for( size_t n = 0; n < 200; ++n ) {
+		auto text = std::string( );
+		for( size_t k = 0; k < n % 20; ++k ) {
+			text += alphabet[pick( random )];
+		}
+		auto const widths = code_point_widths( text );
+		size_t total = 0;
+		for( auto w : widths ) {
+			total += w;
+		}
+		for_each_tier( [&] {
+			daw::expecting( width( text ), total );
+			for( size_t max_width = 0; max_width <= total + 1; ++max_width ) {
+				// The code points that fit, then any without width
+				size_t count = 0;
+				size_t used = 0;
+				while( count < widths.size( ) and
+				       used + widths[count] <= max_width ) {
+					used += widths[count++];
+				}
+				auto const result =
+				  daw::range::truncate_to_width( rng( text ), max_width );
+				daw::expecting( result.size( ), count );
+				daw::expecting( daw::range::display_width( result ), used );
+				daw::expecting( result.raw_size( ),
+				                rng( text ).substr( 0, count ).raw_size( ) );
+				auto const padded =
+				  daw::range::pad_to_width( rng( text ), max_width );
+				daw::expecting( padded.padding, max_width - used );
+			}
+		} );
+	}
+}
+
+int main( ) {
+	width_basic_test_001( );
+	width_truncate_test_001( );
+	width_all_code_points_test_001( );
+	width_tiers_test_001( );
+	std::cout << "width tests passed\n";
+}
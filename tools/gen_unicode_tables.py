@@ -0,0 +1,516 @@
+#!/usr/bin/env python3
+# Copyright (c) Darrell Wright
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# Official repository: https://github.com/beached/utf_range
+#
+"""Generate the Unicode property tables in include/daw/utf_range/impl.
+
+    gen_unicode_tables.py UCD_DIR [OUT_DIR]
+
+UCD_DIR holds the Unicode Character Database files whose properties the
+unicodedata module does not have, GraphemeBreakProperty.txt and
+emoji-data.txt.  They must be the Unicode version of the unicodedata module
+running this, which the other tables come from.  Each table is stored in
+three stages, the high bits of a code point index the first, which gives the
+block of the second that its middle bits index, which gives the block of the
+third that its low bits index.  Identical blocks are stored once and the
+block sizes that give the smallest tables are chosen.
+"""
+
+import os
+import sys
+import unicodedata
+
+CODE_POINTS = 0x110000
+
+HEADER = """\
+// Copyright (c) Darrell Wright
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/beached/utf_range
+//
+// Generated by tools/gen_unicode_tables.py from Unicode {version}, do not edit
+//
+
+#pragma once
+
+#include <cstdint>
+
+"""
+
+
+def ucd_file(ucd, name):
+    """name in ucd or in the auxiliary and emoji directories of the UCD."""
+    for sub in ("", "auxiliary", "emoji"):
+        path = os.path.join(ucd, sub, name)
+        if os.path.exists(path):
+            return path
+    sys.exit("{} is not in {}".format(name, ucd))
+
+
+def read_property(path, wanted=None):
+    """(first, last, value) for each range of the UCD file at path."""
+    result = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            cps, value = (part.strip() for part in line.split(";")[:2])
+            if wanted is not None and value != wanted:
+                continue
+            first, _, last = cps.partition("..")
+            result.append((int(first, 16), int(last or first, 16), value))
+    return result
+
+
+def c_type(largest):
+    return "uint8_t" if largest < 0x100 else "uint16_t"
+
+
+def deduplicate(values, shift):
+    """(index, blocks) with values[cp] == blocks[index[cp >> shift] << shift |
+    cp % (1 << shift)]."""
+    size = 1 << shift
+    seen = {}
+    index = []
+    blocks = []
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+        if block not in seen:
+            seen[block] = len(seen)
+            blocks.extend(block)
+        index.append(seen[block])
+    return index, blocks
+
+
+def byte_size(values):
+    return len(values) * (1 if max(values) < 0x100 else 2)
+
+
+def three_stage(values):
+    """(low_shift, mid_shift, stage1, stage2, stage3) of the smallest three
+    stage table."""
+    best = None
+    for low in range(4, 9):
+        index, stage3 = deduplicate(values, low)
+        for mid in range(2, 9):
+            stage1, stage2 = deduplicate(index, mid)
+            size = byte_size(stage1) + byte_size(stage2) + byte_size(stage3)
+            if best is None or size < best[0]:
+                best = (size, low, mid, stage1, stage2, stage3)
+    return best
+
+
+def emit_array(out, name, values, ctype=None, suffix=""):
+    out.append("\tinline constexpr {} {}[{}] = {{".format(
+        ctype or c_type(max(values)), name, len(values)))
+    line = "\t  "
+    for n, v in enumerate(values):
+        item = str(v) + suffix + ("," if n + 1 < len(values) else "")
+        # Tabs are two columns wide
+        if len(line) + 1 + len(item) + 1 > 80:
+            out.append(line.rstrip())
+            line = "\t  "
+        line += item + " "
+    out.append(line.rstrip() + " };")
+
+
+def emit_table(out, name, values):
+    """The stages of values and name( cp ) to look one up."""
+    size, low, mid, stage1, stage2, stage3 = three_stage(values)
+    emit_array(out, name + "_stage1", stage1)
+    emit_array(out, name + "_stage2", stage2)
+    emit_array(out, name + "_stage3", stage3)
+    out.append("")
+    out.append("\tconstexpr {} {}( char32_t cp ) noexcept {{".format(
+        c_type(max(stage3)), name))
+    out.append("\t\tif( cp >= 0x110000U ) {")
+    out.append("\t\t\treturn {};".format(values[-1]))
+    out.append("\t\t}")
+    out.append("\t\tunsigned const c = cp;")
+    out.append("\t\tunsigned const mid = {}_stage1[c >> {}U];".format(
+        name, low + mid))
+    out.append("\t\tunsigned const low =")
+    out.append("\t\t  {}_stage2[( mid << {}U ) | ( ( c >> {}U ) & {}U )];"
+               .format(name, mid, low, (1 << mid) - 1))
+    out.append("\t\treturn {}_stage3[( low << {}U ) | ( c & {}U )];".format(
+        name, low, (1 << low) - 1))
+    out.append("\t}")
+    sys.stderr.write("{}: {} bytes\n".format(name, size))
+
+
+def lead_code_points(lead):
+    """The code points whose UTF-8 starts with lead."""
+    if lead < 0xE0:
+        first, bits = (lead & 0x1F) << 6, 6
+    elif lead < 0xF0:
+        first, bits = (lead & 0x0F) << 12, 12
+    else:
+        first, bits = (lead & 0x07) << 18, 18
+    return range(first, min(first + (1 << bits), CODE_POINTS))
+
+
+def lead_bits(excluded):
+    """4 words with a bit for each lead byte that none of the code points
+    it starts are excluded(cp) for."""
+    words = [0] * 4
+    for lead in range(0xC2, 0xF5):
+        if not any(excluded(cp) for cp in lead_code_points(lead)):
+            words[lead // 64] |= 1 << (lead % 64)
+    return words
+
+
+def emit_words(out, name, rows):
+    """The 4 words of lead_bits, or a list of them."""
+    def words(values, indent):
+        return [indent + ", ".join("0x{:016X}ULL".format(w)
+                                   for w in values[:2]) + ",",
+                indent + ", ".join("0x{:016X}ULL".format(w)
+                                   for w in values[2:])]
+    if isinstance(rows[0], int):
+        out.append("\tinline constexpr uint64_t {}[4] = {{".format(name))
+        lines = words(rows, "\t  ")
+        out.extend([lines[0], lines[1] + " };"])
+        return
+    out.append("\tinline constexpr uint64_t {}[{}][4] = {{".format(
+        name, len(rows)))
+    for n, row in enumerate(rows):
+        lines = words(row, "\t    ")
+        lines[0] = "\t  { " + lines[0][len("\t    "):]
+        out.extend([lines[0], lines[1] + (" }," if n + 1 < len(rows)
+                                          else " } };")])
+
+
+GRAPHEME_BREAKS = [
+    "Other", "CR", "LF", "Control", "Extend", "ZWJ", "Regional_Indicator",
+    "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT"
+]
+EXTENDED_PICTOGRAPHIC = 0x10
+
+
+def grapheme_tables(ucd):
+    values = [0] * CODE_POINTS
+    path = ucd_file(ucd, "GraphemeBreakProperty.txt")
+    for first, last, value in read_property(path):
+        for cp in range(first, last + 1):
+            values[cp] = GRAPHEME_BREAKS.index(value)
+    path = ucd_file(ucd, "emoji-data.txt")
+    for first, last, _ in read_property(path, "Extended_Pictographic"):
+        for cp in range(first, last + 1):
+            values[cp] |= EXTENDED_PICTOGRAPHIC
+    out = [HEADER.format(version=unicodedata.unidata_version).rstrip("\n"),
+           "",
+           "/// Grapheme_Cluster_Break in the low 4 bits, in the order of",
+           "/// daw::range::grapheme_break, and 0x{:02X} for "
+           "Extended_Pictographic".format(EXTENDED_PICTOGRAPHIC),
+           "namespace daw::range::impl {"]
+    emit_table(out, "grapheme_properties", values)
+    out.append("")
+    out.extend([
+        "\t/// A bit for each lead byte whose code points are all Other and "
+        "not",
+        "\t/// Extended_Pictographic, they start a cluster unless a Prepend "
+        "is",
+        "\t/// before them"])
+    emit_words(out, "grapheme_other_leads", lead_bits(lambda cp: values[cp]))
+    out.append("} // namespace daw::range::impl")
+    return "\n".join(out) + "\n"
+
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+NORMALIZATION_FORMS = ["NFC", "NFD", "NFKC", "NFKD"]
+QC_MAYBE = 1
+QC_NO = 2
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp < 0xE000
+
+
+def decomposition_mapping(cp):
+    """(is_compatibility, code points) of the single level mapping of cp."""
+    parts = unicodedata.decomposition(chr(cp)).split()
+    if not parts:
+        return False, []
+    if parts[0].startswith("<"):
+        return True, [int(p, 16) for p in parts[1:]]
+    return False, [int(p, 16) for p in parts]
+
+
+def primary_composites():
+    """(first, second, composite) for the pairs that compose, Hangul is
+    left to the algorithm."""
+    result = []
+    for cp in range(CODE_POINTS):
+        if is_surrogate(cp) or HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        compat, mapping = decomposition_mapping(cp)
+        if compat or len(mapping) != 2:
+            continue
+        if unicodedata.normalize("NFC", chr(cp)) == chr(cp):
+            result.append((mapping[0], mapping[1], cp))
+    return sorted(result)
+
+
+def utf16(cps):
+    result = []
+    for cp in cps:
+        if cp < 0x10000:
+            result.append(cp)
+        else:
+            cp -= 0x10000
+            result.extend([0xD800 | (cp >> 10), 0xDC00 | (cp & 0x3FF)])
+    return result
+
+
+def normalization_tables(ucd):
+    composites = primary_composites()
+    # The Jamo vowels and trailing consonants compose with what is before them
+    seconds = set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+    seconds.update(second for _, second, _ in composites)
+    properties = [0] * CODE_POINTS
+    indices = [0] * CODE_POINTS
+    # Index 0 is no decomposition
+    pool = [0]
+    quick_checks = {form: [0] * CODE_POINTS for form in NORMALIZATION_FORMS}
+    for cp in range(CODE_POINTS):
+        if is_surrogate(cp):
+            continue
+        c = chr(cp)
+        value = unicodedata.combining(c)
+        for form in NORMALIZATION_FORMS:
+            if unicodedata.normalize(form, c) != c:
+                qc = QC_NO
+            elif form in ("NFC", "NFKC") and cp in seconds:
+                qc = QC_MAYBE
+            else:
+                qc = 0
+            quick_checks[form][cp] = qc
+        value |= quick_checks["NFC"][cp] << 8
+        value |= quick_checks["NFKC"][cp] << 10
+        value |= (quick_checks["NFD"][cp] != 0) << 12
+        value |= (quick_checks["NFKD"][cp] != 0) << 13
+        properties[cp] = value
+        if HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        canonical = unicodedata.normalize("NFD", c)
+        compatibility = unicodedata.normalize("NFKD", c)
+        if compatibility == c:
+            continue
+        canonical = utf16(map(ord, canonical)) if canonical != c else []
+        compatibility = utf16(map(ord, compatibility))
+        if compatibility == canonical:
+            compatibility = []
+        indices[cp] = len(pool)
+        pool.append(len(canonical) | (len(compatibility) << 8))
+        pool.extend(canonical + compatibility)
+    assert len(pool) < 0x10000
+    safe_leads = [
+        lead_bits(lambda cp, form=form: properties[cp] & 0xFF != 0 or
+                  quick_checks[form][cp] != 0)
+        for form in NORMALIZATION_FORMS]
+
+    out = [HEADER.format(version=unicodedata.unidata_version).rstrip("\n"),
+           "",
+           "/// The Unicode data for normalization",
+           "namespace daw::range::impl {",
+           "\t/// Canonical_Combining_Class in the low 8 bits, NFC_Quick_Check "
+           "and",
+           "\t/// NFKC_Quick_Check in the next 2 bit pairs as 0 for Yes, 1 for "
+           "Maybe",
+           "\t/// and 2 for No, then a bit for NFD_Quick_Check and one for",
+           "\t/// NFKD_Quick_Check being No"]
+    emit_table(out, "normalization_properties", properties)
+    out.extend([
+        "",
+        "\t/// Where the full decomposition of a code point starts in",
+        "\t/// decomposition_pool, 0 when it has none or is a Hangul "
+        "syllable"])
+    emit_table(out, "decomposition_index", indices)
+    out.extend([
+        "",
+        "\t/// The canonical decomposition in UTF-16 then the compatibility "
+        "one",
+        "\t/// after a unit with their lengths, in the low and high byte.  A",
+        "\t/// compatibility length of 0 is the canonical decomposition"])
+    emit_array(out, "decomposition_pool", pool)
+    out.extend([
+        "",
+        "\t/// The pairs that compose to a primary composite, as first << 21 "
+        "|",
+        "\t/// second and sorted, and what they compose to"])
+    emit_array(out, "composition_pairs",
+               [(a << 21) | b for a, b, _ in composites], "uint64_t",
+               "ULL")
+    emit_array(out, "composition_values", [c for _, _, c in composites],
+               "char32_t")
+    out.extend([
+        "",
+        "\t/// For NFC, NFD, NFKC and NFKD a bit for each lead byte whose code",
+        "\t/// points are all Quick_Check Yes and combining class 0"])
+    emit_words(out, "normalization_safe_leads", safe_leads)
+    out.append("} // namespace daw::range::impl")
+    sys.stderr.write("decomposition_pool: {} bytes\n".format(2 * len(pool)))
+    sys.stderr.write("composition_pairs: {} bytes\n".format(
+        12 * len(composites)))
+    return "\n".join(out) + "\n"
+
+
+CASE_MAPPINGS = ["lower", "upper", "casefold"]
+
+
+def case_tables(ucd):
+    # Kind 0 maps each code point to itself
+    kinds = {(0, 0, 0): 0}
+    values = [0] * CODE_POINTS
+    specials = []
+    for cp in range(CODE_POINTS):
+        if is_surrogate(cp):
+            continue
+        c = chr(cp)
+        mappings = [getattr(c, name)() for name in CASE_MAPPINGS]
+        if any(len(m) != 1 for m in mappings):
+            specials.append((cp, mappings))
+            continue
+        deltas = tuple(ord(m) - cp for m in mappings)
+        values[cp] = kinds.setdefault(deltas, len(kinds))
+    special = len(kinds)
+    assert special < 0x100
+    index = []
+    pool = []
+    for cp, mappings in specials:
+        values[cp] = special
+        units = [[ord(c) for c in m] for m in mappings]
+        assert all(len(u) < 16 and max(u) < 0x10000 for u in units)
+        index.append(len(pool))
+        pool.append(len(units[0]) | (len(units[1]) << 4) |
+                    (len(units[2]) << 8))
+        for u in units:
+            pool.extend(u)
+    deltas = [0] * (3 * special)
+    for kind_deltas, kind in kinds.items():
+        deltas[3 * kind:3 * kind + 3] = kind_deltas
+
+    out = [HEADER.format(version=unicodedata.unidata_version).rstrip("\n"),
+           "",
+           "/// The Unicode data for full case mapping and case folding, "
+           "without",
+           "/// the mappings of SpecialCasing.txt that depend on context or",
+           "/// language",
+           "namespace daw::range::impl {",
+           "\t/// The kind of the case mappings of a code point, an index into",
+           "\t/// case_deltas or special_casing_kind"]
+    emit_table(out, "case_kind", values)
+    out.extend([
+        "",
+        "\t/// What is added to a code point of each kind to map it to lower "
+        "case,",
+        "\t/// upper case and to fold its case"])
+    emit_array(out, "case_deltas", deltas, "int32_t")
+    out.extend([
+        "",
+        "\t/// The kind of the code points with a mapping to more than one "
+        "code",
+        "\t/// point, they are in special_casing_code_points",
+        "\tinline constexpr uint8_t special_casing_kind = {};".format(special),
+        "",
+        "\t/// Sorted, with where their mappings are in special_casing_pool"])
+    emit_array(out, "special_casing_code_points", [cp for cp, _ in specials],
+               "char32_t")
+    emit_array(out, "special_casing_index", index)
+    out.extend([
+        "",
+        "\t/// A unit with the lengths of the lower case, upper case and case",
+        "\t/// folded mappings in its nibbles from the lowest, then each of "
+        "them.",
+        "\t/// They are all below U+10000"])
+    emit_array(out, "special_casing_pool", pool)
+    out.extend([
+        "",
+        "\t/// A bit for each lead byte whose code points all map to "
+        "themselves"])
+    emit_words(out, "uncased_leads", lead_bits(lambda cp: values[cp]))
+    out.append("} // namespace daw::range::impl")
+    sys.stderr.write("case_deltas: {} bytes\n".format(4 * len(deltas)))
+    sys.stderr.write("special_casing_pool: {} bytes\n".format(
+        2 * len(pool) + 6 * len(specials)))
+    return "\n".join(out) + "\n"
+
+
+# Prepended_Concatenation_Mark, format characters that are visible
+CONCATENATION_MARKS = set(range(0x600, 0x606)) | {
+    0x6DD, 0x70F, 0x890, 0x891, 0x8E2, 0x110BD, 0x110CD}
+
+# The blocks EastAsianWidth.txt makes Wide for unassigned code points
+WIDE_UNASSIGNED = [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF),
+                   (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]
+
+
+def display_width(cp):
+    """The columns cp takes in a terminal, as wcwidth but 0 for controls."""
+    c = chr(cp)
+    category = unicodedata.category(c)
+    if category in ("Cc", "Mn", "Me") or (
+            category == "Cf" and cp != 0xAD and cp not in CONCATENATION_MARKS):
+        return 0
+    # Hangul Jamo vowels and final consonants join the syllable before them
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF or cp == 0x200B:
+        return 0
+    if category == "Cn":
+        return 2 if any(a <= cp <= b for a, b in WIDE_UNASSIGNED) else 1
+    return 2 if unicodedata.east_asian_width(c) in ("W", "F") else 1
+
+
+def width_tables(ucd):
+    values = [1] * CODE_POINTS
+    for cp in range(CODE_POINTS):
+        if not is_surrogate(cp):
+            values[cp] = display_width(cp)
+    out = [HEADER.format(version=unicodedata.unidata_version).rstrip("\n"),
+           "",
+           "/// The Unicode data for display widths",
+           "namespace daw::range::impl {",
+           "\t/// The columns each code point takes, 0, 1 or 2"]
+    emit_table(out, "code_point_width", values)
+    out.extend([
+        "",
+        "\t/// A bit for each lead byte whose code points are all 1 column "
+        "wide"])
+    emit_words(out, "narrow_leads", lead_bits(lambda cp: values[cp] != 1))
+    out.extend([
+        "",
+        "\t/// A bit for each lead byte whose code points are all 2 columns "
+        "wide"])
+    emit_words(out, "wide_leads", lead_bits(lambda cp: values[cp] != 2))
+    out.append("} // namespace daw::range::impl")
+    return "\n".join(out) + "\n"
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.exit(__doc__)
+    ucd = argv[1]
+    here = os.path.dirname(os.path.abspath(__file__))
+    out_dir = argv[2] if len(argv) > 2 else os.path.join(
+        here, "..", "include", "daw", "utf_range", "impl")
+    tables = {
+        "daw_utf_grapheme_tables.h": grapheme_tables,
+        "daw_utf_normalization_tables.h": normalization_tables,
+        "daw_utf_case_tables.h": case_tables,
+        "daw_utf_width_tables.h": width_tables,
+    }
+    for file_name, generate in tables.items():
+        with open(os.path.join(out_dir, file_name), "w",
+                  encoding="utf-8") as f:
+            f.write(generate(ucd))
+
+
+if __name__ == "__main__":
+    main(sys.argv)